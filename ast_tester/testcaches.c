@@ -0,0 +1,201 @@
+#define astCLASS testcaches
+
+#include "ast_err.h"
+#include "error.h"
+#include "object.h"
+#include "frameset.h"
+#include "skyframe.h"
+#include "slamap.h"
+#include "pal.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NITER 2000
+
+/* Each worker thread gets star-independent parameters from the shared
+   palMappa cache for its own four dates, interleaved with the four
+   dates used by the other thread, and checks them against the values
+   returned by palMappa. */
+typedef struct WorkerData {
+   double date[ 4 ];
+   int nbad;
+} WorkerData;
+
+static void *worker( void *ptr ) {
+   WorkerData *data = (WorkerData *) ptr;
+   double amprms[ 21 ];
+   double expect[ 4 ][ 21 ];
+   int i;
+   int status_value = 0;
+   int *status = &status_value;
+
+   for( i = 0; i < 4; i++ ) palMappa( 2000.0, data->date[ i ], expect[ i ] );
+
+   data->nbad = 0;
+   for( i = 0; i < NITER && astOK; i++ ) {
+      astSlaMappa( 2000.0, data->date[ i % 4 ], amprms );
+      if( memcmp( amprms, expect[ i % 4 ], sizeof( amprms ) ) ) data->nbad++;
+   }
+   if( !astOK ) data->nbad++;
+
+   return NULL;
+}
+
+/* Get a palMappa result using the cache, check it against palMappa, and
+   check the change in the number of cache hits and misses. */
+static void mappa( double date, int hit, int ierr, int *status ) {
+   double amprms[ 21 ];
+   double expect[ 21 ];
+   size_t nhit0;
+   size_t nhit;
+   size_t nmiss0;
+   size_t nmiss;
+
+   if( !astOK ) return;
+
+   astSlaCacheStats( "Mappa", &nhit0, &nmiss0 );
+   astSlaMappa( 2000.0, date, amprms );
+   astSlaCacheStats( "Mappa", &nhit, &nmiss );
+
+   palMappa( 2000.0, date, expect );
+   if( memcmp( amprms, expect, sizeof( amprms ) ) ) {
+      astError( AST__INTER, "Error %d (wrong values)\n", status, ierr );
+   } else if( nhit != nhit0 + ( hit ? 1 : 0 ) ||
+              nmiss != nmiss0 + ( hit ? 0 : 1 ) ) {
+      astError( AST__INTER, "Error %d (%lu hits, %lu misses)\n", status,
+                ierr, (unsigned long)( nhit - nhit0 ),
+                (unsigned long)( nmiss - nmiss0 ) );
+   }
+}
+
+int main(){
+   int status_value = 0;
+   int *status = &status_value;
+
+   AstFrameSet *fs;
+   AstSkyFrame *azel;
+   AstSkyFrame *icrs;
+   WorkerData data1;
+   WorkerData data2;
+   double dph[ 3 ];
+   double dpb[ 3 ];
+   double dvb[ 3 ];
+   double dvh[ 3 ];
+   double edph[ 3 ];
+   double edpb[ 3 ];
+   double edvb[ 3 ];
+   double edvh[ 3 ];
+   int i;
+   size_t nhit0;
+   size_t nhit;
+   size_t nmiss0;
+   size_t nmiss;
+   pthread_t thread1;
+   pthread_t thread2;
+
+/* The palMappa cache: a miss followed by a hit. */
+   mappa( 60000.0, 0, 1, status );
+   mappa( 60000.0, 1, 2, status );
+
+/* Fill the cache with seven more dates. The first date is still in the
+   cache. */
+   for( i = 1; i < 8; i++ ) mappa( 60000.0 + i, 0, 2 + i, status );
+   mappa( 60000.0, 1, 10, status );
+
+/* A ninth date evicts the least recently used entry (the second date),
+   which in turn evicts the third date when it is requested again. */
+   mappa( 60008.0, 0, 11, status );
+   mappa( 60001.0, 0, 12, status );
+   mappa( 60000.0, 1, 13, status );
+   mappa( 60002.0, 0, 14, status );
+   mappa( 60008.0, 1, 15, status );
+
+/* The palEvp cache is separate. */
+   if( astOK ) {
+      astSlaCacheStats( "EVP", &nhit0, &nmiss0 );
+      for( i = 0; i < 2; i++ ) {
+         astSlaEvp( 60000.0, 2000.0, dvb, dpb, dvh, dph );
+      }
+      astSlaCacheStats( "evp", &nhit, &nmiss );
+      palEvp( 60000.0, 2000.0, edvb, edpb, edvh, edph );
+
+      if( nhit != nhit0 + 1 || nmiss != nmiss0 + 1 ) {
+         astError( AST__INTER, "Error 16\n", status );
+      } else if( memcmp( dvb, edvb, sizeof( dvb ) ) ||
+                 memcmp( dpb, edpb, sizeof( dpb ) ) ||
+                 memcmp( dvh, edvh, sizeof( dvh ) ) ||
+                 memcmp( dph, edph, sizeof( dph ) ) ) {
+         astError( AST__INTER, "Error 17\n", status );
+      }
+   }
+
+/* Two threads using interleaved dates. Each call is either a hit or a
+   miss. Since the eight dates fit in the cache, each date can be missed
+   at most once by each thread. */
+   if( astOK ) {
+      for( i = 0; i < 4; i++ ) {
+         data1.date[ i ] = 60100.0 + 2*i;
+         data2.date[ i ] = 60101.0 + 2*i;
+      }
+
+      astSlaCacheStats( "MAPPA", &nhit0, &nmiss0 );
+
+      if( pthread_create( &thread1, NULL, worker, &data1 ) ) {
+         astError( AST__INTER, "Error creating thread1\n", status );
+      } else if( pthread_create( &thread2, NULL, worker, &data2 ) ) {
+         astError( AST__INTER, "Error creating thread2\n", status );
+      } else if( pthread_join( thread1, NULL ) ) {
+         astError( AST__INTER, "Error joining thread1\n", status );
+      } else if( pthread_join( thread2, NULL ) ) {
+         astError( AST__INTER, "Error joining thread2\n", status );
+      }
+
+      astSlaCacheStats( "MAPPA", &nhit, &nmiss );
+
+      if( astOK ) {
+         if( data1.nbad || data2.nbad ) {
+            astError( AST__INTER, "Error 18\n", status );
+         } else if( ( nhit - nhit0 ) + ( nmiss - nmiss0 ) != 2*NITER ) {
+            astError( AST__INTER, "Error 19\n", status );
+         } else if( nmiss - nmiss0 < 8 || nmiss - nmiss0 > 16 ) {
+            astError( AST__INTER, "Error 20\n", status );
+         }
+      }
+   }
+
+/* The SkyFrame LAST cache. The LAST for a new SkyFrame is calculated
+   from scratch, but is then found in the cache when another SkyFrame
+   needs the LAST for the same epoch and observatory. */
+   if( astOK ) {
+      icrs = astSkyFrame( "System=ICRS,Epoch=MJD 60200.3", status );
+      azel = astSkyFrame( "System=AZEL,Epoch=MJD 60200.3,ObsLon=-155.5,"
+                          "ObsLat=19.8", status );
+
+      astSkyLastCacheStats( &nhit0, &nmiss0 );
+      fs = astConvert( icrs, azel, "" );
+      astSkyLastCacheStats( &nhit, &nmiss );
+      if( !fs ) {
+         astError( AST__INTER, "Error 21\n", status );
+      } else if( nmiss == nmiss0 ) {
+         astError( AST__INTER, "Error 22\n", status );
+      }
+
+      azel = astSkyFrame( "System=AZEL,Epoch=MJD 60200.3,ObsLon=-155.5,"
+                          "ObsLat=19.8", status );
+      astSkyLastCacheStats( &nhit0, &nmiss0 );
+      fs = astConvert( icrs, azel, "" );
+      astSkyLastCacheStats( &nhit, &nmiss );
+      if( !fs ) {
+         astError( AST__INTER, "Error 23\n", status );
+      } else if( nmiss != nmiss0 || nhit == nhit0 ) {
+         astError( AST__INTER, "Error 24\n", status );
+      }
+   }
+
+   if( astOK ) {
+      printf(" All cache tests passed\n");
+   } else {
+      printf("Cache tests failed\n");
+   }
+}
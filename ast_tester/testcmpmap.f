@@ -4,10 +4,17 @@
       include 'AST_PAR'
       include 'SAE_PAR'
 
-      integer m1, m2, m3, m4, m5, status, i, in(7), out(7)
-      double precision x( 7 ), y(7), y2(7), matrix( 3 )
+      integer m1, m2, m3, m4, m5, status, i, in(7), out(7), perm( 2 )
+      double precision x( 7 ), y(7), y2(7), matrix( 3 ), shift( 2 ),
+     :                 mat2( 4 )
+      character fwd( 2 )*20, inv( 2 )*20
 
       data matrix /-1.0D0, 1.0D0, 2.0D0 /
+      data perm / 2, 1 /
+      data shift / 1.0D0, -1.0D0 /
+      data mat2 / 1.0D0, 1.0D0, 0.0D0, 1.0D0 /
+      data fwd / 'y1 = x1*x1', 'y2 = x2' /
+      data inv / 'x1 = sqrt( y1 )', 'x2 = y2' /
 
       status = sai__ok
       call err_mark( status )
@@ -75,11 +82,70 @@
          call stopit( status, 'Error 13' )
       end if
 
+*  Check that a series CmpMap is not equal to a parallel CmpMap with the
+*  same components.
+      m1 = ast_ZoomMap( 1, 2.0D0, ' ', status )
+      m2 = ast_ZoomMap( 1, 3.0D0, ' ', status )
+      m3 = ast_CmpMap( m1, m2, .true., ' ', status )
+      m4 = ast_CmpMap( m1, m2, .false., ' ', status )
+      if( ast_equal( m3, m4, status ) ) then
+         call stopit( status, 'Error 14' )
+      else if( ast_equal( m4, m3, status ) ) then
+         call stopit( status, 'Error 15' )
+      else if( .not. ast_equal( m3, ast_copy( m3, status ),
+     :                          status ) ) then
+         call stopit( status, 'Error 16' )
+      else if( .not. ast_equal( m4, ast_copy( m4, status ),
+     :                          status ) ) then
+         call stopit( status, 'Error 17' )
+      end if
+
+
 
 
 
 
 
+*  Check that a series CmpMap containing runs of affine Mappings either
+*  side of a non-linear Mapping is applied correctly, including the
+*  propagation of bad values.
+      m1 = ast_CmpMap( ast_ZoomMap( 2, 2.0D0, ' ', status ),
+     :                 ast_PermMap( 2, perm, 2, perm, 0.0D0, ' ',
+     :                              status ), .true., ' ', status )
+      m1 = ast_CmpMap( m1, ast_ShiftMap( 2, shift, ' ', status ),
+     :                 .true., ' ', status )
+      m2 = ast_CmpMap( ast_MatrixMap( 2, 2, 0, mat2, ' ', status ),
+     :                 ast_ZoomMap( 2, 0.5D0, ' ', status ), .true.,
+     :                 ' ', status )
+      m3 = ast_CmpMap( ast_CmpMap( m1, ast_MathMap( 2, 2, 2, fwd, 2,
+     :                                             inv, ' ', status ),
+     :                             .true., ' ', status ),
+     :                 m2, .true., ' ', status )
+
+      x( 1 ) = 1.0D0
+      x( 2 ) = AST__BAD
+      x( 3 ) = 1.0D0
+      x( 4 ) = 2.0D0
+      x( 5 ) = 2.0D0
+      x( 6 ) = AST__BAD
+      call ast_tran2( m3, 3, x( 1 ), x( 4 ), .true., y( 1 ), y( 4 ),
+     :                status )
+      if( abs( y( 1 ) - 13.0D0 ) .gt. 1.0D-12 .or.
+     :    abs( y( 4 ) - 0.5D0 ) .gt. 1.0D-12 ) then
+         call stopit( status, 'Error 18' )
+      else if( y( 2 ) .ne. AST__BAD .or. y( 5 ) .ne. AST__BAD ) then
+         call stopit( status, 'Error 19' )
+      else if( y( 3 ) .ne. AST__BAD .or.
+     :         abs( y( 6 ) - 0.5D0 ) .gt. 1.0D-12 ) then
+         call stopit( status, 'Error 20' )
+      end if
+
+      call ast_tran2( m3, 1, y( 1 ), y( 4 ), .false., y2( 1 ),
+     :                y2( 2 ), status )
+      if( abs( y2( 1 ) - 1.0D0 ) .gt. 1.0D-12 .or.
+     :    abs( y2( 2 ) - 2.0D0 ) .gt. 1.0D-12 ) then
+         call stopit( status, 'Error 21' )
+      end if
 
       call ast_end( status )
       call err_rlse( status )
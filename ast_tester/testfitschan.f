@@ -103,6 +103,36 @@ c      call ast_watchmemory( 225192 )
 *  Annul the fitschan.
       call ast_annul( fc, status )
 
+*  Check that keywords remain available after deleting one of several
+*  cards with the same keyword.
+      fc = ast_fitschan( AST_NULL, AST_NULL, ' ', status )
+      call ast_putfits( fc, 'DUPKEY  = 1', .false., status )
+      call ast_putfits( fc, 'OTHER   = 2', .false., status )
+      call ast_putfits( fc, 'DUPKEY  = 3', .false., status )
+
+      call ast_clear( fc, 'Card', status )
+      if( .not. ast_findfits( fc, 'dupkey', card, .false., status ) )
+     :   call stopit( 3005, ' ', status )
+      call ast_delfits( fc, status )
+
+      call ast_clear( fc, 'Card', status )
+      if( .not. ast_getfitsi( fc, 'DUPKEY', val, status ) ) then
+         call stopit( 3006, ' ', status )
+      else if( val .ne. 3 ) then
+         call stopit( 3007, ' ', status )
+      end if
+      call ast_delfits( fc, status )
+
+      call ast_clear( fc, 'Card', status )
+      if( ast_findfits( fc, 'DUPKEY', card, .false., status ) )
+     :   call stopit( 3008, ' ', status )
+      card = ast_getc( fc, 'CardName', status )
+      if( card .ne. ' ' ) call stopit( 3009, ' ', status )
+      if( ast_geti( fc, 'Nkey', status ) .ne. 1 )
+     :   call stopit( 3010, ' ', status )
+
+      call ast_annul( fc, status )
+
 *  Put a simple FITS-WCS header into a FitsChan.
       cards(1) = 'CRPIX1  = 45'
       cards(2) = 'CRPIX2  = 45'
@@ -324,6 +354,9 @@ c      call ast_setl( fc, 'Clean', .true., status )
       call checktab( status )
       call checktab2( status )
 
+*  Test ast_putcards and the insertion of cards by ast_putfits.
+      call checkputcards( status )
+
 *  Read a SIP header and then attempt to write it out. It should fail
 *  because the SIP header is non-linear.
       call ast_emptyfits( fc, status )
@@ -378,6 +411,199 @@ c      call ast_setl( fc, 'Clean', .true., status )
       end
 
 
+      subroutine checkputcards( status )
+      implicit none
+      include 'SAE_PAR'
+      include 'AST_PAR'
+
+      integer status, fc, i, ival, ncard, types( 14 ), civals( 2 )
+      character cards*( 15*80 ), card*80, names( 14 )*8, sval*80
+      logical lval
+      double precision fval, cfvals( 2 )
+
+      data names / 'SIMPLE', 'NAXIS', 'CRVAL1', 'CPLXF', 'CPLXI',
+     :             'FLAG', 'OBJECT', 'COMMENT', 'LONGSTR', 'CONTINUE',
+     :             'CONTINUE', 'UNDEFD', 'HISTORY', 'EXPTIME' /
+
+      if( status .ne. sai__ok ) return
+      call ast_begin( status )
+
+      types( 1 ) = AST__LOGICAL
+      types( 2 ) = AST__INT
+      types( 3 ) = AST__FLOAT
+      types( 4 ) = AST__COMPLEXF
+      types( 5 ) = AST__COMPLEXI
+      types( 6 ) = AST__LOGICAL
+      types( 7 ) = AST__STRING
+      types( 8 ) = AST__COMMENT
+      types( 9 ) = AST__STRING
+      types( 10 ) = AST__CONTINUE
+      types( 11 ) = AST__CONTINUE
+      types( 12 ) = AST__UNDEF
+      types( 13 ) = AST__COMMENT
+      types( 14 ) = AST__FLOAT
+
+*  Concatenate a set of cards holding each type of value, including a
+*  long string continued on CONTINUE cards, and store them in a
+*  FitsChan using ast_putcards.
+      cards = ' '
+      cards( 1 : 80 ) = 'SIMPLE  =                    T / Standard'
+      cards( 81 : 160 ) = 'NAXIS   =                    2'
+      cards( 161 : 240 ) = 'CRVAL1  =              45.5D01 / D exp'
+      cards( 241 : 320 ) = 'CPLXF   =              1.5 -2.25'
+      cards( 321 : 400 ) = 'CPLXI   =                 3 -4'
+      cards( 401 : 480 ) = 'FLAG    =                   NO'
+      cards( 481 : 560 ) = 'OBJECT  = ''NGC 1275''           / Target'
+      cards( 561 : 640 ) = 'COMMENT   A comment card'
+      cards( 641 : 720 ) = 'LONGSTR = ''The first part, &'''
+      cards( 721 : 800 ) = 'CONTINUE  ''the second part, &'''
+      cards( 801 : 880 ) = 'CONTINUE  ''and the end.'' / Long string'
+      cards( 881 : 960 ) = 'UNDEFD  =                      / No value'
+      cards( 961 : 1040 ) = 'HISTORY Checked by testfitschan'
+      cards( 1041 : 1120 ) = 'EXPTIME =               1200.0'
+
+      fc = ast_fitschan( AST_NULL, AST_NULL, ' ', status )
+      call ast_putcards( fc, cards( : 1120 ), status )
+
+*  Check the cards are stored in the supplied order with the correct
+*  types, and that the FitsChan has been rewound.
+      ncard = ast_geti( fc, 'NCard', status )
+      if( ncard .ne. 14 ) then
+         call msg_seti( 'N', ncard )
+         call stopit( 3000, 'NCard is ^N', status )
+      else if( ast_geti( fc, 'Card', status ) .ne. 1 ) then
+         call stopit( 3001, 'FitsChan not rewound', status )
+      end if
+
+      do i = 1, ncard
+         if( status .eq. sai__ok ) then
+            call ast_seti( fc, 'Card', i, status )
+            if( ast_getc( fc, 'CardName', status ) .ne.
+     :          names( i ) ) then
+               call stopit( 3002, ast_getc( fc, 'CardName', status ),
+     :                      status )
+            else if( ast_geti( fc, 'CardType', status ) .ne.
+     :               types( i ) ) then
+               call stopit( 3003, names( i ), status )
+            end if
+         end if
+      end do
+
+*  Check the values and comments.
+      call ast_clear( fc, 'Card', status )
+      if( .not. ast_getfitsl( fc, 'SIMPLE', lval, status ) .or.
+     :    .not. lval ) then
+         call stopit( 3004, 'SIMPLE', status )
+      else if( ast_getc( fc, 'CardComm', status ) .ne.
+     :         'Standard' ) then
+         call stopit( 3005, 'SIMPLE comment', status )
+      else if( .not. ast_getfitsi( fc, 'NAXIS', ival, status ) .or.
+     :         ival .ne. 2 ) then
+         call stopit( 3006, 'NAXIS', status )
+      else if( .not. ast_getfitsf( fc, 'CRVAL1', fval, status ) .or.
+     :         fval .ne. 455.0D0 ) then
+         call stopit( 3007, 'CRVAL1', status )
+      else if( .not. ast_getfitscf( fc, 'CPLXF', cfvals, status ) .or.
+     :         cfvals( 1 ) .ne. 1.5D0 .or.
+     :         cfvals( 2 ) .ne. -2.25D0 ) then
+         call stopit( 3008, 'CPLXF', status )
+      else if( .not. ast_getfitsci( fc, 'CPLXI', civals, status ) .or.
+     :         civals( 1 ) .ne. 3 .or. civals( 2 ) .ne. -4 ) then
+         call stopit( 3009, 'CPLXI', status )
+      else if( .not. ast_getfitsl( fc, 'FLAG', lval, status ) .or.
+     :         lval ) then
+         call stopit( 3010, 'FLAG', status )
+      else if( .not. ast_getfitss( fc, 'OBJECT', sval, status ) .or.
+     :         sval .ne. 'NGC 1275' ) then
+         call stopit( 3011, sval, status )
+      else if( ast_getc( fc, 'CardComm', status ) .ne.
+     :         'Target' ) then
+         call stopit( 3012, 'OBJECT comment', status )
+      else if( .not. ast_getfitss( fc, 'LONGSTR', sval, status ) .or.
+     :         sval .ne. 'The first part, &' ) then
+         call stopit( 3013, sval, status )
+      else if( .not. ast_getfitscn( fc, 'CONTINUE', sval, status ) .or.
+     :         sval .ne. 'the second part, &' ) then
+         call stopit( 3014, sval, status )
+      end if
+
+      call ast_seti( fc, 'Card', 11, status )
+      if( .not. ast_getfitscn( fc, '.', sval, status ) .or.
+     :    sval .ne. 'and the end.' ) then
+         call stopit( 3015, sval, status )
+      else if( ast_getc( fc, 'CardComm', status ) .ne.
+     :         'Long string' ) then
+         call stopit( 3016, 'CONTINUE comment', status )
+      else if( .not. ast_getfitsf( fc, 'EXPTIME', fval, status ) .or.
+     :         fval .ne. 1200.0D0 ) then
+         call stopit( 3017, 'EXPTIME', status )
+      end if
+
+*  Insert a card in front of the third card. The new card should become
+*  the third card, and the card that was previously the third card
+*  should become the current card.
+      call ast_seti( fc, 'Card', 3, status )
+      call ast_putfits( fc, 'NEWKEY  =                    7 / New',
+     :                  .false., status )
+      if( ast_geti( fc, 'Card', status ) .ne. 4 ) then
+         call stopit( 3018, 'Card after insertion', status )
+      else if( ast_getc( fc, 'CardName', status ) .ne. 'CRVAL1' ) then
+         call stopit( 3019, 'Card after insertion', status )
+      end if
+
+      call ast_seti( fc, 'Card', 3, status )
+      if( .not. ast_getfitsi( fc, '.', ival, status ) .or.
+     :    ival .ne. 7 ) then
+         call stopit( 3020, 'NEWKEY', status )
+      else if( ast_getc( fc, 'CardName', status ) .ne. 'NEWKEY' ) then
+         call stopit( 3021, 'NEWKEY', status )
+      else if( ast_getc( fc, 'CardComm', status ) .ne. 'New' ) then
+         call stopit( 3022, 'NEWKEY comment', status )
+      end if
+
+*  Overwrite the second card.
+      call ast_seti( fc, 'Card', 2, status )
+      call ast_putfits( fc, 'NAXIS   =                    3', .true.,
+     :                  status )
+      if( ast_geti( fc, 'NCard', status ) .ne. 15 ) then
+         call stopit( 3023, 'NCard after overwrite', status )
+      end if
+
+      call ast_seti( fc, 'Card', 2, status )
+      if( .not. ast_getfitsi( fc, '.', ival, status ) .or.
+     :    ival .ne. 3 ) then
+         call stopit( 3024, 'NAXIS after overwrite', status )
+      end if
+
+*  Write the cards out, read them back in using ast_putcards, and check
+*  the same cards are produced.
+      cards = ' '
+      call ast_clear( fc, 'Card', status )
+      i = 0
+      do while( ast_findfits( fc, '%f', card, .true., status ) )
+         cards( i*80 + 1 : i*80 + 80 ) = card
+         i = i + 1
+      end do
+
+      call ast_putcards( fc, cards, status )
+      if( ast_geti( fc, 'NCard', status ) .ne. 15 ) then
+         call stopit( 3025, 'NCard after round trip', status )
+      end if
+
+      i = 0
+      do while( ast_findfits( fc, '%f', card, .true., status ) )
+         if( card .ne. cards( i*80 + 1 : i*80 + 80 ) ) then
+            call stopit( 3026, card, status )
+         end if
+         i = i + 1
+      end do
+
+      call ast_end( status )
+
+      end
+
+
+
       subroutine checktab( status )
       implicit none
 
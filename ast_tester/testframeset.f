@@ -253,6 +253,33 @@ c      call ast_watchmemory(100)
       text = ast_getc( fs, 'Variant', status )
       if( text .ne. 'DSB' ) call stopit( status, 'Error 40' )
 
+c  Check that changes to the structure of a FrameSet are reflected in
+c  subsequent transformations.
+      fs = ast_frameset( ast_frame( 1, ' ', status ), ' ', status )
+      call ast_addframe( fs, AST__BASE, ast_zoommap( 1, 2.0D0, ' ',
+     :                   status ), ast_frame( 1, ' ', status ), status )
+      call ast_tran1( fs, 1, 1.0D0, .TRUE., xout, status )
+      if( abs( xout - 2.0D0 ) .gt. 1.0E-10 ) call stopit( status,
+     :                                                      'Error 41' )
+
+      call ast_remapframe( fs, AST__CURRENT, ast_zoommap( 1, 3.0D0,
+     :                     ' ', status ), status )
+      call ast_tran1( fs, 1, 1.0D0, .TRUE., xout, status )
+      if( abs( xout - 6.0D0 ) .gt. 1.0E-10 ) call stopit( status,
+     :                                                      'Error 42' )
+
+      call ast_invert( fs, status )
+      call ast_tran1( fs, 1, 6.0D0, .TRUE., xout, status )
+      if( abs( xout - 1.0D0 ) .gt. 1.0E-10 ) call stopit( status,
+     :                                                      'Error 43' )
+      call ast_invert( fs, status )
+
+      call ast_remapframe( fs, AST__BASE, ast_zoommap( 1, 4.0D0, ' ',
+     :                     status ), status )
+      call ast_tran1( fs, 1, 1.0D0, .TRUE., xout, status )
+      if( abs( xout - 1.5D0 ) .gt. 1.0E-10 ) call stopit( status,
+     :                                                      'Error 44' )
+
 
 
 
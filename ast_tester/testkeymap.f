@@ -19,6 +19,8 @@ c      call ast_watchmemory( 29286 )
 
       call testcasesens( status )
       call testsorting( status )
+      call testremove( 'SortBy=None', status )
+      call testremove( 'SortBy=KeyUp', status )
 
       map = ast_keymap( ' ', status )
 
@@ -1366,4 +1368,117 @@ C  Now test sorting existing entries in a KeyMap.
 
 
 
+      subroutine testremove( attrs, status )
+      implicit none
+      include 'SAE_PAR'
+      include 'AST_PAR'
+
+      character attrs*(*)
+      integer status, km, i, n, ival, sum, count
+      character key*( AST__SZCHR )
+
+      if( status .ne. sai__ok ) return
+
+*  Add 1000 entries, so that the hash table is enlarged several times,
+*  and then remove most of them, adding some of them back again in
+*  between.
+      km = ast_keymap( attrs, status )
+      do i = 1, 1000
+         write( key, '(A,I4.4)' ) 'K', i
+         call ast_mapput0i( km, key, i, ' ', status )
+      end do
+
+      do i = 1, 1000
+         if( mod( i, 10 ) .ne. 0 ) then
+            write( key, '(A,I4.4)' ) 'K', i
+            call ast_mapremove( km, key, status )
+            if( mod( i, 100 ) .eq. 1 ) then
+               write( key, '(A,I4.4)' ) 'K', i - 1
+               call ast_mapput0i( km, key, -i, ' ', status )
+            end if
+         end if
+      end do
+
+      if( ast_mapsize( km, status ) .ne. 101 ) then
+         write(*,*) ast_mapsize( km, status )
+         call stopit( status, 'Error Remove 1' )
+      end if
+
+*  Check each entry is present or absent as appropriate, and has the
+*  correct value.
+      do i = 1, 1000
+         write( key, '(A,I4.4)' ) 'K', i
+         if( ast_mapget0i( km, key, ival, status ) ) then
+            if( mod( i, 100 ) .eq. 0 .and. i .lt. 1000 ) then
+               if( ival .ne. -i - 1 ) then
+                  write(*,*) key, ival
+                  call stopit( status, 'Error Remove 2' )
+               end if
+            else if( mod( i, 10 ) .ne. 0 .or. ival .ne. i ) then
+               write(*,*) key, ival
+               call stopit( status, 'Error Remove 3' )
+            end if
+         else if( mod( i, 10 ) .eq. 0 ) then
+            write(*,*) key
+            call stopit( status, 'Error Remove 4' )
+         end if
+      end do
 
+*  Check that each key is returned by ast_mapkey exactly once.
+      sum = 0
+      do i = 1, ast_mapsize( km, status )
+         key = ast_mapkey( km, i, status )
+         if( ast_mapget0i( km, key, ival, status ) ) then
+            sum = sum + abs( ival )
+         else
+            call stopit( status, 'Error Remove 5' )
+         end if
+      end do
+      if( sum .ne. 50510 ) then
+         write(*,*) sum
+         call stopit( status, 'Error Remove 6' )
+      end if
+
+*  Add the removed entries back again, and then remove every entry with
+*  a value that is a multiple of 3 whilst looping over the keys. The
+*  same index is used again after an entry is removed. An entry may be
+*  returned more than once, but none should be missed.
+      do i = 1, 1000
+         write( key, '(A,I4.4)' ) 'K', i
+         call ast_mapput0i( km, key, i, ' ', status )
+      end do
+
+      i = 1
+      count = 0
+      do while( i .le. ast_mapsize( km, status ) .and.
+     :          status .eq. sai__ok )
+         key = ast_mapkey( km, i, status )
+         if( .not. ast_mapget0i( km, key, ival, status ) ) then
+            call stopit( status, 'Error Remove 7' )
+         else if( mod( ival, 3 ) .eq. 0 ) then
+            call ast_mapremove( km, key, status )
+         else
+            i = i + 1
+         end if
+         count = count + 1
+         if( count .gt. 2000 ) call stopit( status, 'Error Remove 8' )
+      end do
+
+      n = 0
+      do i = 1, 1000
+         write( key, '(A,I4.4)' ) 'K', i
+         if( ast_mapget0i( km, key, ival, status ) ) then
+            n = n + 1
+            if( mod( ival, 3 ) .eq. 0 ) then
+               call stopit( status, 'Error Remove 9' )
+            end if
+         end if
+      end do
+      if( n .ne. 667 .or. ast_mapsize( km, status ) .ne. 668 ) then
+         write(*,*) n, ast_mapsize( km, status )
+         call stopit( status, 'Error Remove 10' )
+      end if
+
+      call ast_annul( km, status )
+
+      end
@@ -4,8 +4,9 @@
       include 'AST_PAR'
       include 'SAE_PAR'
 
-      integer lm, status, i
-      double precision lut1( 10 ), x( 7 ), y(7)
+      integer lm, status, i, lm2
+      double precision lut1( 10 ), x( 7 ), y(7), lut2( 1000 ),
+     :                 x2( 2000 ), y2( 2000 ), z2( 2000 )
 
       status = sai__ok
       call err_mark( status )
@@ -133,6 +134,37 @@
       end do
 
 
+*  Large non-uniform decreasing table. Transform points in random order
+*  and then in sorted order, using the LutMap and a copy of it.
+      do i = 1, 1000
+         lut2( i ) = 1.0D6 - dble( i )**1.5D0 + 0.3D0*sin( dble( i ) )
+      end do
+      lm = ast_lutmap( 1000, lut2, 1.0D0, 1.0D0, ' ', status )
+      lm2 = ast_copy( lm, status )
+
+      do i = 1, 1000
+         x2( i ) = 1.0D0 + 0.999D0*mod( 37*i, 1000 )
+         x2( i + 1000 ) = 1.0D0 + 0.999D0*( i - 1 )
+      end do
+
+      call ast_tran1( lm, 2000, x2, .TRUE., y2, status )
+      call ast_tran1( lm, 2000, y2, .FALSE., z2, status )
+
+      do i = 1, 2000
+         if( abs( z2( i ) - x2( i ) ) .gt. 1.0D-8 ) then
+            call stopit( status, "Error 13" );
+         end if
+      end do
+
+      call ast_tran1( lm2, 2000, y2, .FALSE., z2, status )
+
+      do i = 1, 2000
+         if( abs( z2( i ) - x2( i ) ) .gt. 1.0D-8 ) then
+            call stopit( status, "Error 14" );
+         end if
+      end do
+
+
 
 
 
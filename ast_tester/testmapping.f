@@ -55,6 +55,10 @@
          call stopit( status, 'Error 4' )
       end if
 
+      call testresample( status )
+      call testinterp( status )
+      call testcompile( status )
+
 
 
 
@@ -83,3 +87,361 @@
 
 
 
+
+      subroutine testresample( status )
+      implicit none
+      include 'AST_PAR'
+      include 'SAE_PAR'
+
+      integer status, pm, lbnd(2), ubnd(2), i, j, nb1, nb2, maxthr,
+     :        oldthr, maxtab, oldtab
+      double precision coeff(40), params(2), in(300,300),
+     :                 invar(300,300), out1(300,300), out2(300,300),
+     :                 var1(300,300), var2(300,300)
+
+      data coeff / 5.0D0,   1.0, 0.0, 0.0,
+     :             0.98D0,  1.0, 1.0, 0.0,
+     :             0.05D0,  1.0, 0.0, 1.0,
+     :             2.0D-5,  1.0, 2.0, 0.0,
+     :             1.0D-5,  1.0, 1.0, 1.0,
+     :             -3.0D0,  2.0, 0.0, 0.0,
+     :             -0.04D0, 2.0, 1.0, 0.0,
+     :             1.01D0,  2.0, 0.0, 1.0,
+     :             3.0D-5,  2.0, 0.0, 2.0,
+     :             -1.0D-5, 2.0, 2.0, 0.0 /
+
+      if( status .ne. sai__ok ) return
+
+*  Resample an image using a PolyMap with an iterative inverse, first
+*  using a single thread and then using several threads. The results
+*  should be identical.
+      pm = ast_polymap( 2, 2, 10, coeff, 0, coeff,
+     :                  'IterInverse=1,TolInverse=1.0E-8', status )
+
+      lbnd( 1 ) = 1
+      lbnd( 2 ) = 1
+      ubnd( 1 ) = 300
+      ubnd( 2 ) = 300
+
+      do j = 1, 300
+         do i = 1, 300
+            if( mod( i + 7*j, 97 ) .eq. 0 ) then
+               in( i, j ) = AST__BAD
+            else
+               in( i, j ) = sin( 0.01*i ) + cos( 0.02*j )
+            end if
+            invar( i, j ) = 1.0D0 + mod( i, 5 )
+         end do
+      end do
+
+      params( 1 ) = 2.0D0
+      params( 2 ) = 2.0D0
+
+      oldthr = ast_tune( 'MaxThreads', 1, status )
+      nb1 = ast_resampled( pm, 2, lbnd, ubnd, in, invar, AST__SINC,
+     :                     ast_null, params,
+     :                     AST__USEBAD + AST__USEVAR, 0.1D0, 100,
+     :                     AST__BAD, 2, lbnd, ubnd, lbnd, ubnd, out1,
+     :                     var1, status )
+
+      maxthr = ast_tune( 'MaxThreads', 4, status )
+      nb2 = ast_resampled( pm, 2, lbnd, ubnd, in, invar, AST__SINC,
+     :                     ast_null, params,
+     :                     AST__USEBAD + AST__USEVAR, 0.1D0, 100,
+     :                     AST__BAD, 2, lbnd, ubnd, lbnd, ubnd, out2,
+     :                     var2, status )
+      maxthr = ast_tune( 'MaxThreads', oldthr, status )
+
+      if( maxthr .ne. 4 ) then
+         call stopit( status, 'Error resample 1' )
+      else if( nb1 .ne. nb2 ) then
+         write(*,*) nb1, nb2
+         call stopit( status, 'Error resample 2' )
+      end if
+
+      do j = 1, 300
+         do i = 1, 300
+            if( out1( i, j ) .ne. out2( i, j ) .or.
+     :          var1( i, j ) .ne. var2( i, j ) ) then
+               write(*,*) i, j, out1( i, j ), out2( i, j )
+               call stopit( status, 'Error resample 3' )
+               return
+            end if
+         end do
+      end do
+
+*  Resample the image again using a tabulated kernel. The results should
+*  be very close to those found using the kernel function directly.
+      oldtab = ast_tune( 'KernelTable', 8, status )
+      nb2 = ast_resampled( pm, 2, lbnd, ubnd, in, invar, AST__SINC,
+     :                     ast_null, params,
+     :                     AST__USEBAD + AST__USEVAR, 0.1D0, 100,
+     :                     AST__BAD, 2, lbnd, ubnd, lbnd, ubnd, out2,
+     :                     var2, status )
+      maxtab = ast_tune( 'KernelTable', oldtab, status )
+
+      if( maxtab .ne. 8 ) then
+         call stopit( status, 'Error resample 4' )
+      else if( nb1 .ne. nb2 ) then
+         write(*,*) nb1, nb2
+         call stopit( status, 'Error resample 5' )
+      end if
+
+      do j = 1, 300
+         do i = 1, 300
+            if( out1( i, j ) .eq. AST__BAD ) then
+               if( out2( i, j ) .ne. AST__BAD ) then
+                  write(*,*) i, j, out1( i, j ), out2( i, j )
+                  call stopit( status, 'Error resample 6' )
+                  return
+               end if
+            else if( abs( out1( i, j ) - out2( i, j ) ) .gt. 1.0D-6 .or.
+     :               abs( var1( i, j ) - var2( i, j ) ) .gt.
+     :               1.0D-6*abs( var1( i, j ) ) ) then
+               write(*,*) i, j, out1( i, j ), out2( i, j )
+               call stopit( status, 'Error resample 7' )
+               return
+            end if
+         end do
+      end do
+
+      call ast_annul( pm, status )
+
+      end
+
+
+
+
+      subroutine testinterp( status )
+      implicit none
+      include 'AST_PAR'
+      include 'SAE_PAR'
+
+      integer status, sm, lbnd(2), ubnd(2), i, j, k, nb, ix, iy,
+     :        nbad
+      double precision in(10,10), out1(10,10), out2(10,10),
+     :                 shifts(2,6), px, py, expect, ex, ey
+
+      data shifts / 0.0D0, 0.0D0,
+     :              0.5D0, -0.5D0,
+     :              0.3D0, -0.3D0,
+     :              -0.7D0, 1.25D0,
+     :              2.0D0, -3.0D0,
+     :              -1.5D0, 0.7D0 /
+
+      if( status .ne. sai__ok ) return
+
+*  Resample an image whose pixel indices include negative values, using
+*  shifts that put the interpolation points at integer, half-integer
+*  and fractional pixel coordinates on either side of zero. The image
+*  value is a linear function of position, so linear interpolation
+*  should reproduce it, except within half a pixel of an edge where
+*  only the edge pixels are used.
+      lbnd( 1 ) = -5
+      lbnd( 2 ) = -5
+      ubnd( 1 ) = 4
+      ubnd( 2 ) = 4
+
+      do j = 1, 10
+         do i = 1, 10
+            in( i, j ) = 10.0D0*( i - 6 ) + ( j - 6 )
+         end do
+      end do
+
+      do k = 1, 6
+         sm = ast_shiftmap( 2, shifts( 1, k ), ' ', status )
+
+*  Linear interpolation, first without and then with the AST__USEBAD
+*  flag. There are no bad input values, so the two should agree exactly.
+         nb = ast_resampled( sm, 2, lbnd, ubnd, in, in, AST__LINEAR,
+     :                       ast_null, 0.0D0, 0, 0.0D0, 100, AST__BAD,
+     :                       2, lbnd, ubnd, lbnd, ubnd, out1, out1,
+     :                       status )
+         nb = ast_resampled( sm, 2, lbnd, ubnd, in, in, AST__LINEAR,
+     :                       ast_null, 0.0D0, AST__USEBAD, 0.0D0, 100,
+     :                       AST__BAD, 2, lbnd, ubnd, lbnd, ubnd, out2,
+     :                       out2, status )
+
+         nbad = 0
+         do j = 1, 10
+            do i = 1, 10
+               px = ( i - 6 ) - shifts( 1, k )
+               py = ( j - 6 ) - shifts( 2, k )
+               if( px .lt. -5.5D0 .or. px .ge. 4.5D0 .or.
+     :             py .lt. -5.5D0 .or. py .ge. 4.5D0 ) then
+                  nbad = nbad + 1
+                  expect = AST__BAD
+               else
+                  ex = min( max( px, -5.0D0 ), 4.0D0 )
+                  ey = min( max( py, -5.0D0 ), 4.0D0 )
+                  expect = 10.0D0*ex + ey
+               end if
+
+               if( out1( i, j ) .ne. out2( i, j ) ) then
+                  write(*,*) k, i, j, out1( i, j ), out2( i, j )
+                  call stopit( status, 'Error interp 1' )
+               else if( expect .eq. AST__BAD ) then
+                  if( out1( i, j ) .ne. AST__BAD ) then
+                     write(*,*) k, i, j, out1( i, j )
+                     call stopit( status, 'Error interp 2' )
+                  end if
+               else if( abs( out1( i, j ) - expect ) .gt. 1.0D-10 ) then
+                  write(*,*) k, i, j, out1( i, j ), expect
+                  call stopit( status, 'Error interp 3' )
+               end if
+            end do
+         end do
+
+         if( nb .ne. nbad ) then
+            write(*,*) k, nb, nbad
+            call stopit( status, 'Error interp 4' )
+         end if
+
+*  Nearest neighbour interpolation should use the pixel with index
+*  floor( p + 0.5 ) on each axis.
+         nb = ast_resampled( sm, 2, lbnd, ubnd, in, in, AST__NEAREST,
+     :                       ast_null, 0.0D0, 0, 0.0D0, 100, AST__BAD,
+     :                       2, lbnd, ubnd, lbnd, ubnd, out1, out1,
+     :                       status )
+
+         do j = 1, 10
+            do i = 1, 10
+               px = ( i - 6 ) - shifts( 1, k )
+               py = ( j - 6 ) - shifts( 2, k )
+               if( px .lt. -5.5D0 .or. px .ge. 4.5D0 .or.
+     :             py .lt. -5.5D0 .or. py .ge. 4.5D0 ) then
+                  expect = AST__BAD
+               else
+                  ix = floor( px + 0.5D0 )
+                  iy = floor( py + 0.5D0 )
+                  expect = 10.0D0*ix + iy
+               end if
+
+               if( out1( i, j ) .ne. expect ) then
+                  write(*,*) k, i, j, out1( i, j ), expect
+                  call stopit( status, 'Error interp 5' )
+               end if
+            end do
+         end do
+
+         if( nb .ne. nbad ) then
+            write(*,*) k, nb, nbad
+            call stopit( status, 'Error interp 6' )
+         end if
+
+         call ast_annul( sm, status )
+      end do
+
+      end
+
+
+
+      subroutine testcompile( status )
+      implicit none
+      include 'AST_PAR'
+      include 'SAE_PAR'
+
+      integer status, map, cmap, ccopy, fs, cfs, i, j, k, n, np(5)
+      character fwd(2)*20, inv(2)*20
+      double precision in(3000,2), out1(3000,2), out2(3000,2),
+     :                 shift(2), matrix(4), x1(5), y1(5), x2(5),
+     :                 y2(5), x3(5), y3(5)
+
+      data np / 1, 7, 3000, 5, 2100 /
+      data fwd / 'y1=x1+0.1*x2*x2', 'y2=x2' /
+      data inv / 'x1=y1-0.1*y2*y2', 'x2=y2' /
+      data shift / 1.5D0, -2.0D0 /
+      data matrix / 1.0D0, 0.5D0, -0.25D0, 2.0D0 /
+
+      if( status .ne. sai__ok ) return
+
+*  Create a series CmpMap containing affine Mappings separated by a
+*  MathMap, and including a parallel CmpMap.
+      map = ast_cmpmap( ast_zoommap( 2, 2.5D0, ' ', status ),
+     :                  ast_mathmap( 2, 2, 2, fwd, 2, inv, ' ',
+     :                               status ), .true., ' ', status )
+      map = ast_cmpmap( map, ast_shiftmap( 2, shift, ' ', status ),
+     :                  .true., ' ', status )
+      map = ast_cmpmap( map, ast_cmpmap( ast_zoommap( 1, 3.0D0, ' ',
+     :                                                status ),
+     :                                   ast_mathmap( 1, 1, 1, 'y=2*x',
+     :                                                1, 'x=y/2', ' ',
+     :                                                status ),
+     :                                   .false., ' ', status ),
+     :                  .true., ' ', status )
+      map = ast_cmpmap( map, ast_matrixmap( 2, 2, 0, matrix, ' ',
+     :                                      status ),
+     :                  .true., ' ', status )
+
+*  Compile it. The compiled Mapping should give the same results as the
+*  original for a sequence of different numbers of points, in both
+*  directions, both before and after being inverted, and as should a
+*  copy of it.
+      cmap = ast_compile( map, status )
+
+      do k = 1, 4
+         do j = 1, 5
+            n = np( j )
+            do i = 1, n
+               in( i, 1 ) = 0.01D0*i - 3.0D0
+               in( i, 2 ) = 1.0D0 - 0.003D0*i
+            end do
+            if( j .eq. 4 ) in( 2, 1 ) = AST__BAD
+
+            call ast_trann( map, n, 2, 3000, in, mod( k, 2 ) .eq. 1,
+     :                      2, 3000, out1, status )
+            call ast_trann( cmap, n, 2, 3000, in, mod( k, 2 ) .eq. 1,
+     :                      2, 3000, out2, status )
+
+            do i = 1, n
+               if( out1( i, 1 ) .eq. AST__BAD ) then
+                  if( out2( i, 1 ) .ne. AST__BAD ) then
+                     call stopit( status, 'Error compile 1' )
+                  end if
+               else if( abs( out1( i, 1 ) - out2( i, 1 ) ) .gt.
+     :                  1.0D-10*( abs( out1( i, 1 ) ) + 1.0D0 ) .or.
+     :                  abs( out1( i, 2 ) - out2( i, 2 ) ) .gt.
+     :                  1.0D-10*( abs( out1( i, 2 ) ) + 1.0D0 ) ) then
+                  call stopit( status, 'Error compile 2' )
+               end if
+            end do
+         end do
+
+         if( k .eq. 2 ) then
+            call ast_invert( map, status )
+            call ast_invert( cmap, status )
+         else if( k .eq. 3 ) then
+            ccopy = ast_copy( cmap, status )
+            call ast_annul( cmap, status )
+            cmap = ccopy
+         end if
+      end do
+
+*  A compiled FrameSet should be a compiled copy of its base->current
+*  Mapping.
+      call ast_invert( map, status )
+      fs = ast_frameset( ast_frame( 2, ' ', status ), ' ', status )
+      call ast_addframe( fs, AST__BASE, map, ast_frame( 2, ' ',
+     :                                                   status ),
+     :                   status )
+      cfs = ast_compile( fs, status )
+      if( ast_isaframeset( cfs, status ) ) then
+         call stopit( status, 'Error compile 3' )
+      end if
+
+      do j = 1, 3
+         do i = 1, 5
+            x1( i ) = 0.2D0*i*j
+            y1( i ) = -0.1D0*i
+         end do
+         call ast_tran2( fs, 5, x1, y1, .true., x2, y2, status )
+         call ast_tran2( cfs, 5, x1, y1, .true., x3, y3, status )
+         do i = 1, 5
+            if( abs( x3( i ) - x2( i ) ) .gt. 1.0D-10 .or.
+     :          abs( y3( i ) - y2( i ) ) .gt. 1.0D-10 ) then
+               call stopit( status, 'Error compile 4' )
+            end if
+         end do
+      end do
+
+      end
@@ -0,0 +1,424 @@
+      program testmathmap
+      implicit none
+
+      include 'AST_PAR'
+      include 'SAE_PAR'
+
+      integer status
+
+      status = sai__ok
+      call ast_begin( status )
+
+      call checkPowers( status )
+      call checkFused( status )
+      call checkShared( status )
+      call checkRandom( status )
+      call checkEqual( status )
+
+      call ast_end( status )
+
+c      call ast_activememory( 'testmathmap' )
+      call ast_flushmemory( 1 )
+
+      if( status .eq. sai__ok ) then
+         write(*,*) 'All MathMap tests passed'
+      else
+         write(*,*) 'MathMap tests failed'
+      end if
+
+      end
+
+
+
+*  Check integer powers (which are evaluated by repeated multiplication)
+*  and polynomials with constant coefficients (which are evaluated using
+*  Horner's method), including bad input values and overflow.
+      subroutine checkPowers( status )
+      implicit none
+      include 'AST_PAR'
+      include 'SAE_PAR'
+
+      integer status, mm, i, j
+      double precision xin( 12 ), yout( 12, 6 ), x, expect( 6 )
+      character fwd( 6 )*40, inv( 1 )*10
+      logical isbad( 6 )
+
+      data fwd / 'a=x**2', 'b=x*x', 'c=x**7', 'd=(-x)**32',
+     :           'e=1+2*x-3*x**2+0.5*x**3+x**5', 'f=1/(x-1)' /
+      data inv / 'x' /
+      data xin / -3.5D0, -1.0D0, -0.25D0, 0.0D0, 0.5D0, 1.0D0, 1.5D0,
+     :           3.25D0, 1.0D20, -1.0D200, 1.0D160, 0.0D0 /
+
+      if( status .ne. sai__ok ) return
+
+      xin( 12 ) = AST__BAD
+
+      mm = ast_mathmap( 1, 6, 6, fwd, 1, inv, ' ', status )
+      call ast_trann( mm, 12, 1, 12, xin, .true., 6, 12, yout, status )
+
+      do i = 1, 12
+         x = xin( i )
+
+*  Find the expected results. Each result overflows if the magnitude of
+*  the highest power of "x" exceeds about 1.0E308.
+         do j = 1, 6
+            isbad( j ) = ( x .eq. AST__BAD )
+         end do
+
+         if( .not. isbad( 1 ) ) then
+            if( abs( x ) .gt. 1.0D100 ) then
+               isbad( 1 ) = .true.
+               isbad( 2 ) = .true.
+            else
+               expect( 1 ) = x**2
+               expect( 2 ) = x**2
+            end if
+
+            if( abs( x ) .gt. 1.0D40 ) then
+               isbad( 3 ) = .true.
+            else
+               expect( 3 ) = x**7
+            end if
+
+            if( abs( x ) .gt. 1.0D9 ) then
+               isbad( 4 ) = .true.
+            else
+               expect( 4 ) = x**32
+            end if
+
+            if( abs( x ) .gt. 1.0D60 ) then
+               isbad( 5 ) = .true.
+            else
+               expect( 5 ) = 1 + 2*x - 3*x**2 + 0.5D0*x**3 + x**5
+            end if
+
+            if( x .eq. 1.0D0 ) then
+               isbad( 6 ) = .true.
+            else
+               expect( 6 ) = 1/( x - 1 )
+            end if
+         end if
+
+         do j = 1, 6
+            call checkval( yout( i, j ), isbad( j ), expect( j ),
+     :                     1.0D-14, 'Power', i, j, status )
+         end do
+      end do
+
+      call ast_annul( mm, status )
+
+      end
+
+
+
+*  Check multiplications followed by additions or subtractions, which
+*  are combined into single operations, including bad input values and
+*  overflow.
+      subroutine checkFused( status )
+      implicit none
+      include 'AST_PAR'
+      include 'SAE_PAR'
+
+      integer status, mm, i, j
+      double precision xin( 6, 3 ), yout( 6, 4 ), x, y, z, expect( 4 )
+      character fwd( 4 )*40, inv( 3 )*10
+      logical isbad( 4 ), bad
+
+      data fwd / 'p=x*y+z', 'q=z+x*y', 'r=x*y-z', 's=z-x*y' /
+      data inv / 'x', 'y', 'z' /
+      data xin / 1.5D0, -2.0D0, 1.0D200, 3.0D0, 0.0D0, 1.0D0,
+     :           2.5D0, 0.125D0, 1.0D200, 0.0D0, 4.0D0, 1.0D0,
+     :           -7.0D0, 3.0D0, 1.0D0, 1.0D0, 1.0D0, 0.0D0 /
+
+      if( status .ne. sai__ok ) return
+
+      xin( 4, 2 ) = AST__BAD
+      xin( 5, 3 ) = AST__BAD
+
+      mm = ast_mathmap( 3, 4, 4, fwd, 3, inv, ' ', status )
+      call ast_trann( mm, 6, 3, 6, xin, .true., 4, 6, yout, status )
+
+      do i = 1, 6
+         x = xin( i, 1 )
+         y = xin( i, 2 )
+         z = xin( i, 3 )
+
+*  The product overflows for the third point.
+         bad = ( x .eq. AST__BAD .or. y .eq. AST__BAD .or.
+     :           z .eq. AST__BAD .or. i .eq. 3 )
+         do j = 1, 4
+            isbad( j ) = bad
+         end do
+
+         if( .not. bad ) then
+            expect( 1 ) = x*y + z
+            expect( 2 ) = z + x*y
+            expect( 3 ) = x*y - z
+            expect( 4 ) = z - x*y
+         end if
+
+         do j = 1, 4
+            call checkval( yout( i, j ), isbad( j ), expect( j ),
+     :                     1.0D-15, 'Fused', i, j, status )
+         end do
+      end do
+
+      call ast_annul( mm, status )
+
+      end
+
+
+
+*  Check sub-expressions that are used more than once, both within a
+*  single function and in several functions, both directly and through
+*  intermediate variables. Also check that constant sub-expressions are
+*  evaluated correctly.
+      subroutine checkShared( status )
+      implicit none
+      include 'AST_PAR'
+      include 'SAE_PAR'
+
+      integer status, mm, i, j
+      double precision xin( 5, 2 ), yout( 5, 4 ), zout( 5, 2 ), x, y,
+     :                 f, expect( 4 )
+      character fwd( 6 )*60, inv( 2 )*60, fwd2( 2 )*60
+      logical isbad( 4 )
+
+      data fwd / 'r2=x*x+y*y',
+     :           'f=1+0.1*r2+0.01*r2**2',
+     :           'u=x*f',
+     :           'v=y*f',
+     :           'w=sqrt(x*x+y*y)+x*y',
+     :           't=(x*y)*(x*y)+cos(2*atan(1))*x' /
+      data fwd2 / 'u=x*(1+0.1*(x*x+y*y))', 'v=y*(1+0.1*(x*x+y*y))' /
+      data inv / 'x', 'y' /
+      data xin / 1.0D0, -0.5D0, 2.0D0, 0.0D0, 1.0D200,
+     :           2.0D0, 0.75D0, 0.0D0, 0.0D0, 1.0D0 /
+
+      if( status .ne. sai__ok ) return
+
+      xin( 4, 1 ) = AST__BAD
+
+      mm = ast_mathmap( 2, 4, 6, fwd, 2, inv, ' ', status )
+      call ast_trann( mm, 5, 2, 5, xin, .true., 4, 5, yout, status )
+
+      do i = 1, 5
+         x = xin( i, 1 )
+         y = xin( i, 2 )
+
+*  The squares overflow for the fifth point.
+         do j = 1, 4
+            isbad( j ) = ( x .eq. AST__BAD .or. i .eq. 5 )
+         end do
+
+         if( .not. isbad( 1 ) ) then
+            f = 1 + 0.1D0*( x*x + y*y ) + 0.01D0*( x*x + y*y )**2
+            expect( 1 ) = x*f
+            expect( 2 ) = y*f
+            expect( 3 ) = sqrt( x*x + y*y ) + x*y
+            expect( 4 ) = ( x*y )**2 + cos( 2*atan( 1.0D0 ) )*x
+         end if
+
+         do j = 1, 4
+            call checkval( yout( i, j ), isbad( j ), expect( j ),
+     :                     1.0D-14, 'Shared', i, j, status )
+         end do
+      end do
+
+      call ast_annul( mm, status )
+
+      mm = ast_mathmap( 2, 2, 2, fwd2, 2, inv, ' ', status )
+      call ast_trann( mm, 5, 2, 5, xin, .true., 2, 5, zout, status )
+
+      do i = 1, 5
+         x = xin( i, 1 )
+         y = xin( i, 2 )
+         do j = 1, 2
+            isbad( j ) = ( x .eq. AST__BAD .or. i .eq. 5 )
+         end do
+
+         if( .not. isbad( 1 ) ) then
+            expect( 1 ) = x*( 1 + 0.1D0*( x*x + y*y ) )
+            expect( 2 ) = y*( 1 + 0.1D0*( x*x + y*y ) )
+         end if
+
+         do j = 1, 2
+            call checkval( zout( i, j ), isbad( j ), expect( j ),
+     :                     1.0D-15, 'Shared2', i, j, status )
+         end do
+      end do
+
+      call ast_annul( mm, status )
+
+      end
+
+
+
+*  Check that random number functions are neither evaluated once as
+*  constants nor shared, and that they give the same sequence for a
+*  given Seed value.
+      subroutine checkRandom( status )
+      implicit none
+      include 'AST_PAR'
+      include 'SAE_PAR'
+
+      integer status, mm1, mm2, mm3, i
+      double precision xin( 100 ), yout1( 100, 3 ), yout2( 100, 3 ),
+     :                 yout3( 200 )
+      character fwd( 3 )*40, fwd3( 1 )*40, inv( 1 )*10
+      logical same
+
+      data fwd / 'a=rand(0,1)', 'b=rand(0,1)',
+     :           'c=rand(0,1)-rand(0,1)+x*(2+3)' /
+      data fwd3 / 'a=rand(0,1)' /
+      data inv / 'x' /
+
+      if( status .ne. sai__ok ) return
+
+      do i = 1, 100
+         xin( i ) = i
+      end do
+
+      mm1 = ast_mathmap( 1, 3, 3, fwd, 1, inv, 'Seed=1234', status )
+      mm2 = ast_mathmap( 1, 3, 3, fwd, 1, inv, 'Seed=1234', status )
+      call ast_trann( mm1, 100, 1, 100, xin, .true., 3, 100, yout1,
+     :                status )
+      call ast_trann( mm2, 100, 1, 100, xin, .true., 3, 100, yout2,
+     :                status )
+
+      same = .true.
+      do i = 1, 100
+         if( yout1( i, 1 ) .ne. yout2( i, 1 ) .or.
+     :       yout1( i, 2 ) .ne. yout2( i, 2 ) .or.
+     :       yout1( i, 3 ) .ne. yout2( i, 3 ) ) then
+            call stopit( status, 'Random 1' )
+         else if( yout1( i, 1 ) .lt. 0.0 .or.
+     :            yout1( i, 1 ) .gt. 1.0 ) then
+            call stopit( status, 'Random 2' )
+         else if( abs( yout1( i, 3 ) - 5*i ) .gt. 1.0 ) then
+            call stopit( status, 'Random 3' )
+         end if
+
+         if( i .gt. 1 .and. yout1( i, 1 ) .ne. yout1( 1, 1 ) ) then
+            same = .false.
+         end if
+         if( yout1( i, 1 ) .eq. yout1( i, 2 ) ) then
+            call stopit( status, 'Random 4' )
+         end if
+         if( yout1( i, 3 ) .eq. 5*i ) then
+            call stopit( status, 'Random 5' )
+         end if
+      end do
+
+      if( same ) call stopit( status, 'Random 6' )
+
+*  The random values are generated one function at a time, so a single
+*  function applied to twice as many points with the same Seed gives the
+*  values for the first two functions in turn.
+      mm3 = ast_mathmap( 1, 1, 1, fwd3, 1, inv, 'Seed=1234', status )
+      call ast_trann( mm3, 200, 1, 200, xin, .true., 1, 200, yout3,
+     :                status )
+
+      do i = 1, 100
+         if( yout3( i ) .ne. yout1( i, 1 ) ) then
+            call stopit( status, 'Random 7' )
+         else if( yout3( i + 100 ) .ne. yout1( i, 2 ) ) then
+            call stopit( status, 'Random 8' )
+         end if
+      end do
+
+      call ast_annul( mm1, status )
+      call ast_annul( mm2, status )
+      call ast_annul( mm3, status )
+
+      end
+
+
+
+*  Check that MathMaps whose functions differ only in the value of a
+*  constant sub-expression are not equal.
+      subroutine checkEqual( status )
+      implicit none
+      include 'AST_PAR'
+      include 'SAE_PAR'
+
+      integer status, mm1, mm2, mm3, mm4
+
+      if( status .ne. sai__ok ) return
+
+      mm1 = ast_mathmap( 1, 1, 1, 'y=x*(2+3)', 1, 'x=y/(2+3)', ' ',
+     :                   status )
+      mm2 = ast_mathmap( 1, 1, 1, 'y=x*(2+3)', 1, 'x=y/(2+3)', ' ',
+     :                   status )
+      mm3 = ast_mathmap( 1, 1, 1, 'y=x*(2+4)', 1, 'x=y/(2+3)', ' ',
+     :                   status )
+      mm4 = ast_mathmap( 1, 1, 1, 'y=x*(2+3)', 1, 'x=y/(2+4)', ' ',
+     :                   status )
+
+      if( .not. ast_equal( mm1, mm2, status ) ) then
+         call stopit( status, 'Equal 1' )
+      else if( ast_equal( mm1, mm3, status ) ) then
+         call stopit( status, 'Equal 2' )
+      else if( ast_equal( mm1, mm4, status ) ) then
+         call stopit( status, 'Equal 3' )
+      else if( ast_equal( mm3, mm4, status ) ) then
+         call stopit( status, 'Equal 4' )
+      end if
+
+      call ast_annul( mm1, status )
+      call ast_annul( mm2, status )
+      call ast_annul( mm3, status )
+      call ast_annul( mm4, status )
+
+      end
+
+
+
+*  Checks a value produced by a MathMap. It should be bad if "isbad" is
+*  true. Otherwise it should equal "expect" to within a relative
+*  tolerance of "tol".
+      subroutine checkval( val, isbad, expect, tol, text, i, j, status )
+      implicit none
+      include 'AST_PAR'
+      include 'SAE_PAR'
+
+      double precision val, expect, tol
+      logical isbad
+      character text*(*)
+      integer i, j, status
+
+      if( status .ne. sai__ok ) return
+
+      if( isbad ) then
+         if( val .ne. AST__BAD ) then
+            write(*,*) text,': point ',i,' output ',j,' is ',val,
+     :                 ' (should be bad)'
+            call stopit( status, text )
+         end if
+
+      else if( val .eq. AST__BAD ) then
+         write(*,*) text,': point ',i,' output ',j,
+     :              ' is bad (should be ',expect,')'
+         call stopit( status, text )
+
+      else if( abs( val - expect ) .gt. tol*abs( expect ) ) then
+         write(*,*) text,': point ',i,' output ',j,' is ',val,
+     :              ' (should be ',expect,')'
+         call stopit( status, text )
+      end if
+
+      end
+
+
+
+      subroutine stopit( status, text )
+      implicit none
+      include 'SAE_PAR'
+      integer status
+      character text*(*)
+
+      if( status .ne. sai__ok ) return
+      status = sai__error
+      write(*,*) text
+
+      end
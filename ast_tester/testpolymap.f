@@ -9,7 +9,9 @@
      :                 xin(3), yin(3), xout(3), yout(3), errlim,
      :                 xin2(3), yin2(3), coeff_1d(6), acc,
      :                 coeff2( 24 ), coeff3( 6*4 ), err, maxacc,
-     :                 cofs( 20 )
+     :                 cofs( 20 ), xbig( 700 ), ybig( 700 ),
+     :                 xbig2( 700 ), ybig2( 700 ), xbig3( 700 ),
+     :                 ybig3( 700 ), coeff4( 16 ), x, y
 
       data coeff / 1.0, 1.0, 0.0, 0.0,
      :             2.0, 1.0, 1.0, 0.0,
@@ -40,6 +42,11 @@ c     :              -1.0E-9,  2.0, 1.0, 2.0 /
      :              1.0E-4,   2.0, 1.0, 1.0 /
 
 
+      data coeff4 / 1.0,      1.0, 0.0, 0.0,
+     :              2.0,      1.0, 2.0, 1.0,
+     :              3.0,      1.0, 0.0, 3.0,
+     :              0.5,      2.0, 1.0, 0.0 /
+
       data coeff_1d / 1.0, 1.0, 0.0,
      :                2.0, 1.0, 1.0 /
 
@@ -288,6 +295,71 @@ c      call ast_watchmemory( 131 )
       endif
 
 
+c  Check the iterative inverse on enough points to fill several blocks,
+c  including a bad position.
+      pm = ast_polymap( 2, 2, 6, coeff3, 0, coeff3,
+     :                  'IterInverse=1,TolInverse=1.0E-10', status )
+      do i = 1, 700
+         xbig( i ) = -500.0D0 + 1.5D0*i
+         ybig( i ) = 300.0D0 - i
+      end do
+      xbig( 300 ) = AST__BAD
+
+      call ast_tran2( pm, 700, xbig, ybig, .true., xbig2, ybig2,
+     :                status )
+      call ast_tran2( pm, 700, xbig2, ybig2, .false., xbig3, ybig3,
+     :                status )
+
+      do i = 1, 700
+         if( i .eq. 300 ) then
+            if( xbig3( i ) .ne. AST__BAD .or.
+     :          ybig3( i ) .ne. AST__BAD ) then
+               call stopit( 9001, status )
+            end if
+         else if( abs( xbig( i ) - xbig3( i ) ) .gt. errlim ) then
+            write(*,*) i, xbig( i ), xbig3( i ), errlim
+            call stopit( 9002, status )
+         else if( abs( ybig( i ) - ybig3( i ) ) .gt. errlim ) then
+            write(*,*) i, ybig( i ), ybig3( i ), errlim
+            call stopit( 9003, status )
+         endif
+      end do
+
+c  Check the forward transformation against direct evaluation of the
+c  polynomials, including positions with bad axis values.
+      pm = ast_polymap( 2, 2, 4, coeff4, 0, coeff4, ' ', status )
+      do i = 1, 700
+         xbig( i ) = -3.5D0 + 0.01D0*i
+         ybig( i ) = 2.0D0 - 0.005D0*i
+      end do
+      xbig( 10 ) = AST__BAD
+      ybig( 20 ) = AST__BAD
+
+      call ast_tran2( pm, 700, xbig, ybig, .true., xbig2, ybig2,
+     :                status )
+
+      do i = 1, 700
+         x = xbig( i )
+         y = ybig( i )
+         if( i .eq. 10 ) then
+            if( xbig2( i ) .ne. AST__BAD .or.
+     :          ybig2( i ) .ne. AST__BAD ) call stopit( 9004, status )
+         else if( i .eq. 20 ) then
+            if( xbig2( i ) .ne. AST__BAD ) then
+               call stopit( 9005, status )
+            else if( abs( ybig2( i ) - 0.5D0*x ) .gt. 1.0D-12 ) then
+               call stopit( 9006, status )
+            end if
+         else if( abs( xbig2( i ) - ( 1.0D0 + 2.0D0*x*x*y +
+     :                                3.0D0*y**3 ) ) .gt. 1.0D-12 ) then
+            write(*,*) i, xbig2( i ), 1.0D0 + 2.0D0*x*x*y + 3.0D0*y**3
+            call stopit( 9007, status )
+         else if( abs( ybig2( i ) - 0.5D0*x ) .gt. 1.0D-12 ) then
+            call stopit( 9008, status )
+         endif
+      end do
+
+
 
 
 
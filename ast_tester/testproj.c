@@ -0,0 +1,208 @@
+#include "ast.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define NPHI 49
+#define NTHETA 27
+#define NPOINT ( NPHI*NTHETA )
+
+typedef int (*ScalarFun)( const double, const double, struct AstPrjPrm *,
+                          double *, double * );
+typedef int (*ArrayFun)( const int, const double [], const double [],
+                         struct AstPrjPrm *, double [], double [], int [] );
+
+/* The projections that have array versions of their projection
+   functions. */
+typedef struct Proj {
+   const char *code;
+   ScalarFun fwd;
+   ScalarFun rev;
+   ArrayFun fwdn;
+   ArrayFun revn;
+} Proj;
+
+static Proj projs[] = {
+   { "TAN", astTANfwd, astTANrev, astTANfwdN, astTANrevN },
+   { "SIN", astSINfwd, astSINrev, astSINfwdN, astSINrevN },
+   { "ARC", astARCfwd, astARCrev, astARCfwdN, astARCrevN },
+   { "ZEA", astZEAfwd, astZEArev, astZEAfwdN, astZEArevN },
+   { "CAR", astCARfwd, astCARrev, astCARfwdN, astCARrevN },
+   { "AIT", astAITfwd, astAITrev, astAITfwdN, astAITrevN },
+   { "HPX", astHPXfwd, astHPXrev, astHPXfwdN, astHPXrevN }
+};
+
+/* Initialise a AstPrjPrm structure for a projection with default
+   parameters. */
+static void init( struct AstPrjPrm *prj, double *p, double *p2,
+                  const char *code ) {
+   memset( prj, 0, sizeof( *prj ) );
+   memset( p, 0, sizeof( double )*WCSLIB_MXPAR );
+   memset( p2, 0, sizeof( double )*WCSLIB_MXPAR );
+   strcpy( prj->code, code );
+   prj->p = p;
+   prj->p2 = p2;
+   if( !strcmp( code, "HPX" ) ) {
+      p[ 1 ] = 4.0;
+      p[ 2 ] = 3.0;
+   }
+}
+
+/* Return the angle in degrees between two positions on the sphere. */
+static double separation( double phi1, double theta1, double phi2,
+                          double theta2 ) {
+   double s1, c1, s2, c2, sp1, cp1, sp2, cp2, dx, dy, dz;
+
+   astSinCosd( theta1, &s1, &c1 );
+   astSinCosd( theta2, &s2, &c2 );
+   astSinCosd( phi1, &sp1, &cp1 );
+   astSinCosd( phi2, &sp2, &cp2 );
+   dx = c1*cp1 - c2*cp2;
+   dy = c1*sp1 - c2*sp2;
+   dz = s1 - s2;
+   return 2.0*astASind( 0.5*sqrt( dx*dx + dy*dy + dz*dz ) );
+}
+
+/* Transform a grid of (phi,theta) values with the array forward
+   projection function, and the result with the array reverse function.
+   Check that each gives the same values and status as the scalar
+   function, and that valid positions away from the poles are
+   recovered. The SIN projection cannot recover positions accurately
+   near its horizon at theta=0, so these are excluded. */
+static void check( Proj *proj, int ierr ) {
+   struct AstPrjPrm prj1;
+   struct AstPrjPrm prj2;
+   double p1[ WCSLIB_MXPAR ];
+   double p2[ WCSLIB_MXPAR ];
+   double q1[ WCSLIB_MXPAR ];
+   double q2[ WCSLIB_MXPAR ];
+   double phi[ NPOINT ];
+   double theta[ NPOINT ];
+   double x[ NPOINT ];
+   double y[ NPOINT ];
+   double phi2[ NPOINT ];
+   double theta2[ NPOINT ];
+   double xs, ys, phis, thetas;
+   int fstat[ NPOINT ];
+   int rstat[ NPOINT ];
+   int i, j, k, s;
+
+   if( !astOK ) return;
+
+/* The grid includes multiples of 45 and 90 degrees, the poles, and
+   longitudes either side of +/-180. */
+   k = 0;
+   for( i = 0; i < NPHI; i++ ) {
+      for( j = 0; j < NTHETA; j++ ) {
+         phi[ k ] = -180.0 + 7.5*i;
+         theta[ k ] = -90.0 + 7.5*j;
+         if( i % 4 == 1 ) phi[ k ] += 0.123;
+         if( j % 4 == 1 ) theta[ k ] -= 0.0456;
+         if( j == NTHETA - 1 ) theta[ k ] = 89.999;
+         fstat[ k ] = 0;
+         k++;
+      }
+   }
+
+/* Use separate structures for the array and scalar functions, so that
+   each is initialised by its own function. */
+   init( &prj1, p1, p2, proj->code );
+   init( &prj2, q1, q2, proj->code );
+
+   if( proj->fwdn( NPOINT, phi, theta, &prj1, x, y, fstat ) ) {
+      astError( AST__INTER, "Error %d: %s array forward function failed\n",
+                ierr, proj->code );
+      return;
+   }
+
+   for( k = 0; k < NPOINT && astOK; k++ ) {
+      s = proj->fwd( phi[ k ], theta[ k ], &prj2, &xs, &ys );
+      if( s != fstat[ k ] ) {
+         astError( AST__INTER, "Error %d: %s forward status %d != %d at "
+                   "(%g,%g)\n", ierr, proj->code, fstat[ k ], s, phi[ k ],
+                   theta[ k ] );
+      } else if( !s && ( x[ k ] != xs || y[ k ] != ys ) ) {
+         astError( AST__INTER, "Error %d: %s forward (%.17g,%.17g) != "
+                   "(%.17g,%.17g) at (%g,%g)\n", ierr + 1, proj->code,
+                   x[ k ], y[ k ], xs, ys, phi[ k ], theta[ k ] );
+      }
+      rstat[ k ] = fstat[ k ];
+   }
+   if( !astOK ) return;
+
+   if( proj->revn( NPOINT, x, y, &prj1, phi2, theta2, rstat ) ) {
+      astError( AST__INTER, "Error %d: %s array reverse function failed\n",
+                ierr + 2, proj->code );
+      return;
+   }
+
+   for( k = 0; k < NPOINT && astOK; k++ ) {
+      if( fstat[ k ] ) continue;
+      s = proj->rev( x[ k ], y[ k ], &prj2, &phis, &thetas );
+      if( s != rstat[ k ] ) {
+         astError( AST__INTER, "Error %d: %s reverse status %d != %d at "
+                   "(%g,%g)\n", ierr + 3, proj->code, rstat[ k ], s, x[ k ],
+                   y[ k ] );
+      } else if( !s && ( phi2[ k ] != phis || theta2[ k ] != thetas ) ) {
+         astError( AST__INTER, "Error %d: %s reverse (%.17g,%.17g) != "
+                   "(%.17g,%.17g) at (%g,%g)\n", ierr + 4, proj->code,
+                   phi2[ k ], theta2[ k ], phis, thetas, x[ k ], y[ k ] );
+      } else if( !s && fabs( theta[ k ] ) < 89.0 &&
+                 ( strcmp( proj->code, "SIN" ) || theta[ k ] > 1.0 ) &&
+                 separation( phi[ k ], theta[ k ], phi2[ k ],
+                             theta2[ k ] ) > 1.0E-9 ) {
+         astError( AST__INTER, "Error %d: %s round trip gives (%.17g,%.17g) "
+                   "for (%.17g,%.17g)\n", ierr + 5, proj->code, phi2[ k ],
+                   theta2[ k ], phi[ k ], theta[ k ] );
+      }
+   }
+}
+
+int main(){
+   double a;
+   double c;
+   double s;
+   int i;
+   int iproj;
+
+/* astSinCosd should give the same values as astSind and astCosd at
+   exact multiples of 45 degrees, and exact values at multiples of 90
+   degrees. Include angles beyond one turn, which are handled
+   separately. */
+   for( i = -24; i <= 24 && astOK; i++ ) {
+      a = 45.0*i;
+      astSinCosd( a, &s, &c );
+      if( s != astSind( a ) || c != astCosd( a ) ) {
+         astError( AST__INTER, "Error 1: astSinCosd(%g) gives (%.17g,%.17g)"
+                   "\n", a, s, c );
+      } else if( i % 2 == 0 ) {
+         if( s != ( ( i % 8 == 2 || i % 8 == -6 ) ? 1.0 :
+                    ( i % 8 == 6 || i % 8 == -2 ) ? -1.0 : 0.0 ) ||
+             c != ( ( i % 8 == 0 ) ? 1.0 :
+                    ( i % 8 == 4 || i % 8 == -4 ) ? -1.0 : 0.0 ) ) {
+            astError( AST__INTER, "Error 2: astSinCosd(%g) gives "
+                      "(%.17g,%.17g)\n", a, s, c );
+         }
+      }
+   }
+
+/* Values that are not special cases. */
+   for( i = -1000; i <= 1000 && astOK; i++ ) {
+      a = 0.737*i;
+      astSinCosd( a, &s, &c );
+      if( s != astSind( a ) || c != astCosd( a ) ) {
+         astError( AST__INTER, "Error 3: astSinCosd(%g) gives (%.17g,%.17g)"
+                   "\n", a, s, c );
+      }
+   }
+
+   for( iproj = 0; iproj < sizeof( projs )/sizeof( projs[ 0 ] ); iproj++ ) {
+      check( projs + iproj, 10*( iproj + 1 ) );
+   }
+
+   if( astOK ) {
+      printf(" All projection tests passed\n");
+   } else {
+      printf("Projection tests failed\n");
+   }
+}
@@ -57,6 +57,7 @@
       call test11( NDIM, SPREAD, params, status )
       call test12( NDIM, SPREAD, params, status )
       call test12( NDIM, SPREAD, params, status )
+      call test14( NDIM, SPREAD, params, status )
 
       if( status .ne. SAI__OK ) then
          call msg_seti( 'N', ndim )
@@ -1668,3 +1669,176 @@
       END
 
 
+
+      SUBROUTINE TEST14( NDIM, SPREAD, PARAMS, STATUS )
+      IMPLICIT NONE
+      INCLUDE 'SAE_PAR'
+      INCLUDE 'AST_PAR'
+
+      INTEGER SPREAD, STATUS, NDIM
+      DOUBLE PRECISION PARAMS(2)
+
+      INTEGER NX, NY
+      PARAMETER( NX = 300 )
+      PARAMETER( NY = 300 )
+
+      DOUBLE PRECISION IN( NX, NY ), INVAR( NX, NY ), COEFFS( 40 )
+      DOUBLE PRECISION OUT1( NX, NY ), OUTV1( NX, NY ),
+     :                 WEIGHTS1( NX, NY, 2 )
+      DOUBLE PRECISION OUT2( NX, NY ), OUTV2( NX, NY ),
+     :                 WEIGHTS2( NX, NY, 2 )
+      INTEGER LBND(2), UBND(2), FLAGS, I, J, K, PM, OLDTHR, ITHR, M
+      INTEGER MFLAGS( 3 )
+      LOGICAL DIFF
+      INTEGER*8 NUSED1, NUSED2
+      DOUBLE PRECISION SCALE
+
+      DATA COEFFS / 5.0D0,   1.0, 0.0, 0.0,
+     :              0.98D0,  1.0, 1.0, 0.0,
+     :              0.05D0,  1.0, 0.0, 1.0,
+     :              2.0D-5,  1.0, 2.0, 0.0,
+     :              1.0D-5,  1.0, 1.0, 1.0,
+     :              -3.0D0,  2.0, 0.0, 0.0,
+     :              -0.04D0, 2.0, 1.0, 0.0,
+     :              1.01D0,  2.0, 0.0, 1.0,
+     :              3.0D-5,  2.0, 0.0, 2.0,
+     :              -1.0D-5, 2.0, 2.0, 0.0 /
+
+*  Check that rebinning a sequence of large 2-dimensional arrays using
+*  several threads gives the same results (to within rounding errors)
+*  as using a single thread. The output data, variances and weights are
+*  compared, with output variances generated from the spread of input
+*  data values, and with input variances used as weights.
+      IF( STATUS .NE. SAI__OK .OR. NDIM .NE. 2 ) RETURN
+      CALL AST_BEGIN( STATUS )
+
+      MFLAGS( 1 ) = AST__GENVAR
+      MFLAGS( 2 ) = AST__VARWGT
+      MFLAGS( 3 ) = AST__GENVAR + AST__VARWGT
+
+      PM = AST_POLYMAP( 2, 2, 10, COEFFS, 0, COEFFS, ' ', STATUS )
+
+      LBND( 1 ) = 1
+      LBND( 2 ) = 1
+      UBND( 1 ) = NX
+      UBND( 2 ) = NY
+
+      DO J = 1, NY
+         DO I = 1, NX
+            IF( MOD( I + 7*J, 97 ) .EQ. 0 ) THEN
+               IN( I, J ) = AST__BAD
+            ELSE
+               IN( I, J ) = 2.0 + SIN( 0.01*I ) + COS( 0.02*J )
+            END IF
+            INVAR( I, J ) = 1.0D0 + MOD( I, 5 )
+         END DO
+      END DO
+
+      DO M = 1, 3
+         OLDTHR = AST_TUNE( 'MaxThreads', 1, STATUS )
+         DO K = 1, 3
+            FLAGS = AST__USEBAD + MFLAGS( M )
+            IF( K .EQ. 1 ) FLAGS = FLAGS + AST__REBININIT
+            IF( K .EQ. 3 ) FLAGS = FLAGS + AST__REBINEND
+            CALL AST_REBINSEQD( PM, 0.0D0, 2, LBND, UBND, IN, INVAR,
+     :                          SPREAD, PARAMS, FLAGS, 0.1D0, 50,
+     :                          AST__BAD, 2, LBND, UBND, LBND, UBND,
+     :                          OUT1, OUTV1, WEIGHTS1, NUSED1, STATUS )
+         END DO
+
+         ITHR = AST_TUNE( 'MaxThreads', 4, STATUS )
+         DO K = 1, 3
+            FLAGS = AST__USEBAD + MFLAGS( M )
+            IF( K .EQ. 1 ) FLAGS = FLAGS + AST__REBININIT
+            IF( K .EQ. 3 ) FLAGS = FLAGS + AST__REBINEND
+            CALL AST_REBINSEQD( PM, 0.0D0, 2, LBND, UBND, IN, INVAR,
+     :                          SPREAD, PARAMS, FLAGS, 0.1D0, 50,
+     :                          AST__BAD, 2, LBND, UBND, LBND, UBND,
+     :                          OUT2, OUTV2, WEIGHTS2, NUSED2, STATUS )
+         END DO
+         ITHR = AST_TUNE( 'MaxThreads', OLDTHR, STATUS )
+
+         IF( NUSED1 .NE. NUSED2 .AND. STATUS .EQ. SAI__OK ) THEN
+            STATUS = SAI__ERROR
+            CALL MSG_SETI( 'M', M )
+            CALL ERR_REP( ' ', 'NUSED differs when using threads '//
+     :                    '(case ^M).', STATUS )
+         END IF
+
+         DO J = 1, NY
+            DO I = 1, NX
+               IF( STATUS .EQ. SAI__OK ) THEN
+                  CALL TEST14_CMP( OUT1( I, J ), OUT2( I, J ),
+     :                             ABS( OUT1( I, J ) ), DIFF )
+
+*  Variances generated from the spread of input values are the small
+*  difference of two large sums, so their rounding errors scale with
+*  the square of the data value.
+                  IF( .NOT. DIFF ) THEN
+                     SCALE = ABS( OUTV1( I, J ) )
+                     IF( OUT1( I, J ) .NE. AST__BAD ) THEN
+                        SCALE = MAX( SCALE, OUT1( I, J )**2 )
+                     END IF
+                     CALL TEST14_CMP( OUTV1( I, J ), OUTV2( I, J ),
+     :                                SCALE, DIFF )
+                  END IF
+
+                  IF( .NOT. DIFF ) THEN
+                     CALL TEST14_CMP( WEIGHTS1( I, J, 1 ),
+     :                                WEIGHTS2( I, J, 1 ),
+     :                                ABS( WEIGHTS1( I, J, 1 ) ), DIFF )
+                  END IF
+
+*  The second plane of the weights array is only used when output
+*  variances are generated from the spread of input data values.
+                  IF( .NOT. DIFF .AND.
+     :                MFLAGS( M ) .NE. AST__VARWGT ) THEN
+                     CALL TEST14_CMP( WEIGHTS1( I, J, 2 ),
+     :                                WEIGHTS2( I, J, 2 ),
+     :                                ABS( WEIGHTS1( I, J, 2 ) ), DIFF )
+                  END IF
+
+                  IF( DIFF ) THEN
+                     STATUS = SAI__ERROR
+                     CALL MSG_SETI( 'M', M )
+                     CALL MSG_SETI( 'I', I )
+                     CALL MSG_SETI( 'J', J )
+                     CALL MSG_SETD( 'A', OUT1( I, J ) )
+                     CALL MSG_SETD( 'B', OUT2( I, J ) )
+                     CALL MSG_SETD( 'C', OUTV1( I, J ) )
+                     CALL MSG_SETD( 'D', OUTV2( I, J ) )
+                     CALL ERR_REP( ' ', 'Threaded value differs at '//
+     :                             'pixel (^I,^J) in case ^M: ^A '//
+     :                             '!= ^B or ^C != ^D (or weights '//
+     :                             'differ)', STATUS )
+                  END IF
+               END IF
+            END DO
+         END DO
+      END DO
+
+      CALL AST_END( STATUS )
+      IF( STATUS .NE. SAI__OK ) THEN
+         CALL ERR_REP( ' ', 'test14 failed', STATUS )
+      END IF
+
+      END
+
+
+
+      SUBROUTINE TEST14_CMP( A, B, SCALE, DIFF )
+      IMPLICIT NONE
+      INCLUDE 'AST_PAR'
+
+      DOUBLE PRECISION A, B, SCALE
+      LOGICAL DIFF
+
+*  Return DIFF = .TRUE. if A and B differ by more than rounding error
+*  in a value of size SCALE, or if only one of them is bad.
+      IF( A .EQ. AST__BAD .OR. B .EQ. AST__BAD ) THEN
+         DIFF = ( A .NE. B )
+      ELSE
+         DIFF = ( ABS( A - B ) .GT. 1.0D-10*SCALE )
+      END IF
+
+      END
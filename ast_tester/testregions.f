@@ -20,6 +20,8 @@ c      call ast_watchmemory( 282905 )
       call generalChecks( status )
       call checkCmpRegion( status )
       call checkPointList( status )
+      call checkMasks( status )
+      call checkPolyIndex( status )
 
       call ast_end( status )
 
@@ -2072,6 +2074,422 @@ C
       end
 
 
+      subroutine checkMasks( status )
+      implicit none
+      include 'AST_PAR'
+      include 'SAE_PAR'
+
+      integer status, frm, box, cir, ell, pol, cmp, neg, n, nmaskpix
+      integer inmask(40,30), outmask(40,30)
+      double precision p1(2), p2(2), p(8,2)
+
+      if( status .ne.sai__ok ) return
+
+      call ast_begin( status )
+
+*  All Regions are defined directly in a 2D Frame used as the grid
+*  coordinate system, so that astMask<X> can rasterise them a row at a
+*  time. The grid holds more than 1024 pixels so the Regions are also
+*  simplified before use. Pixel centres on the boundary of a closed
+*  Region are inside both the Region and its negation, so they are
+*  masked neither when masking the inside nor when masking the outside.
+
+*  A Box with corners on pixel centres.
+      frm = ast_frame( 2, ' ', status )
+      p1(1) = 5.0
+      p1(2) = 4.0
+      p2(1) = 20.0
+      p2(2) = 12.0
+      box = ast_box( frm, 1, p1, p2, AST__NULL, ' ', status )
+      n = nmaskpix( box, inmask, outmask, 'Mask box', status )
+      if( n .ne. 98 ) call stopit( status, 'Mask 1' )
+      if( inmask( 6, 5 ) .ne. 1 ) call stopit( status, 'Mask 2' )
+      if( inmask( 5, 4 ) + outmask( 5, 4 ) .ne. 0 )
+     :   call stopit( status, 'Mask 3' )
+      if( inmask( 20, 12 ) + outmask( 20, 12 ) .ne. 0 )
+     :   call stopit( status, 'Mask 4' )
+      if( outmask( 21, 12 ) .ne. 1 ) call stopit( status, 'Mask 5' )
+
+*  A Circle of radius 5. Twelve pixel centres lie exactly on the
+*  circumference.
+      p1(1) = 20.0
+      p1(2) = 15.0
+      p2(1) = 5.0
+      cir = ast_circle( frm, 1, p1, p2, AST__NULL, ' ', status )
+      n = nmaskpix( cir, inmask, outmask, 'Mask circle', status )
+      if( n .ne. 69 ) call stopit( status, 'Mask 6' )
+      if( inmask( 25, 15 ) + outmask( 25, 15 ) .ne. 0 )
+     :   call stopit( status, 'Mask 7' )
+      if( inmask( 23, 19 ) + outmask( 23, 19 ) .ne. 0 )
+     :   call stopit( status, 'Mask 8' )
+      if( outmask( 26, 15 ) .ne. 1 ) call stopit( status, 'Mask 9' )
+      if( outmask( 24, 19 ) .ne. 1 ) call stopit( status, 'Mask 10' )
+
+*  An Ellipse with its 8 pixel semi-axis parallel to the first axis and
+*  its 3 pixel semi-axis parallel to the second axis.
+      p1(1) = 20.0
+      p1(2) = 15.0
+      p2(1) = 8.0
+      p2(2) = 3.0
+      p(1,1) = acos( 0.0D0 )
+      ell = ast_ellipse( frm, 1, p1, p2, p, AST__NULL, ' ', status )
+      n = nmaskpix( ell, inmask, outmask, 'Mask ellipse', status )
+      if( n .ne. 67 ) call stopit( status, 'Mask 11' )
+      if( inmask( 28, 15 ) + outmask( 28, 15 ) .ne. 0 )
+     :   call stopit( status, 'Mask 12' )
+      if( inmask( 20, 18 ) + outmask( 20, 18 ) .ne. 0 )
+     :   call stopit( status, 'Mask 13' )
+      if( outmask( 29, 15 ) .ne. 1 ) call stopit( status, 'Mask 14' )
+      if( outmask( 20, 19 ) .ne. 1 ) call stopit( status, 'Mask 15' )
+
+*  A concave U-shaped Polygon with all vertices on pixel centres. Each
+*  row through the notch crosses the boundary four times. There are 442
+*  pixel centres inside or on the Polygon, of which 116 are on the
+*  boundary.
+      p(1,1) = 5.0
+      p(1,2) = 5.0
+      p(2,1) = 30.0
+      p(2,2) = 5.0
+      p(3,1) = 30.0
+      p(3,2) = 25.0
+      p(4,1) = 22.0
+      p(4,2) = 25.0
+      p(5,1) = 22.0
+      p(5,2) = 12.0
+      p(6,1) = 13.0
+      p(6,2) = 12.0
+      p(7,1) = 13.0
+      p(7,2) = 25.0
+      p(8,1) = 5.0
+      p(8,2) = 25.0
+      pol = ast_polygon( frm, 8, 8, p, AST__NULL, ' ', status )
+      n = nmaskpix( pol, inmask, outmask, 'Mask polygon', status )
+      if( n .ne. 326 ) call stopit( status, 'Mask 16' )
+      if( inmask( 13, 20 ) + outmask( 13, 20 ) .ne. 0 )
+     :   call stopit( status, 'Mask 17' )
+      if( inmask( 22, 12 ) + outmask( 22, 12 ) .ne. 0 )
+     :   call stopit( status, 'Mask 18' )
+      if( inmask( 17, 12 ) + outmask( 17, 12 ) .ne. 0 )
+     :   call stopit( status, 'Mask 19' )
+      if( inmask( 12, 20 ) .ne. 1 ) call stopit( status, 'Mask 20' )
+      if( outmask( 14, 20 ) .ne. 1 ) call stopit( status, 'Mask 21' )
+      if( outmask( 17, 13 ) .ne. 1 ) call stopit( status, 'Mask 22' )
+      if( outmask( 4, 25 ) .ne. 1 ) call stopit( status, 'Mask 23' )
+
+*  The negated Polygon.
+      neg = ast_copy( pol, status )
+      call ast_negate( neg, status )
+      n = nmaskpix( neg, inmask, outmask, 'Mask negated', status )
+      if( n .ne. 758 ) call stopit( status, 'Mask 24' )
+      if( inmask( 13, 20 ) + outmask( 13, 20 ) .ne. 0 )
+     :   call stopit( status, 'Mask 25' )
+      if( inmask( 14, 20 ) .ne. 1 ) call stopit( status, 'Mask 26' )
+      if( outmask( 12, 20 ) .ne. 1 ) call stopit( status, 'Mask 27' )
+      if( inmask( 1, 1 ) .ne. 1 ) call stopit( status, 'Mask 28' )
+
+*  A CmpRegion, which cannot be rasterised a row at a time, combining
+*  the Box and Circle.
+      cmp = ast_cmpregion( box, cir, AST__OR, ' ', status )
+      n = nmaskpix( cmp, inmask, outmask, 'Mask cmpregion', status )
+      if( inmask( 20, 11 ) .ne. 1 ) call stopit( status, 'Mask 29' )
+      if( inmask( 21, 12 ) .ne. 1 ) call stopit( status, 'Mask 30' )
+      if( inmask( 5, 4 ) + outmask( 5, 4 ) .ne. 0 )
+     :   call stopit( status, 'Mask 31' )
+      if( outmask( 21, 4 ) .ne. 1 ) call stopit( status, 'Mask 32' )
+
+      call ast_end( status )
+
+      end
+
+
+
+*  Masks the inside and then the outside of a Region on a 40x30 grid of
+*  pixels, and checks that the masked pixels are exactly those that
+*  astResample<X> would mask, using the Transform method of the Region
+*  (and of its negation) to decide if each pixel centre is inside.
+*  Returns the number of pixels masked when masking the inside. On exit,
+*  "inmask" and "outmask" hold 1 for each pixel that was masked when
+*  masking the inside and outside respectively, and 0 elsewhere.
+      integer function nmaskpix( reg, inmask, outmask, text, status )
+      implicit none
+      include 'AST_PAR'
+      include 'SAE_PAR'
+
+      integer reg, inmask(40,30), outmask(40,30), status, i, j, k, n,
+     :        m, nin, nout, neg
+      integer lbnd(2), ubnd(2)
+      double precision pin(1200,2), pout(1200,2), qout(1200,2)
+      character text*(*)
+
+      nmaskpix = 0
+      if( status .ne.sai__ok ) return
+
+      lbnd(1) = 1
+      lbnd(2) = 1
+      ubnd(1) = 40
+      ubnd(2) = 30
+
+      k = 0
+      do j = 1, 30
+         do i = 1, 40
+            k = k + 1
+            pin( k, 1 ) = i
+            pin( k, 2 ) = j
+            inmask( i, j ) = 0
+            outmask( i, j ) = 0
+         end do
+      end do
+
+      neg = ast_copy( reg, status )
+      call ast_negate( neg, status )
+      call ast_trann( reg, 1200, 2, 1200, pin, .true., 2, 1200, pout,
+     :                status )
+      call ast_trann( neg, 1200, 2, 1200, pin, .true., 2, 1200, qout,
+     :                status )
+      call ast_annul( neg, status )
+
+      nin = ast_maski( reg, AST__NULL, .true., 2, lbnd, ubnd, inmask,
+     :                 1, status )
+      nout = ast_maski( reg, AST__NULL, .false., 2, lbnd, ubnd,
+     :                  outmask, 1, status )
+
+      n = 0
+      m = 0
+      k = 0
+      do j = 1, 30
+         do i = 1, 40
+            k = k + 1
+            if( qout( k, 1 ) .eq. AST__BAD ) then
+               n = n + 1
+               if( inmask( i, j ) .ne. 1 ) then
+                  write(*,*) text,': pixel ',i,j,' should be masked'
+                  call stopit( status, 'Mask A' )
+               end if
+            else if( inmask( i, j ) .ne. 0 ) then
+               write(*,*) text,': pixel ',i,j,' should not be masked'
+               call stopit( status, 'Mask B' )
+            end if
+
+            if( pout( k, 1 ) .eq. AST__BAD ) then
+               m = m + 1
+               if( outmask( i, j ) .ne. 1 ) then
+                  write(*,*) text,': pixel ',i,j,' should be masked'
+                  call stopit( status, 'Mask C' )
+               end if
+            else if( outmask( i, j ) .ne. 0 ) then
+               write(*,*) text,': pixel ',i,j,' should not be masked'
+               call stopit( status, 'Mask D' )
+            end if
+         end do
+      end do
+
+      if( nin .ne. n ) then
+         write(*,*) text,': ',nin,' pixels masked, should be ',n
+         call stopit( status, 'Mask E' )
+      else if( nout .ne. m ) then
+         write(*,*) text,': ',nout,' pixels masked, should be ',m
+         call stopit( status, 'Mask F' )
+      end if
+
+      nmaskpix = nin
+
+      end
+
+
+
+      subroutine checkPolyIndex( status )
+      implicit none
+      include 'AST_PAR'
+      include 'SAE_PAR'
+
+      integer status, frm, pol, i, k, n, ia
+      double precision v(40,2), pin(20000,2), tol, ymin, ymax, w, r,
+     :                 ang, len
+
+      if( status .ne.sai__ok ) return
+
+      call ast_begin( status )
+
+*  A concave star-shaped Polygon with 40 vertices on integer
+*  coordinates, in a simple Frame so that the Polygon uses an index of
+*  the edges crossing each horizontal slab.
+      do i = 1, 40
+         ang = ( i - 1 )*acos( -1.0D0 )/20.0D0
+         if( mod( i, 2 ) .eq. 1 ) then
+            r = 20.0D0
+         else
+            r = 8.0D0
+         end if
+         v( i, 1 ) = nint( r*cos( ang ) )
+         v( i, 2 ) = nint( r*sin( ang ) )
+      end do
+
+      frm = ast_frame( 2, ' ', status )
+      pol = ast_polygon( frm, 40, 40, v, AST__NULL, ' ', status )
+
+*  Test points: the vertices, the edge mid-points, a grid of points
+*  every half pixel (many of which are on edges), and rows of points just
+*  above and below each vertex, where edges start and end.
+      n = 0
+      ia = 40
+      do i = 1, 40
+         n = n + 1
+         pin( n, 1 ) = v( i, 1 )
+         pin( n, 2 ) = v( i, 2 )
+         n = n + 1
+         pin( n, 1 ) = 0.5D0*( v( i, 1 ) + v( ia, 1 ) )
+         pin( n, 2 ) = 0.5D0*( v( i, 2 ) + v( ia, 2 ) )
+         ia = i
+      end do
+
+      do k = -44, 44
+         do i = -44, 44
+            n = n + 1
+            pin( n, 1 ) = 0.5D0*i
+            pin( n, 2 ) = 0.5D0*k
+         end do
+      end do
+
+      do k = -20, 20
+         do i = -44, 44
+            n = n + 1
+            pin( n, 1 ) = 0.5D0*i
+            pin( n, 2 ) = k - 1.0D-3
+            n = n + 1
+            pin( n, 1 ) = 0.5D0*i
+            pin( n, 2 ) = k + 1.0D-3
+         end do
+      end do
+
+*  Also use rows of points on the boundaries between the slabs of the
+*  index, assuming one slab per edge. The slabs span the vertices
+*  extended by the tolerance used when testing if a point is on an edge.
+      ymin = 1.0D30
+      ymax = -1.0D30
+      ia = 40
+      do i = 1, 40
+         len = sqrt( ( v( i, 1 ) - v( ia, 1 ) )**2 +
+     :               ( v( i, 2 ) - v( ia, 2 ) )**2 )
+         tol = 1.0D-7*len
+         ymin = min( ymin, min( v( i, 2 ), v( ia, 2 ) ) - tol )
+         ymax = max( ymax, max( v( i, 2 ), v( ia, 2 ) ) + tol )
+         ia = i
+      end do
+      w = ( ymax - ymin )/40
+
+      do k = 0, 40
+         do i = -44, 44
+            n = n + 1
+            pin( n, 1 ) = 0.5D0*i
+            pin( n, 2 ) = ymin + k*w
+         end do
+      end do
+
+*  Check the points, and then check them again after each change to the
+*  Polygon, which must cause the index to be re-created.
+      call polyIndexPoints( pol, 40, v, n, pin, .false., .true.,
+     :                      'PolyIndex 1', status )
+
+      call ast_negate( pol, status )
+      call polyIndexPoints( pol, 40, v, n, pin, .true., .true.,
+     :                      'PolyIndex 2', status )
+
+      call ast_setl( pol, 'Closed', .false., status )
+      call polyIndexPoints( pol, 40, v, n, pin, .true., .false.,
+     :                      'PolyIndex 3', status )
+
+      call ast_negate( pol, status )
+      call polyIndexPoints( pol, 40, v, n, pin, .false., .false.,
+     :                      'PolyIndex 4', status )
+
+      call ast_clear( pol, 'Closed', status )
+      call polyIndexPoints( pol, 40, v, n, pin, .false., .true.,
+     :                      'PolyIndex 5', status )
+
+      call ast_end( status )
+
+      end
+
+
+
+*  Transforms a set of points using a Polygon, and checks that each
+*  point is inside or outside the Polygon as expected, using a
+*  separate test based on counting crossings of a ray towards plus
+*  infinity on the first axis. Points that are very close to, but not
+*  on, an edge are not checked.
+      subroutine polyIndexPoints( pol, nv, v, n, pin, negated, closed,
+     :                            text, status )
+      implicit none
+      include 'AST_PAR'
+      include 'SAE_PAR'
+
+      integer pol, nv, n, status, i, j, ia, ncross, pos
+      double precision v(nv,2), pin(n,2), pout(20000,2), xa, ya, xb, yb,
+     :                 x, y, cross, len
+      logical negated, closed, good
+      character text*(*)
+
+      if( status .ne.sai__ok ) return
+
+      call ast_trann( pol, n, 2, n, pin, .true., 2, 20000, pout,
+     :                status )
+
+      do j = 1, n
+         x = pin( j, 1 )
+         y = pin( j, 2 )
+
+*  Find the position of the point: 1 if inside, 0 if on an edge, -1 if
+*  outside, and 2 if too close to an edge to be checked.
+         pos = 1
+         ncross = 0
+         ia = nv
+         do i = 1, nv
+            xa = v( ia, 1 )
+            ya = v( ia, 2 )
+            xb = v( i, 1 )
+            yb = v( i, 2 )
+            cross = ( xb - xa )*( y - ya ) - ( yb - ya )*( x - xa )
+            len = sqrt( ( xb - xa )**2 + ( yb - ya )**2 )
+            if( x .ge. min( xa, xb ) - 1.0D-4 .and.
+     :          x .le. max( xa, xb ) + 1.0D-4 .and.
+     :          y .ge. min( ya, yb ) - 1.0D-4 .and.
+     :          y .le. max( ya, yb ) + 1.0D-4 ) then
+               if( cross .eq. 0.0D0 .and. pos .ne. 2 ) then
+                  pos = 0
+               else if( abs( cross ) .lt. 1.0D-4*len ) then
+                  pos = 2
+               end if
+            end if
+            if( ( ya .gt. y ) .neqv. ( yb .gt. y ) ) then
+               if( x .lt. xa + ( y - ya )*( xb - xa )/( yb - ya ) ) then
+                  ncross = ncross + 1
+               end if
+            end if
+            ia = i
+         end do
+
+         if( pos .eq. 1 .and. mod( ncross, 2 ) .eq. 0 ) pos = -1
+
+         if( pos .ne. 2 ) then
+            if( pos .eq. 0 ) then
+               good = closed
+            else
+               good = ( ( pos .eq. 1 ) .neqv. negated )
+            end if
+
+            if( good .neqv. ( pout( j, 1 ) .ne. AST__BAD ) ) then
+               write(*,*) text,': point (',x,',',y,') position ',pos,
+     :                    ' result ',pout( j, 1 )
+               call stopit( status, text )
+               return
+            end if
+         end if
+      end do
+
+      end
+
+
+
       subroutine stopit( status, text )
       implicit none
       include 'SAE_PAR'
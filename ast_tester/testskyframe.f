@@ -3,8 +3,18 @@
       include 'SAE_PAR'
       include 'AST_PAR'
 
-      integer status, sf1, sf2, fs
-      double precision vals(5)
+      integer status, sf1, sf2, fs, sm, sm1, i, j
+      double precision vals(5), ra(10), dec(10), ra1(10),
+     :                 dec1(10), ra2(10), dec2(10), ra3(300),
+     :                 dec3(300), ra4(300), dec4(300), aargs(2)
+      character cvt(4)*5
+      integer narg(4)
+      double precision cargs(2,4)
+
+      data cvt / 'GALEQ', 'PREC', 'EQECL', 'HFK5Z' /
+      data narg / 0, 2, 1, 1 /
+      data cargs / 0.0D0, 0.0D0, 2000.0D0, 2010.0D0, 55000.0D0, 0.0D0,
+     :             2005.0D0, 0.0D0 /
 
       status = sai__ok
 
@@ -66,6 +76,75 @@
          call stopit( status, 'Error 6' )
       end if
 
+*  An SlaMap holding several adjacent rotations should give the same
+*  results as applying each rotation separately.
+      sm = ast_slamap( 0, ' ', status )
+      do j = 1, 4
+         call ast_slaadd( sm, cvt( j ), narg( j ), cargs( 1, j ),
+     :                    status )
+      end do
+
+      do i = 1, 10
+         ra( i ) = 0.6D0*i
+         dec( i ) = -1.5D0 + 0.3D0*i
+         ra1( i ) = ra( i )
+         dec1( i ) = dec( i )
+      end do
+
+      do j = 1, 4
+         sm1 = ast_slamap( 0, ' ', status )
+         call ast_slaadd( sm1, cvt( j ), narg( j ), cargs( 1, j ),
+     :                    status )
+         call ast_tran2( sm1, 10, ra1, dec1, .TRUE., ra1, dec1,
+     :                   status )
+      end do
+
+      call ast_tran2( sm, 10, ra, dec, .TRUE., ra2, dec2, status )
+      do i = 1, 10
+         if( abs( ra2( i ) - ra1( i ) ) .gt. 1.0D-12 .or.
+     :       abs( dec2( i ) - dec1( i ) ) .gt. 1.0D-12 ) then
+            call stopit( status, 'Error 7' )
+         end if
+      end do
+
+      call ast_tran2( sm, 10, ra2, dec2, .FALSE., ra1, dec1, status )
+      do i = 1, 10
+         if( abs( ra( i ) - ra1( i ) ) .gt. 1.0D-8 .or.
+     :       abs( dec( i ) - dec1( i ) ) .gt. 1.0D-8 ) then
+            call stopit( status, 'Error 8' )
+         end if
+      end do
+
+*  Converting more than one block of positions from apparent to mean
+*  place and back again should reproduce the original positions, and
+*  bad values should be returned for bad positions.
+      sm = ast_slamap( 0, ' ', status )
+      aargs( 1 ) = 2000.0D0
+      aargs( 2 ) = 58000.3D0
+      call ast_slaadd( sm, 'AMP', 2, aargs, status )
+
+      do i = 1, 300
+         ra3( i ) = 0.02D0*i
+         dec3( i ) = -1.5D0 + 0.01D0*i
+      end do
+      dec3( 150 ) = AST__BAD
+
+      call ast_tran2( sm, 300, ra3, dec3, .TRUE., ra4, dec4, status )
+      if( ra4( 150 ) .ne. AST__BAD .or.
+     :    dec4( 150 ) .ne. AST__BAD ) then
+         call stopit( status, 'Error 9' )
+      end if
+
+      call ast_tran2( sm, 300, ra4, dec4, .FALSE., ra4, dec4, status )
+      do i = 1, 300
+         if( i .ne. 150 ) then
+            if( abs( ra3( i ) - ra4( i ) ) .gt. 1.0D-9 .or.
+     :          abs( dec3( i ) - dec4( i ) ) .gt. 1.0D-9 ) then
+               call stopit( status, 'Error 10' )
+            end if
+         end if
+      end do
+
       if( status .eq. sai__ok ) then
          write(*,*) 'All SkyFrame tests passed'
       else
@@ -4,9 +4,15 @@
       include 'AST_PAR'
       include 'AST_ERR'
 
-      character txt*40
-      double precision xin, xout, xout2, ct, ctl, origin
-      integer status, tf, tf1, tf2, fs, n, chr_len, nc
+      character txt*40, buf*80
+      double precision xin, xout, xout2, ct, ctl, origin, targs(2),
+     :                 utc(6), tai(6), dat(6), utc2(6), tt(200),
+     :                 tdb1(200), tdb2(200), dargs(5)
+      integer status, tf, tf1, tf2, fs, n, chr_len, nc, tm, i, oldval
+
+      data utc / 38000.0D0, 41400.0D0, 57000.0D0, 57800.0D0,
+     :           62501.5D0, 62503.0D0 /
+      data dat / 0.0D0, 10.0D0, 35.0D0, 37.0D0, 37.0D0, 38.0D0 /
       status = sai__ok
 
       call ast_begin( status )
@@ -787,6 +793,144 @@ c
       end if
 
 
+* Test leap seconds, including those read from a file. Converting UTC
+* to TAI and back again should reproduce the original UTC, even before
+* 1972 when TAI-UTC varied continuously.
+      tm = ast_timemap( 0, ' ', status )
+      targs( 1 ) = 0.0D0
+      targs( 2 ) = AST__BAD
+      call ast_timeadd( tm, 'UTCTOTAI', 2, targs, status )
+
+      call ast_tran1( tm, 6, utc, .true., tai, status )
+      call ast_tran1( tm, 6, tai, .false., utc2, status )
+      do i = 1, 6
+         if( abs( utc2( i ) - utc( i ) )*86400.0D0 .gt. 1.0D-5 ) then
+            write(*,*) i, utc2( i )
+            call stopit( status, 'error 59' )
+         end if
+      end do
+
+      do i = 2, 5
+         if( abs( ( tai( i ) - utc( i ) )*86400.0D0 - dat( i ) )
+     :       .gt. 1.0D-5 ) then
+            write(*,*) i, tai( i )
+            call stopit( status, 'error 60' )
+         end if
+      end do
+
+      open( unit=10, file='leaptest.dat', status='unknown' )
+      write( 10, '(A)' ) '#  MJD        Date        TAI-UTC (s)'
+      write( 10, '(A)' ) '    57204.0    1  7 2015       36'
+      write( 10, '(A)' ) '    57754.0    1  1 2017       37'
+      write( 10, '(A)' ) '    62502.0    1  1 2030       38'
+      close( 10 )
+
+      call ast_tunec( 'LeapFile', 'leaptest.dat', buf, status )
+      call ast_tran1( tm, 6, utc, .true., tai, status )
+      open( unit=10, file='leaptest.dat', status='old' )
+      close( 10, status='delete' )
+      do i = 2, 6
+         if( abs( ( tai( i ) - utc( i ) )*86400.0D0 - dat( i ) )
+     :       .gt. 1.0D-5 ) then
+            write(*,*) i, tai( i )
+            call stopit( status, 'error 61' )
+         end if
+      end do
+
+      call ast_tran1( tm, 6, tai, .false., utc2, status )
+      do i = 1, 6
+         if( abs( utc2( i ) - utc( i ) )*86400.0D0 .gt. 1.0D-5 ) then
+            write(*,*) i, utc2( i )
+            call stopit( status, 'error 62' )
+         end if
+      end do
+
+      call ast_tunec( 'LeapFile', ' ', buf, status )
+      if( buf .ne. 'leaptest.dat' ) then
+         write(*,*) buf
+         call stopit( status, 'error 63' )
+      end if
+
+      call ast_tran1( tm, 1, utc( 6 ), .true., xout, status )
+      if( abs( ( xout - utc( 6 ) )*86400.0D0 - 37.0D0 )
+     :    .gt. 1.0D-5 ) then
+         write(*,*) xout
+         call stopit( status, 'error 64' )
+      end if
+
+* Check that a leap second file that cannot be read is reported once,
+* and is not read again until the LeapFile tuning parameter is set.
+      call ast_tunec( 'LeapFile', 'leaptest.dat', buf, status )
+      if( status .eq. sai__ok ) then
+         call err_mark
+         call ast_tran1( tm, 1, utc( 6 ), .true., xout, status )
+         if( status .eq. AST__RDERR ) then
+            call err_annul( status )
+         else
+            call stopit( status, 'error 65' )
+         end if
+         call err_rlse
+      end if
+
+      open( unit=10, file='leaptest.dat', status='unknown' )
+      write( 10, '(A)' ) '    57754.0    1  1 2017       37'
+      write( 10, '(A)' ) '    62502.0    1  1 2030       38'
+      close( 10 )
+
+      call ast_tran1( tm, 1, utc( 6 ), .true., xout, status )
+      if( abs( ( xout - utc( 6 ) )*86400.0D0 - 37.0D0 )
+     :    .gt. 1.0D-5 ) then
+         write(*,*) xout
+         call stopit( status, 'error 66' )
+      end if
+
+      call ast_tunec( 'LeapFile', 'leaptest.dat', buf, status )
+      call ast_tran1( tm, 1, utc( 6 ), .true., xout, status )
+      if( abs( ( xout - utc( 6 ) )*86400.0D0 - 38.0D0 )
+     :    .gt. 1.0D-5 ) then
+         write(*,*) xout
+         call stopit( status, 'error 67' )
+      end if
+
+      open( unit=10, file='leaptest.dat', status='old' )
+      close( 10, status='delete' )
+      call ast_tunec( 'LeapFile', ' ', buf, status )
+
+* Test the interpolation of TDB-TT for a densely sampled time series. The
+* times are offsets in days from the MJD given by the first argument.
+      tm = ast_timemap( 0, ' ', status )
+      dargs( 1 ) = 58000.3D0
+      dargs( 2 ) = -0.3D0
+      dargs( 3 ) = 0.6D0
+      dargs( 4 ) = 100.0D0
+      dargs( 5 ) = AST__BAD
+      call ast_timeadd( tm, 'TTTOTDB', 5, dargs, status )
+
+      do i = 1, 200
+         tt( i ) = 0.01D0*i
+      end do
+      tt( 50 ) = AST__BAD
+
+      call ast_tran1( tm, 200, tt, .true., tdb1, status )
+      oldval = ast_tune( 'TDBInterp', 1, status )
+      if( oldval .ne. 0 ) call stopit( status, 'error 68' )
+      call ast_tran1( tm, 200, tt, .true., tdb2, status )
+      oldval = ast_tune( 'TDBInterp', 0, status )
+      if( oldval .ne. 1 ) call stopit( status, 'error 69' )
+
+      do i = 1, 200
+         if( i .eq. 50 ) then
+            if( tdb2( i ) .ne. AST__BAD ) then
+               call stopit( status, 'error 70' )
+            end if
+         else if( abs( tdb1( i ) - tdb2( i ) )*86400.0D0 .gt.
+     :            1.0D-10 ) then
+            write(*,*) i, tdb1( i ), tdb2( i )
+            call stopit( status, 'error 71' )
+         end if
+      end do
+
+
 
 
 
@@ -0,0 +1,115 @@
+#include "ast.h"
+#include <stdio.h>
+
+/* An error handler that discards the expected error messages. */
+static void quietPutErr( int status_value, const char *message ){
+}
+
+/* Compare astTranI with astTranN for "npoint" points, using Mapping
+   "map" with "nin" inputs and "nout" outputs. Some input values are
+   bad. If "inplace" is non-zero, astTranI transforms the interleaved
+   coordinates in place (this requires "nin" to equal "nout"). */
+static void check( AstMapping *map, int npoint, int nin, int nout,
+                   int forward, int inplace, int ierr ){
+   double *inn;
+   double *ini;
+   double *outn;
+   double *outi;
+   int coord;
+   int point;
+
+   if( !astOK ) return;
+
+   inn = astMalloc( sizeof( double )*npoint*nin );
+   ini = astMalloc( sizeof( double )*npoint*( nin > nout ? nin : nout ) );
+   outn = astMalloc( sizeof( double )*npoint*nout );
+   outi = inplace ? ini : astMalloc( sizeof( double )*npoint*nout );
+
+   if( astOK ) {
+
+/* Store the input coordinates in separate rows for astTranN, and
+   interleaved for astTranI. Make some values bad, including values at
+   the end of the first block of 1024 points and the start of the
+   second. */
+      for( point = 0; point < npoint; point++ ) {
+         for( coord = 0; coord < nin; coord++ ) {
+            if( point % 97 == 3 || point == 1023 || point == 1024 ) {
+               inn[ coord*npoint + point ] = ( coord == point % nin ) ?
+                                             AST__BAD : 0.5;
+            } else {
+               inn[ coord*npoint + point ] = 0.001*( point + 1 ) + 0.3*coord;
+            }
+            ini[ point*nin + coord ] = inn[ coord*npoint + point ];
+         }
+      }
+
+      astTranN( map, npoint, nin, npoint, inn, forward, nout, npoint, outn );
+      astTranI( map, npoint, nin, ini, forward, nout, outi );
+
+      for( point = 0; point < npoint && astOK; point++ ) {
+         for( coord = 0; coord < nout && astOK; coord++ ) {
+            if( outi[ point*nout + coord ] != outn[ coord*npoint + point ] ) {
+               astError( AST__INTER, "Error %d: point %d, coord %d: %.17g "
+                         "!= %.17g\n", ierr, point, coord,
+                         outi[ point*nout + coord ],
+                         outn[ coord*npoint + point ] );
+            }
+         }
+      }
+   }
+
+   inn = astFree( inn );
+   ini = astFree( ini );
+   outn = astFree( outn );
+   if( !inplace ) outi = astFree( outi );
+}
+
+int main(){
+   AstMapping *rmap;
+   AstMapping *smap;
+   double mat[ 9 ] = { 0.8, 0.6, 0.0, -0.6, 0.8, 0.0, 0.0, 0.0, 2.0 };
+   double shift[ 3 ] = { 1.0, -2.0, 0.5 };
+   double in[ 3 ] = { 1.0, 2.0, 3.0 };
+   double out[ 2 ];
+   int i;
+   int npoint[ 6 ] = { 1, 1023, 1024, 1025, 2048, 2049 };
+
+   astBegin;
+
+/* A Mapping with 3 inputs and 2 outputs, and a Mapping with 3 inputs and
+   3 outputs. */
+   rmap = (AstMapping *) astCmpMap( astShiftMap( 3, shift, " " ),
+                                    astMatrixMap( 3, 3, 0, mat, " " ), 1,
+                                    " " );
+   smap = (AstMapping *) astCmpMap( rmap, astSphMap( " " ), 1, " " );
+
+/* Check points either side of the block boundary, transforming out of
+   place with the non-square Mapping, and in place with the square
+   Mapping. */
+   for( i = 0; i < 6; i++ ) {
+      check( smap, npoint[ i ], 3, 2, 1, 0, 10 + i );
+      check( smap, npoint[ i ], 2, 3, 0, 0, 20 + i );
+      check( rmap, npoint[ i ], 3, 3, 1, 1, 30 + i );
+      check( rmap, npoint[ i ], 3, 3, 0, 1, 40 + i );
+   }
+
+/* Check that no points are rejected in the same way as astTranN. */
+   if( astOK ) {
+      astSetPutErr( quietPutErr );
+      astTranI( smap, 0, 3, in, 1, 2, out );
+      astSetPutErr( NULL );
+      if( astStatus == AST__NPTIN ) {
+         astClearStatus;
+      } else if( astOK ) {
+         astError( AST__INTER, "Error 1\n" );
+      }
+   }
+
+   astEnd;
+
+   if( astOK ) {
+      printf(" All TranI tests passed\n");
+   } else {
+      printf("TranI tests failed\n");
+   }
+}
@@ -107,6 +107,8 @@ f     The Box class does not define any new routines beyond those
 *        Remove the unused box shrinking facility (a hang over from the
 *        days when the RegBaseGrid function operated by creating multiple
 *        meshes on the surface of the box, shrinking the box each time).
+*     17-OCT-2026 (DSB):
+*        Added RegScan.
 *class--
 */
 
@@ -223,6 +225,7 @@ static int GetObjSize( AstObject *, int * );
 static int MakeGrid( int, double **, int, double *, double *, int *, int, int, double, int * );
 static int MapMerge( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
 static int RegPins( AstRegion *, AstPointSet *, AstRegion *, int **, int * );
+static int RegScan( AstRegion *, double, int *, double **, int * );
 static int RegTrace( AstRegion *, int, double *, double **, int * );
 static void BoxPoints( AstBox *, double *, double *, int *);
 static void Cache( AstBox *, int, int * );
@@ -1246,6 +1249,7 @@ void astInitBoxVtab_(  AstBoxVtab *vtab, const char *name, int *status ) {
    region->RegBasePick = RegBasePick;
    region->RegBaseBox = RegBaseBox;
    region->RegPins = RegPins;
+   region->RegScan = RegScan;
    region->RegTrace = RegTrace;
    region->RegCentre = RegCentre;
 
@@ -3209,6 +3213,132 @@ static int RegPins( AstRegion *this_region, AstPointSet *pset, AstRegion *unc,
    return result;
 }
 
+static int RegScan( AstRegion *this_region, double y, int *nx, double **x,
+                    int *status ){
+/*
+*+
+*  Name:
+*     RegScan
+
+*  Purpose:
+*     Find where a row of constant Y crosses the boundary of a 2D Region.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "box.h"
+*     int RegScan( AstRegion *this, double y, int *nx, double **x,
+*                  int *status )
+
+*  Class Membership:
+*     Box member function (overrides the astRegScan method
+*     inherited from the parent Region class).
+
+*  Description:
+*     This function finds the places at which a line of constant value
+*     on the second axis of the base Frame of the supplied 2-dimensional
+*     Region crosses the boundary of the Region. Each crossing is
+*     returned as an interval along the first base Frame axis that is
+*     guaranteed to contain the crossing. See the description of
+*     astRegScan in the parent Region class for further details.
+*
+*     Only Boxes defined within a simple 2-dimensional Frame are
+*     supported.
+
+*  Parameters:
+*     this
+*        Pointer to the Region.
+*     y
+*        The value on the second base Frame axis at which the crossings
+*        are required. If this is AST__BAD, the function returns
+*        without action (but the returned function value still
+*        indicates if the method is supported or not).
+*     nx
+*        Pointer to an int in which to return the number of intervals.
+*     x
+*        Address of a pointer to an array in which to return the lower
+*        and upper bounds of each interval. The array is extended if
+*        necessary using astGrow.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Non-zero if the crossings can be found, and zero otherwise.
+
+*-
+*/
+
+/* Local Variables; */
+   AstBox *this;
+   AstFrame *frm;
+   const char *class;
+   double *hi;
+   double *lo;
+   int result;
+
+/* Initialise */
+   result = 0;
+
+/* Check inherited status. */
+   if( ! astOK ) return result;
+
+/* Get a pointer to the base Frame in the encapsulated FrameSet. Check it
+   is a simple 2-dimensional Frame, so that the axes are not cyclic. */
+   frm = astGetFrame( this_region->frameset, AST__BASE );
+   class = astGetClass( frm );
+   if( astGetNaxes( frm ) == 2 && class && !strcmp( class, "Frame" ) ) {
+      result = 1;
+   }
+   frm = astAnnul( frm );
+
+/* Check we have a row to scan. */
+   if( result && y != AST__BAD ) {
+
+/* Get a pointer to the Box structure. */
+      this = (AstBox *) this_region;
+
+/* Ensure cached information is available, including the limits used by
+   the Transform method. */
+      Cache( this, 1, status );
+      lo = this->lo;
+      hi = this->hi;
+
+/* Rows that do not come within one unit of the box have no crossings. */
+      *nx = 0;
+      if( astOK && y >= lo[ 1 ] - 1.0 && y <= hi[ 1 ] + 1.0 ) {
+         *x = astGrow( *x, 4, sizeof( double ) );
+         if( astOK ) {
+
+/* For rows well inside the box, return an interval of half-width one
+   unit around each vertical edge. */
+            if( y > lo[ 1 ] + 1.0 && y < hi[ 1 ] - 1.0 ) {
+               (*x)[ 0 ] = lo[ 0 ] - 1.0;
+               (*x)[ 1 ] = lo[ 0 ] + 1.0;
+               (*x)[ 2 ] = hi[ 0 ] - 1.0;
+               (*x)[ 3 ] = hi[ 0 ] + 1.0;
+
+/* Rows close to a horizontal edge may be on the boundary along their
+   whole length, so return the same interval twice to cover the whole
+   edge without changing the parity of any point. */
+            } else {
+               (*x)[ 0 ] = lo[ 0 ] - 1.0;
+               (*x)[ 1 ] = hi[ 0 ] + 1.0;
+               (*x)[ 2 ] = lo[ 0 ] - 1.0;
+               (*x)[ 3 ] = hi[ 0 ] + 1.0;
+            }
+            *nx = 2;
+         }
+      }
+   }
+
+/* If an error occurred, return zero. */
+   if( !astOK ) result = 0;
+
+/* Return the result. */
+   return result;
+}
+
 static int RegTrace( AstRegion *this_region, int n, double *dist, double **ptr,
                      int *status ){
 /*
@@ -11,16 +11,11 @@
      for a ChebyMap:  if y = C.Tn(x)   then y' = n.C.Un-1(x)
 
      where Un-1(x) is the Chebyshev polynomial of the second kind, degree
-     (n-1), evaluated at x. Since PolyMap.GetJacobian function uses PolyMaps
-     to express the Jacobian of a PolyMap, it would need to use ChebyMaps
-     to express the Jacobian of a ChebyMap. But this would mean that
-     ChebyMap needs to be able to represent Chebyshev polynomials of the
-     second type. In fact the set of powers associated with each coefficient
-     would need to indicate somehow whether to use type 1 or type 2 for
-     each power. Could use negative powers to indicate type 2, but PolyMap.StoreArrays
-     objects to negative powers. StoreArrays could just store them
-     without checking, and then call a virtual function to verify the powers
-     are OK.
+     (n-1), evaluated at x. PolyMap.IterInverse evaluates the Jacobian
+     directly from the forward coefficients and powers assuming simple
+     powers of x, so it would need a virtual function that ChebyMap could
+     over-ride to evaluate the derivatives of the Chebyshev polynomials
+     instead.
 
      Simpler for the moment just to disable iterative inverses in
      ChebyMap.
@@ -130,6 +125,10 @@ f     - AST_CHEBYDOMAIN: Get the bounds of the domain of the ChebyMap
 *     30-MAR-2017 (DSB):
 *        Over-ride the astFitPoly1DInit and astFitPoly2DInit virtual
 *        functions inherited form the PolyMap class.
+*     17-OCT-2026 (DSB):
+*        Over-ride the astPolyBlock virtual function inherited from the
+*        PolyMap class, to evaluate Chebyshev polynomials for blocks of
+*        points.
 *class--
 */
 
@@ -180,6 +179,7 @@ static int class_check;
 static int (* parent_getobjsize)( AstObject *, int * );
 static int (* parent_equal)( AstObject *, AstObject *, int * );
 static void (* parent_polypowers)( AstPolyMap *, double **, int, const int *, double **, int, int, int * );
+static int (* parent_polyblock)( AstPolyMap *, AstPointSet *, AstPointSet *, int, int * );
 static AstPolyMap *(*parent_polytran)( AstPolyMap *, int, double, double, int, const double *, const double *, int * );
 
 
@@ -224,6 +224,7 @@ static AstPolyMap *PolyTran( AstPolyMap *, int, double, double, int, const doubl
 static int Equal( AstObject *, AstObject *, int * );
 static int GetIterInverse( AstPolyMap *, int * );
 static int GetObjSize( AstObject *, int * );
+static int PolyBlock( AstPolyMap *, AstPointSet *, AstPointSet *, int, int * );
 static void ChebyDomain( AstChebyMap *, int, double *, double *, int * );
 static void Copy( const AstObject *, AstObject *, int * );
 static void Delete( AstObject *obj, int * );
@@ -1027,6 +1028,9 @@ void astInitChebyMapVtab_(  AstChebyMapVtab *vtab, const char *name, int *status
    parent_polypowers = polymap->PolyPowers;
    polymap->PolyPowers = PolyPowers;
 
+   parent_polyblock = polymap->PolyBlock;
+   polymap->PolyBlock = PolyBlock;
+
    parent_polytran = polymap->PolyTran;
    polymap->PolyTran = PolyTran;
 
@@ -1056,6 +1060,261 @@ void astInitChebyMapVtab_(  AstChebyMapVtab *vtab, const char *name, int *status
    }
 }
 
+static int PolyBlock( AstPolyMap *this_polymap, AstPointSet *in,
+                      AstPointSet *out, int fwd, int *status ){
+/*
+*  Name:
+*     PolyBlock
+
+*  Purpose:
+*     Transform a set of points a block at a time.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "chebymap.h"
+*     int PolyBlock( AstPolyMap *this, AstPointSet *in, AstPointSet *out,
+*                    int fwd, int *status )
+
+*  Class Membership:
+*     ChebyMap member function (over-rides the astPolyBlock protected
+*     method inherited from the PolyMap class).
+
+*  Description:
+*     This function is used by astTransform to evaluate the polynomials
+*     of a transformation for blocks of points. If the transformation is
+*     defined by Chebyshev polynomials, the Chebyshev functions of every
+*     required degree are first found for all the points in a block,
+*     using the same recurrence relation as PolyPowers. Each term of each
+*     polynomial is then evaluated and summed for the whole block. The
+*     terms are summed in the same order as astTransform would use, so
+*     that the results are identical to those produced by evaluating the
+*     points one at a time. If the transformation is defined by standard
+*     polynomials, the parent method is used.
+
+*  Parameters:
+*     this
+*        Pointer to the ChebyMap.
+*     in
+*        Pointer to the PointSet holding the input positions.
+*     out
+*        Pointer to the PointSet in which to store the output positions.
+*     fwd
+*        Use the foward transformation of the ChebyMap? Otherwise, the
+*        inverse transformation is used.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Non-zero if the points were transformed. Zero if astTransform
+*     should transform the points one at a time instead.
+*/
+
+/* Local Variables: */
+   AstChebyMap *this;            /* Pointer to ChebyMap structure */
+   double **coeff;               /* Coefficients of each polynomial */
+   double **ptr_in;              /* Input axis values */
+   double **ptr_out;             /* Output axis values */
+   double **tcheb;               /* Chebyshev functions of each input */
+   double *offsets;              /* Offsets to normalise input values */
+   double *outval;               /* Output values for a block */
+   double *pi;                   /* Pointer to input axis values */
+   double *po;                   /* Pointer to output axis values */
+   double *scales;               /* Scales to normalise input values */
+   double *t;                    /* Pointer to Chebyshev functions */
+   double *t1;                   /* Degree one Chebyshev functions */
+   double *term;                 /* Value of a single term */
+   double *tn;                   /* Degree n Chebyshev functions */
+   double *work;                 /* Work space for a block of points */
+   double cof;                   /* Coefficient value */
+   double x;                     /* Normalised input axis value */
+   int ***power;                 /* Powers used by each coefficient */
+   int *bad;                     /* Flags for bad input values */
+   int *mxpow;                   /* Max power of each input axis */
+   int *ncoeff;                  /* No. of coefficients per output */
+   int *pbad;                    /* Pointer to bad input flags */
+   int *pow;                     /* Powers used by current coefficient */
+   int *used;                    /* Flags for inputs used by output */
+   int badcof;                   /* Bad coefficient found? */
+   int block;                    /* Index of first point in block */
+   int icoord;                   /* Input axis index */
+   int ico;                      /* Coefficient index */
+   int iout;                     /* Output axis index */
+   int ip;                       /* Degree index */
+   int k;                        /* Index of point within block */
+   int nb;                       /* No. of points in block */
+   int ncoord_in;                /* No. of inputs */
+   int ncoord_out;               /* No. of outputs */
+   int npoint;                   /* Total no. of points */
+   int ntcheb;                   /* Total no. of Chebyshev functions */
+   int result;                   /* Returned flag */
+
+/* Check the local error status. */
+   if ( !astOK ) return 0;
+
+/* Get a pointer to the ChebyMap structure. */
+   this = (AstChebyMap *) this_polymap;
+
+/* If the coefficients relate to a standard polynomial, then invoke the
+   astPolyBlock implementation of the parent class (PolyMap). */
+   scales = fwd ? this->scale_f : this->scale_i;
+   offsets = fwd ? this->offset_f : this->offset_i;
+   if( !scales ) return (*parent_polyblock)( this_polymap, in, out, fwd,
+                                             status );
+
+/* Get pointers to the arrays holding the required coefficient values
+   and powers. */
+   if( fwd ) {
+      ncoeff = this_polymap->ncoeff_f;
+      coeff = this_polymap->coeff_f;
+      power = this_polymap->power_f;
+      mxpow = this_polymap->mxpow_f;
+   } else {
+      ncoeff = this_polymap->ncoeff_i;
+      coeff = this_polymap->coeff_i;
+      power = this_polymap->power_i;
+      mxpow = this_polymap->mxpow_i;
+   }
+
+/* Get the number of points and axes, and pointers to the axis values. */
+   npoint = astGetNpoint( in );
+   ncoord_in = astGetNcoord( in );
+   ncoord_out = astGetNcoord( out );
+   ptr_in = astGetPoints( in );
+   ptr_out = astGetPoints( out );
+
+/* Find the total number of Chebyshev functions needed for each point,
+   including degree zero on each axis. */
+   ntcheb = 0;
+   if( astOK ) {
+      for( icoord = 0; icoord < ncoord_in; icoord++ ) {
+         ntcheb += mxpow[ icoord ] + 1;
+      }
+   }
+
+/* Allocate work space for a block of points. This holds the Chebyshev
+   functions of each input axis value, and the current term and output
+   value of a single polynomial. Also allocate arrays to flag bad input
+   axis values and the inputs used by each polynomial. */
+   work = astMalloc( sizeof( double )*AST__POLYMAP_BLOCK*( ntcheb + 2 ) );
+   tcheb = astMalloc( sizeof( double * )*ncoord_in );
+   bad = astMalloc( sizeof( int )*AST__POLYMAP_BLOCK*ncoord_in );
+   used = astMalloc( sizeof( int )*ncoord_in );
+
+   result = 0;
+   if( astOK ) {
+      result = 1;
+
+/* Partition the work space. Element "k" of row "ip" of array tcheb[icoord]
+   holds the Chebyshev function of degree "ip" for input axis "icoord"
+   at the k'th point in the block. */
+      t = work;
+      for( icoord = 0; icoord < ncoord_in; icoord++ ) {
+         tcheb[ icoord ] = t;
+         t += AST__POLYMAP_BLOCK*( mxpow[ icoord ] + 1 );
+      }
+      term = t;
+      outval = term + AST__POLYMAP_BLOCK;
+
+/* Loop round each block of points. */
+      for( block = 0; block < npoint; block += AST__POLYMAP_BLOCK ) {
+         nb = astMIN( AST__POLYMAP_BLOCK, npoint - block );
+
+/* Loop round each input axis. */
+         for( icoord = 0; icoord < ncoord_in; icoord++ ) {
+            t = tcheb[ icoord ];
+            pi = ptr_in[ icoord ] + block;
+            pbad = bad + icoord*AST__POLYMAP_BLOCK;
+            t1 = t + AST__POLYMAP_BLOCK;
+
+/* The Chebyshev function of degree zero is always 1.0. The Chebyshev
+   function of degree one is equal to the input axis value scaled and
+   shifted into the range [-1,+1]. Values that are bad or fall outside
+   the bounding box of the transformation are flagged and replaced with
+   zero. */
+            for( k = 0; k < nb; k++ ) {
+               t[ k ] = 1.0;
+               x = pi[ k ];
+               if( x != AST__BAD ) x = x*scales[ icoord ] + offsets[ icoord ];
+               pbad[ k ] = ( x == AST__BAD || fabs( x ) > 1.0 );
+               if( mxpow[ icoord ] > 0 ) t1[ k ] = pbad[ k ] ? 0.0 : x;
+            }
+
+/* Form the remaining Chebyshev functions using the standard recurrence
+   relation: Tn+1(x') = 2.x'.Tn(x') - Tn-1(x'). */
+            for( ip = 2; ip <= mxpow[ icoord ]; ip++ ) {
+               tn = t + ip*AST__POLYMAP_BLOCK;
+               for( k = 0; k < nb; k++ ) {
+                  tn[ k ] = 2.0*t1[ k ]*tn[ k - AST__POLYMAP_BLOCK ] -
+                            tn[ k - 2*AST__POLYMAP_BLOCK ];
+               }
+            }
+         }
+
+/* Loop round each output. */
+         for( iout = 0; iout < ncoord_out; iout++ ) {
+
+/* Initialise the output values, and the flags indicating which inputs
+   are used by the polynomial. */
+            for( k = 0; k < nb; k++ ) outval[ k ] = 0.0;
+            for( icoord = 0; icoord < ncoord_in; icoord++ ) used[ icoord ] = 0;
+
+/* Loop round all polynomial coefficients. A bad coefficient produces
+   bad output values. */
+            badcof = 0;
+            for( ico = 0; ico < ncoeff[ iout ]; ico++ ) {
+               cof = coeff[ iout ][ ico ];
+               if( cof == AST__BAD ) {
+                  badcof = 1;
+                  break;
+               }
+
+/* Evaluate the term for every point in the block, and add it onto the
+   output values. */
+               pow = power[ iout ][ ico ];
+               for( k = 0; k < nb; k++ ) term[ k ] = cof;
+               for( icoord = 0; icoord < ncoord_in; icoord++ ) {
+                  if( pow[ icoord ] > 0 ) {
+                     used[ icoord ] = 1;
+                     t = tcheb[ icoord ] + pow[ icoord ]*AST__POLYMAP_BLOCK;
+                     for( k = 0; k < nb; k++ ) term[ k ] *= t[ k ];
+                  }
+               }
+               for( k = 0; k < nb; k++ ) outval[ k ] += term[ k ];
+            }
+
+/* Flag output values that depend on any bad input value. */
+            if( badcof ) {
+               for( k = 0; k < nb; k++ ) outval[ k ] = AST__BAD;
+            } else {
+               for( icoord = 0; icoord < ncoord_in; icoord++ ) {
+                  if( used[ icoord ] ) {
+                     pbad = bad + icoord*AST__POLYMAP_BLOCK;
+                     for( k = 0; k < nb; k++ ) {
+                        if( pbad[ k ] ) outval[ k ] = AST__BAD;
+                     }
+                  }
+               }
+            }
+
+/* Store the output values. */
+            po = ptr_out[ iout ] + block;
+            for( k = 0; k < nb; k++ ) po[ k ] = outval[ k ];
+         }
+      }
+   }
+
+/* Free resources. */
+   work = astFree( work );
+   tcheb = astFree( tcheb );
+   bad = astFree( bad );
+   used = astFree( used );
+
+/* Return the result. */
+   return result;
+}
+
 static void PolyPowers( AstPolyMap *this_polymap, double **work, int ncoord,
                         const int *mxpow, double **ptr, int point, int fwd,
                         int *status ){
@@ -62,6 +62,8 @@ f     - AST_CIRCLEPARS: Get the geometric parameters of the Circle
 *        Modify RegPins so that it can handle uncertainty regions that straddle
 *        a discontinuity. Previously, such uncertainty Regions could have a huge
 *        bounding box resulting in matching region being far too big.
+*     17-OCT-2026 (DSB):
+*        Added RegScan.
 *class--
 */
 
@@ -159,6 +161,7 @@ static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *,
 static double *CircumPoint( AstFrame *, int, const double *, double, int * );
 static double *RegCentre( AstRegion *this, double *, double **, int, int, int * );
 static int RegPins( AstRegion *, AstPointSet *, AstRegion *, int **, int * );
+static int RegScan( AstRegion *, double, int *, double **, int * );
 static int RegTrace( AstRegion *, int, double *, double **, int * );
 static void Cache( AstCircle *, int * );
 static void CalcPars( AstFrame *, AstPointSet *, double *, double *, double *, int * );
@@ -729,6 +732,7 @@ void astInitCircleVtab_(  AstCircleVtab *vtab, const char *name, int *status ) {
    region->ResetCache = ResetCache;
 
    region->RegPins = RegPins;
+   region->RegScan = RegScan;
    region->RegTrace = RegTrace;
    region->RegBaseMesh = RegBaseMesh;
    region->RegBaseBox = RegBaseBox;
@@ -1539,6 +1543,127 @@ static int RegPins( AstRegion *this_region, AstPointSet *pset, AstRegion *unc,
    return result;
 }
 
+static int RegScan( AstRegion *this_region, double y, int *nx, double **x,
+                    int *status ){
+/*
+*+
+*  Name:
+*     RegScan
+
+*  Purpose:
+*     Find where a row of constant Y crosses the boundary of a 2D Region.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "circle.h"
+*     int RegScan( AstRegion *this, double y, int *nx, double **x,
+*                  int *status )
+
+*  Class Membership:
+*     Circle member function (overrides the astRegScan method
+*     inherited from the parent Region class).
+
+*  Description:
+*     This function finds the places at which a line of constant value
+*     on the second axis of the base Frame of the supplied 2-dimensional
+*     Region crosses the boundary of the Region. Each crossing is
+*     returned as an interval along the first base Frame axis that is
+*     guaranteed to contain the crossing. See the description of
+*     astRegScan in the parent Region class for further details.
+*
+*     Only Circles defined within a simple 2-dimensional Frame (in
+*     which plane geometry applies) are supported.
+
+*  Parameters:
+*     this
+*        Pointer to the Region.
+*     y
+*        The value on the second base Frame axis at which the crossings
+*        are required. If this is AST__BAD, the function returns
+*        without action (but the returned function value still
+*        indicates if the method is supported or not).
+*     nx
+*        Pointer to an int in which to return the number of intervals.
+*     x
+*        Address of a pointer to an array in which to return the lower
+*        and upper bounds of each interval. The array is extended if
+*        necessary using astGrow.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Non-zero if the crossings can be found, and zero otherwise.
+
+*-
+*/
+
+/* Local Variables; */
+   AstCircle *this;
+   AstFrame *frm;
+   const char *class;
+   double dy;
+   double h;
+   double h2;
+   int result;
+
+/* Initialise */
+   result = 0;
+
+/* Check inherited status. */
+   if( ! astOK ) return result;
+
+/* Get a pointer to the base Frame in the encapsulated FrameSet. Check it
+   is a simple 2-dimensional Frame, so that we can assume plane geometry. */
+   frm = astGetFrame( this_region->frameset, AST__BASE );
+   class = astGetClass( frm );
+   if( astGetNaxes( frm ) == 2 && class && !strcmp( class, "Frame" ) ) {
+      result = 1;
+   }
+   frm = astAnnul( frm );
+
+/* Check we have a row to scan. */
+   if( result && y != AST__BAD ) {
+
+/* Get a pointer to the Circle structure. */
+      this = (AstCircle *) this_region;
+
+/* Ensure cached information is available. */
+      Cache( this, status );
+
+/* Rows that do not come within one unit of the circle have no
+   crossings. */
+      *nx = 0;
+      dy = y - ( this->centre )[ 1 ];
+      if( fabs( dy ) <= this->radius + 1.0 && astOK ) {
+
+/* Find the half-length of the chord. Rows that just miss the circle are
+   given a zero-length chord so that the pixels near the tangent point
+   are tested individually. */
+         h2 = this->radius*this->radius - dy*dy;
+         h = ( h2 > 0.0 ) ? sqrt( h2 ) : 0.0;
+
+/* Return an interval of half-width one unit around each end of the
+   chord. */
+         *x = astGrow( *x, 4, sizeof( double ) );
+         if( astOK ) {
+            (*x)[ 0 ] = ( this->centre )[ 0 ] - h - 1.0;
+            (*x)[ 1 ] = ( this->centre )[ 0 ] - h + 1.0;
+            (*x)[ 2 ] = ( this->centre )[ 0 ] + h - 1.0;
+            (*x)[ 3 ] = ( this->centre )[ 0 ] + h + 1.0;
+            *nx = 2;
+         }
+      }
+   }
+
+/* If an error occurred, return zero. */
+   if( !astOK ) result = 0;
+
+/* Return the result. */
+   return result;
+}
+
 static int RegTrace( AstRegion *this_region, int n, double *dist, double **ptr,
                      int *status ){
 /*
@@ -152,6 +152,16 @@ f     The CmpMap class does not define any new routines beyond those
 *     23-APR-2015 (DSB):
 *        In Simplify, prevent mappings that are known to cause infinite
 *        loops from being nominated for simplification.
+*     17-OCT-2026 (DSB):
+*        In Equal, compare the series flags of the two CmpMaps rather
+*        than comparing the second CmpMap's flag with itself.
+*     17-OCT-2026 (DSB):
+*        In Transform, expand nested series CmpMaps into a single list of
+*        Mappings, fuse adjacent affine Mappings into a single matrix
+*        multiplication, and re-use work arrays for intermediate results.
+*     17-OCT-2026 (DSB):
+*        Retain the work space used by Transform within compiled CmpMaps
+*        (see astCompile).
 *class--
 */
 
@@ -162,6 +172,12 @@ f     The CmpMap class does not define any new routines beyond those
    "protected" symbols available. */
 #define astCLASS CmpMap
 
+/* Is a Mapping of a class that may implement an affine transformation
+   that can be fused with other affine transformations (see AffineTerms)? */
+#define AFFINE_CLASS(map) ( astIsAUnitMap(map) || astIsAZoomMap(map) || \
+                            astIsAShiftMap(map) || astIsAWinMap(map) || \
+                            astIsAMatrixMap(map) || astIsAPermMap(map) )
+
 /* Include files. */
 /* ============== */
 /* Interface definitions. */
@@ -175,6 +191,10 @@ f     The CmpMap class does not define any new routines beyond those
 #include "channel.h"             /* I/O channels */
 #include "permmap.h"             /* Coordinate permutation Mappings */
 #include "unitmap.h"             /* Unit transformations */
+#include "matrixmap.h"           /* Matrix transformations */
+#include "shiftmap.h"            /* Shifts of origin */
+#include "winmap.h"              /* Shifts and scalings on each axis */
+#include "zoommap.h"             /* Uniform scalings */
 #include "cmpmap.h"              /* Interface definition for this class */
 #include "frameset.h"            /* Interface definition for FrameSets */
 #include "globals.h"             /* Thread-safe global data access */
@@ -190,6 +210,47 @@ f     The CmpMap class does not define any new routines beyond those
 #include <string.h>
 #include <stdio.h>
 
+/* Type definitions. */
+/* ================= */
+
+/* A structure that describes one step in the sequence of transformations
+   used to apply a series CmpMap. A step either applies a single component
+   Mapping using its own astTransform method, or applies an affine
+   transformation formed by fusing together several adjacent component
+   Mappings. The affine transformation is "out = matrix*(in + shift) +
+   offset". Keeping any initial shifts separate from the offset means
+   that, as with the original components, the shift is applied before
+   any scaling, thus avoiding loss of precision. */
+typedef struct TranStep {
+   AstMapping *map;   /* Component Mapping (NULL for a fused step) */
+   int forward;       /* "forward" value to pass to astTransform */
+   int nin;           /* No. of input coordinates */
+   int nout;          /* No. of output coordinates */
+   double *shift;     /* nin offsets added to the inputs (or NULL) */
+   double *matrix;    /* nout*nin matrix elements (fused step only) */
+   double *offset;    /* nout offsets, AST__BAD if always bad (fused step) */
+   char *depend;      /* nout*nin flags: output depends on input? */
+} TranStep;
+
+/* A structure that holds the work space used to transform points with a
+   CmpMap. A local structure is used on each invocation of the Transform
+   function, unless the CmpMap has been compiled (see astCompile), in
+   which case a dynamically allocated structure is retained within the
+   CmpMap and re-used. */
+typedef struct TranCache {
+   TranStep *plan;          /* Plan for a series CmpMap (or NULL) */
+   int nstep;               /* Number of steps in plan */
+   int forward1;            /* Direction used for first component */
+   int forward2;            /* Direction used for second component */
+   int nb;                  /* No. of points each work array can hold */
+   double *work[ 2 ];       /* Work arrays for intermediate values */
+   double **rows[ 2 ];      /* Pointers to rows of each work array */
+   double **inrows;         /* Pointers to batch input values */
+   double **outrows;        /* Pointers to batch output values */
+   AstPointSet *wrap[ 4 ];  /* PointSets describing coordinate arrays */
+   int dynamic;             /* Was the structure dynamically allocated? */
+} TranCache;
+
 /* Module Variables. */
 /* ================= */
 
@@ -254,17 +315,26 @@ AstCmpMap *astCmpMapId_( void *, void *, int, const char *, ... );
 static AstMapping *CombineMaps( AstMapping *, int, AstMapping *, int, int, int * );
 static AstMapping *RemoveRegions( AstMapping *, int * );
 static AstMapping *Simplify( AstMapping *, int * );
+static AstPointSet *TranWrapper( AstPointSet **, int, int, double **, int * );
 static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
+static TranCache *FreeTranCache( TranCache *, int * );
+static TranCache *GetTranCache( AstCmpMap *, int, int, int, TranCache *, int * );
+static TranCache *ReleaseTranCache( AstCmpMap *, int, TranCache *, int * );
+static TranStep *FreeTranPlan( TranStep *, int, int * );
+static TranStep *TranPlan( AstCmpMap *, int, int, int *, int * );
 static double Rate( AstMapping *, double *, int, int, int * );
 static int *MapSplit( AstMapping *, int, const int *, AstMapping **, int * );
 static int *MapSplit0( AstMapping *, int, const int *, AstMapping **, int, int * );
 static int *MapSplit1( AstMapping *, int, const int *, AstMapping **, int * );
 static int *MapSplit2( AstMapping *, int, const int *, AstMapping **, int * );
+static int AffineTerms( AstMapping *, int, int *, int *, double **, double **, char **, int * );
 static int Equal( AstObject *, AstObject *, int * );
 static int GetIsLinear( AstMapping *, int * );
 static int MapList( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
 static int MapMerge( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
 static int PatternCheck( int, int, int **, int *, int * );
+static void ApplyAffine( TranStep *, int, double **, double **, int * );
+static void ApplyPlan( TranCache *, AstPointSet *, AstPointSet *, int * );
 static void Copy( const AstObject *, AstObject *, int * );
 static void Decompose( AstMapping *, AstMapping **, AstMapping **, int *, int *, int *, int * );
 static void Delete( AstObject *, int * );
@@ -347,7 +417,7 @@ static int Equal( AstObject *this_object, AstObject *that_object, int *status )
    if( astIsACmpMap( that ) ) {
 
 /* Check they are both either parallel or series. */
-      if( that->series == that->series ) {
+      if( this->series == that->series ) {
 
 /* Decompose the first CmpMap into a sequence of Mappings to be applied in
    series or parallel, as appropriate, and an associated list of
@@ -488,6 +558,9 @@ static int GetObjSize( AstObject *this_object, int *status ) {
 
 /* Local Variables: */
    AstCmpMap *this;         /* Pointer to CmpMap structure */
+   TranCache *cache;          /* Work space retained by compiled CmpMap */
+   int i;                     /* Index of retained work space */
+   int j;                     /* Index of work array or PointSet */
    int result;                /* Result value to return */
 
 /* Initialise. */
@@ -507,6 +580,23 @@ static int GetObjSize( AstObject *this_object, int *status ) {
    result += astGetObjSize( this->map1 );
    result += astGetObjSize( this->map2 );
 
+   for( i = 0; i < 2; i++ ) {
+      cache = this->tran_cache[ i ];
+      if( cache ) {
+         result += astTSizeOf( cache );
+         result += astTSizeOf( cache->plan );
+         result += astTSizeOf( cache->inrows );
+         result += astTSizeOf( cache->outrows );
+         for( j = 0; j < 2; j++ ) {
+            result += astTSizeOf( cache->work[ j ] );
+            result += astTSizeOf( cache->rows[ j ] );
+         }
+         for( j = 0; j < 4; j++ ) {
+            if( cache->wrap[ j ] ) result += astGetObjSize( cache->wrap[ j ] );
+         }
+      }
+   }
+
 /* If an error occurred, clear the result value. */
    if ( !astOK ) result = 0;
 
@@ -966,6 +1056,9 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
 
 /* Local Variables: */
    AstCmpMap *this;       /* Pointer to CmpMap structure */
+   TranCache *cache;      /* Work space retained by a compiled CmpMap */
+   int i;                 /* Index of retained work space */
+   int j;                 /* Index of retained PointSet */
    int result;            /* Returned status value */
 
 /* Initialise */
@@ -986,6 +1079,16 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
    if( !result ) result = astManageLock( this->map1, mode, extra, fail );
    if( !result ) result = astManageLock( this->map2, mode, extra, fail );
 
+/* Also invoke it on any PointSets retained by a compiled CmpMap. */
+   for( i = 0; i < 2 && !result; i++ ) {
+      cache = this->tran_cache[ i ];
+      for( j = 0; cache && j < 4 && !result; j++ ) {
+         if( cache->wrap[ j ] ) {
+            result = astManageLock( cache->wrap[ j ], mode, extra, fail );
+         }
+      }
+   }
+
    return result;
 
 }
@@ -3639,6 +3742,1157 @@ static AstMapping *Simplify( AstMapping *this_mapping, int *status ) {
    return result;
 }
 
+static int AffineTerms( AstMapping *map, int forward, int *nin, int *nout,
+                        double **matrix, double **offset, char **depend,
+                        int *status ){
+/*
+*  Name:
+*     AffineTerms
+
+*  Purpose:
+*     Get the affine transformation implemented by a simple Mapping.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     int AffineTerms( AstMapping *map, int forward, int *nin, int *nout,
+*                      double **matrix, double **offset, char **depend,
+*                      int *status )
+
+*  Class Membership:
+*     CmpMap member function.
+
+*  Description:
+*     If the supplied Mapping is a UnitMap, ZoomMap, ShiftMap, WinMap,
+*     MatrixMap or PermMap, this function returns the matrix and offset
+*     vector describing the affine transformation it implements in the
+*     requested direction. It also returns flags indicating which input
+*     coordinates affect each output coordinate, so that bad input values
+*     can be propagated in the same way as the Mapping's own astTransform
+*     method would propagate them.
+
+*  Parameters:
+*     map
+*        Pointer to the Mapping.
+*     forward
+*        The value of the "forward" argument that would be passed to
+*        astTransform to apply the Mapping (the current value of the
+*        Mapping's Invert attribute is taken into account).
+*     nin
+*        Address of an int in which to return the number of input
+*        coordinates for the requested transformation.
+*     nout
+*        Address of an int in which to return the number of output
+*        coordinates for the requested transformation.
+*     matrix
+*        Address of a location at which to return a pointer to a newly
+*        allocated array holding the "nout*nin" matrix elements, in row
+*        order (i.e. all the elements for the first output first).
+*     offset
+*        Address of a location at which to return a pointer to a newly
+*        allocated array holding the "nout" values to be added to the
+*        matrix product. An element holding AST__BAD indicates that the
+*        corresponding output is always bad.
+*     depend
+*        Address of a location at which to return a pointer to a newly
+*        allocated array holding "nout*nin" flags. Each flag is non-zero
+*        if the corresponding output will be bad when the corresponding
+*        input is bad. The flags are stored in the same order as the
+*        matrix elements.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Non-zero if the Mapping implements an affine transformation that
+*     can be described in this way, and zero otherwise.
+
+*  Notes:
+*     - NULL pointers are returned for the three arrays if zero is
+*     returned.
+*     - The returned arrays should be freed using astFree when no longer
+*     needed.
+*     - Zero will be returned if this function is invoked with the global
+*     error status set, or if it should fail for any reason.
+*/
+
+/* Local Variables: */
+   AstMatrixMap *mm;             /* Pointer to MatrixMap */
+   AstPermMap *pm;               /* Pointer to PermMap */
+   AstShiftMap *sm;              /* Pointer to ShiftMap */
+   AstWinMap *wm;                /* Pointer to WinMap */
+   double *mat;                  /* Pointer to MatrixMap elements */
+   double aa;                    /* WinMap shift */
+   double bb;                    /* WinMap scale */
+   double zoom;                  /* ZoomMap zoom factor */
+   int *perm;                    /* Pointer to PermMap permutation array */
+   int dir;                      /* Use the Mapping's forward transformation? */
+   int i;                        /* Coordinate index */
+   int maxperm;                  /* Max value in permutation array */
+   int n;                        /* Number of matrix elements */
+   int p;                        /* Permuted coordinate index */
+   int result;                   /* Returned flag */
+
+/* Initialise. */
+   result = 0;
+   *matrix = NULL;
+   *offset = NULL;
+   *depend = NULL;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Only the following classes are handled. */
+   if( !astIsAUnitMap( map ) && !astIsAZoomMap( map ) &&
+       !astIsAShiftMap( map ) && !astIsAWinMap( map ) &&
+       !astIsAMatrixMap( map ) && !astIsAPermMap( map ) ) return result;
+
+/* Get the numbers of input and output coordinates for the requested
+   transformation, and note whether this is the forward transformation
+   of the Mapping as originally defined. */
+   *nin = forward ? astGetNin( map ) : astGetNout( map );
+   *nout = forward ? astGetNout( map ) : astGetNin( map );
+   dir = astGetInvert( map ) ? !forward : forward;
+
+/* Allocate the returned arrays, initialised to zero. */
+   n = (*nin)*(*nout);
+   *matrix = astCalloc( n, sizeof( double ) );
+   *offset = astCalloc( *nout, sizeof( double ) );
+   *depend = astCalloc( n, sizeof( char ) );
+   if( astOK ) {
+      result = 1;
+
+/* UnitMaps and ZoomMaps scale each axis by the same factor. */
+      if( astIsAUnitMap( map ) || astIsAZoomMap( map ) ) {
+         zoom = 1.0;
+         if( astIsAZoomMap( map ) ) {
+            zoom = astGetZoom( map );
+            if( !dir && astOK ) zoom = 1.0/zoom;
+         }
+         for( i = 0; i < *nin; i++ ) {
+            (*matrix)[ i*( *nin + 1 ) ] = zoom;
+            (*depend)[ i*( *nin + 1 ) ] = 1;
+         }
+
+/* ShiftMaps add a constant to each axis. */
+      } else if( astIsAShiftMap( map ) ) {
+         sm = (AstShiftMap *) map;
+         if( sm->shift ) {
+            for( i = 0; i < *nin; i++ ) {
+               (*matrix)[ i*( *nin + 1 ) ] = 1.0;
+               (*depend)[ i*( *nin + 1 ) ] = 1;
+               if( sm->shift[ i ] == AST__BAD ) {
+                  (*offset)[ i ] = AST__BAD;
+               } else {
+                  (*offset)[ i ] = dir ? sm->shift[ i ] : -sm->shift[ i ];
+               }
+            }
+         } else {
+            result = 0;
+         }
+
+/* WinMaps scale and shift each axis independently. Axes for which the
+   scale or shift is bad, or which cannot be inverted, always produce bad
+   values. */
+      } else if( astIsAWinMap( map ) ) {
+         wm = (AstWinMap *) map;
+         if( wm->a && wm->b ) {
+            for( i = 0; i < *nin; i++ ) {
+               (*depend)[ i*( *nin + 1 ) ] = 1;
+               aa = wm->a[ i ];
+               bb = wm->b[ i ];
+               if( aa == AST__BAD || bb == AST__BAD || ( !dir && bb == 0.0 ) ) {
+                  (*offset)[ i ] = AST__BAD;
+               } else {
+                  if( !dir ) {
+                     bb = 1.0/bb;
+                     aa = -aa*bb;
+                  }
+                  (*matrix)[ i*( *nin + 1 ) ] = bb;
+                  (*offset)[ i ] = aa;
+               }
+            }
+         } else {
+            result = 0;
+         }
+
+/* MatrixMaps. A full matrix is used only if it is defined in the
+   required direction and contains no bad elements. Each output then
+   depends on the inputs that have non-zero matrix elements. Diagonal
+   and unit matrices are used only if they are square. */
+      } else if( astIsAMatrixMap( map ) ) {
+         mm = (AstMatrixMap *) map;
+         mat = dir ? mm->f_matrix : mm->i_matrix;
+         if( mm->form == 0 ) {
+            if( mat ) {
+               for( i = 0; i < n; i++ ) {
+                  if( mat[ i ] == AST__BAD ) {
+                     result = 0;
+                     break;
+                  }
+                  (*matrix)[ i ] = mat[ i ];
+                  (*depend)[ i ] = ( mat[ i ] != 0.0 );
+               }
+            } else {
+               result = 0;
+            }
+
+         } else if( *nin != *nout || ( mm->form == 1 && !mat ) ) {
+            result = 0;
+
+         } else {
+            for( i = 0; i < *nin; i++ ) {
+               (*depend)[ i*( *nin + 1 ) ] = 1;
+               if( mm->form == 2 ) {
+                  (*matrix)[ i*( *nin + 1 ) ] = 1.0;
+               } else if( mat[ i ] == AST__BAD ) {
+                  (*offset)[ i ] = AST__BAD;
+               } else {
+                  (*matrix)[ i*( *nin + 1 ) ] = mat[ i ];
+               }
+            }
+         }
+
+/* PermMaps copy each output from an input, or assign it a constant
+   value. This mirrors the logic used in the PermMap Transform function. */
+      } else {
+         pm = (AstPermMap *) map;
+         perm = dir ? pm->outperm : pm->inperm;
+         maxperm = dir ? *nin : *nout;
+         for( i = 0; i < *nout; i++ ) {
+            p = perm ? perm[ i ] : ( i < maxperm ? i : -1 );
+            if( p >= 0 && p < *nin ) {
+               (*matrix)[ i*( *nin ) + p ] = 1.0;
+               (*depend)[ i*( *nin ) + p ] = 1;
+            } else if( p < 0 ) {
+               (*offset)[ i ] = pm->constant ? pm->constant[ (-p) - 1 ] : AST__BAD;
+            } else {
+               (*offset)[ i ] = AST__BAD;
+            }
+         }
+      }
+   }
+
+/* Free the arrays if the Mapping cannot be described in this way, or an
+   error occurred. */
+   if( !result || !astOK ) {
+      *matrix = astFree( *matrix );
+      *offset = astFree( *offset );
+      *depend = astFree( *depend );
+      result = 0;
+   }
+
+/* Return the result. */
+   return result;
+}
+
+static void ApplyAffine( TranStep *step, int npoint, double **ptr_in,
+                         double **ptr_out, int *status ){
+/*
+*  Name:
+*     ApplyAffine
+
+*  Purpose:
+*     Apply a fused affine transformation to a set of points.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     void ApplyAffine( TranStep *step, int npoint, double **ptr_in,
+*                       double **ptr_out, int *status )
+
+*  Class Membership:
+*     CmpMap member function.
+
+*  Description:
+*     This function applies the affine transformation described by a
+*     fused step within a transformation plan (see TranPlan) to a set
+*     of points. Bad input values are propagated in the same way as the
+*     component Mappings that were fused to form the step would
+*     propagate them. Any input shifts are applied before the matrix.
+
+*  Parameters:
+*     step
+*        Pointer to the fused step.
+*     npoint
+*        The number of points to transform.
+*     ptr_in
+*        Array of pointers to the input values for each coordinate.
+*     ptr_out
+*        Array of pointers to the output values for each coordinate.
+*        These may refer to the same memory as the input values.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   char *dep;                    /* Pointer to dependency flags for output */
+   double *mat;                  /* Pointer to matrix elements for output */
+   double *xin;                  /* Input values for current point */
+   double sum;                   /* Output value */
+   int icoord;                   /* Input coordinate index */
+   int ocoord;                   /* Output coordinate index */
+   int point;                    /* Point index */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Allocate work space to hold the input values for a single point. These
+   are copied before any output values are stored, so that the input and
+   output arrays can be the same. */
+   xin = astMalloc( sizeof( double )*(size_t) step->nin );
+   if( astOK ) {
+
+/* Loop round each point. */
+      for( point = 0; point < npoint; point++ ) {
+         for( icoord = 0; icoord < step->nin; icoord++ ) {
+            xin[ icoord ] = ptr_in[ icoord ][ point ];
+            if( step->shift && xin[ icoord ] != AST__BAD ) {
+               if( step->shift[ icoord ] == AST__BAD ) {
+                  xin[ icoord ] = AST__BAD;
+               } else {
+                  xin[ icoord ] += step->shift[ icoord ];
+               }
+            }
+         }
+
+/* Form each output value from the inputs on which it depends. The output
+   is bad if the offset is bad or if any such input is bad. */
+         mat = step->matrix;
+         dep = step->depend;
+         for( ocoord = 0; ocoord < step->nout; ocoord++ ) {
+            sum = step->offset[ ocoord ];
+            if( sum != AST__BAD ) {
+               for( icoord = 0; icoord < step->nin; icoord++ ) {
+                  if( dep[ icoord ] ) {
+                     if( xin[ icoord ] == AST__BAD ) {
+                        sum = AST__BAD;
+                        break;
+                     }
+                     sum += mat[ icoord ]*xin[ icoord ];
+                  }
+               }
+            }
+            ptr_out[ ocoord ][ point ] = sum;
+            mat += step->nin;
+            dep += step->nin;
+         }
+      }
+   }
+
+/* Free resources. */
+   xin = astFree( xin );
+}
+
+static void ApplyPlan( TranCache *cache, AstPointSet *in, AstPointSet *out,
+                       int *status ){
+/*
+*  Name:
+*     ApplyPlan
+
+*  Purpose:
+*     Transform a set of points using a transformation plan.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     void ApplyPlan( TranCache *cache, AstPointSet *in, AstPointSet *out,
+*                     int *status )
+
+*  Class Membership:
+*     CmpMap member function.
+
+*  Description:
+*     This function applies each step in a plan created by TranPlan to
+*     a set of points. The points are processed in batches. Intermediate
+*     results are stored in a pair of work arrays that are re-used for
+*     every step and every batch, and the PointSets used to pass them to
+*     the astTransform method of each component Mapping are re-used
+*     wherever possible. The work arrays and PointSets are stored in the
+*     supplied cache, and are only re-allocated if they are too small.
+
+*  Parameters:
+*     cache
+*        Pointer to the structure holding the plan and work space.
+*     in
+*        Pointer to the PointSet holding the input coordinate values.
+*     out
+*        Pointer to the PointSet in which to store the output coordinate
+*        values.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstPointSet *psin;            /* PointSet holding step input values */
+   AstPointSet *psout;           /* PointSet holding step output values */
+   TranStep *plan;               /* Pointer to first step */
+   TranStep *step;               /* Pointer to current step */
+   double **dst;                 /* Pointers to step output values */
+   double **ptr_in;              /* Pointers to input coordinate data */
+   double **ptr_out;             /* Pointers to output coordinate data */
+   double **src;                 /* Pointers to step input values */
+   int dstslot;                  /* Index of PointSet for step output */
+   int i;                        /* Loop index */
+   int icoord;                   /* Coordinate index */
+   int ipoint1;                  /* Index of first point in batch */
+   int istep;                    /* Step index */
+   int maxcoord;                 /* Max. no. of intermediate coordinates */
+   int nb;                       /* Max. number of points in a batch */
+   int nin;                      /* No. of input coordinates */
+   int nout;                     /* No. of output coordinates */
+   int np;                       /* Number of points in batch */
+   int npoint;                   /* Number of points to be transformed */
+   int nstep;                    /* Number of steps in plan */
+   int srcslot;                  /* Index of PointSet for step input */
+
+/* Local Constants: */
+   const int nbatch = 2048;      /* Maximum points in a batch */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Get the plan, the number of points and coordinates, and pointers to the
+   coordinate values. */
+   plan = cache->plan;
+   nstep = cache->nstep;
+   npoint = astGetNpoint( in );
+   nin = astGetNcoord( in );
+   nout = astGetNcoord( out );
+   ptr_in = astGetPoints( in );
+   ptr_out = astGetPoints( out );
+
+/* Find the number of points in each batch. */
+   nb = ( npoint < nbatch ) ? npoint : nbatch;
+
+/* If the work arrays are too small to hold a batch (e.g. because they
+   have not yet been created), allocate new ones and set up pointers to
+   the first value for each coordinate within them. The first work array
+   is needed only if there are at least two steps, and the second only if
+   there are at least three. */
+   if( nb > cache->nb ) {
+      maxcoord = 1;
+      for( istep = 0; istep < nstep - 1; istep++ ) {
+         if( plan[ istep ].nout > maxcoord ) maxcoord = plan[ istep ].nout;
+      }
+      if( !cache->inrows ) {
+         cache->inrows = astMalloc( sizeof( double * )*(size_t) nin );
+      }
+      if( !cache->outrows ) {
+         cache->outrows = astMalloc( sizeof( double * )*(size_t) nout );
+      }
+      for( i = 0; i < 2; i++ ) {
+         if( nstep > i + 1 ) {
+            cache->work[ i ] = astFree( cache->work[ i ] );
+            cache->work[ i ] = astMalloc( sizeof( double )*
+                                          (size_t)( nb*maxcoord ) );
+            if( !cache->rows[ i ] ) {
+               cache->rows[ i ] = astMalloc( sizeof( double * )*
+                                             (size_t) maxcoord );
+            }
+            if( astOK ) {
+               for( icoord = 0; icoord < maxcoord; icoord++ ) {
+                  cache->rows[ i ][ icoord ] = cache->work[ i ] + icoord*nb;
+               }
+            }
+         }
+      }
+      if( astOK ) cache->nb = nb;
+   }
+
+/* Loop to process all the points in batches. */
+   for( ipoint1 = 0; ipoint1 < npoint && astOK; ipoint1 += nb ) {
+      np = npoint - ipoint1;
+      if( np > nb ) np = nb;
+
+/* Get pointers to the input and output values for this batch. */
+      for( icoord = 0; icoord < nin; icoord++ ) {
+         cache->inrows[ icoord ] = ptr_in[ icoord ] + ipoint1;
+      }
+      for( icoord = 0; icoord < nout; icoord++ ) {
+         cache->outrows[ icoord ] = ptr_out[ icoord ] + ipoint1;
+      }
+
+/* Apply each step in turn. The first step reads the supplied input
+   values and the last step writes to the supplied output values. The
+   other steps alternate between the two work arrays. */
+      src = cache->inrows;
+      srcslot = 2;
+      for( istep = 0; istep < nstep && astOK; istep++ ) {
+         step = plan + istep;
+         if( istep == nstep - 1 ) {
+            dst = cache->outrows;
+            dstslot = 3;
+         } else {
+            dst = cache->rows[ istep % 2 ];
+            dstslot = istep % 2;
+         }
+
+/* Fused steps are applied directly. Other steps use the astTransform
+   method of the component Mapping. */
+         if( step->map ) {
+            psin = TranWrapper( cache->wrap + srcslot, step->nin, np, src,
+                                status );
+            psout = TranWrapper( cache->wrap + dstslot, step->nout, np, dst,
+                                 status );
+            (void) astTransform( step->map, psin, step->forward, psout );
+         } else {
+            ApplyAffine( step, np, src, dst, status );
+         }
+
+         src = dst;
+         srcslot = dstslot;
+      }
+   }
+}
+
+static TranCache *FreeTranCache( TranCache *cache, int *status ){
+/*
+*  Name:
+*     FreeTranCache
+
+*  Purpose:
+*     Free the work space used to transform points.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     TranCache *FreeTranCache( TranCache *cache, int *status )
+
+*  Class Membership:
+*     CmpMap member function.
+
+*  Description:
+*     This function frees the plan, work arrays and PointSets held in a
+*     structure returned by GetTranCache, and then frees the structure
+*     itself if it was dynamically allocated.
+
+*  Parameters:
+*     cache
+*        Pointer to the structure. May be NULL.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     A NULL pointer.
+
+*  Notes:
+*     - This function attempts to execute even if the global error
+*     status is set.
+*/
+
+/* Local Variables: */
+   int i;                        /* Loop index */
+
+/* Check a structure was supplied. */
+   if( !cache ) return NULL;
+
+/* Free the plan, the PointSets and the work arrays, and then the
+   structure itself if it was dynamically allocated. */
+   cache->plan = FreeTranPlan( cache->plan, cache->nstep, status );
+   for( i = 0; i < 4; i++ ) {
+      if( cache->wrap[ i ] ) cache->wrap[ i ] = astAnnul( cache->wrap[ i ] );
+   }
+   for( i = 0; i < 2; i++ ) {
+      cache->work[ i ] = astFree( cache->work[ i ] );
+      cache->rows[ i ] = astFree( cache->rows[ i ] );
+   }
+   cache->inrows = astFree( cache->inrows );
+   cache->outrows = astFree( cache->outrows );
+   return cache->dynamic ? astFree( cache ) : NULL;
+}
+
+static TranStep *FreeTranPlan( TranStep *plan, int nstep, int *status ){
+/*
+*  Name:
+*     FreeTranPlan
+
+*  Purpose:
+*     Free a transformation plan.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     TranStep *FreeTranPlan( TranStep *plan, int nstep, int *status )
+
+*  Class Membership:
+*     CmpMap member function.
+
+*  Description:
+*     This function annuls the Mapping pointers and frees the memory
+*     held by a plan created by TranPlan.
+
+*  Parameters:
+*     plan
+*        Pointer to the first step in the plan. May be NULL.
+*     nstep
+*        The number of steps in the plan.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     A NULL pointer.
+
+*  Notes:
+*     - This function attempts to execute even if the global error
+*     status is set.
+*/
+
+/* Local Variables: */
+   int istep;                    /* Step index */
+
+/* Check a plan was supplied. */
+   if( !plan ) return NULL;
+
+/* Free the resources used by each step, and then the plan itself. */
+   for( istep = 0; istep < nstep; istep++ ) {
+      if( plan[ istep ].map ) plan[ istep ].map = astAnnul( plan[ istep ].map );
+      plan[ istep ].shift = astFree( plan[ istep ].shift );
+      plan[ istep ].matrix = astFree( plan[ istep ].matrix );
+      plan[ istep ].offset = astFree( plan[ istep ].offset );
+      plan[ istep ].depend = astFree( plan[ istep ].depend );
+   }
+   return astFree( plan );
+}
+
+static TranCache *GetTranCache( AstCmpMap *this, int forward, int forward1,
+                                int forward2, TranCache *local,
+                                int *status ){
+/*
+*  Name:
+*     GetTranCache
+
+*  Purpose:
+*     Get the work space needed to transform points.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     TranCache *GetTranCache( AstCmpMap *this, int forward, int forward1,
+*                              int forward2, TranCache *local,
+*                              int *status )
+
+*  Class Membership:
+*     CmpMap member function.
+
+*  Description:
+*     This function returns a structure holding the work space used by
+*     the Transform function, including any plan for applying a series
+*     CmpMap (see TranPlan). If the CmpMap has been compiled (see
+*     astCompile), the structure retained by a previous call for the same
+*     direction is re-used if possible, and otherwise a new structure is
+*     allocated. If the CmpMap has not been compiled, the supplied local
+*     structure is initialised and returned, so that no memory is
+*     allocated for the structure itself. The structure should be passed
+*     to ReleaseTranCache when it is no longer needed.
+
+*  Parameters:
+*     this
+*        Pointer to the CmpMap.
+*     forward
+*        Non-zero if the forward transformation of the CmpMap is to be
+*        applied (ignoring the CmpMap's Invert attribute), and zero if
+*        the inverse transformation is to be applied.
+*     forward1
+*        The "forward" value to pass to astTransform when applying the
+*        first component Mapping.
+*     forward2
+*        The "forward" value to pass to astTransform when applying the
+*        second component Mapping.
+*     local
+*        Pointer to a structure to use if the CmpMap has not been
+*        compiled. This will usually be a local variable in the caller.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Pointer to the structure.
+
+*  Notes:
+*     - A NULL pointer will be returned if this function is invoked with
+*     the global error status set, or if it should fail for any reason.
+*/
+
+/* Local Variables: */
+   TranCache *result;            /* Returned structure */
+   int compiled;                 /* Has the CmpMap been compiled? */
+   int i;                        /* Loop index */
+
+/* Check the global error status. */
+   if ( !astOK ) return NULL;
+
+/* If the CmpMap has been compiled, take any structure retained by a
+   previous call out of the CmpMap. It is removed so that it cannot also
+   be used by a nested call for the same CmpMap. Discard it if the
+   directions of the component Mappings have changed since it was
+   created. */
+   result = NULL;
+   compiled = ( ( (AstMapping *) this )->flags & AST__COMPILED_FLAG );
+   if( compiled ) {
+      result = this->tran_cache[ forward ? 0 : 1 ];
+      this->tran_cache[ forward ? 0 : 1 ] = NULL;
+      if( result && ( result->forward1 != forward1 ||
+                      result->forward2 != forward2 ) ) {
+         result = FreeTranCache( result, status );
+      }
+   }
+
+/* Otherwise, initialise a new structure. A compiled CmpMap retains the
+   structure, so it must be dynamically allocated. Otherwise, the supplied
+   local structure is used. For a series CmpMap, also create a plan for
+   applying the component Mappings. A compiled CmpMap always uses a plan,
+   so that it can re-use the work arrays held in the structure. */
+   if( !result ) {
+      if( compiled ) {
+         result = astMalloc( sizeof( TranCache ) );
+         if( result ) result->dynamic = 1;
+      } else {
+         result = local;
+         result->dynamic = 0;
+      }
+      if( astOK ) {
+         result->nstep = 0;
+         result->forward1 = forward1;
+         result->forward2 = forward2;
+         result->nb = 0;
+         result->inrows = NULL;
+         result->outrows = NULL;
+         for( i = 0; i < 2; i++ ) {
+            result->work[ i ] = NULL;
+            result->rows[ i ] = NULL;
+         }
+         for( i = 0; i < 4; i++ ) result->wrap[ i ] = NULL;
+         result->plan = this->series ? TranPlan( this, forward, compiled,
+                                                 &result->nstep, status )
+                                     : NULL;
+      }
+   }
+
+/* Free the structure if an error occurred. */
+   if( !astOK ) result = FreeTranCache( result, status );
+
+/* Return the structure. */
+   return result;
+}
+
+static TranCache *ReleaseTranCache( AstCmpMap *this, int forward,
+                                    TranCache *cache, int *status ){
+/*
+*  Name:
+*     ReleaseTranCache
+
+*  Purpose:
+*     Release the work space obtained using GetTranCache.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     TranCache *ReleaseTranCache( AstCmpMap *this, int forward,
+*                                  TranCache *cache, int *status )
+
+*  Class Membership:
+*     CmpMap member function.
+
+*  Description:
+*     This function indicates that a structure returned by GetTranCache
+*     is no longer needed. If the CmpMap has been compiled (see
+*     astCompile), the structure is retained within the CmpMap for re-use
+*     by later calls to GetTranCache. Otherwise the resources it holds
+*     are freed.
+
+*  Parameters:
+*     this
+*        Pointer to the CmpMap.
+*     forward
+*        The value supplied for "forward" when calling GetTranCache.
+*     cache
+*        Pointer to the structure. No action is taken if this is NULL.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     A NULL pointer.
+
+*  Notes:
+*     - This function attempts to execute even if the global error
+*     status is set.
+*/
+
+/* Local Variables: */
+   int slot;                     /* Index of retained structure */
+
+/* Check a structure was supplied. */
+   if( !cache ) return NULL;
+
+/* If the structure was allocated for a compiled CmpMap, store it in the
+   CmpMap, freeing any structure that was stored by a nested call. */
+   if( cache->dynamic && astOK ) {
+      slot = forward ? 0 : 1;
+      if( this->tran_cache[ slot ] ) {
+         this->tran_cache[ slot ] = FreeTranCache( this->tran_cache[ slot ],
+                                                   status );
+      }
+      this->tran_cache[ slot ] = cache;
+
+/* Otherwise, free the structure and the resources it holds. */
+   } else {
+      cache = FreeTranCache( cache, status );
+   }
+
+/* Return a NULL pointer. */
+   return NULL;
+}
+
+static TranStep *TranPlan( AstCmpMap *this, int forward, int force,
+                           int *nstep, int *status ){
+/*
+*  Name:
+*     TranPlan
+
+*  Purpose:
+*     Create a plan for applying a series CmpMap to a set of points.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     TranStep *TranPlan( AstCmpMap *this, int forward, int force,
+*                         int *nstep, int *status )
+
+*  Class Membership:
+*     CmpMap member function.
+
+*  Description:
+*     This function decomposes a series CmpMap into the sequence of
+*     component Mappings that it applies (expanding any nested series
+*     CmpMaps), and returns a list of the steps needed to apply them. Any
+*     run of two or more adjacent component Mappings that implement
+*     affine transformations (UnitMaps, ZoomMaps, ShiftMaps, WinMaps,
+*     MatrixMaps and PermMaps) is fused into a single step, which is
+*     applied using one matrix multiplication. This can give a
+*     significant saving for long CmpMaps in which such Mappings could
+*     not be merged by astSimplify because they are separated by other
+*     Mappings or combined in parallel.
+
+*  Parameters:
+*     this
+*        Pointer to the series CmpMap.
+*     forward
+*        Non-zero if the forward transformation of the CmpMap is to be
+*        applied (ignoring the CmpMap's Invert attribute), and zero if
+*        the inverse transformation is to be applied.
+*     force
+*        If non-zero, a plan is returned even if it gives no benefit
+*        over applying the two component Mappings in turn.
+*     nstep
+*        Address of an int in which to return the number of steps in the
+*        plan.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     A pointer to an array of "*nstep" structures describing the steps,
+*     in the order in which they should be applied. It should be freed
+*     using FreeTranPlan when no longer needed. A NULL pointer is returned
+*     if the CmpMap cannot usefully be decomposed, in which case it should
+*     be applied by applying its two component Mappings in turn (unless
+*     "force" is non-zero).
+
+*  Notes:
+*     - A NULL pointer will be returned if this function is invoked with
+*     the global error status set, or if it should fail for any reason.
+*/
+
+/* Local Variables: */
+   AstMapping **map_list;        /* Array of component Mappings */
+   TranStep *prev;               /* Pointer to previous step */
+   TranStep *result;             /* Returned plan */
+   char *depend;                 /* Dependency flags for component */
+   char *newdep;                 /* Dependency flags for fused step */
+   double *matrix;               /* Matrix for component */
+   double *newmat;               /* Matrix for fused step */
+   double *newoff;               /* Offsets for fused step */
+   double *offset;               /* Offsets for component */
+   double off;                   /* Offset for one output of fused step */
+   double sum;                   /* Matrix element for fused step */
+   int *invert_list;             /* Array of Invert values for components */
+   int affine;                   /* Is the component affine? */
+   int dep;                      /* Does fused output depend on input? */
+   int fused;                    /* Have any components been fused? */
+   int i;                        /* Fused step input index */
+   int ident;                    /* Is previous step a pure shift? */
+   int imap;                     /* Index of component Mapping */
+   int j;                        /* Intermediate coordinate index */
+   int k;                        /* Fused step output index */
+   int nin;                      /* No. of inputs for component */
+   int nmap;                     /* Number of component Mappings */
+   int nout;                     /* No. of outputs for component */
+
+/* Initialise. */
+   result = NULL;
+   *nstep = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Nothing can be gained unless one of the components is itself a CmpMap
+   that can be expanded, or both components are potentially affine. */
+   if( !force && !astIsACmpMap( this->map1 ) &&
+       !astIsACmpMap( this->map2 ) ) {
+      if( !AFFINE_CLASS( this->map1 ) || !AFFINE_CLASS( this->map2 ) ) {
+         return result;
+      }
+   }
+
+/* Decompose the CmpMap (notionally un-inverted) into a list of Mappings
+   to be applied in series. */
+   nmap = 0;
+   map_list = NULL;
+   invert_list = NULL;
+   (void) astMapList( (AstMapping *) this, 1, 0, &nmap, &map_list,
+                      &invert_list );
+
+/* Allocate the plan. */
+   result = astMalloc( sizeof( TranStep )*(size_t) nmap );
+   fused = 0;
+   if( astOK ) {
+
+/* Loop round the component Mappings in the order in which they will be
+   applied. */
+      for( imap = 0; imap < nmap; imap++ ) {
+         i = forward ? imap : nmap - 1 - imap;
+
+/* Get the "forward" value to pass to astTransform to apply the component
+   Mapping, allowing for any change to its Invert attribute. */
+         result[ *nstep ].map = map_list[ i ];
+         result[ *nstep ].forward = ( astGetInvert( map_list[ i ] ) ==
+                                      invert_list[ i ] );
+         if( !forward ) result[ *nstep ].forward = !result[ *nstep ].forward;
+         map_list[ i ] = NULL;
+
+/* Get the affine transformation implemented by the component, if
+   possible. */
+         affine = AffineTerms( result[ *nstep ].map, result[ *nstep ].forward,
+                               &nin, &nout, &matrix, &offset, &depend,
+                               status );
+         if( !affine ) {
+            nin = result[ *nstep ].forward ? astGetNin( result[ *nstep ].map ) :
+                                             astGetNout( result[ *nstep ].map );
+            nout = result[ *nstep ].forward ? astGetNout( result[ *nstep ].map ) :
+                                              astGetNin( result[ *nstep ].map );
+         }
+
+/* If the component and the previous step are both affine, combine them
+   into a single fused step. The output of the fused step is bad if any
+   intermediate value that it depends on is bad. */
+         prev = ( *nstep > 0 ) ? result + *nstep - 1 : NULL;
+         if( affine && prev && prev->matrix && prev->nout == nin ) {
+
+/* If the previous step is a pure shift (e.g. a ShiftMap), transfer its
+   offsets to the input shifts, so that they are applied before the
+   scaling described by the new component. */
+            ident = ( prev->nin == prev->nout );
+            for( k = 0; k < prev->nout && ident; k++ ) {
+               for( i = 0; i < prev->nin; i++ ) {
+                  if( prev->depend[ k*prev->nin + i ] != ( i == k ) ||
+                      prev->matrix[ k*prev->nin + i ] != ( i == k ) ) {
+                     ident = 0;
+                     break;
+                  }
+               }
+            }
+            if( ident ) {
+               if( !prev->shift ) {
+                  prev->shift = astCalloc( prev->nin, sizeof( double ) );
+               }
+               if( astOK ) {
+                  for( i = 0; i < prev->nin; i++ ) {
+                     if( prev->offset[ i ] == AST__BAD ) {
+                        prev->shift[ i ] = AST__BAD;
+                     } else if( prev->shift[ i ] != AST__BAD ) {
+                        prev->shift[ i ] += prev->offset[ i ];
+                     }
+                     prev->offset[ i ] = 0.0;
+                  }
+               }
+            }
+
+            newmat = astMalloc( sizeof( double )*(size_t)( nout*prev->nin ) );
+            newoff = astMalloc( sizeof( double )*(size_t) nout );
+            newdep = astMalloc( sizeof( char )*(size_t)( nout*prev->nin ) );
+            if( astOK ) {
+               for( k = 0; k < nout; k++ ) {
+                  off = offset[ k ];
+                  for( j = 0; j < nin && off != AST__BAD; j++ ) {
+                     if( depend[ k*nin + j ] ) {
+                        if( prev->offset[ j ] == AST__BAD ) {
+                           off = AST__BAD;
+                        } else {
+                           off += matrix[ k*nin + j ]*prev->offset[ j ];
+                        }
+                     }
+                  }
+                  newoff[ k ] = off;
+
+                  for( i = 0; i < prev->nin; i++ ) {
+                     sum = 0.0;
+                     dep = 0;
+                     for( j = 0; j < nin; j++ ) {
+                        if( depend[ k*nin + j ] ) {
+                           sum += matrix[ k*nin + j ]*prev->matrix[ j*prev->nin + i ];
+                           if( prev->depend[ j*prev->nin + i ] ) dep = 1;
+                        }
+                     }
+                     newmat[ k*prev->nin + i ] = sum;
+                     newdep[ k*prev->nin + i ] = dep;
+                  }
+               }
+            }
+
+/* Replace the previous step with the fused step, and discard the
+   component. */
+            (void) astFree( prev->matrix );
+            (void) astFree( prev->offset );
+            (void) astFree( prev->depend );
+            prev->matrix = newmat;
+            prev->offset = newoff;
+            prev->depend = newdep;
+            prev->nout = nout;
+            if( prev->map ) prev->map = astAnnul( prev->map );
+            result[ *nstep ].map = astAnnul( result[ *nstep ].map );
+            matrix = astFree( matrix );
+            offset = astFree( offset );
+            depend = astFree( depend );
+            fused = 1;
+
+/* Otherwise, add a new step. The affine terms are retained in case the
+   next component can be fused with it. */
+         } else {
+            result[ *nstep ].nin = nin;
+            result[ *nstep ].nout = nout;
+            result[ *nstep ].shift = NULL;
+            result[ *nstep ].matrix = matrix;
+            result[ *nstep ].offset = offset;
+            result[ *nstep ].depend = depend;
+            ( *nstep )++;
+         }
+      }
+
+/* Steps that were not fused with any others are applied using the
+   astTransform method of the component Mapping, so discard their
+   affine terms. */
+      for( imap = 0; imap < *nstep; imap++ ) {
+         if( result[ imap ].map ) {
+            result[ imap ].shift = astFree( result[ imap ].shift );
+            result[ imap ].matrix = astFree( result[ imap ].matrix );
+            result[ imap ].offset = astFree( result[ imap ].offset );
+            result[ imap ].depend = astFree( result[ imap ].depend );
+         }
+      }
+   }
+
+/* Annul any remaining component Mapping pointers and free the lists. */
+   for( imap = 0; imap < nmap; imap++ ) {
+      if( map_list[ imap ] ) map_list[ imap ] = astAnnul( map_list[ imap ] );
+   }
+   map_list = astFree( map_list );
+   invert_list = astFree( invert_list );
+
+/* If no components were fused and the CmpMap could not be expanded
+   beyond its two components, there is no benefit in using the plan
+   (unless one is required). Also discard it if an error occurred. */
+   if( ( !force && !fused && *nstep < 3 ) || !astOK ) {
+      result = FreeTranPlan( result, *nstep, status );
+      *nstep = 0;
+   }
+
+/* Return the plan. */
+   return result;
+}
+
+static AstPointSet *TranWrapper( AstPointSet **wrap, int ncoord, int npoint,
+                                 double **ptr, int *status ){
+/*
+*  Name:
+*     TranWrapper
+
+*  Purpose:
+*     Get a PointSet that describes a set of coordinate arrays.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "cmpmap.h"
+*     AstPointSet *TranWrapper( AstPointSet **wrap, int ncoord, int npoint,
+*                               double **ptr, int *status )
+
+*  Class Membership:
+*     CmpMap member function.
+
+*  Description:
+*     This function returns a PointSet that refers to the supplied
+*     coordinate arrays (without copying them). A previously created
+*     PointSet is re-used if it has the correct number of coordinates.
+
+*  Parameters:
+*     wrap
+*        Address of a location holding a pointer to the previously
+*        created PointSet, or NULL. On exit it holds a pointer to the
+*        returned PointSet.
+*     ncoord
+*        The number of coordinates.
+*     npoint
+*        The number of points.
+*     ptr
+*        Array of "ncoord" pointers to the coordinate arrays.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Pointer to the PointSet. It should not be annulled by the caller.
+
+*  Notes:
+*     - A NULL pointer will be returned if this function is invoked with
+*     the global error status set, or if it should fail for any reason.
+*/
+
+/* Check the global error status. */
+   if ( !astOK ) return NULL;
+
+/* Discard any existing PointSet if it cannot be used. */
+   if( *wrap && astGetNcoord( *wrap ) != ncoord ) *wrap = astAnnul( *wrap );
+
+/* Create a new PointSet if required, or change the number of points in
+   the existing PointSet (this is possible since it does not hold any
+   internally allocated coordinate values). */
+   if( !*wrap ) {
+      *wrap = astPointSet( npoint, ncoord, "", status );
+   } else if( astGetNpoint( *wrap ) != npoint ) {
+      astSetNpoint( *wrap, npoint );
+   }
+
+/* Store the pointers to the coordinate arrays. */
+   astSetPoints( *wrap, ptr );
+
+/* Return the PointSet. */
+   return astOK ? *wrap : NULL;
+}
+
 static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
                                int forward, AstPointSet *out, int *status ) {
 /*
@@ -3701,6 +4955,10 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
    AstPointSet *temp1;           /* Pointer to temporary PointSet */
    AstPointSet *temp2;           /* Pointer to temporary PointSet */
    AstPointSet *temp;            /* Pointer to temporary PointSet */
+   TranCache *cache;             /* Work space for transforming points */
+   TranCache local_cache;        /* Work space for an uncompiled CmpMap */
+   double **ptr_in;              /* Pointers to input coordinate data */
+   double **ptr_out;             /* Pointers to output coordinate data */
    int forward1;                 /* Use forward direction for Mapping 1? */
    int forward2;                 /* Use forward direction for Mapping 2? */
    int ipoint1;                  /* Index of first point in batch */
@@ -3749,6 +5007,13 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 /* Determine the number of points being transformed. */
    npoint = astGetNpoint( in );
 
+/* Get the work space needed to transform the points. This includes any
+   plan for applying a series CmpMap. A compiled CmpMap retains this
+   work space between invocations. Otherwise, the local structure is
+   used to hold it. */
+   cache = GetTranCache( map, forward, forward1, forward2, &local_cache,
+                         status );
+
 /* Mappings in series. */
 /* ------------------- */
 /* If required, use the two component Mappings in series. To do this, we must
@@ -3764,43 +5029,52 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
          nin = astGetNcoord( in );
          nout = astGetNcoord( result );
 
+/* If a plan was created that expands any nested series CmpMaps and
+   fuses adjacent affine Mappings, use it to transform the points. */
+         if( cache->plan ) {
+            ApplyPlan( cache, in, result, status );
+
+/* Otherwise, apply the two component Mappings in turn. */
+         } else {
+
 /* Loop to process all the points in batches, of maximum size nbatch points. */
-         for ( ipoint1 = 0; ipoint1 < npoint; ipoint1 += nbatch ) {
+            for ( ipoint1 = 0; ipoint1 < npoint; ipoint1 += nbatch ) {
 
 /* Calculate the index of the final point in the batch and deduce the number of
    points (np) to be processed in this batch. */
-            ipoint2 = ipoint1 + nbatch - 1;
-            if ( ipoint2 > npoint - 1 ) ipoint2 = npoint - 1;
-            np = ipoint2 - ipoint1 + 1;
+               ipoint2 = ipoint1 + nbatch - 1;
+               if ( ipoint2 > npoint - 1 ) ipoint2 = npoint - 1;
+               np = ipoint2 - ipoint1 + 1;
 
 /* Create temporary PointSets to describe the input and output points for this
    batch. */
-            temp1 = astPointSet( np, nin, "", status );
-            temp2 = astPointSet( np, nout, "", status );
+               temp1 = astPointSet( np, nin, "", status );
+               temp2 = astPointSet( np, nout, "", status );
 
 /* Associate the required subsets of the input and output coordinates with the
    two PointSets. */
-            astSetSubPoints( in, ipoint1, 0, temp1 );
-            astSetSubPoints( result, ipoint1, 0, temp2 );
+               astSetSubPoints( in, ipoint1, 0, temp1 );
+               astSetSubPoints( result, ipoint1, 0, temp2 );
 
 /* Apply the two Mappings in sequence and in the required order and direction.
    Store the intermediate result in a temporary PointSet (temp) which is
    created by the first Mapping applied. */
-            if ( forward ) {
-               temp = astTransform( map->map1, temp1, forward1, NULL );
-               (void) astTransform( map->map2, temp, forward2, temp2 );
-            } else {
-               temp = astTransform( map->map2, temp1, forward2, NULL );
-               (void) astTransform( map->map1, temp, forward1, temp2 );
-            }
+               if ( forward ) {
+                  temp = astTransform( map->map1, temp1, forward1, NULL );
+                  (void) astTransform( map->map2, temp, forward2, temp2 );
+               } else {
+                  temp = astTransform( map->map2, temp1, forward2, NULL );
+                  (void) astTransform( map->map1, temp, forward1, temp2 );
+               }
 
 /* Delete the temporary PointSets after processing each batch of points. */
-            temp = astDelete( temp );
-            temp1 = astDelete( temp1 );
-            temp2 = astDelete( temp2 );
+               temp = astDelete( temp );
+               temp1 = astDelete( temp1 );
+               temp2 = astDelete( temp2 );
 
 /* Quit processing batches if an error occurs. */
-            if ( !astOK ) break;
+               if ( !astOK ) break;
+            }
          }
 
 /* Mappings in parallel. */
@@ -3818,41 +5092,31 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
          nin2 = forward2 ? astGetNin( map->map2 ) : astGetNout( map->map2 );
          nout2 = forward2 ? astGetNout( map->map2 ) : astGetNin( map->map2 );
 
-/* Create temporary PointSets to describe the input and output coordinates for
-   the first Mapping. */
-         temp1 = astPointSet( npoint, nin1, "", status );
-         temp2 = astPointSet( npoint, nout1, "", status );
-
-/* Associate the required subsets of the input and output coordinates with
-   these PointSets. */
-         astSetSubPoints( in, 0, 0, temp1 );
-         astSetSubPoints( result, 0, 0, temp2 );
-
-/* Use the astTransform method to apply the coordinate transformation described
-   by the first Mapping. */
-         (void) astTransform( map->map1, temp1, forward1, temp2 );
-
-/* Delete the temporary PointSets. */
-         temp1 = astDelete( temp1 );
-         temp2 = astDelete( temp2 );
-
-/* Create a new pair of temporary PointSets to describe the input and output
-   coordinates for the second Mapping, and associate the required subsets of
-   the input and output coordinates with these PointSets. */
-         temp1 = astPointSet( npoint, nin2, "", status );
-         temp2 = astPointSet( npoint, nout2, "", status );
-         astSetSubPoints( in, 0, nin1, temp1 );
-         astSetSubPoints( result, 0, nout1, temp2 );
-
-/* Apply the coordinate transformation described by the second Mapping. */
-         (void) astTransform( map->map2, temp1, forward2, temp2 );
-
-/* Delete the two temporary PointSets. */
-         temp1 = astDelete( temp1 );
-         temp2 = astDelete( temp2 );
+/* Get PointSets that describe the required subsets of the input and output
+   coordinates for the first Mapping, and use the astTransform method to
+   apply the coordinate transformation it describes. The PointSets are
+   held in the work space, so that a compiled CmpMap can re-use them. */
+         ptr_in = astGetPoints( in );
+         ptr_out = astGetPoints( result );
+         if( astOK ) {
+            temp1 = TranWrapper( cache->wrap, nin1, npoint, ptr_in, status );
+            temp2 = TranWrapper( cache->wrap + 1, nout1, npoint, ptr_out,
+                                 status );
+            (void) astTransform( map->map1, temp1, forward1, temp2 );
+
+/* Do the same for the second Mapping. */
+            temp1 = TranWrapper( cache->wrap + 2, nin2, npoint, ptr_in + nin1,
+                                 status );
+            temp2 = TranWrapper( cache->wrap + 3, nout2, npoint,
+                                 ptr_out + nout1, status );
+            (void) astTransform( map->map2, temp1, forward2, temp2 );
+         }
       }
    }
 
+/* Release the work space. */
+   cache = ReleaseTranCache( map, forward, cache, status );
+
 /* If an error occurred, clean up by deleting the output PointSet (if
    allocated by this function) and setting a NULL result pointer. */
    if ( !astOK ) {
@@ -3911,9 +5175,12 @@ static void Copy( const AstObject *objin, AstObject *objout, int *status ) {
    out = (AstCmpMap *) objout;
 
 /* For safety, start by clearing any references to the input component
-   Mappings from the output CmpMap. */
+   Mappings from the output CmpMap. The output CmpMap does not share any
+   work space retained by a compiled input CmpMap. */
    out->map1 = NULL;
    out->map2 = NULL;
+   out->tran_cache[ 0 ] = NULL;
+   out->tran_cache[ 1 ] = NULL;
 
 /* Make copies of these Mappings and store pointers to them in the output
    CmpMap structure. */
@@ -3960,6 +5227,11 @@ static void Delete( AstObject *obj, int *status ) {
 /* Obtain a pointer to the CmpMap structure. */
    this = (AstCmpMap *) obj;
 
+/* Free any work space retained by a compiled CmpMap. This holds
+   pointers to the component Mappings, so do it first. */
+   this->tran_cache[ 0 ] = FreeTranCache( this->tran_cache[ 0 ], status );
+   this->tran_cache[ 1 ] = FreeTranCache( this->tran_cache[ 1 ], status );
+
 /* Annul the pointers to the component Mappings. */
    this->map1 = astAnnul( this->map1 );
    this->map2 = astAnnul( this->map2 );
@@ -4519,6 +5791,10 @@ AstCmpMap *astInitCmpMap_( void *mem, size_t size, int init,
 
 /* Initialise the CmpMap data. */
 /* --------------------------- */
+/* No work space is retained until the CmpMap is compiled. */
+         new->tran_cache[ 0 ] = NULL;
+         new->tran_cache[ 1 ] = NULL;
+
 /* Store pointers to the component Mappings. Extract Mappings if
    FrameSets are provided. */
          if( astIsAFrameSet( map1 ) ) {
@@ -4671,6 +5947,10 @@ AstCmpMap *astLoadCmpMap_( void *mem, size_t size,
 
    if ( astOK ) {
 
+/* Compiled CmpMaps are not dumped, so there is no retained work space. */
+      new->tran_cache[ 0 ] = NULL;
+      new->tran_cache[ 1 ] = NULL;
+
 /* Read input data. */
 /* ================ */
 /* Request the input Channel to read all the input data appropriate to
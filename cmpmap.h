@@ -129,6 +129,8 @@
 *        Over-ride the astSimplify method.
 *     8-JAN-2003 (DSB):
 *        Added protected astInitCmpMapVtab method.
+*     17-OCT-2026 (DSB):
+*        Added work space retained by compiled CmpMaps.
 *-
 */
 
@@ -174,6 +176,7 @@ typedef struct AstCmpMap {
    char invert1;                  /* Inversion flag for first Mapping */
    char invert2;                  /* Inversion flag for second Mapping */
    char series;                   /* Connect in series (else in parallel)? */
+   void *tran_cache[ 2 ];         /* Work space retained by compiled CmpMaps */
 } AstCmpMap;
 
 /* Virtual function table. */
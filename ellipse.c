@@ -65,6 +65,8 @@ f     - AST_ELLIPSEPARS: Get the geometric parameters of the Ellipse
 *     6-JAN-2014 (DSB):
 *        Ensure cached information is available in RegCentre even if no new
 *        centre is supplied.
+*     17-OCT-2026 (DSB):
+*        Added RegScan.
 *class--
 */
 
@@ -162,6 +164,7 @@ static AstPointSet *RegBaseMesh( AstRegion *, int * );
 static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static double *RegCentre( AstRegion *this, double *, double **, int, int, int * );
 static int RegPins( AstRegion *, AstPointSet *, AstRegion *, int **, int * );
+static int RegScan( AstRegion *, double, int *, double **, int * );
 static int RegTrace( AstRegion *, int, double *, double **, int * );
 static void Cache( AstEllipse *, int * );
 static void CalcPars( AstFrame *, double[2], double[2], double[2], double *, double *, double *, int * );
@@ -546,6 +549,7 @@ void astInitEllipseVtab_(  AstEllipseVtab *vtab, const char *name, int *status )
    region->RegBaseMesh = RegBaseMesh;
    region->RegBaseBox = RegBaseBox;
    region->RegCentre = RegCentre;
+   region->RegScan = RegScan;
    region->RegTrace = RegTrace;
 
 /* Store replacement pointers for methods which will be over-ridden by
@@ -1616,6 +1620,161 @@ static int RegPins( AstRegion *this_region, AstPointSet *pset, AstRegion *unc,
    return result;
 }
 
+static int RegScan( AstRegion *this_region, double y, int *nx, double **x,
+                    int *status ){
+/*
+*+
+*  Name:
+*     RegScan
+
+*  Purpose:
+*     Find where a row of constant Y crosses the boundary of a 2D Region.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "ellipse.h"
+*     int RegScan( AstRegion *this, double y, int *nx, double **x,
+*                  int *status )
+
+*  Class Membership:
+*     Ellipse member function (overrides the astRegScan method
+*     inherited from the parent Region class).
+
+*  Description:
+*     This function finds the places at which a line of constant value
+*     on the second axis of the base Frame of the supplied 2-dimensional
+*     Region crosses the boundary of the Region. Each crossing is
+*     returned as an interval along the first base Frame axis that is
+*     guaranteed to contain the crossing. See the description of
+*     astRegScan in the parent Region class for further details.
+*
+*     Only Ellipses defined within a simple 2-dimensional Frame (in
+*     which plane geometry applies) are supported.
+
+*  Parameters:
+*     this
+*        Pointer to the Region.
+*     y
+*        The value on the second base Frame axis at which the crossings
+*        are required. If this is AST__BAD, the function returns
+*        without action (but the returned function value still
+*        indicates if the method is supported or not).
+*     nx
+*        Pointer to an int in which to return the number of intervals.
+*     x
+*        Address of a pointer to an array in which to return the lower
+*        and upper bounds of each interval. The array is extended if
+*        necessary using astGrow.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Non-zero if the crossings can be found, and zero otherwise.
+
+*-
+*/
+
+/* Local Variables; */
+   AstEllipse *this;
+   AstFrame *frm;
+   const char *class;
+   double c1;
+   double c2;
+   double disc;
+   double dy;
+   double len;
+   double qa;
+   double qb;
+   double qc;
+   double ux;
+   double uy;
+   double x1;
+   double x2;
+   double ymax;
+   int result;
+
+/* Initialise */
+   result = 0;
+
+/* Check inherited status. */
+   if( ! astOK ) return result;
+
+/* Get a pointer to the base Frame in the encapsulated FrameSet. Check it
+   is a simple 2-dimensional Frame, so that we can assume plane geometry. */
+   frm = astGetFrame( this_region->frameset, AST__BASE );
+   class = astGetClass( frm );
+   if( astGetNaxes( frm ) == 2 && class && !strcmp( class, "Frame" ) ) {
+      result = 1;
+   }
+   frm = astAnnul( frm );
+
+/* Check we have a row to scan. */
+   if( result && y != AST__BAD ) {
+
+/* Get a pointer to the Ellipse structure. */
+      this = (AstEllipse *) this_region;
+
+/* Ensure cached information is available. */
+      Cache( this, status );
+      *nx = 0;
+      if( astOK ) {
+
+/* Get the unit vector along the primary axis. */
+         ux = ( this->point1 )[ 0 ] - ( this->centre )[ 0 ];
+         uy = ( this->point1 )[ 1 ] - ( this->centre )[ 1 ];
+         len = sqrt( ux*ux + uy*uy );
+         if( len > 0.0 ) {
+            ux /= len;
+            uy /= len;
+         } else {
+            ux = 1.0;
+            uy = 0.0;
+         }
+
+/* Rows that do not come within one unit of the ellipse have no
+   crossings. */
+         dy = y - ( this->centre )[ 1 ];
+         ymax = sqrt( this->a*this->a*uy*uy + this->b*this->b*ux*ux );
+         if( fabs( dy ) <= ymax + 1.0 ) {
+
+/* A point (dx,dy) relative to the centre is on the ellipse if its
+   components parallel (p) and perpendicular (q) to the primary axis
+   satisfy (p/a)**2 + (q/b)**2 = 1. Express this as a quadratic in dx
+   and solve it. Rows that just miss the ellipse are given a repeated
+   root so that the pixels near the tangent point are tested
+   individually. */
+            c1 = 1.0/( this->a*this->a );
+            c2 = 1.0/( this->b*this->b );
+            qa = ux*ux*c1 + uy*uy*c2;
+            qb = 2.0*dy*ux*uy*( c1 - c2 );
+            qc = dy*dy*( uy*uy*c1 + ux*ux*c2 ) - 1.0;
+            disc = qb*qb - 4.0*qa*qc;
+            disc = ( disc > 0.0 ) ? sqrt( disc ) : 0.0;
+            x1 = ( this->centre )[ 0 ] + ( -qb - disc )/( 2.0*qa );
+            x2 = ( this->centre )[ 0 ] + ( -qb + disc )/( 2.0*qa );
+
+/* Return an interval of half-width one unit around each root. */
+            *x = astGrow( *x, 4, sizeof( double ) );
+            if( astOK ) {
+               (*x)[ 0 ] = x1 - 1.0;
+               (*x)[ 1 ] = x1 + 1.0;
+               (*x)[ 2 ] = x2 - 1.0;
+               (*x)[ 3 ] = x2 + 1.0;
+               *nx = 2;
+            }
+         }
+      }
+   }
+
+/* If an error occurred, return zero. */
+   if( !astOK ) result = 0;
+
+/* Return the result. */
+   return result;
+}
+
 static int RegTrace( AstRegion *this_region, int n, double *dist, double **ptr,
                      int *status ){
 /*
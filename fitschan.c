@@ -1209,6 +1209,21 @@ f     - AST_WRITEFITS: Write all cards out to the sink function
 *        than on the basis of their class. This is because some linear
 *        combinations contain non-linear mappings (eg. a spherical
 *        rotation projected using a TAN projection).
+*     17-OCT-2026 (DSB):
+*        - The KeyMap holding the keywords in the FitsChan now records the
+*        number of cards with each keyword. This is used by FindKeyCard to
+*        avoid searching the list of cards for keywords that are not present,
+*        and corrects DeleteCard so that deleting one of several cards with
+*        the same keyword no longer causes HasCard to report the keyword as
+*        absent.
+*        - astPutCards now stores each card using the new private function
+*        PutCard, which inserts new cards directly rather than through the
+*        astSetFits<X> methods. Split now tries to read a single numerical
+*        value before trying to read a complex pair, and only checks for
+*        logical values if the value could be one.
+*        - NewCard now stores the data value and comment for each card in
+*        the same block of memory as the FitsCard structure, so that each
+*        card requires a single allocation.
 
 *class--
 */
@@ -1944,6 +1959,7 @@ static void MarkCard( AstFitsChan *, int * );
 static void NewCard( AstFitsChan *, const char *, int, const void *, const char *, int, int * );
 static void PreQuote( const char *, char [ AST__FITSCHAN_FITSCARDLEN - FITSNAMLEN - 3 ], int * );
 static void PurgeWCS( AstFitsChan *, int * );
+static void PutCard( AstFitsChan *, const char *, int, const char *, const char *, int * );
 static void PutCards( AstFitsChan *, const char *, int * );
 static void PutFits( AstFitsChan *, const char [ AST__FITSCHAN_FITSCARDLEN + 1 ], int, int * );
 static void PutTable( AstFitsChan *, AstFitsTable *, const char *, int * );
@@ -7847,6 +7863,7 @@ static void DeleteCard( AstFitsChan *this, const char *method,
    FitsCard *card;            /* Pointer to the current card */
    FitsCard *next;            /* Pointer to next card in list */
    FitsCard *prev;            /* Pointer to previous card in list */
+   int ncard;                 /* Number of cards with the same keyword */
 
 /* Return if the supplied object or current card is NULL. */
    if( !this || !this->card ) return;
@@ -7854,8 +7871,13 @@ static void DeleteCard( AstFitsChan *this, const char *method,
 /* Get a pointer to the card to be deleted (the current card). */
    card = (FitsCard *) this->card;
 
-/* Remove it from the KeyMap holding all keywords. */
-   astMapRemove( this->keywords, card->name );
+/* Decrement the number of cards with the same keyword in the KeyMap
+   holding all keywords, removing the entry if no such cards remain. */
+   if( astMapGet0I( this->keywords, card->name, &ncard ) && ncard > 1 ) {
+      astMapPut0I( this->keywords, card->name, ncard - 1, NULL );
+   } else {
+      astMapRemove( this->keywords, card->name );
+   }
 
 /* Move the current card on to the next card. */
    MoveCard( this, 1, method, class, status );
@@ -7873,13 +7895,8 @@ static void DeleteCard( AstFitsChan *this, const char *method,
    head. */
    if( this->head == (void *) card ) this->head = (void *) next;
 
-/* Free the memory used to hold the data value. */
-   (void) astFree( card->data );
-
-/* Free the memory used to hold any comment. */
-   if( card->comment ) (void) astFree( (void *) card->comment );
-
-/* Free the memory used to hold the whole structure. */
+/* Free the memory used to hold the whole structure. This includes the
+   data value and comment (see NewCard). */
    (void) astFree( (void *) card );
 
 /* Fix up the links between the two adjacent cards in the list, unless the
@@ -11626,8 +11643,6 @@ static int GetObjSize( AstObject *this_object, int *status ) {
    card = (FitsCard *) ( this->head );
    while( card ) {
       result += astTSizeOf( card );
-      result += card->size;
-      result += astTSizeOf( card->comment );
       card = GetLink( card, NEXT, "astGetObjSize", "FitsChan", status );
       if( (void *) card == this->head ) break;
    }
@@ -14050,6 +14065,9 @@ static int FindKeyCard( AstFitsChan *this, const char *name,
 */
 
 /* Local Variables: */
+   char uname[ FITSNAMLEN + 1 ]; /* Upper case copy of an exact keyword name */
+   int i;                /* Character index */
+   int ncard;            /* Number of cards with the required keyword */
    int nfld;             /* Number of fields in keyword template */
    int ret;              /* Was a card found? */
 
@@ -14059,6 +14077,39 @@ static int FindKeyCard( AstFitsChan *this, const char *name,
 /* Indicate that no card has been found yet. */
    ret = 0;
 
+/* If the template contains no field specifiers it can only match a
+   keyword with the same name (apart from case). In this case we use the
+   KeyMap holding the number of cards for each keyword to avoid searching
+   the list if there are no cards with the required name, and compare the
+   upper case names directly rather than using the Match function. */
+   i = strlen( name );
+   if( i > 0 && i <= FITSNAMLEN && !strchr( name, '%' ) ) {
+      for( i = 0; name[ i ]; i++ ) uname[ i ] = (char) toupper( (int) name[ i ] );
+      uname[ i ] = 0;
+
+/* Ensure the source function has been called before checking the
+   KeyMap, so that the KeyMap describes all the cards in the FitsChan. */
+      ReadFromSource( this, status );
+      if( !this->keywords || !astMapGet0I( this->keywords, uname, &ncard ) ||
+          ncard <= 0 ) {
+         this->card = NULL;
+         return 0;
+      }
+
+/* Search forward through the list until all cards have been checked. */
+      while( !astFitsEof( this ) && astOK ){
+         if( !strcmp( CardName( this, status ), uname ) ){
+            ret = 1;
+            break;
+         } else {
+            MoveCard( this, 1, method, class, status );
+         }
+      }
+
+/* Return. */
+      return ret;
+   }
+
 /* Search forward through the list until all cards have been checked. */
    while( !astFitsEof( this ) && astOK ){
 
@@ -22473,14 +22524,77 @@ static void NewCard( AstFitsChan *this, const char *name, int type,
    FitsCard *prev;            /* Pointer to the previous card in the list */
    char *b;                   /* Pointer to next stored character */
    const char *a;             /* Pointer to next supplied character */
+   const char *com;           /* Pointer to first comment character to store */
+   const void *dsrc;          /* Pointer to the data value to store */
    int lval;                  /* Logical data value restricted to 0 or 1 */
    int nc;                    /* No. of characters to store */
+   int ncard;                 /* No. of existing cards with the same keyword */
+   size_t dsize;              /* No. of bytes in the stored data value */
 
 /* Check the global status. */
    if( !astOK ) return;
 
-/* Get memory to hold the new FitsCard structure. */
-   new = (FitsCard *) astMalloc( sizeof( FitsCard ) );
+/* Find the data value to be stored and its size (ignore any data
+   supplied for an UNDEF value). */
+   dsrc = NULL;
+   dsize = 0;
+   if( data && type != AST__UNDEF ){
+
+/* Logical values are converted to zero or one before being stored. */
+      if( type == AST__LOGICAL ){
+         lval = *( (int *) data ) ? 1 : 0;
+         dsrc = &lval;
+         dsize = sizeof( int );
+
+/* String values are stored with a terminating null. */
+      } else if( type == AST__STRING || type == AST__CONTINUE ){
+         dsrc = data;
+         dsize = strlen( data ) + 1;
+
+/* Other types are stored as supplied. */
+      } else if( type == AST__INT ){
+         dsrc = data;
+         dsize = sizeof( int );
+      } else if( type == AST__FLOAT ){
+         dsrc = data;
+         dsize = sizeof( double );
+      } else if( type == AST__COMPLEXF ){
+         if( *( (double *) data ) != AST__BAD ) {
+            dsrc = data;
+            dsize = 2*sizeof( double );
+         } else {
+            dsrc = BAD_STRING;
+            dsize = strlen( BAD_STRING ) + 1;
+         }
+      } else if( type == AST__COMPLEXI ){
+         dsrc = data;
+         dsize = 2*sizeof( int );
+      }
+   }
+
+/* Find the first non-blank character in the comment, and find the used
+   length of the remaining string. We retain leading and trailing white
+   space if the card is a COMMENT card. */
+   com = comment;
+   if( com ){
+      if( type != AST__COMMENT ) {
+         while( isspace( *com ) ) com++;
+         nc = ChrLen( com, status );
+      } else {
+         nc = strlen( com );
+      }
+   } else {
+      nc = 0;
+   }
+
+/* Get memory to hold the new FitsCard structure, followed by the data
+   value and comment. Using a single block of memory for each card means
+   that reading a header does not require separate allocations for each
+   data value and comment. The structure size is a multiple of the
+   alignment of its pointer components, so the data value is suitably
+   aligned for storing double precision values. */
+   new = (FitsCard *) astMalloc( sizeof( FitsCard ) + dsize +
+                                 ( nc > 0 ? nc + 1 : 0 ) );
 
 /* Check the pointer can be used. */
    if( astOK ){
@@ -22496,83 +22610,29 @@ static void NewCard( AstFitsChan *this, const char *name, int type,
       if( !this->keywords ) this->keywords = astKeyMap( " ", status );
 
 /* Add the keyword name to the KeyMap. The value associated with the
-   KeyMap entry is not used and is set arbitrarily to zero. */
-      astMapPut0I( this->keywords, new->name, 0, NULL );
+   KeyMap entry is the number of cards in the FitsChan that have the
+   keyword. */
+      if( !astMapGet0I( this->keywords, new->name, &ncard ) ) ncard = 0;
+      astMapPut0I( this->keywords, new->name, ncard + 1, NULL );
 
 /* Copy the data type. */
       new->type = type;
 
-/* Copy any data (ignore any data supplied for an UNDEF value). */
-      if( data && type != AST__UNDEF ){
-
-/* Logical values are converted to zero or one before being stored. */
-         if( type == AST__LOGICAL ){
-            lval = *( (int *) data ) ? 1 : 0;
-            new->size = sizeof( int );
-            new->data = astStore( NULL, (void *) &lval, sizeof( int ) );
-
-/* String values... */
-         } else if( type == AST__STRING || type == AST__CONTINUE ){
-
-/* Find the number of characters excluding the trailing null character. */
-            nc = strlen( data );
-
-/* Store the string, reserving room for a terminating null. */
-            new->size = (size_t)( nc + 1 );
-            new->data = astStore( NULL, (void *) data, (size_t)( nc + 1 ) );
-
-/* Terminate it. */
-            ( (char *) new->data)[ nc ] = 0;
-
-/* Other types are stored as supplied. */
-         } else if( type == AST__INT ){
-            new->size = sizeof( int );
-            new->data = astStore( NULL, (void *) data, sizeof( int ) );
-         } else if( type == AST__FLOAT ){
-            new->size = sizeof( double );
-            new->data = astStore( NULL, (void *) data, sizeof( double ) );
-         } else if( type == AST__COMPLEXF ){
-            if( *( (double *) data ) != AST__BAD ) {
-               new->size = 2*sizeof( double );
-               new->data = astStore( NULL, (void *) data, 2*sizeof( double ) );
-            } else {
-               nc = strlen( BAD_STRING );
-               new->size = (size_t)( nc + 1 );
-               new->data = astStore( NULL, BAD_STRING, (size_t)( nc + 1 ) );
-               ( (char *) new->data)[ nc ] = 0;
-            }
-         } else if( type == AST__COMPLEXI ){
-            new->size = 2*sizeof( int );
-            new->data = astStore( NULL, (void *) data, 2*sizeof( int ) );
-         } else {
-            new->size = 0;
-            new->data = NULL;
-         }
+/* Copy any data value to the memory following the structure. */
+      new->size = dsize;
+      if( dsize > 0 ){
+         new->data = (void *) ( new + 1 );
+         memcpy( new->data, dsrc, dsize );
       } else {
-         new->size = 0;
          new->data = NULL;
       }
 
-/* Find the first non-blank character in the comment, and find the used
-   length of the remaining string. We retain leading and trailing white
-   space if the card is a COMMENT card. */
-      if( comment ){
-         a = comment;
-         if( type != AST__COMMENT ) {
-            while( isspace( *a ) ) a++;
-            nc = ChrLen( a, status );
-         } else {
-            nc = strlen( a );
-         }
-      } else {
-         nc = 0;
-      }
-
-/* Copy any comment, excluding leading and trailing white space unless
-   this is a COMMENT card */
+/* Copy any comment to the memory following the data value, excluding
+   leading and trailing white space unless this is a COMMENT card */
       if( nc > 0 ){
-         new->comment = astStore( NULL, (void *) a, (size_t)( nc + 1 ) );
-         ( (char *) new->comment)[ nc ] = 0;
+         new->comment = (char *) ( new + 1 ) + dsize;
+         memcpy( new->comment, com, (size_t) nc );
+         new->comment[ nc ] = 0;
       } else {
          new->comment = NULL;
       }
@@ -24267,6 +24327,197 @@ f        The global status.
 
 }
 
+static void PutCard( AstFitsChan *this, const char *card, int overwrite,
+                     const char *method, const char *class, int *status ){
+
+/*
+*  Name:
+*     PutCard
+
+*  Purpose:
+*     Store a single FITS header card in a FitsChan.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "fitschan.h"
+*     void PutCard( AstFitsChan *this, const char *card, int overwrite,
+*                   const char *method, const char *class, int *status )
+
+*  Class Membership:
+*     FitsChan member function.
+
+*  Description:
+*     This function splits the supplied header card into keyword name,
+*     value and comment, and stores it in the FitsChan, either in front
+*     of the current card or replacing the current card. It implements
+*     the astPutFits method, and is also used by astPutCards to store
+*     each card without the overheads of a public method invocation.
+
+*  Parameters:
+*     this
+*        Pointer to the FitsChan.
+*     card
+*        Pointer to a possibly null-terminated character string
+*        containing the FITS card to be stored. No more than 80
+*        characters will be used from this string.
+*     overwrite
+*        If non-zero, the new card replaces the current card. Otherwise
+*        it is inserted in front of the current card.
+*     method
+*        Pointer to string holding name of calling method.
+*     class
+*        Pointer to string holding object class.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Notes:
+*     -  The source function is not called by this function. It is
+*     assumed that the caller has already called ReadFromSource.
+*/
+
+/* Local Variables: */
+   char *comment;         /* The keyword comment */
+   char *name;            /* The keyword name */
+   char *value;           /* The keyword value */
+   const char *com;       /* The comment to store with a new card */
+   double cfval[2];       /* Complex floating point keyword value */
+   double fval;           /* floating point keyword value */
+   int cival[2];          /* Complex integer keyword value */
+   int ival;              /* Integer keyword value */
+   int len;               /* No. of characters to read from the value string */
+   int nc;                /* No. of characters read from value string */
+   int type;              /* Keyword data type */
+   void *data;            /* Pointer to the keyword value */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Split the supplied card up into name, value and commment strings, and
+   get pointers to local copies of them. The data type associated with the
+   keyword is returned. */
+   type = Split( this, card, &name, &value, &comment, method, class, status );
+
+/* Check that the pointers can be used. */
+   if( astOK ){
+
+/* Initialise the number of characters read from the value string, and
+   the pointer to the keyword value. */
+      nc = 0;
+      data = NULL;
+
+/* Store the number of characters in the value string. */
+      len = strlen( value );
+
+/* Read floating point values from the value string. NB, this list is
+   roughly in the order of descreasing frequency of use (i.e. most FITS
+   keywords are simple floating point values, the next most common are
+   strings, etc). */
+      if( type == AST__FLOAT ){
+         if( 1 == astSscanf( value, " %lf %n", &fval, &nc ) && nc >= len ){
+            data = &fval;
+         } else {
+            astError( AST__BDFTS, "%s(%s): Unable to read a floating point "
+                      "FITS keyword value.", status, method, class );
+         }
+
+/* String values are used as they are. */
+      } else if( type == AST__STRING || type == AST__CONTINUE ){
+         data = value;
+
+/* Comment cards and undefined values have no data value. */
+      } else if( type == AST__COMMENT || type == AST__UNDEF ){
+         data = NULL;
+
+/* Read integer values from the value string. */
+      } else if( type == AST__INT ){
+         if( 1 == astSscanf( value, " %d %n", &ival, &nc ) && nc >= len ){
+            data = &ival;
+         } else {
+            astError( AST__BDFTS, "%s(%s): Unable to read an integer FITS "
+                      "keyword value.", status, method, class );
+         }
+
+/* Read logical values from the value string. */
+      } else if( type == AST__LOGICAL ){
+         ival = ( *value == 'T' );
+         data = &ival;
+
+/* Read complex floating point values from the value string. */
+      } else if( type == AST__COMPLEXF ){
+         if( 2 == astSscanf( value, " %lf %lf %n", cfval, cfval + 1, &nc ) &&
+             nc >= len ){
+            data = cfval;
+         } else {
+            astError( AST__BDFTS, "%s(%s): Unable to read a complex pair "
+                      "of floating point FITS keyword values.", status, method, class );
+         }
+
+/* Read complex integer values from the value string. */
+      } else if( type == AST__COMPLEXI ){
+         if( 2 == astSscanf( value, " %d %d %n", cival, cival + 1, &nc ) &&
+             nc >= len ){
+            data = cival;
+         } else {
+            astError( AST__BDFTS, "%s(%s): Unable to read a complex pair "
+                      "of integer FITS keyword values.", status, method, class );
+         }
+
+/* Report an error for any other type. */
+      } else {
+         astError( AST__INTER, "%s: AST internal programming error - "
+                   "FITS data-type '%d' not yet supported.", status, method, type );
+      }
+
+/* If the new card is to be inserted in front of the current card there
+   is no existing card to take a comment or data value from, so store
+   the new card directly rather than using the astSetFits<X> method
+   (which would split the keyword name again). A blank comment is stored
+   as a NULL pointer. */
+      if( astOK && !overwrite ) {
+         com = ChrLen( comment, status ) ? comment : NULL;
+         InsCard( this, 0, name, type, data, com, method, class, status );
+
+/* Otherwise, use the astSetFits<X> method appropriate to the data type,
+   so that the comment and (for comment cards) the data value of the
+   current card are retained if required. */
+      } else if( astOK ) {
+         if( type == AST__FLOAT ){
+            astSetFitsF( this, name, fval, comment, overwrite );
+         } else if( type == AST__STRING ){
+            astSetFitsS( this, name, value, comment, overwrite );
+         } else if( type == AST__CONTINUE ){
+            astSetFitsCN( this, name, value, comment, overwrite );
+         } else if( type == AST__COMMENT ){
+            astSetFitsCom( this, name, comment, overwrite );
+         } else if( type == AST__INT ){
+            astSetFitsI( this, name, ival, comment, overwrite );
+         } else if( type == AST__LOGICAL ){
+            astSetFitsL( this, name, ival, comment, overwrite );
+         } else if( type == AST__UNDEF ){
+            astSetFitsU( this, name, comment, overwrite );
+         } else if( type == AST__COMPLEXF ){
+            astSetFitsCF( this, name, cfval, comment, overwrite );
+         } else if( type == AST__COMPLEXI ){
+            astSetFitsCI( this, name, cival, comment, overwrite );
+         }
+      }
+
+/* Give a context message if an error occurred. */
+      if( !astOK ){
+         astError( astStatus, "%s(%s): Unable to store the following FITS "
+                   "header card:\n%s\n", status, method, class, card );
+      }
+   }
+
+/* Free the memory used to hold the keyword name, comment and value
+   strings. */
+   (void) astFree( (void *) name );
+   (void) astFree( (void *) comment );
+   (void) astFree( (void *) value );
+}
+
 static void PutCards( AstFitsChan *this, const char *cards, int *status ) {
 
 /*
@@ -24328,6 +24579,7 @@ f        The global status.
 
 /* Local Variables: */
    const char *a;         /* Pointer to start of next card */
+   const char *class;     /* Object class */
    int clen;              /* Length of supplied string */
    int i;                 /* Card index */
    int ncard;             /* No. of cards supplied */
@@ -24348,7 +24600,10 @@ f        The global status.
    ncard = clen/80;
    if( ncard*80 < clen ) ncard++;
    a = cards;
-   for( i = 0; i < ncard; i++, a += 80 ) astPutFits( this, a, 1 );
+   class = astGetClass( this );
+   for( i = 0; i < ncard && astOK; i++, a += 80 ) {
+      PutCard( this, a, 0, "astPutCards", class, status );
+   }
 
 /* Rewind the FitsChan. */
    astClearCard( this );
@@ -24420,124 +24675,15 @@ f        The global status.
 *--
 */
 
-/* Local Variables: */
-   char *comment;         /* The keyword comment */
-   char *name;            /* The keyword name */
-   char *value;           /* The keyword value */
-   const char *class;     /* Object class */
-   const char *method;    /* Current method */
-   double cfval[2];       /* Complex floating point keyword value */
-   double fval;           /* floating point keyword value */
-   int cival[2];          /* Complex integer keyword value */
-   int ival;              /* Integer keyword value */
-   int len;               /* No. of characters to read from the value string */
-   int nc;                /* No. of characters read from value string */
-   int type;              /* Keyword data type */
-
 /* Check the global error status. */
    if ( !astOK ) return;
 
 /* Ensure the source function has been called */
    ReadFromSource( this, status );
 
-/* Store the current method, and the class of the supplied object for use
-   in error messages.*/
-   method = "astPutFits";
-   class = astGetClass( this );
-
-/* Split the supplied card up into name, value and commment strings, and
-   get pointers to local copies of them. The data type associated with the
-   keyword is returned. */
-   type = Split( this, card, &name, &value, &comment, method, class, status );
-
-/* Check that the pointers can be used. */
-   if( astOK ){
-
-/* Initialise the number of characters read from the value string. */
-      nc = 0;
-
-/* Store the number of characters in the value string. */
-      len = strlen( value );
-
-/* Read and store floating point values from the value string. NB, this
-   list is roughly in the order of descreasing frequency of use (i.e.
-   most FITS keywords are simple floating point values, the next most
-   common are strings, etc). */
-      if( type == AST__FLOAT ){
-         if( 1 == astSscanf( value, " %lf %n", &fval, &nc ) && nc >= len ){
-            astSetFitsF( this, name, fval, comment, overwrite );
-         } else {
-            astError( AST__BDFTS, "%s(%s): Unable to read a floating point "
-                      "FITS keyword value.", status, method, class );
-         }
-
-/* Read and store string values from the value string. */
-      } else if( type == AST__STRING ){
-         astSetFitsS( this, name, value, comment, overwrite );
-
-/* Read and store string values from the value string. */
-      } else if( type == AST__CONTINUE ){
-         astSetFitsCN( this, name, value, comment, overwrite );
-
-/* Store comment card. */
-      } else if( type == AST__COMMENT ){
-         astSetFitsCom( this, name, comment, overwrite );
-
-/* Read and store integer values from the value string. */
-      } else if( type == AST__INT ){
-         if( 1 == astSscanf( value, " %d %n", &ival, &nc ) && nc >= len ){
-            astSetFitsI( this, name, ival, comment, overwrite );
-         } else {
-            astError( AST__BDFTS, "%s(%s): Unable to read an integer FITS "
-                      "keyword value.", status, method, class );
-         }
-
-/* Read and store logical values from the value string. */
-      } else if( type == AST__LOGICAL ){
-         astSetFitsL( this, name, (*value == 'T'), comment, overwrite );
-
-/* Read and store undefined values from the value string. */
-      } else if( type == AST__UNDEF ){
-         astSetFitsU( this, name, comment, overwrite );
-
-/* Read and store complex floating point values from the value string. */
-      } else if( type == AST__COMPLEXF ){
-         if( 2 == astSscanf( value, " %lf %lf %n", cfval, cfval + 1, &nc ) &&
-             nc >= len ){
-            astSetFitsCF( this, name, cfval, comment, overwrite );
-         } else {
-            astError( AST__BDFTS, "%s(%s): Unable to read a complex pair "
-                      "of floating point FITS keyword values.", status, method, class );
-         }
-
-/* Read and store complex integer values from the value string. */
-      } else if( type == AST__COMPLEXI ){
-         if( 2 == astSscanf( value, " %d %d %n", cival, cival + 1, &nc ) &&
-             nc >= len ){
-            astSetFitsCI( this, name, cival, comment, overwrite );
-         } else {
-            astError( AST__BDFTS, "%s(%s): Unable to read a complex pair "
-                      "of integer FITS keyword values.", status, method, class );
-         }
-
-/* Report an error for any other type. */
-      } else {
-         astError( AST__INTER, "%s: AST internal programming error - "
-                   "FITS data-type '%d' not yet supported.", status, method, type );
-      }
-
-/* Give a context message if an error occurred. */
-      if( !astOK ){
-         astError( astStatus, "%s(%s): Unable to store the following FITS "
-                   "header card:\n%s\n", status, method, class, card );
-      }
-   }
-
-/* Free the memory used to hold the keyword name, comment and value
-   strings. */
-   (void) astFree( (void *) name );
-   (void) astFree( (void *) comment );
-   (void) astFree( (void *) value );
+/* Store the card. */
+   PutCard( this, card, overwrite, "astPutFits", astGetClass( this ),
+            status );
 }
 
 static void PutTable( AstFitsChan *this, AstFitsTable *table,
@@ -31153,8 +31299,14 @@ int Split( AstFitsChan *this, const char *card, char **name, char **value,
                while( *v0 && isspace( (int) *v0 ) ) v0++;
 
 /* See if the value string is one of the following strings (optionally
-   abbreviated and case insensitive): YES, NO, TRUE, FALSE. */
-               iopt = FullForm( "YES NO TRUE FALSE", v0, 1, status );
+   abbreviated and case insensitive): YES, NO, TRUE, FALSE. Numerical
+   values cannot match any of these, so only call FullForm if the first
+   character could start one of them. */
+               if( *v0 && strchr( "YNTFyntf", *v0 ) ) {
+                  iopt = FullForm( "YES NO TRUE FALSE", v0, 1, status );
+               } else {
+                  iopt = -1;
+               }
 
 /* Return the single character "T" or "F" at the start of the value string
    if the value matches one of the above strings. */
@@ -31178,35 +31330,37 @@ int Split( AstFitsChan *this, const char *card, char **name, char **value,
 /* If there are no dots (decimal points) or exponents (D or E) in the value... */
                   } else if( !strpbrk( v, ".EeDd" ) ){
 
-/* First attempt to read two integers from the string (separated by white
-   space). */
+/* First attempt to read a single integer from the string. This is
+   tried first since it is the most common case, and a string holding
+   two integers cannot be read as a single integer. */
                      if( nch = 0,
-                         ( 2 == astSscanf( v, " %d %d%n", &ir, &ii, &nch ) ) &&
+                         ( 1 == astSscanf( v, " %d%n", &ir, &nch ) ) &&
                          ( nch >= len ) ) {
-                        type = AST__COMPLEXI;
+                        type = AST__INT;
 
-/* If that failed, attempt to read a single integer from the string. */
+/* If that failed, attempt to read two integers from the string (separated
+   by white space). */
                      } else if( nch = 0,
-                         ( 1 == astSscanf( v, " %d%n", &ir, &nch ) ) &&
+                         ( 2 == astSscanf( v, " %d %d%n", &ir, &ii, &nch ) ) &&
                          ( nch >= len ) ) {
-                        type = AST__INT;
+                        type = AST__COMPLEXI;
                      }
 
 /* If there are dots (decimal points) in the value... */
                   } else {
 
-/* First attempt to read two doubles from the string (separated by white
-   space). */
+/* First attempt to read a single double from the string. */
                      if( nch = 0,
-                         ( 2 == astSscanf( v, " %lf %lf%n", &fr, &fi, &nch ) ) &&
+                         ( 1 == astSscanf( v, " %lf%n", &fr, &nch ) ) &&
                          ( nch >= len ) ) {
-                        type = AST__COMPLEXF;
+                        type = AST__FLOAT;
 
-/* If that failed, attempt to read a single double from the string. */
+/* If that failed, attempt to read two doubles from the string (separated
+   by white space). */
                      } else if( nch = 0,
-                         ( 1 == astSscanf( v, " %lf%n", &fr, &nch ) ) &&
+                         ( 2 == astSscanf( v, " %lf %lf%n", &fr, &fi, &nch ) ) &&
                          ( nch >= len ) ) {
-                        type = AST__FLOAT;
+                        type = AST__COMPLEXF;
                      }
 
 /* If both the above failed, it could be because the string contains a
@@ -31221,18 +31375,18 @@ int Split( AstFitsChan *this, const char *card, char **name, char **value,
                            if( v[ i ] == 'd' || v[ i ] == 'D' ) v[ i ] = 'e';
                         }
 
-/* Attempt to read two doubles from the edited string (separated by white
-   space). */
+/* Attempt to read a single double from the edited string. */
                         if( nch = 0,
-                          ( 2 == astSscanf( v, " %lf %lf%n", &fr, &fi, &nch ) ) &&
-                          ( nch >= len ) ) {
-                           type = AST__COMPLEXF;
-
-/* If that failed, attempt to read a single double from the edited string. */
-                        } else if( nch = 0,
                             ( 1 == astSscanf( v, " %lf%n", &fr, &nch ) ) &&
                             ( nch >= len ) ) {
                            type = AST__FLOAT;
+
+/* If that failed, attempt to read two doubles from the edited string
+   (separated by white space). */
+                        } else if( nch = 0,
+                          ( 2 == astSscanf( v, " %lf %lf%n", &fr, &fi, &nch ) ) &&
+                          ( nch >= len ) ) {
+                           type = AST__COMPLEXF;
                         }
                      }
                   }
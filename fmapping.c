@@ -14,6 +14,7 @@
 *     a public FORTRAN 77 interface to the Mapping class.
 
 *  Routines Defined:
+*     AST_COMPILE
 *     AST_DECOMPOSE
 *     AST_INVERT
 *     AST_ISAMAPPING
@@ -85,6 +86,8 @@
 *        Added AST_REMOVEREGIONS.
 *     4-MAY-2010 (DSB):
 *        Add support for AST__VARWGT flag to AST_REBINSEQ<X>.
+*     17-OCT-2026 (DSB):
+*        Added AST_COMPILE.
 */
 
 /* Define the astFORTRAN77 macro which prevents error messages from
@@ -213,6 +216,18 @@ static void ast_resample_ukern1( double offset, const double params[],
 /* ============================ */
 /* These functions implement the remainder of the FORTRAN interface. */
 
+F77_INTEGER_FUNCTION(ast_compile)( INTEGER(THIS),
+                                   INTEGER(STATUS) ) {
+   GENPTR_INTEGER(THIS)
+   F77_INTEGER_TYPE(RESULT);
+
+   astAt( "AST_COMPILE", NULL, 0 );
+   astWatchSTATUS(
+      RESULT = astP2I( astCompile( astI2P( *THIS ) ) );
+   )
+   return RESULT;
+}
+
 F77_SUBROUTINE(ast_decompose)( INTEGER(THIS),
                                INTEGER(MAP1),
                                INTEGER(MAP2),
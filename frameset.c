@@ -274,6 +274,12 @@ f     - AST_REMOVEFRAME: Remove a Frame from a FrameSet
 *        instead.
 *     11-DEC-2017 (DSB):
 *        Added method astGetNode.
+*     17-OCT-2026 (DSB):
+*        Cache the simplified Mappings used by astTransform and astRate,
+*        so that repeated transformations of small numbers of points do
+*        not need to re-assemble and re-simplify the Mapping each time.
+*     17-OCT-2026 (DSB):
+*        Over-ride the astCompile method.
 *class--
 */
 
@@ -871,6 +877,8 @@ static AstFrameSet *ConvertX( AstFrame *, AstFrame *, const char *, int * );
 static AstFrameSet *FindFrame( AstFrame *, AstFrame *, const char *, int * );
 static AstLineDef *LineDef( AstFrame *, const double[2], const double[2], int * );
 static AstMapping *CombineMaps( AstMapping *, int, AstMapping *, int, int, int * );
+static AstMapping *GetCachedMapping( AstFrameSet *, int, int, int * );
+static AstMapping *Compile( AstMapping *, int * );
 static AstMapping *GetMapping( AstFrameSet *, int, int, int * );
 static AstMapping *RemoveRegions( AstMapping *, int * );
 static AstMapping *Simplify( AstMapping *, int * );
@@ -959,6 +967,7 @@ static void Clear( AstObject *, const char *, int * );
 static void ClearAttrib( AstObject *, const char *, int * );
 static void ClearBase( AstFrameSet *, int * );
 static void ClearCurrent( AstFrameSet *, int * );
+static void ClearMappingCache( AstFrameSet *, int * );
 static void ClearDigits( AstFrame *, int * );
 static void ClearDirection( AstFrame *, int, int * );
 static void ClearDomain( AstFrame *, int * );
@@ -1329,6 +1338,9 @@ f     AST_SIMPLIFY
 /* Check the global error status. */
    if ( !astOK ) return;
 
+/* Discard any cached Mappings between Frames. */
+   ClearMappingCache( this, status );
+
 /* First handle cases where we are appending axes to the existing
    Frames in a FrameSet. */
    if( iframe == AST__ALLFRAMES ) {
@@ -1729,6 +1741,9 @@ f     AST_MIRRORVARIANTS routine
 /* Check the global error status. */
    if ( !astOK ) return;
 
+/* Discard any cached Mappings between Frames. */
+   ClearMappingCache( this, status );
+
 /* Get the one-based index of the current Frame. */
    icur = astGetCurrent( this );
 
@@ -1987,6 +2002,9 @@ static void AppendAxes( AstFrameSet *this, AstFrame *frame, int *status ) {
 /* Check the global error status. */
    if ( !astOK ) return;
 
+/* Discard any cached Mappings between Frames. */
+   ClearMappingCache( this, status );
+
 /* Loop round every Frame in the FrameSet. */
    for ( iframe = 0; iframe < this->nframe; iframe++ ) {
 
@@ -2900,6 +2918,54 @@ static void ClearCurrent( AstFrameSet *this, int *status ) {
    if ( astOK ) *( invert ? &this->base : &this->current ) = -INT_MAX;
 }
 
+static void ClearMappingCache( AstFrameSet *this, int *status ) {
+/*
+*  Name:
+*     ClearMappingCache
+
+*  Purpose:
+*     Empty the cache of simplified Mappings held in a FrameSet.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "frameset.h"
+*     void ClearMappingCache( AstFrameSet *this, int *status )
+
+*  Class Membership:
+*     FrameSet member function.
+
+*  Description:
+*     This function annuls any simplified Mappings stored in the
+*     FrameSet by GetCachedMapping. It should be called whenever the
+*     Frames, Mappings or nodes within the FrameSet are changed.
+
+*  Parameters:
+*     this
+*        Pointer to the FrameSet.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Notes:
+*     - This function attempts to execute even if the global error
+*     status is set.
+*/
+
+/* Local Variables: */
+   int icache;                   /* Index of cache entry */
+
+/* Annul the cached Mappings. */
+   for( icache = 0; icache < AST__FRAMESET_MAP_CACHE; icache++ ) {
+      if( this->map_cache[ icache ] ) {
+         this->map_cache[ icache ] = astAnnul( this->map_cache[ icache ] );
+      }
+      this->map_cache_from[ icache ] = AST__NOFRAME;
+      this->map_cache_to[ icache ] = AST__NOFRAME;
+   }
+   this->map_cache_next = 0;
+}
+
 static void ClearVariant( AstFrameSet *this, int *status ) {
 /*
 *+
@@ -3098,6 +3164,63 @@ static AstMapping *CombineMaps( AstMapping *mapping1, int invert1,
    return result;
 }
 
+static AstMapping *Compile( AstMapping *this_mapping, int *status ) {
+/*
+*  Name:
+*     Compile
+
+*  Purpose:
+*     Create a Mapping that retains work space for repeated use.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "frameset.h"
+*     AstMapping *Compile( AstMapping *this, int *status )
+
+*  Class Membership:
+*     FrameSet member function (over-rides the astCompile method
+*     inherited from the Mapping class).
+
+*  Description:
+*     This function returns a compiled copy of the Mapping from the base
+*     Frame to the current Frame of a FrameSet (see astCompile). The
+*     Frames themselves are not needed to transform points, so the
+*     returned Mapping is not a FrameSet.
+
+*  Parameters:
+*     this
+*        Pointer to the FrameSet.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     A pointer to the compiled Mapping.
+
+*  Notes:
+*     - A NULL pointer will be returned if this function is invoked with
+*     the global error status set, or if it should fail for any reason.
+*/
+
+/* Local Variables: */
+   AstMapping *map;              /* Base->current Mapping */
+   AstMapping *result;           /* Pointer to compiled Mapping */
+
+/* Check the global error status. */
+   if ( !astOK ) return NULL;
+
+/* Get the Mapping from the base Frame to the current Frame, and compile
+   it. */
+   map = astGetMapping( (AstFrameSet *) this_mapping, AST__BASE,
+                        AST__CURRENT );
+   result = astCompile( map );
+   map = astAnnul( map );
+
+/* Return the result. */
+   return result;
+}
+
 static AstFrameSet *Convert( AstFrame *from, AstFrame *to,
                              const char *domainlist, int *status ) {
 /*
@@ -4154,6 +4277,9 @@ static int ForceCopy( AstFrameSet *this, int iframe, int *status ) {
 /* Check the global error status. */
    if ( !astOK ) return result;
 
+/* Discard any cached Mappings between Frames. */
+   ClearMappingCache( this, status );
+
 /* Get a pointer to the structure holding thread-specific global data. */
    astGET_GLOBALS(this);
 
@@ -4521,6 +4647,12 @@ static int GetObjSize( AstObject *this_object, int *status ) {
       result += astGetObjSize( this->map[ inode ] );
    }
 
+   for ( inode = 0; inode < AST__FRAMESET_MAP_CACHE; inode++ ) {
+      if( this->map_cache[ inode ] ) {
+         result += astGetObjSize( this->map_cache[ inode ] );
+      }
+   }
+
    result += astTSizeOf( this->frame );
    result += astTSizeOf( this->varfrm );
    result += astTSizeOf( this->node );
@@ -4906,6 +5038,140 @@ static int GetBase( AstFrameSet *this, int *status ) {
    return result;
 }
 
+static AstMapping *GetCachedMapping( AstFrameSet *this, int iframe1,
+                                     int iframe2, int *status ) {
+/*
+*  Name:
+*     GetCachedMapping
+
+*  Purpose:
+*     Obtain a cached Mapping between two Frames in a FrameSet.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "frameset.h"
+*     AstMapping *GetCachedMapping( AstFrameSet *this, int iframe1,
+*                                   int iframe2, int *status )
+
+*  Class Membership:
+*     FrameSet member function.
+
+*  Description:
+*     This function returns a pointer to a Mapping that will convert
+*     coordinates between the coordinate systems represented by two
+*     Frames in a FrameSet. If possible, the Mapping returned by
+*     astGetMapping is simplified and retained within the FrameSet, so
+*     that subsequent calls requesting the same pair of Frames can return
+*     it without needing to find the path between the Frames, assemble
+*     the Mappings along the path and simplify the result. Otherwise, the
+*     unsimplified Mapping returned by astGetMapping is returned.
+
+*  Parameters:
+*     this
+*        Pointer to the FrameSet.
+*     iframe1
+*        The index of the first Frame in the FrameSet. This Frame describes
+*        the coordinate system for the "input" end of the Mapping. A value
+*        of AST__BASE or AST__CURRENT may also be given.
+*     iframe2
+*        The index of the second Frame in the FrameSet. This Frame
+*        describes the coordinate system for the "output" end of the
+*        Mapping. A value of AST__BASE or AST__CURRENT may also be given.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Pointer to the Mapping.
+
+*  Notes:
+*     - The returned Mapping may be shared with the FrameSet and so must
+*     not be modified. It should be annulled when no longer required.
+*     - The cache is emptied by ClearMappingCache whenever the structure
+*     of the FrameSet is changed. Mappings are not cached if the FrameSet
+*     contains any Frames that are not equivalent to a UnitMap (e.g.
+*     Regions), since such Frames may be modified by using the pointers
+*     returned by astGetFrame. Nor are they cached if any of the Mappings
+*     in the FrameSet are referenced from elsewhere (e.g. by a pointer
+*     passed to astRemapFrame that has not yet been annulled), since
+*     such Mappings could be modified without the FrameSet knowing.
+*     - A NULL pointer will be returned if this function is invoked with
+*     the global error status set, or if it should fail for any reason.
+*/
+
+/* Local Variables: */
+   AstMapping *map;              /* Unsimplified Mapping */
+   AstMapping *result;           /* Returned pointer */
+   int cache;                    /* Can the Mapping be cached? */
+   int icache;                   /* Index of cache entry */
+   int iframe;                   /* Frame index */
+   int inode;                    /* Node index */
+
+/* Initialise. */
+   result = NULL;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Validate and translate the Frame indices supplied. */
+   iframe1 = astValidateFrameIndex( this, iframe1, "astGetMapping" );
+   iframe2 = astValidateFrameIndex( this, iframe2, "astGetMapping" );
+
+/* Look for a cached Mapping between the two Frames. */
+   for( icache = 0; icache < AST__FRAMESET_MAP_CACHE; icache++ ) {
+      if( this->map_cache[ icache ] &&
+          this->map_cache_from[ icache ] == iframe1 &&
+          this->map_cache_to[ icache ] == iframe2 ) {
+         result = astClone( this->map_cache[ icache ] );
+         break;
+      }
+   }
+
+/* If none was found, get the Mapping. */
+   if( !result && astOK ) {
+      map = astGetMapping( this, iframe1, iframe2 );
+
+/* The Mapping can only be cached if the FrameSet contains no Frames that
+   are not equivalent to a UnitMap, and no Mappings that are shared with
+   other Objects. */
+      cache = astOK;
+      for( iframe = 0; iframe < this->nframe && cache; iframe++ ) {
+         if( !astIsUnitFrame( this->frame[ iframe ] ) ) cache = 0;
+      }
+      for( inode = 0; inode < this->nnode - 1 && cache; inode++ ) {
+         if( astGetRefCount( this->map[ inode ] ) > 1 ) cache = 0;
+      }
+
+/* If so, simplify the Mapping and cache the result, replacing the oldest
+   entry if the cache is full. Otherwise, return the unsimplified Mapping,
+   since simplifying it afresh on every call would cost more than it
+   saves. */
+      if( cache && astOK ) {
+         result = astSimplify( map );
+         map = astAnnul( map );
+
+         icache = this->map_cache_next;
+         if( this->map_cache[ icache ] ) {
+            this->map_cache[ icache ] = astAnnul( this->map_cache[ icache ] );
+         }
+         this->map_cache[ icache ] = astClone( result );
+         this->map_cache_from[ icache ] = iframe1;
+         this->map_cache_to[ icache ] = iframe2;
+         this->map_cache_next = ( icache + 1 ) % AST__FRAMESET_MAP_CACHE;
+
+      } else {
+         result = map;
+      }
+   }
+
+/* If an error occurred, annul the returned Mapping. */
+   if ( !astOK ) result = astAnnul( result );
+
+/* Return the result. */
+   return result;
+}
+
 static int GetCurrent( AstFrameSet *this, int *status ) {
 /*
 *+
@@ -6060,6 +6326,7 @@ void astInitFrameSetVtab_(  AstFrameSetVtab *vtab, const char *name, int *status
    object->Equal = Equal;
    object->Cast = Cast;
 
+   mapping->Compile = Compile;
    mapping->GetIsLinear = GetIsLinear;
    mapping->GetNin = GetNin;
    mapping->GetNout = GetNout;
@@ -6889,6 +7156,12 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
                                             fail );
    }
 
+   for ( i = 0; i < AST__FRAMESET_MAP_CACHE; i++ ) {
+      if( !result && this->map_cache[ i ] ) {
+         result = astManageLock( this->map_cache[ i ], mode, extra, fail );
+      }
+   }
+
    return result;
 
 }
@@ -7365,6 +7638,9 @@ f     AST_ADDVARIANT
 /* Check the global error status. */
    if ( !astOK ) return;
 
+/* Discard any cached Mappings between Frames. */
+   ClearMappingCache( this, status );
+
 /* Get the current Frame index. */
    icur = astGetCurrent( this );
 
@@ -8138,7 +8414,7 @@ static double Rate( AstMapping *this_mapping, double *at, int ax1, int ax2, int
 /* Obtain the Mapping between the base and current Frames in the
    FrameSet (note this takes account of whether the FrameSet has been
    inverted). */
-   map = astGetMapping( this, AST__BASE, AST__CURRENT );
+   map = GetCachedMapping( this, AST__BASE, AST__CURRENT, status );
 
 /* Invoke the astRate method on the Mapping. */
    result = astRate( map, at, ax1, ax2 );
@@ -8303,6 +8579,9 @@ f     (AST_REMOVEFRAME).
 /* Check the global error status. */
    if ( !astOK ) return;
 
+/* Discard any cached Mappings between Frames. */
+   ClearMappingCache( this, status );
+
 /* Validate and translate the Frame index supplied. */
    iframe = astValidateFrameIndex( this, iframe, "astRemapFrame" );
 
@@ -8466,6 +8745,9 @@ f     IFRAME argument to specify the base Frame or the current
 /* Check the global error status. */
    if ( !astOK ) return;
 
+/* Discard any cached Mappings between Frames. */
+   ClearMappingCache( this, status );
+
 /* Validate and translate the Frame index supplied. */
    iframe = astValidateFrameIndex( this, iframe, "astRemoveFrame" );
    if ( astOK ) {
@@ -8580,6 +8862,9 @@ static void RemoveMirrors( AstFrameSet *this, int iframe, int *status ) {
 /* Check the global error status. */
    if ( !astOK ) return;
 
+/* Discard any cached Mappings between Frames. */
+   ClearMappingCache( this, status );
+
 /* Iniitalise a list to hold the indices of the FRames that mirror
    "iframe". */
    nfrm = 0;
@@ -9676,6 +9961,9 @@ static void SetVariant( AstFrameSet *this, const char *variant, int *status ) {
 /* Check the global error status. */
    if ( !astOK ) return;
 
+/* Discard any cached Mappings between Frames. */
+   ClearMappingCache( this, status );
+
 /* Get a copy of the supplied string and clean it. */
    myvar = astStore( NULL, variant, strlen( variant ) + 1 );
    astRemoveLeadingBlanks( myvar );
@@ -10827,6 +11115,9 @@ static void TidyNodes( AstFrameSet *this, int *status ) {
 /* Check the global error status. */
    if ( !astOK ) return;
 
+/* Discard any cached Mappings between Frames. */
+   ClearMappingCache( this, status );
+
 /* Loop to search for unnecessary nodes until no more are found. */
    needed = 0;
    while ( !needed ) {
@@ -11038,7 +11329,7 @@ static AstPointSet *Transform( AstMapping *this_mapping, AstPointSet *in,
 /* Obtain the Mapping between the base and current Frames in the
    FrameSet (note this takes account of whether the FrameSet has been
    inverted). */
-   map = astGetMapping( this, AST__BASE, AST__CURRENT );
+   map = GetCachedMapping( this, AST__BASE, AST__CURRENT, status );
 
 /* Apply the Mapping to the input PointSet. */
    result = astTransform( map, in, forward, out );
@@ -12069,6 +12360,15 @@ static void Copy( const AstObject *objin, AstObject *objout, int *status ) {
    out->link = NULL;
    out->invert = NULL;
 
+/* The output FrameSet starts with an empty cache of Mappings between
+   Frames. */
+   for ( inode = 0; inode < AST__FRAMESET_MAP_CACHE; inode++ ) {
+      out->map_cache[ inode ] = NULL;
+      out->map_cache_from[ inode ] = AST__NOFRAME;
+      out->map_cache_to[ inode ] = AST__NOFRAME;
+   }
+   out->map_cache_next = 0;
+
 /* Allocate memory in the output FrameSet to store the Frame and node
    information and copy scalar information across. */
    out->frame = astMalloc( sizeof( AstFrame * ) * (size_t) in->nframe );
@@ -12154,6 +12454,9 @@ static void Delete( AstObject *obj, int *status ) {
 /* Obtain a pointer to the FrameSet structure. */
    this = (AstFrameSet *) obj;
 
+/* Annul any cached Mappings between Frames. */
+   ClearMappingCache( this, status );
+
 /* Annul all Frame pointers and clear the node numbers associated with
    them. */
    for ( iframe = 0; iframe < this->nframe; iframe++ ) {
@@ -12587,6 +12890,13 @@ AstFrameSet *astInitFrameSet_( void *mem, size_t size, int init,
 
 /* Initialise the FrameSet data. */
 /* ----------------------------- */
+/* Start with an empty cache of Mappings between Frames. */
+      for ( inode = 0; inode < AST__FRAMESET_MAP_CACHE; inode++ ) {
+         new->map_cache[ inode ] = NULL;
+         new->map_cache_from[ inode ] = AST__NOFRAME;
+         new->map_cache_to[ inode ] = AST__NOFRAME;
+      }
+      new->map_cache_next = 0;
 
 /* Normal Frame supplied. */
 /* ---------------------- */
@@ -12843,6 +13153,14 @@ AstFrameSet *astLoadFrameSet_( void *mem, size_t size,
       new->nnode = astReadInt( channel, "nnode", new->nframe );
       if ( new->nnode < 1 ) new->nnode = 1;
 
+/* Start with an empty cache of Mappings between Frames. */
+      for ( inode = 0; inode < AST__FRAMESET_MAP_CACHE; inode++ ) {
+         new->map_cache[ inode ] = NULL;
+         new->map_cache_from[ inode ] = AST__NOFRAME;
+         new->map_cache_to[ inode ] = AST__NOFRAME;
+      }
+      new->map_cache_next = 0;
+
 /* Allocate memory to hold Frame and node information. */
       new->frame = astMalloc( sizeof( AstFrame *) * (size_t) new->nframe );
       new->node = astMalloc( sizeof( int ) * (size_t) new->nframe );
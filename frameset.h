@@ -428,6 +428,8 @@
 *        Over-ride the astUnformat method.
 *     8-JAN-2003 (DSB):
 *        Added protected astInitFrameSetVtab method.
+*     17-OCT-2026 (DSB):
+*        Added a cache of simplified Mappings between Frames.
 *-
 */
 
@@ -465,6 +467,7 @@
 #define AST__ALLFRAMES (-199)    /* A value representing all Frames */
 #define AST__FRAMESET_GETALLVARIANTS_BUFF_LEN 200 /* Length for AllVariants buffer */
 #define AST__FRAMESET_GETATTRIB_BUFF_LEN 200 /* Length for GetAtribb buffer */
+#define AST__FRAMESET_MAP_CACHE 4 /* No. of cached inter-Frame Mappings */
 
 /* Type Definitions. */
 /* ================= */
@@ -488,6 +491,13 @@ typedef struct AstFrameSet {
    int current;                  /* Index of current Frame */
    int nframe;                   /* Number of Frames */
    int nnode;                    /* Number of nodes */
+   AstMapping *map_cache[ AST__FRAMESET_MAP_CACHE ]; /* Cached simplified
+                                    Mappings between pairs of Frames */
+   int map_cache_from[ AST__FRAMESET_MAP_CACHE ]; /* Index of Frame at
+                                    start of each cached Mapping */
+   int map_cache_to[ AST__FRAMESET_MAP_CACHE ]; /* Index of Frame at
+                                    end of each cached Mapping */
+   int map_cache_next;           /* Index of next cache entry to use */
 } AstFrameSet;
 
 /* Virtual function table. */
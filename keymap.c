@@ -194,6 +194,12 @@ f     - AST_MAPTYPE: Return the data type of a named entry in a map
 *         into a KeyMap using astMapPutElemC.
 *     16-MAR-2017 (DSB):
 *         Added astMapGetC.
+*     17-OCT-2026 (DSB):
+*         Use an open addressing hash table with linear probing in place
+*         of the table of linked lists, and store each key string in the
+*         same memory block as its MapEntry. astMapKey now remembers the
+*         position of the previous key so that looping over all keys is no
+*         longer quadratic in the number of entries.
 *class--
 */
 
@@ -207,9 +213,14 @@ f     - AST_MAPTYPE: Return the data type of a named entry in a map
 /* Minimum size for the hash table. */
 #define MIN_TABLE_SIZE 16
 
-/* The maximum number of entries per element of the hash table. If this
-   value is exceeded the hash table will be doubled in size. */
-#define MAX_ENTRIES_PER_TABLE_ENTRY 10
+/* The number of hash table elements to allocate for each entry. The hash
+   table is doubled in size if it becomes more full than this. Keeping the
+   table sparse ensures that the probe sequences used to find an entry are
+   short. */
+#define TABLE_SIZE_PER_ENTRY 2
+
+/* Default value for the SizeGuess attribute. */
+#define DEFAULT_SIZEGUESS 160
 
 /* String used to represent the formatetd version of AST__BAD. */
 #define BAD_STRING "<bad>"
@@ -449,11 +460,11 @@ AstKeyMap *astKeyMapId_( const char *, ... );
 
 /* Prototypes for Private Member Functions. */
 /* ======================================== */
-static AstMapEntry *AddTableEntry( AstKeyMap *, int, AstMapEntry *, int, int * );
+static AstMapEntry *AddTableEntry( AstKeyMap *, AstMapEntry *, int, int * );
 static AstMapEntry *CopyMapEntry( AstMapEntry *, int * );
 static AstMapEntry *FreeMapEntry( AstMapEntry *, int * );
-static AstMapEntry *RemoveTableEntry( AstKeyMap *, int, const char *, int * );
-static AstMapEntry *SearchTableEntry( AstKeyMap *, int, const char *, int * );
+static AstMapEntry *RemoveTableEntry( AstKeyMap *, unsigned long, const char *, int * );
+static AstMapEntry *SearchTableEntry( AstKeyMap *, unsigned long, const char *, int * );
 static const char *ConvertKey( AstKeyMap *, const char *, char *, int, const char *, int * );
 static const char *GetKey( AstKeyMap *, int index, int * );
 static const char *MapIterate( AstKeyMap *, int, int * );
@@ -462,7 +473,6 @@ static const char *SortByString( int, const char *, int * );
 static int CompareEntries( const void *, const void * );
 static int ConvertValue( void *, int, void *, int, int * );
 static int GetObjSize( AstObject *, int * );
-static int HashFun( const char *, int, unsigned long *, int * );
 static int KeyCmp( const char *, const char * );
 static int MapDefined( AstKeyMap *, const char *, int * );
 static int MapGet0A( AstKeyMap *, const char *, AstObject **, int * );
@@ -497,6 +507,7 @@ static int MapSize( AstKeyMap *, int * );
 static int MapType( AstKeyMap *, const char *, int * );
 static int SortByInt( const char *, const char *, int * );
 static size_t SizeOfEntry( AstMapEntry *, int * );
+static unsigned long HashFun( const char *, int * );
 static void AddToObjectList( AstKeyMap *, AstMapEntry *, int * );
 static void AddToSortedList( AstKeyMap *, AstMapEntry *, int * );
 static void CheckCircle( AstKeyMap *, AstObject *, const char *, int * );
@@ -506,7 +517,7 @@ static void Delete( AstObject *, int * );
 static void DoubleTableSize( AstKeyMap *, int * );
 static void Dump( AstObject *, AstChannel *, int * );
 static void DumpEntry( AstMapEntry *, AstChannel *, int, int * );
-static void FreeTableEntry( AstKeyMap *, int itab, int * );
+static void FreeTableEntry( AstKeyMap *, int, int * );
 static void InitMapEntry( AstMapEntry *, int, int, int * );
 static void MapCopy( AstKeyMap *, AstKeyMap *, int * );
 static void MapPut0A( AstKeyMap *, const char *, AstObject *, const char *, int * );
@@ -577,42 +588,39 @@ static int ManageLock( AstObject *, int, int, AstObject **, int * );
 
 /* Member functions. */
 /* ================= */
-static AstMapEntry *AddTableEntry( AstKeyMap *this, int itab,
-                                   AstMapEntry *entry, int keymember,
-                                   int *status ){
+static AstMapEntry *AddTableEntry( AstKeyMap *this, AstMapEntry *entry,
+                                   int keymember, int *status ){
 /*
 *  Name:
 *     AddTableEntry
 
 *  Purpose:
-*     Add an new entry to a linked-list of KeyMap entries.
+*     Add an new entry to the hash table of a KeyMap.
 
 *  Type:
 *     Private function.
 
 *  Synopsis:
 *     #include "keymap.h"
-*     AstMapEntry *AddTableEntry( AstKeyMap *this, int itab,
-*                                 AstMapEntry *entry, int keymember,
-*                                 int *status ){
+*     AstMapEntry *AddTableEntry( AstKeyMap *this, AstMapEntry *entry,
+*                                 int keymember, int *status ){
 
 *  Class Membership:
 *     KeyMap member function.
 
 *  Description:
-*     This function adds the supplied MapEntry to the head of the linked
-*     list of MapEntries stored at the specified entry of the hash table.
-*     If this results in the linked list having too many entries, then a
-*     new larger hash table is allocated and the entries in the existing
-*     table are moved into the new table.
+*     This function stores the supplied MapEntry in the first free element
+*     of the hash table, starting at the element selected by the full width
+*     hash value stored in the MapEntry. If this results in the table
+*     being too full, then a new larger hash table is allocated and the
+*     entries in the existing table are moved into the new table.
 
 *  Parameters:
 *     this
 *        Pointer to the KeyMap.
-*     itab
-*        Index of the hash table element to be searched.
 *     entry
-*        Pointer to the MapEntry to be added.
+*        Pointer to the MapEntry to be added. The KeyMap must not already
+*        contain an entry with the same key.
 *     keymember
 *        A unique integer identifier for the key that increases
 *        monotonically with age of the key. If this is negative,
@@ -625,19 +633,32 @@ static AstMapEntry *AddTableEntry( AstKeyMap *this, int itab,
 
 */
 
+/* Local Variables: */
+   int bitmask;            /* Mask to select table index from hash value */
+   int itab;               /* Index of hash table element to use */
+
 /* Check the global error status. */
    if ( !astOK ) return NULL;
 
-/* Put a pointer to the MapEntry which is currently at the head of the
-   linked list in the "next" component of the supplied MapEntry. */
-   entry->next = this->table[ itab ];
+/* If the table would become too full, double its size. */
+   if( TABLE_SIZE_PER_ENTRY*( this->nentry + 1 ) > this->mapsize ) {
+      DoubleTableSize( this, status );
+      if( !astOK ) return NULL;
+   }
+
+/* Starting at the element selected by the hash value, find the first
+   free element of the hash table. */
+   bitmask = this->mapsize - 1;
+   itab = entry->hash & bitmask;
+   while( this->table[ itab ] ) itab = ( itab + 1 ) & bitmask;
 
-/* Store the supplied MapEntry pointer in the requested element of the
-   hash table. */
+/* Store the supplied MapEntry pointer and its hash value in the table. */
    this->table[ itab ] = entry;
+   this->hashes[ itab ] = entry->hash;
 
-/* Increment the length of linked list. */
-   this->nentry[ itab ]++;
+/* Increment the number of entries in the table. */
+   this->nentry++;
+   this->key_index = -1;
 
 /* Each new entry added to the KeyMap has a unique member index that is
    never re-used. */
@@ -660,13 +681,6 @@ static AstMapEntry *AddTableEntry( AstKeyMap *this, int itab,
    list of AST__OBJECTTYPE entries in the KeyMap. */
    AddToObjectList( this, entry, status );
 
-/* If the population of this table entry is now too large, double the size
-   of the table, moving the table entries to appropriate places in the
-   new larger table. */
-   if( this->nentry[ itab ] > MAX_ENTRIES_PER_TABLE_ENTRY ) {
-      DoubleTableSize( this, status );
-   }
-
 /* Return a NULL pointer. */
    return NULL;
 }
@@ -1120,7 +1134,6 @@ static void ClearKeyCase( AstKeyMap *this, int *status ) {
 
 /* Local Variables: */
    int defval;                /* Default KeyCase value */
-   int itab;                  /* Index into hash table */
    int oldval;                /* Old KeyCase value */
 
 /* Check the global error status. */
@@ -1138,16 +1151,11 @@ static void ClearKeyCase( AstKeyMap *this, int *status ) {
 /* If the old value and the default value are not the same, we must check
    that the KeyMap is empty. If not, restore the old value and report an
    error. */
-   if( defval != oldval ) {
-      for( itab = 0; itab < this->mapsize; itab++ ) {
-         if( this->nentry[ itab ] > 0 ) {
-            this->keycase = oldval;
-            astError( AST__NOWRT, "astClearAttrib(KeyMap): Illegal attempt to "
-                      "clear the KeyCase attribute of a non-empty KeyMap.",
-                      status);
-            break;
-         }
-      }
+   if( defval != oldval && this->nentry > 0 ) {
+      this->keycase = oldval;
+      astError( AST__NOWRT, "astClearAttrib(KeyMap): Illegal attempt to "
+                "clear the KeyCase attribute of a non-empty KeyMap.",
+                status);
    }
 }
 
@@ -1198,11 +1206,9 @@ static void ClearKeyError( AstKeyMap *this, int *status ) {
 /* Loop round each entry in the hash table. */
    for( i = 0; i < this->mapsize; i++ ) {
 
-/* Get a pointer to the next KeyMap entry. */
+/* Get a pointer to the KeyMap entry (if any) in this element. */
       next = this->table[ i ];
-
-/* Loop round all entries in this element of the hash table. */
-      while( next && astOK ) {
+      if( next && astOK ) {
 
 /* If this entry has an Object data type, see if holds any KeyMaps. */
          if( next->type == AST__OBJECTTYPE ) {
@@ -1225,9 +1231,6 @@ static void ClearKeyError( AstKeyMap *this, int *status ) {
                }
             }
          }
-
-/* Get a pointer to the next entry. */
-         next = next->next;
       }
    }
 }
@@ -1279,11 +1282,9 @@ static void ClearMapLocked( AstKeyMap *this, int *status ) {
 /* Loop round each entry in the hash table. */
    for( i = 0; i < this->mapsize; i++ ) {
 
-/* Get a pointer to the next KeyMap entry. */
+/* Get a pointer to the KeyMap entry (if any) in this element. */
       next = this->table[ i ];
-
-/* Loop round all entries in this element of the hash table. */
-      while( next && astOK ) {
+      if( next && astOK ) {
 
 /* If this entry has an Object data type, see if holds any KeyMaps. */
          if( next->type == AST__OBJECTTYPE ) {
@@ -1306,9 +1307,6 @@ static void ClearMapLocked( AstKeyMap *this, int *status ) {
                }
             }
          }
-
-/* Get a pointer to the next entry. */
-         next = next->next;
       }
    }
 }
@@ -1345,19 +1343,12 @@ static void ClearSizeGuess( AstKeyMap *this, int *status ) {
 
 /* Local Variables: */
    int empty;                 /* Is the KeyMap empty? */
-   int itab;                  /* Index into hash table */
 
 /* Check the global error status. */
    if ( !astOK ) return;
 
 /* See if the KeyMap is empty. */
-   empty = 1;
-   for( itab = 0; itab < this->mapsize; itab++ ) {
-      if( this->nentry[ itab ] > 0 ) {
-         empty = 0;
-         break;
-      }
-   }
+   empty = ( this->nentry == 0 );
 
 /* If not report an error. */
    if( !empty ) {
@@ -2211,6 +2202,7 @@ static AstMapEntry *CopyMapEntry( AstMapEntry *in, int *status ){
    int i;                 /* Loop count */
    int nel;               /* No. of values in entry vector (0 => scalar) */
    int type;              /* Entry data type */
+   size_t keylen;         /* Length of key string */
    size_t size;           /* Size of Entry structure */
 
 /* Initialise. */
@@ -2224,15 +2216,18 @@ static AstMapEntry *CopyMapEntry( AstMapEntry *in, int *status ){
    nel = in->nel;
    type = in->type;
 
-/* Do a byte-for-byte copy of the supplied MapEntry. */
-   result = astStore( NULL, in, size );
+/* Allocate memory for the new MapEntry, with room for the key string at
+   the end, and do a byte-for-byte copy of the supplied MapEntry. */
+   text = in->key;
+   keylen = text ? strlen( text ) : 0;
+   result = astMalloc( size + keylen + 1 );
+   if( !astOK ) return result;
+   memcpy( result, in, size );
 
 /* Copy or nullify pointers in the AstMapEntry structure. */
-   result->next = NULL;
    result->snext = NULL;
    result->sprev = NULL;
-   text = in->key;
-   result->key = text ? astStore( NULL, text, strlen( text ) + 1 ) : NULL;
+   result->key = text ? strcpy( (char *) result + size, text ) : NULL;
    text = in->comment;
    result->comment = text ? astStore( NULL, text, strlen( text ) + 1 ) : NULL;
 
@@ -2368,8 +2363,10 @@ static void CopyTableEntry( AstKeyMap *in, AstKeyMap *out, int itab, int *status
 *     KeyMap member function.
 
 *  Description:
-*     This function creates a deep copy of the linked-list of KeyMap entries
-*     stored in the specified element of the input KeyMaps hash table.
+*     This function creates a deep copy of the KeyMap entry (if any)
+*     stored in the specified element of the input KeyMaps hash table,
+*     and stores it in the same element of the output KeyMaps hash table.
+*     The two hash tables must be the same size.
 
 *  Parameters:
 *     in
@@ -2383,52 +2380,21 @@ static void CopyTableEntry( AstKeyMap *in, AstKeyMap *out, int itab, int *status
 
 */
 
-/* Local Variables: */
-   AstMapEntry **link;    /* Address to store foward link */
-   AstMapEntry *next;     /* Pointer to next Entry to copy */
-
 /* Check the global error status. */
    if ( !astOK ) return;
 
-/* The "link" variable holds the address of the location at which the
-   pointer to the next copied MapEntry should be stored. Initialise this to
-   be the address of the required element of the output hash table. */
-   link = &( out->table[ itab ] );
-
-/* The "next" variable holds the address of the next MapEntry to be
-   copied. Initialise this to the MapEntry at the head of the linked list
-   associated with the specified index of the input KeyMaps hash table. */
-   next = in->table[ itab ];
-
-/* If the hash table element is empty, store a null pointer and pass on. */
-   if( !next ) {
+/* If the hash table element is empty, store a null pointer. */
+   if( !in->table[ itab ] ) {
       out->table[ itab ] = NULL;
 
-/* Otherwise copy the liked list. */
+/* Otherwise copy the entry and its hash value. If the entry is of type
+   AST__OBJECTTYPE, add it to the head of the list of AST__OBJECTTYPE
+   entries in the output KeyMap. */
    } else {
-
-/* Loop round until we have copied all entries. */
-      while( next && astOK ) {
-
-/* Copy the next entry, storing the resulting pointer at the position
-   indicated by "link". */
-         *link = CopyMapEntry( next, status );
-
-/* If the entry is of type AST__OBJECTTYPE, add it to the head of the
-   list of AST__OBJECTTYPE entries in the output KeyMap. */
-         AddToObjectList( out, *link, status );
-
-/* Update "link" and "next" */
-         next = next->next;
-         link = &( (*link)->next );
-      }
+      out->table[ itab ] = CopyMapEntry( in->table[ itab ], status );
+      out->hashes[ itab ] = in->hashes[ itab ];
+      AddToObjectList( out, out->table[ itab ], status );
    }
-
-/* Set the number of entries in the output to be the same as the input. */
-   out->nentry[ itab ] = in->nentry[ itab ];
-
-/* If an error has occurred, attempt to delete the returned MapEntry. */
-   if( !astOK ) FreeTableEntry( out, itab, status );
 }
 
 static void DoubleTableSize( AstKeyMap *this, int *status ) {
@@ -2464,9 +2430,7 @@ static void DoubleTableSize( AstKeyMap *this, int *status ) {
 
 /* Local Variables: */
    AstMapEntry **newtable;
-   AstMapEntry *next;
-   AstMapEntry *new_next;
-   int *newnentry;
+   unsigned long *newhashes;
    int bitmask;
    int i;
    int newi;
@@ -2484,46 +2448,24 @@ static void DoubleTableSize( AstKeyMap *this, int *status ) {
 
 /* Create the new arrays, leaving the old arrays intact for the moment. */
    newtable = astMalloc( newmapsize*sizeof( AstMapEntry * ) );
-   newnentry = astMalloc( newmapsize*sizeof( int ) );
+   newhashes = astMalloc( newmapsize*sizeof( unsigned long ) );
    if( astOK ) {
 
 /* Initialise the new table. */
-      for( i = 0; i < newmapsize; i++ ) {
-         newtable[ i ] = NULL;
-         newnentry[ i ] = 0;
-      }
+      for( i = 0; i < newmapsize; i++ ) newtable[ i ] = NULL;
 
 /* Loop round each of the existing table entries. */
       for( i = 0; i < this->mapsize; i++ ) {
+         if( this->table[ i ] ) {
 
-/* The "next" variable holds the address of the next MapEntry to be
-   moved. Initialise this to the MapEntry at the head of the linked list
-   associated with the specified index of the input KeyMaps hash table. */
-         next = this->table[ i ];
-
-/* Loop round until we have moved all entries. */
-         while( next && astOK ) {
+/* Find the first free element in the new table, starting at the
+   element selected by the hash value. */
+            newi = ( this->hashes[ i ] & bitmask );
+            while( newtable[ newi ] ) newi = ( newi + 1 ) & bitmask;
 
-/* Find the index within the new table at which to store this entry. */
-            newi = ( next->hash & bitmask );
-
-/* Save the pointer to the next entry following the current one in the
-   linked list. */
-            new_next = next->next;
-
-/* Put a pointer to the MapEntry which is currently at the head of the
-   linked list in the "next" component of the current MapEntry. */
-            next->next = newtable[ newi ];
-
-/* Store the supplied MapEntry pointer in the requested element of the
-   hash table. */
-            newtable[ newi ] = next;
-
-/* Increment the length of linked list. */
-            newnentry[ newi ]++;
-
-/* Use the pointer to the next map entry to be moved. */
-            next = new_next;
+/* Move the entry and its hash value into the new table. */
+            newtable[ newi ] = this->table[ i ];
+            newhashes[ newi ] = this->hashes[ i ];
          }
       }
    }
@@ -2535,13 +2477,15 @@ static void DoubleTableSize( AstKeyMap *this, int *status ) {
       (void) astFree( this->table );
       this->table = newtable;
 
-      (void) astFree( this->nentry );
-      this->nentry = newnentry;
+      (void) astFree( this->hashes );
+      this->hashes = newhashes;
+
+      this->key_index = -1;
 
 /* If not OK, delete the new table. */
    } else {
       newtable = astFree( newtable );
-      newnentry = astFree( newnentry );
+      newhashes = astFree( newhashes );
    }
 }
 
@@ -2891,11 +2835,11 @@ static AstMapEntry *FreeMapEntry( AstMapEntry *in, int *status ){
                 type );
    }
 
-/* Free or nullify pointers in the AstMapEntry structure. */
-   in->next = NULL;
+/* Free or nullify pointers in the AstMapEntry structure. The key string
+   is stored within the same memory block as the structure. */
    in->snext = NULL;
    in->sprev = NULL;
-   in->key = astFree( (void *) in->key );
+   in->key = NULL;
    in->comment = astFree( (void *) in->comment );
 
 /* Free the complete AstMapEntry structure. */
@@ -2911,8 +2855,7 @@ static void FreeTableEntry( AstKeyMap *this, int itab, int *status ){
 *     FreeTableEntry
 
 *  Purpose:
-*     Frees the linked list of KeyMap entries stored in a given element of
-*     the hash table.
+*     Frees the KeyMap entry stored in a given element of the hash table.
 
 *  Type:
 *     Private function.
@@ -2925,9 +2868,10 @@ static void FreeTableEntry( AstKeyMap *this, int itab, int *status ){
 *     KeyMap member function.
 
 *  Description:
-*     This function frees resources used by all the MapEntries in the
-*     linked list associated with the specified element of the hash table
-*     of the supplied KeyMap.
+*     This function frees resources used by the MapEntry (if any) stored
+*     in the specified element of the hash table of the supplied KeyMap.
+*     It does not move any other entries, and so should only be used
+*     when all entries in the hash table are being freed.
 
 *  Parameters:
 *     this
@@ -2942,34 +2886,16 @@ static void FreeTableEntry( AstKeyMap *this, int itab, int *status ){
 *     global error status set.
 */
 
-/* Local Variables: */
-   AstMapEntry *link;     /* Pointer the next but one MapEntry to be freed */
-   AstMapEntry *next;     /* Pointer the next MapEntry to be freed */
-
 /* Check it is safe to proceed. */
-   if( this && itab >= 0 && itab < this->mapsize ) {
-
-/* Store a pointer to the MapEntry which is to be freed next. */
-      next = this->table[ itab ];
-
-/* Loop round freeing all MapEntries in the linked list. */
-      while( next ) {
+   if( this && itab >= 0 && itab < this->mapsize && this->table[ itab ] ) {
 
-/* Store a pointer to the MapEntry which will be freed after this one. */
-         link = next->next;
-
-/* Free this MapEntry */
-         (void) FreeMapEntry( next, status );
-
-/* Set up the next MapEntry to be freed. */
-         next = link;
-      }
-
-/* Store a NULL pointer in the table element. */
+/* Free the MapEntry and store a NULL pointer in the table element. */
+      (void) FreeMapEntry( this->table[ itab ], status );
       this->table[ itab ] = NULL;
 
-/* Sets the number of entries in this hash table element to zero. */
-      this->nentry[ itab ] = 0;
+/* Decrement the number of entries in the table. */
+      this->nentry--;
+      this->key_index = -1;
    }
 }
 
@@ -3163,9 +3089,12 @@ static int GetObjSize( AstObject *this_object, int *status ) {
    which are stored in dynamically allocated memory. */
    result = (*parent_getobjsize)( this_object, status );
 
+   result += astTSizeOf( this->table );
+   result += astTSizeOf( this->hashes );
+
    for( itab = 0; itab < this->mapsize; itab++ ) {
       next = this->table[ itab ];
-      while( next ) {
+      if( next ) {
          nel = next->nel;
          type = next->type;
 
@@ -3222,11 +3151,8 @@ static int GetObjSize( AstObject *this_object, int *status ) {
                       type );
          }
 
-         result += astTSizeOf( (void *) next->key );
          result += astTSizeOf( (void *) next->comment );
          result += astTSizeOf( next );
-
-         next = next->next;
       }
    }
 
@@ -3283,11 +3209,8 @@ static const char *GetKey( AstKeyMap *this, int index, int *status ) {
 /* Local Variables: */
    AstMapEntry *entry;         /* Pointer to the entry */
    const char *result;         /* Pointer value to return */
-   int ifirst;                 /* Index of first entry in this table element */
-   int ilast;                  /* Index of last entry in this table element */
    int istep;                  /* Entry count */
    int itab;                   /* Index into hash table */
-   int nstep;                  /* No. of entries to skip */
    int sortby;                 /* The value of the SortBy attribute */
 
 /* Initialise. */
@@ -3299,50 +3222,59 @@ static const char *GetKey( AstKeyMap *this, int index, int *status ) {
 /* Get the SortBy value. */
    sortby = astGetSortBy( this );
 
+/* Keys are usually requested in order of increasing index. So, if
+   possible, start searching from the key returned by the previous
+   invocation of this function. The "key_index" value is reset to -1
+   whenever the KeyMap is changed. */
+   if( this->key_index >= 0 && this->key_index <= index ) {
+      istep = this->key_index;
+      itab = this->key_itab;
+      entry = this->key_entry;
+   } else {
+      istep = -1;
+      itab = -1;
+      entry = NULL;
+   }
+
 /* First deal with unsorted keys. */
    if( sortby == SORTBY_NONE ) {
 
-/* Loop round each entry in the hash table. */
-      ilast = -1;
-      for( itab = 0; itab < this->mapsize; itab++ ) {
-
-/* Find the index of the first and the last Entry in the linked list associated
-   with this element of the hash table. */
-         ifirst = ilast + 1;
-         ilast += this->nentry[ itab ];
-
-/* Pass on if we have not yet reached the element containing the required
-   key. */
-         if( ilast >= index ) {
-
-/* Find how many steps we need to proceed down the linked list to reach
-   the required index. */
-            nstep = index - ifirst;
-
-/* Make this many steps down the linked list.*/
-            entry = this->table[ itab ];
-            for( istep = 0; entry && istep < nstep; istep++ ) entry = entry->next;
-
-/* Return a pointer to the key string, and break out of the loop. */
-            if( entry ) result = entry->key;
-            break;
+/* Move through the elements of the hash table, counting the entries
+   found, until we reach the required index. */
+      while( istep < index && ++itab < this->mapsize ) {
+         if( this->table[ itab ] ) istep++;
+      }
 
-         }
+/* Return a pointer to the key string. */
+      if( istep == index && itab < this->mapsize ) {
+         entry = this->table[ itab ];
+         result = entry->key;
       }
 
 /* Now deal with sorted keys. */
    } else {
 
-/* Get a pointer to the first entry in the sorted list. */
-      entry = this->first;
+/* If not starting from a previous key, get a pointer to the first entry
+   in the sorted list. */
+      if( istep < 0 ) {
+         istep = 0;
+         entry = this->first;
+      }
 
-/* Move up the sorted list by the required number of entries. */
-      for( istep = 0; entry && istep < index; istep++ ) entry = entry->snext;
+/* Move up the sorted list to the required index. */
+      for( ; entry && istep < index; istep++ ) entry = entry->snext;
 
 /* Return a pointer to the key string. */
       if( entry ) result = entry->key;
    }
 
+/* Remember the position of the returned key. */
+   if( result ) {
+      this->key_index = index;
+      this->key_itab = itab;
+      this->key_entry = entry;
+   }
+
 /* Report an error if the element was not found. */
    if( !result && astOK ) {
       astError( AST__MPIND, "astMapKey(%s): Cannot find element "
@@ -3402,46 +3334,41 @@ static int GetSizeGuess( AstKeyMap *this, int *status ) {
 
 /* Return the attribute value using a default if not set. */
    return ( this->sizeguess == INT_MAX ) ?
-           MIN_TABLE_SIZE*MAX_ENTRIES_PER_TABLE_ENTRY : this->sizeguess;
+           DEFAULT_SIZEGUESS : this->sizeguess;
 }
 
-static int HashFun( const char *key, int bitmask, unsigned long *hash, int *status ){
+static unsigned long HashFun( const char *key, int *status ){
 /*
 *  Name:
 *     HashFun
 
 *  Purpose:
-*     Returns an integer hash code for a string
+*     Returns a full width hash code for a string
 
 *  Type:
 *     Private function.
 
 *  Synopsis:
 *     #include "keymap.h"
-*     int HashFun( const char *key, int bitmask, int *hash, int *status )
+*     unsigned long HashFun( const char *key, int *status )
 
 *  Class Membership:
 *     KeyMap member function.
 
 *  Description:
-*     This function returns an integer hash code for the supplied string,
-*     This is the value that isused as the index into the hash table for
-*     the specified key.
+*     This function returns a full width hash code for the supplied
+*     string. The index of the hash table element at which to start
+*     searching for the key is formed by zeroing the upper bits of the
+*     returned value.
 
 *  Parameters:
 *     key
 *        Pointer to the string. Trailing spaces are ignored.
-*     bitmask
-*        A bit mask that is used to zero the upper bits of a full width
-*        hash value in order to produce the required array index. This
-*        should be one less than the length of the hash table.
-*     hash
-*        Pointer to a location at which to put the full width hash value.
 *     status
 *        Pointer to the inherited status variable.
 
 *  Returned Value:
-*     An integer in the range zero to ( mapsize - 1 ).
+*     The full width hash value.
 
 *  Notes:
 *     - A value of zero is returned if this function is invoked with the
@@ -3450,6 +3377,7 @@ static int HashFun( const char *key, int bitmask, unsigned long *hash, int *stat
 
 /* Local Variables: */
    int c;
+   unsigned long hash;
 
 /* Check the local error status. */
    if ( !astOK ) return 0;
@@ -3458,13 +3386,22 @@ static int HashFun( const char *key, int bitmask, unsigned long *hash, int *stat
    ago in comp.lang.c Each through the "hile" loop corresponds to
    "hash = hash*33 + c ". Ignore spaces so that trailing spaces used to
    pad F77 character variables will be ignored. */
-   *hash = 5381;
+   hash = 5381;
    while( (c = *key++) ) {
       if( c != ' ' ) {
-         *hash = ((*hash << 5) + *hash) + c;
+         hash = ((hash << 5) + hash) + c;
       }
    }
-   return ( *hash & bitmask );
+
+/* The lower bits of the djb2 hash depend only on the lower bits of each
+   character. Mix the upper bits into the lower bits so that keys which
+   differ only in the upper bits of a character do not select the same
+   hash table element. */
+   hash ^= hash >> 13;
+   hash *= 0x5bd1e995UL;
+   hash ^= hash >> 15;
+
+   return hash;
 }
 
 void astInitKeyMapVtab_(  AstKeyMapVtab *vtab, const char *name, int *status ) {
@@ -3690,7 +3627,6 @@ static void InitMapEntry( AstMapEntry *entry, int type, int nel, int *status ){
    if( !astOK ) return;
 
 /* Initialise all elements with in the MapEntry structure. */
-   entry->next = NULL;
    entry->key = NULL;
    entry->hash = 0;
    entry->type = type;
@@ -3965,7 +3901,6 @@ f        The global status.
    AstObject *out_obj;    /* Pointer for destination Object entry */
    const char *key;       /* Key for current entry */
    int i;                 /* Index into source hash table */
-   int itab;              /* Index of destination hash table element */
    int keymember;         /* Identifier for key */
    int merged;            /* Were source and destination KeyMaps merged? */
    unsigned long hash;    /* Full width hash value */
@@ -3976,18 +3911,16 @@ f        The global status.
 /* Loop round all entries in the source hash table. */
    for( i = 0; i < that->mapsize; i++ ) {
 
-/* Get a pointer to the next source KeyMap entry. */
+/* Get a pointer to the source KeyMap entry (if any) in this element. */
       in_entry = that->table[ i ];
-
-/* Loop round all entries in this element of the source hash table. */
-      while( in_entry && astOK ) {
+      if( in_entry && astOK ) {
 
 /* Get its key. */
          key = in_entry->key;
 
 /* Search for a destination entry with the same key. */
-         itab = HashFun( key, this->mapsize - 1, &hash, status );
-         out_entry = SearchTableEntry( this, itab, key, status );
+         hash = HashFun( key, status );
+         out_entry = SearchTableEntry( this, hash, key, status );
 
 /* If the destination KeyMap does not contain an entry with the current
    key, store a copy of the entry in the destination, or report an error
@@ -3999,7 +3932,7 @@ f        The global status.
                          astGetClass( this ), key, key );
             } else {
                out_entry = CopyMapEntry( in_entry, status );
-               out_entry = AddTableEntry( this, itab, out_entry, -1, status );
+               out_entry = AddTableEntry( this, out_entry, -1, status );
             }
 
 /* If the destination KeyMap contains an entry with the current key... */
@@ -4044,16 +3977,13 @@ f        The global status.
    But retain the original keymember value since we are just changing the
    value of an existing key. */
             if( ! merged ) {
-               out_entry = RemoveTableEntry( this, itab, key, status );
+               out_entry = RemoveTableEntry( this, hash, key, status );
                keymember = out_entry->keymember;
                (void) FreeMapEntry( out_entry, status );
                out_entry = CopyMapEntry( in_entry, status );
-               out_entry = AddTableEntry( this, itab, out_entry, keymember, status );
+               out_entry = AddTableEntry( this, out_entry, keymember, status );
             }
          }
-
-/* Update the address of the next MapEntry in the source. */
-         in_entry = in_entry->next;
       }
    }
 }
@@ -4300,7 +4230,6 @@ static void MapPut0##X( AstKeyMap *this, const char *skey, Xtype value, \
    const char *key;        /* Pointer to key string to use */ \
    char *p;                /* Pointer to next key character */ \
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */ \
-   int itab;               /* Index of hash table element to use */ \
    int keylen;             /* Length of supplied key string */ \
    int keymember;          /* Identifier for existing key */ \
    int there;              /* Did the entry already exist in the KeyMap? */ \
@@ -4315,8 +4244,10 @@ static void MapPut0##X( AstKeyMap *this, const char *skey, Xtype value, \
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapPut0" #X, \
                      status ); \
 \
-/* Allocate memory for the new MapEntry. */ \
-   entry = astMalloc( sizeof( Entry0##X ) ); \
+/* Allocate memory for the new MapEntry, with room for the key string \
+   at the end. */ \
+   keylen = strlen( key ); \
+   entry = astMalloc( sizeof( Entry0##X ) + keylen + 1 ); \
    if( astOK ) { \
 \
 /* Initialise the new structure.*/ \
@@ -4324,8 +4255,7 @@ static void MapPut0##X( AstKeyMap *this, const char *skey, Xtype value, \
       InitMapEntry( mapentry, Itype, 0, status ); \
 \
 /* Now store the new values. */ \
-      keylen = strlen( key ); \
-      mapentry->key = astStore( NULL, key, keylen + 1 ); \
+      mapentry->key = strcpy( (char *) entry + sizeof( Entry0##X ), key ); \
       if( comment ) mapentry->comment = astStore( NULL, comment, strlen( comment ) + 1 ); \
       mapentry->defined = 1; \
       entry->value = ValExp; \
@@ -4342,13 +4272,13 @@ static void MapPut0##X( AstKeyMap *this, const char *skey, Xtype value, \
          } \
       } \
 \
-/* Use the hash function to determine the element of the hash table in \
-   which to store the new entry. */ \
-      itab = HashFun( mapentry->key, this->mapsize - 1, &(mapentry->hash), status ); \
+/* Use the hash function to get the full width hash value for the \
+   new key. */ \
+      mapentry->hash = HashFun( mapentry->key, status ); \
 \
 /* Remove any existing entry with the given key from the table element. \
    First save the key identifier. */ \
-      oldent = RemoveTableEntry( this, itab, mapentry->key, status ); \
+      oldent = RemoveTableEntry( this, mapentry->hash, mapentry->key, status ); \
       if( oldent ) { \
          keymember = oldent->keymember; \
          oldent = FreeMapEntry( oldent, status ); \
@@ -4368,7 +4298,7 @@ static void MapPut0##X( AstKeyMap *this, const char *skey, Xtype value, \
 /* If all has gone OK, store the new entry at the head of the linked list \
    associated with the selected table entry. */ \
       if( astOK ) { \
-         mapentry = AddTableEntry( this, itab, mapentry, keymember, status ); \
+         mapentry = AddTableEntry( this, mapentry, keymember, status ); \
 \
 /* If anything went wrong, try to delete the new entry. */ \
       } else { \
@@ -4525,7 +4455,6 @@ static void MapPut1##X( AstKeyMap *this, const char *skey, int size, \
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */ \
    const char *key;        /* Pointer to key string to use */ \
    char *p;                /* Pointer to next key character */ \
-   int itab;               /* Index of hash table element to use */ \
    int i;                  /* Loop count */ \
    int keylen;             /* Length of supplied key string */ \
    int keymember;          /* Identifier for existing key */ \
@@ -4541,8 +4470,10 @@ static void MapPut1##X( AstKeyMap *this, const char *skey, int size, \
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapPut1" #X, \
                      status ); \
 \
-/* Allocate memory for the new MapEntry. */ \
-   entry = astMalloc( sizeof( Entry1##X ) ); \
+/* Allocate memory for the new MapEntry, with room for the key string \
+   at the end. */ \
+   keylen = strlen( key ); \
+   entry = astMalloc( sizeof( Entry1##X ) + keylen + 1 ); \
    if( astOK ) { \
 \
 /* Initialise the new structure.*/ \
@@ -4550,8 +4481,7 @@ static void MapPut1##X( AstKeyMap *this, const char *skey, int size, \
       InitMapEntry( mapentry, Itype, size, status ); \
 \
 /* Now store the new values. */ \
-      keylen = strlen( key ); \
-      mapentry->key = astStore( NULL, key, keylen + 1 ); \
+      mapentry->key = strcpy( (char *) entry + sizeof( Entry1##X ), key ); \
       if( comment ) mapentry->comment = astStore( NULL, comment, strlen( comment ) + 1 ); \
       mapentry->defined = 1; \
       entry->value = astMalloc( sizeof( Xtype )*(size_t)size ); \
@@ -4572,13 +4502,13 @@ static void MapPut1##X( AstKeyMap *this, const char *skey, int size, \
          } \
       } \
 \
-/* Use the hash function to determine the element of the hash table in \
-   which to store the new entry. */ \
-      itab = HashFun( mapentry->key, this->mapsize - 1, &(mapentry->hash), status ); \
+/* Use the hash function to get the full width hash value for the \
+   new key. */ \
+      mapentry->hash = HashFun( mapentry->key, status ); \
 \
 /* Remove any existing entry with the given key from the table element. \
    First save the key identifier. */ \
-      oldent = RemoveTableEntry( this, itab, mapentry->key, status ); \
+      oldent = RemoveTableEntry( this, mapentry->hash, mapentry->key, status ); \
       if( oldent ) { \
          keymember = oldent->keymember; \
          oldent = FreeMapEntry( oldent, status ); \
@@ -4598,7 +4528,7 @@ static void MapPut1##X( AstKeyMap *this, const char *skey, int size, \
 /* If all has gone OK, store the new entry at the head of the linked list \
    associated with the selected table entry. */ \
       if( astOK ) { \
-         mapentry = AddTableEntry( this, itab, mapentry, keymember, status ); \
+         mapentry = AddTableEntry( this, mapentry, keymember, status ); \
 \
 /* If anything went wrong, try to delete the new entry. */ \
       } else { \
@@ -4685,7 +4615,6 @@ void astMapPut1AId_( AstKeyMap *this, const char *skey, int size,
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */ \
    const char *key;        /* Pointer to key string to use */ \
    int i;                  /* Loop count */
-   int itab;               /* Index of hash table element to use */
    int keylen;             /* Length of supplied key string */
    int keymember;          /* Identifier for existing key */
    int there;              /* Did the entry already exist in the KeyMap? */
@@ -4697,8 +4626,10 @@ void astMapPut1AId_( AstKeyMap *this, const char *skey, int size,
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapPut1A",
                      status );
 
-/* Allocate memory for the new MapEntry. */
-   entry = astMalloc( sizeof( Entry1A ) );
+/* Allocate memory for the new MapEntry, with room for the key string
+   at the end. */
+   keylen = strlen( key );
+   entry = astMalloc( sizeof( Entry1A ) + keylen + 1 );
    if( astOK ) {
 
 /* Initialise the new structure.*/
@@ -4706,8 +4637,7 @@ void astMapPut1AId_( AstKeyMap *this, const char *skey, int size,
       InitMapEntry( mapentry, AST__OBJECTTYPE, size, status );
 
 /* Now store the new values. */
-      keylen = strlen( key );
-      mapentry->key = astStore( NULL, key, keylen + 1 );
+      mapentry->key = strcpy( (char *) entry + sizeof( Entry1A ), key );
       if( comment ) mapentry->comment = astStore( NULL, comment, strlen( comment ) + 1 );
       mapentry->defined = 1;
       entry->value = astMalloc( sizeof( AstObject * )*(size_t)size );
@@ -4729,12 +4659,12 @@ void astMapPut1AId_( AstKeyMap *this, const char *skey, int size,
          }
       }
 
-/* Use the hash function to determine the element of the hash table in
-   which to store the new entry. */
-      itab = HashFun( mapentry->key, this->mapsize - 1, &(mapentry->hash), status );
+/* Use the hash function to get the full width hash value for the
+   new key. */
+      mapentry->hash = HashFun( mapentry->key, status );
 
 /* Remove any existing entry with the given key from the table element. */
-      oldent = RemoveTableEntry( this, itab, mapentry->key, status );
+      oldent = RemoveTableEntry( this, mapentry->hash, mapentry->key, status );
       if( oldent ) {
          keymember = oldent->keymember;
          oldent = FreeMapEntry( oldent, status );
@@ -4754,7 +4684,7 @@ void astMapPut1AId_( AstKeyMap *this, const char *skey, int size,
 /* If all has gone OK, store the new entry at the head of the linked list
    associated with the selected table entry. */
       if( astOK ) {
-         mapentry = AddTableEntry( this, itab, mapentry, keymember, status );
+         mapentry = AddTableEntry( this, mapentry, keymember, status );
 
 /* If anything went wrong, try to delete the new entry. */
       } else {
@@ -4829,7 +4759,6 @@ f        The global status.
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */
    const char *key;        /* Pointer to key string to use */
    char *p;                /* Pointer to next key character */
-   int itab;               /* Index of hash table element to use */
    int keylen;             /* Length of supplied key string */
    int keymember;          /* Identifier for existing key */
    int there;              /* Did the entry already exist in the KeyMap? */
@@ -4841,16 +4770,17 @@ f        The global status.
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapPutU",
                      status );
 
-/* Allocate memory for the new MapEntry. */
-   mapentry = astMalloc( sizeof( AstMapEntry ) );
+/* Allocate memory for the new MapEntry, with room for the key string
+   at the end. */
+   keylen = strlen( key );
+   mapentry = astMalloc( sizeof( AstMapEntry ) + keylen + 1 );
    if( astOK ) {
 
 /* Initialise the new structure.*/
       InitMapEntry( mapentry, AST__UNDEFTYPE, 0, status );
 
 /* Now store the new values. */
-      keylen = strlen( key );
-      mapentry->key = astStore( NULL, key, keylen + 1 );
+      mapentry->key = strcpy( (char *) mapentry + sizeof( AstMapEntry ), key );
       if( comment ) mapentry->comment = astStore( NULL, comment, strlen( comment ) + 1 );
       mapentry->defined = 0;
 
@@ -4866,12 +4796,12 @@ f        The global status.
          }
       }
 
-/* Use the hash function to determine the element of the hash table in
-   which to store the new entry. */
-      itab = HashFun( mapentry->key, this->mapsize - 1, &(mapentry->hash), status );
+/* Use the hash function to get the full width hash value for the
+   new key. */
+      mapentry->hash = HashFun( mapentry->key, status );
 
 /* Remove any existing entry with the given key from the table element. */
-      oldent = RemoveTableEntry( this, itab, mapentry->key, status );
+      oldent = RemoveTableEntry( this, mapentry->hash, mapentry->key, status );
       if( oldent ) {
          keymember = oldent->keymember;
          oldent = FreeMapEntry( oldent, status );
@@ -4891,7 +4821,7 @@ f        The global status.
 /* If all has gone OK, store the new entry at the head of the linked list
    associated with the selected table entry. */
       if( astOK ) {
-         mapentry = AddTableEntry( this, itab, mapentry, keymember, status );
+         mapentry = AddTableEntry( this, mapentry, keymember, status );
 
 /* If anything went wrong, try to delete the new entry. */
       } else {
@@ -5036,7 +4966,6 @@ static int MapGet0##X( AstKeyMap *this, const char *skey, Xtype *value, int *sta
    AstMapEntry *mapentry;  /* Pointer to parent MapEntry structure */ \
    const char *key;        /* Pointer to key string to use */ \
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */ \
-   int itab;               /* Index of hash table element to use */ \
    int raw_type;           /* Data type of stored value */ \
    int result;             /* Returned flag */ \
    unsigned long hash;     /* Full width hash value */ \
@@ -5052,12 +4981,12 @@ static int MapGet0##X( AstKeyMap *this, const char *skey, Xtype *value, int *sta
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapGet0" #X, \
                      status ); \
 \
-/* Use the hash function to determine the element of the hash table in \
-   which the key will be stored. */ \
-   itab = HashFun( key, this->mapsize - 1, &hash, status ); \
+/* Use the hash function to get the full width hash value for the \
+   key. */ \
+   hash = HashFun( key, status ); \
 \
 /* Search the relevent table entry for the required MapEntry. */ \
-   mapentry = SearchTableEntry( this, itab, key, status ); \
+   mapentry = SearchTableEntry( this, hash, key, status ); \
 \
 /* Skip rest if the key was not found. */ \
    if( mapentry ) { \
@@ -5207,7 +5136,6 @@ int astMapGet0AId_( AstKeyMap *this, const char *skey, AstObject **value, int *s
    AstMapEntry *mapentry;  /* Pointer to parent MapEntry structure */
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */ \
    const char *key;        /* Pointer to key string to use */ \
-   int itab;               /* Index of hash table element to use */
    int raw_type;           /* Data type of stored value */
    int result;             /* Returned flag */
    unsigned long hash;     /* Full width hash value */
@@ -5223,12 +5151,12 @@ int astMapGet0AId_( AstKeyMap *this, const char *skey, AstObject **value, int *s
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapGet0A",
                      status );
 
-/* Use the hash function to determine the element of the hash table in
-   which the key will be stored. */
-   itab = HashFun( key, this->mapsize - 1, &hash, status );
+/* Use the hash function to get the full width hash value for the
+   key. */
+   hash = HashFun( key, status );
 
 /* Search the relevent table entry for the required MapEntry. */
-   mapentry = SearchTableEntry( this, itab, key, status );
+   mapentry = SearchTableEntry( this, hash, key, status );
 
 /* Skip rest if the key was not found. */
    if( mapentry ) {
@@ -5478,7 +5406,6 @@ static int MapGet1##X( AstKeyMap *this, const char *skey, int mxval, int *nval,
    const char *key;        /* Pointer to key string to use */ \
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */ \
    int i;                  /* Element index */ \
-   int itab;               /* Index of hash table element to use */ \
    int nel;                /* Number of elements in raw vector */ \
    int raw_type;           /* Data type of stored value */ \
    int result;             /* Returned flag */ \
@@ -5497,12 +5424,12 @@ static int MapGet1##X( AstKeyMap *this, const char *skey, int mxval, int *nval,
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapGet1" #X, \
                      status ); \
 \
-/* Use the hash function to determine the element of the hash table in \
-   which the key will be stored. */ \
-   itab = HashFun( key, this->mapsize - 1, &hash, status ); \
+/* Use the hash function to get the full width hash value for the \
+   key. */ \
+   hash = HashFun( key, status ); \
 \
 /* Search the relevent table entry for the required MapEntry. */ \
-   mapentry = SearchTableEntry( this, itab, key, status ); \
+   mapentry = SearchTableEntry( this, hash, key, status ); \
 \
 /* Skip rest if the key was not found. */ \
    if( mapentry ) { \
@@ -5681,7 +5608,6 @@ static int MapGet1C( AstKeyMap *this, const char *skey, int l, int mxval,
    const char *cvalue;     /* Pointer to converted string */
    const char *key;        /* Pointer to key string to use */ \
    int i;                  /* Element index */
-   int itab;               /* Index of hash table element to use */
    int nel;                /* Number of elements in raw vector */
    int raw_type;           /* Data type of stored value */
    int result;             /* Returned flag */
@@ -5700,12 +5626,12 @@ static int MapGet1C( AstKeyMap *this, const char *skey, int l, int mxval,
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapGet1C",
                      status );
 
-/* Use the hash function to determine the element of the hash table in
-   which the key will be stored. */
-   itab = HashFun( key, this->mapsize - 1, &hash, status );
+/* Use the hash function to get the full width hash value for the
+   key. */
+   hash = HashFun( key, status );
 
 /* Search the relevent table entry for the required MapEntry. */
-   mapentry = SearchTableEntry( this, itab, key, status );
+   mapentry = SearchTableEntry( this, hash, key, status );
 
 /* Skip rest if the key was not found. */
    if( mapentry ) {
@@ -5880,7 +5806,6 @@ int astMapGet1AId_( AstKeyMap *this, const char *skey, int mxval, int *nval,
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */ \
    const char *key;        /* Pointer to key string to use */ \
    int i;                  /* Element index */
-   int itab;               /* Index of hash table element to use */
    int nel;                /* Number of elements in raw vector */
    int raw_type;           /* Data type of stored value */
    int result;             /* Returned flag */
@@ -5899,12 +5824,12 @@ int astMapGet1AId_( AstKeyMap *this, const char *skey, int mxval, int *nval,
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapGet1A",
                      status );
 
-/* Use the hash function to determine the element of the hash table in
-   which the key will be stored. */
-   itab = HashFun( key, this->mapsize - 1, &hash, status );
+/* Use the hash function to get the full width hash value for the
+   key. */
+   hash = HashFun( key, status );
 
 /* Search the relevent table entry for the required MapEntry. */
-   mapentry = SearchTableEntry( this, itab, key, status );
+   mapentry = SearchTableEntry( this, hash, key, status );
 
 /* Skip rest if the key was not found. */
    if( mapentry ) {
@@ -6350,7 +6275,6 @@ static int MapGetElem##X( AstKeyMap *this, const char *skey, int elem, \
    AstMapEntry *mapentry;  /* Pointer to parent MapEntry structure */ \
    const char *key;        /* Pointer to key string to use */ \
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */ \
-   int itab;               /* Index of hash table element to use */ \
    int nel;                /* Number of elements in raw vector */ \
    int raw_type;           /* Data type of stored value */ \
    int result;             /* Returned flag */ \
@@ -6368,12 +6292,12 @@ static int MapGetElem##X( AstKeyMap *this, const char *skey, int elem, \
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapGetElem" #X, \
                      status ); \
 \
-/* Use the hash function to determine the element of the hash table in \
-   which the key will be stored. */ \
-   itab = HashFun( key, this->mapsize - 1, &hash, status ); \
+/* Use the hash function to get the full width hash value for the \
+   key. */ \
+   hash = HashFun( key, status ); \
 \
 /* Search the relevent table entry for the required MapEntry. */ \
-   mapentry = SearchTableEntry( this, itab, key, status ); \
+   mapentry = SearchTableEntry( this, hash, key, status ); \
 \
 /* Skip rest if the key was not found. */ \
    if( mapentry ) { \
@@ -6548,7 +6472,6 @@ static int MapGetElemC( AstKeyMap *this, const char *skey, int l, int elem,
    const char *key;        /* Pointer to key string to use */
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */
    const char *cvalue;     /* Pointer to converted string */
-   int itab;               /* Index of hash table element to use */
    int nel;                /* Number of elements in raw vector */
    int raw_type;           /* Data type of stored value */
    int result;             /* Returned flag */
@@ -6566,12 +6489,12 @@ static int MapGetElemC( AstKeyMap *this, const char *skey, int l, int elem,
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapGetElemC",
                      status );
 
-/* Use the hash function to determine the element of the hash table in
-   which the key will be stored. */
-   itab = HashFun( key, this->mapsize - 1, &hash, status );
+/* Use the hash function to get the full width hash value for the
+   key. */
+   hash = HashFun( key, status );
 
 /* Search the relevent table entry for the required MapEntry. */
-   mapentry = SearchTableEntry( this, itab, key, status );
+   mapentry = SearchTableEntry( this, hash, key, status );
 
 /* Skip rest if the key was not found. */
    if( mapentry ) {
@@ -6739,7 +6662,6 @@ int astMapGetElemAId_( AstKeyMap *this, const char *skey, int elem,
    AstObject *avalue;      /* Pointer to AstObject */
    const char *key;        /* Pointer to key string to use */
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */
-   int itab;               /* Index of hash table element to use */
    int nel;                /* Number of elements in raw vector */
    int raw_type;           /* Data type of stored value */
    int result;             /* Returned flag */
@@ -6757,12 +6679,12 @@ int astMapGetElemAId_( AstKeyMap *this, const char *skey, int elem,
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapGetElemA",
                      status );
 
-/* Use the hash function to determine the element of the hash table in
-   which the key will be stored. */
-   itab = HashFun( key, this->mapsize - 1, &hash, status );
+/* Use the hash function to get the full width hash value for the
+   key. */
+   hash = HashFun( key, status );
 
 /* Search the relevent table entry for the required MapEntry. */
-   mapentry = SearchTableEntry( this, itab, key, status );
+   mapentry = SearchTableEntry( this, hash, key, status );
 
 /* Skip rest if the key was not found. */
    if( mapentry ) {
@@ -6946,7 +6868,6 @@ f        .TRUE.
    AstMapEntry *mapentry;  /* Pointer to parent MapEntry structure */
    const char *key;        /* Pointer to key string to use */
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */
-   int itab;               /* Index of hash table element to use */
    int result;             /* Returned flag */
    unsigned long hash;     /* Full width hash value */
 
@@ -6960,12 +6881,12 @@ f        .TRUE.
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapDefined",
                      status );
 
-/* Use the hash function to determine the element of the hash table in
-   which the key will be stored. */
-   itab = HashFun( key, this->mapsize - 1, &hash, status );
+/* Use the hash function to get the full width hash value for the
+   key. */
+   hash = HashFun( key, status );
 
 /* Search the relevent table entry for the required MapEntry. */
-   mapentry = SearchTableEntry( this, itab, key, status );
+   mapentry = SearchTableEntry( this, hash, key, status );
 
 /* Skip rest if the key was not found. */
    if( mapentry ) {
@@ -7057,7 +6978,6 @@ f     .FALSE.
    AstMapEntry *mapentry;  /* Pointer to entry in linked list */
    const char *key;        /* Pointer to key string to use */
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */
-   int itab;               /* Index of hash table element to use */
    int result;             /* Returned value */
    unsigned long hash;     /* Full width hash value */
 
@@ -7071,12 +6991,12 @@ f     .FALSE.
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapHasKey",
                      status );
 
-/* Use the hash function to determine the element of the hash table in
-   which the key will be stored. */
-   itab = HashFun( key, this->mapsize - 1, &hash, status );
+/* Use the hash function to get the full width hash value for the
+   key. */
+   hash = HashFun( key, status );
 
 /* Search the relevent table entry for the required MapEntry. */
-   mapentry = SearchTableEntry( this, itab, key, status );
+   mapentry = SearchTableEntry( this, hash, key, status );
 
 /* Set a non-zero return value if the key was found. */
    if( mapentry ) result = 1;
@@ -7134,7 +7054,6 @@ f        The global status.
 /* Local Variables: */
    const char *key;        /* Pointer to key string to use */
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */
-   int itab;               /* Index of hash table element to use */
    unsigned long hash;     /* Full width hash value */
 
 /* Check the global error status. */
@@ -7144,12 +7063,12 @@ f        The global status.
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapRemove",
                      status );
 
-/* Use the hash function to determine the element of the hash table in
-   which the key will be stored. */
-   itab = HashFun( key, this->mapsize - 1, &hash, status );
+/* Use the hash function to get the full width hash value for the
+   key. */
+   hash = HashFun( key, status );
 
 /* Search the relevent table entry for the required MapEntry and remove it. */
-   (void) FreeMapEntry( RemoveTableEntry( this, itab, key, status ), status );
+   (void) FreeMapEntry( RemoveTableEntry( this, hash, key, status ), status );
 }
 
 static void MapRename( AstKeyMap *this, const char *soldkey, const char *snewkey,
@@ -7209,10 +7128,10 @@ f        The global status.
    const char *newkey;     /* Pointer to key string to use */
    char newkeybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */
    char *p;                /* Pointer to next key character */
-   int itab;               /* Index of hash table element to use */
    int keylen;             /* Length of supplied key string */
    int keymember;          /* Identifier for new key */
    int there;              /* Did the entry already exist in the KeyMap? */
+   size_t size;            /* Size of Entry structure */
    unsigned long hash;     /* Full width hash value */
 
 /* Check the global error status. */
@@ -7227,22 +7146,27 @@ f        The global status.
 /* Do nothing if the keys are the same. */
    if( strcmp( oldkey, newkey ) ){
 
-/* Use the hash function to determine the element of the hash table in
-   which the old key will be stored. */
-      itab = HashFun( oldkey, this->mapsize - 1, &hash, status );
+/* Use the hash function to get the full width hash value for the
+   old key. */
+      hash = HashFun( oldkey, status );
 
 /* Search the relevent table entry for the required MapEntry. Remove it
    from the list, but do not free it. */
-      entry = RemoveTableEntry( this, itab, oldkey, status );
+      entry = RemoveTableEntry( this, hash, oldkey, status );
 
 /* Skip rest if the key was not found. */
       if( entry ) {
 
-/* Store the new key string, and terminate it to exclude any trailing
+/* The key string is stored at the end of the memory block holding the
+   MapEntry, so extend the block to hold the new key. This is safe since
+   the entry has now been removed from all the lists that refer to it.
+   Store the new key string, and terminate it to exclude any trailing
    spaces. */
          keylen = strlen( newkey );
-         entry->key = astStore( (void *) entry->key, newkey, keylen + 1 );
+         size = SizeOfEntry( entry, status );
+         entry = astRealloc( entry, size + keylen + 1 );
          if( astOK ) {
+            entry->key = strcpy( (char *) entry + size, newkey );
             p = (char *) entry->key + keylen;
             while( --p >= entry->key ) {
                if( *p == ' ' ) {
@@ -7253,13 +7177,13 @@ f        The global status.
             }
          }
 
-/* Use the hash function to determine the element of the hash table in
-   which to store the entry with its new key. */
-         itab = HashFun( entry->key, this->mapsize - 1, &(entry->hash), status );
+/* Use the hash function to get the full width hash value for the
+   new key. */
+         entry->hash = HashFun( entry->key, status );
 
 /* Remove and free any existing entry with the given key from the table
    element. */
-         oldent = RemoveTableEntry( this, itab, entry->key, status );
+         oldent = RemoveTableEntry( this, entry->hash, entry->key, status );
          if( oldent ) {
             keymember = oldent->keymember;
             oldent = FreeMapEntry( oldent, status );
@@ -7278,10 +7202,9 @@ f        The global status.
                       newkey );
          }
 
-/* If all has gone OK, store the renamed entry at the head of the linked list
-   associated with the selected table entry. */
+/* If all has gone OK, store the renamed entry in the hash table. */
          if( astOK ) {
-            entry = AddTableEntry( this, itab, entry, keymember, status );
+            entry = AddTableEntry( this, entry, keymember, status );
 
 /* If anything went wrong, try to delete the renamed entry. */
          } else {
@@ -7335,7 +7258,6 @@ f     AST_MAPSIZE = INTEGER
 */
 
 /* Local Variables: */
-   int itab;               /* Index of hash table element to use */
    int result;             /* Returned value */
 
 /* Initialise */
@@ -7344,8 +7266,8 @@ f     AST_MAPSIZE = INTEGER
 /* Check the global error status. */
    if ( !astOK ) return result;
 
-/* Add up the number of entries in all elements of the hash table. */
-   for( itab = 0; itab < this->mapsize; itab++ ) result += this->nentry[ itab ];
+/* Get the number of entries in the hash table. */
+   result = this->nentry;
 
 /* Return the result. */
    return result;
@@ -7414,7 +7336,6 @@ c        This does not include the trailing null character.
    const char *key;        /* Pointer to key string to use */
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */
    int i;                  /* Element index */
-   int itab;               /* Index of hash table element to use */
    int l;                  /* Length of formatted vector element */
    int nel;                /* Number of elements in raw vector */
    int raw_type;           /* Data type of stored value */
@@ -7433,12 +7354,12 @@ c        This does not include the trailing null character.
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapLenC",
                      status );
 
-/* Use the hash function to determine the element of the hash table in
-   which the key will be stored. */
-   itab = HashFun( key, this->mapsize - 1, &hash, status );
+/* Use the hash function to get the full width hash value for the
+   key. */
+   hash = HashFun( key, status );
 
 /* Search the relevent table entry for the required MapEntry. */
-   mapentry = SearchTableEntry( this, itab, key, status );
+   mapentry = SearchTableEntry( this, hash, key, status );
 
 /* Skip rest if the key was not found. */
    if( mapentry ) {
@@ -7613,7 +7534,6 @@ f     AST_MAPLENGTH = INTEGER
    AstMapEntry *mapentry;  /* Pointer to entry in linked list */
    const char *key;        /* Pointer to key string to use */
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */
-   int itab;               /* Index of hash table element to use */
    int result;             /* Returned value */
    unsigned long hash;     /* Full width hash value */
 
@@ -7627,12 +7547,12 @@ f     AST_MAPLENGTH = INTEGER
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapLength",
                      status );
 
-/* Use the hash function to determine the element of the hash table in
-   which the key will be stored. */
-   itab = HashFun( key, this->mapsize - 1, &hash, status );
+/* Use the hash function to get the full width hash value for the
+   key. */
+   hash = HashFun( key, status );
 
 /* Search the relevent table entry for the required MapEntry. */
-   mapentry = SearchTableEntry( this, itab, key, status );
+   mapentry = SearchTableEntry( this, hash, key, status );
 
 /* Skip rest if the key was not found. */
    if( mapentry ) {
@@ -7779,7 +7699,6 @@ static void MapPutElem##X( AstKeyMap *this, const char *skey, int elem, \
    AstMapEntry *mapentry;  /* Pointer to parent MapEntry structure */ \
    const char *key;        /* Pointer to key string to use */ \
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */ \
-   int itab;               /* Index of hash table element to use */ \
    int nel;                /* Number of elements in raw vector */ \
    int new;                /* Was a new uninitialised element created? */ \
    int raw_type;           /* Data type of stored value */ \
@@ -7797,12 +7716,12 @@ static void MapPutElem##X( AstKeyMap *this, const char *skey, int elem, \
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapPutElem" #X, \
                      status ); \
 \
-/* Use the hash function to determine the element of the hash table in \
-   which the key will be stored. */ \
-   itab = HashFun( key, this->mapsize - 1, &hash, status ); \
+/* Use the hash function to get the full width hash value for the \
+   key. */ \
+   hash = HashFun( key, status ); \
 \
 /* Search the relevent table entry for the required MapEntry. */ \
-   mapentry = SearchTableEntry( this, itab, key, status ); \
+   mapentry = SearchTableEntry( this, hash, key, status ); \
 \
 /* If the key was not found, or was found but has an undefined value, create \
    a new one with a single element, \
@@ -7826,7 +7745,7 @@ static void MapPutElem##X( AstKeyMap *this, const char *skey, int elem, \
          if( nel == 0 ) { \
             astMapPut1I( this, key, 1, &( ((Entry0I *)mapentry)->value ), \
                          mapentry->comment ); \
-            mapentry = SearchTableEntry( this, itab, key, status ); \
+            mapentry = SearchTableEntry( this, hash, key, status ); \
             nel = 1; \
          } \
 \
@@ -7840,7 +7759,7 @@ static void MapPutElem##X( AstKeyMap *this, const char *skey, int elem, \
          if( nel == 0 ) { \
             astMapPut1S( this, key, 1, &( ((Entry0S *)mapentry)->value ), \
                          mapentry->comment ); \
-            mapentry = SearchTableEntry( this, itab, key, status ); \
+            mapentry = SearchTableEntry( this, hash, key, status ); \
             nel = 1; \
          } \
          raw = ((Entry1S *)mapentry)->value; \
@@ -7850,7 +7769,7 @@ static void MapPutElem##X( AstKeyMap *this, const char *skey, int elem, \
          if( nel == 0 ) { \
             astMapPut1B( this, key, 1, &( ((Entry0B *)mapentry)->value ), \
                          mapentry->comment ); \
-            mapentry = SearchTableEntry( this, itab, key, status ); \
+            mapentry = SearchTableEntry( this, hash, key, status ); \
             nel = 1; \
          } \
          raw = ((Entry1B *)mapentry)->value; \
@@ -7860,7 +7779,7 @@ static void MapPutElem##X( AstKeyMap *this, const char *skey, int elem, \
          if( nel == 0 ) { \
             astMapPut1D( this, key, 1, &( ((Entry0D *)mapentry)->value ), \
                          mapentry->comment ); \
-            mapentry = SearchTableEntry( this, itab, key, status ); \
+            mapentry = SearchTableEntry( this, hash, key, status ); \
             nel = 1; \
          } \
          raw = ((Entry1D *)mapentry)->value; \
@@ -7870,7 +7789,7 @@ static void MapPutElem##X( AstKeyMap *this, const char *skey, int elem, \
          if( nel == 0 ) { \
             astMapPut1P( this, key, 1, &( ((Entry0P *)mapentry)->value ), \
                          mapentry->comment ); \
-            mapentry = SearchTableEntry( this, itab, key, status ); \
+            mapentry = SearchTableEntry( this, hash, key, status ); \
             nel = 1; \
          } \
          raw = ((Entry1P *)mapentry)->value; \
@@ -7880,7 +7799,7 @@ static void MapPutElem##X( AstKeyMap *this, const char *skey, int elem, \
          if( nel == 0 ) { \
             astMapPut1F( this, key, 1, &( ((Entry0F *)mapentry)->value ), \
                          mapentry->comment ); \
-            mapentry = SearchTableEntry( this, itab, key, status ); \
+            mapentry = SearchTableEntry( this, hash, key, status ); \
             nel = 1; \
          } \
          raw = ((Entry1F *)mapentry)->value; \
@@ -7890,7 +7809,7 @@ static void MapPutElem##X( AstKeyMap *this, const char *skey, int elem, \
          if( nel == 0 ) { \
             astMapPut1C( this, key, 1, &( ((Entry0C *)mapentry)->value ), \
                          mapentry->comment ); \
-            mapentry = SearchTableEntry( this, itab, key, status ); \
+            mapentry = SearchTableEntry( this, hash, key, status ); \
             nel = 1; \
          } \
          raw = ((Entry1C *)mapentry)->value; \
@@ -7900,7 +7819,7 @@ static void MapPutElem##X( AstKeyMap *this, const char *skey, int elem, \
          if( nel == 0 ) { \
             astMapPut1A( this, key, 1, &( ((Entry0A *)mapentry)->value ), \
                          mapentry->comment ); \
-            mapentry = SearchTableEntry( this, itab, key, status ); \
+            mapentry = SearchTableEntry( this, hash, key, status ); \
             nel = 1; \
          } \
          raw = ((Entry1A *)mapentry)->value; \
@@ -8083,7 +8002,6 @@ f        AST_MAPPUTU).
    AstMapEntry *mapentry;  /* Pointer to entry in linked list */
    const char *key;        /* Pointer to key string to use */
    char keybuf[ AST__MXKEYLEN + 1 ]; /* Buffer for upper cas key */
-   int itab;               /* Index of hash table element to use */
    int result;             /* Returned value */
    unsigned long hash;     /* Full width hash value */
 
@@ -8097,12 +8015,12 @@ f        AST_MAPPUTU).
    key = ConvertKey( this, skey, keybuf, AST__MXKEYLEN + 1, "astMapType",
                      status );
 
-/* Use the hash function to determine the element of the hash table in
-   which the key will be stored. */
-   itab = HashFun( key, this->mapsize - 1, &hash, status );
+/* Use the hash function to get the full width hash value for the
+   key. */
+   hash = HashFun( key, status );
 
 /* Search the relevent table entry for the required MapEntry. */
-   mapentry = SearchTableEntry( this, itab, key, status );
+   mapentry = SearchTableEntry( this, hash, key, status );
 
 /* Store the type if found. */
    if( mapentry ) result = mapentry->type;
@@ -8181,29 +8099,20 @@ static const char *MapIterate( AstKeyMap *this, int reset, int *status ) {
 /* First deal with unsorted keys. */
    if( sortby == SORTBY_NONE ) {
 
-/* Get the index of the hash table to check first. Also get a pointer to
-   the entry within the hash table to check next. */
-      if( reset ){
-         itab = 0;
-         entry = this->table[ 0 ];
-      } else {
-         itab = this->iter_itab;
-         entry = this->iter_entry;
-      }
+/* Get the index of the hash table element to check first. */
+      itab = reset ? 0 : this->iter_itab;
 
 /* Move through elements of the hash table until we have a non-null entry. */
-      while( !entry && ++itab < this->mapsize ) {
-         entry = this->table[ itab ];
+      entry = NULL;
+      while( !entry && itab < this->mapsize ) {
+         entry = this->table[ itab++ ];
       }
 
-/* Return a pointer to the key. */
+/* Return a pointer to the key, saving the index of the next element to
+   check in the KeyMap structure. */
       if( entry ) {
          key = entry->key;
-
-/* Move on to the next entry in the unsorted linked list, saving the context
-   in the KeyMap structure. */
          this->iter_itab = itab;
-         this->iter_entry = entry->next;
       }
 
 /* Now deal with sorted keys. */
@@ -8292,16 +8201,17 @@ static void NewTable( AstKeyMap *this, int size, int *status ){
 /* Modify the size of the existing table. */
       this->mapsize = size;
       this->table = astGrow( this->table, size, sizeof( AstMapEntry * ) );
-      this->nentry = astGrow( this->nentry, size, sizeof( int ) );
+      this->hashes = astGrow( this->hashes, size, sizeof( unsigned long ) );
 
 /* Initialise the new table. */
       if( astOK ) {
-         for( i = 0; i < size; i++ ) {
-            this->table[ i ] = NULL;
-            this->nentry[ i ] = 0;
-         }
+         for( i = 0; i < size; i++ ) this->table[ i ] = NULL;
       }
    }
+
+/* Indicate the table is empty. */
+   this->nentry = 0;
+   this->key_index = -1;
 }
 
 static void RemoveFromObjectList( AstKeyMap *this, AstMapEntry *entry,
@@ -8464,37 +8374,40 @@ static void RemoveFromSortedList( AstKeyMap *this, AstMapEntry *entry,
    }
 }
 
-static AstMapEntry *RemoveTableEntry( AstKeyMap *this, int itab,
+static AstMapEntry *RemoveTableEntry( AstKeyMap *this, unsigned long hash,
                                       const char *key, int *status ){
 /*
 *  Name:
 *     RemoveTableEntry
 
 *  Purpose:
-*     Remove an entry from a linked-list of KeyMap entries.
+*     Remove an entry from the hash table of a KeyMap.
 
 *  Type:
 *     Private function.
 
 *  Synopsis:
 *     #include "keymap.h"
-*     AstMapEntry *RemoveTableEntry( AstKeyMap *this, int itab,
+*     AstMapEntry *RemoveTableEntry( AstKeyMap *this, unsigned long hash,
 *                                    const char *key, int *status )
 
 *  Class Membership:
 *     KeyMap member function.
 
 *  Description:
-*     This function removes any entries with the specified key from the
-*     linked-list of entries stored at the specified entry of the hash
-*     table. If the supplied key is found in the list, a pointer to the
-*     first removed entry is returned. Otherwise, a NULL pointer is returned.
+*     This function removes any entry with the specified key from the
+*     hash table. If the supplied key is found, a pointer to the removed
+*     entry is returned. Otherwise, a NULL pointer is returned.
+*
+*     The entries following the removed entry are moved back to fill the
+*     gap, if they would otherwise no longer be found by a search
+*     starting at the hash table element selected by their hash value.
 
 *  Parameters:
 *     this
 *        Pointer to the KeyMap.
-*     itab
-*        Index of the hash table element to be searched.
+*     hash
+*        The full width hash value for the key, as returned by HashFun.
 *     key
 *        The key string to be searched for. Trailing spaces are ignored.
 *     status
@@ -8506,9 +8419,11 @@ static AstMapEntry *RemoveTableEntry( AstKeyMap *this, int itab,
 */
 
 /* Local Variables: */
-   AstMapEntry **link;    /* Address to store foward link */
-   AstMapEntry *next;     /* Pointer to next Entry to copy */
-   AstMapEntry *result;
+   AstMapEntry *result;   /* Returned pointer */
+   int bitmask;           /* Mask to select table index from hash value */
+   int ihome;             /* Element selected by hash value of an entry */
+   int itab;              /* Index of hash table element to check */
+   int jtab;              /* Index of hash table element to move */
 
 /* Initialise */
    result = NULL;
@@ -8516,106 +8431,104 @@ static AstMapEntry *RemoveTableEntry( AstKeyMap *this, int itab,
 /* Check the global error status. */
    if ( !astOK ) return result;
 
-/* The "next" variable holds the address of the next MapEntry to be
-   checked. Initialise this to the MapEntry at the head of the linked
-   list associated with the supplied element of the hash table. */
-   next = this->table[ itab ];
-
-/* The "link" variable holds the address of the location at which the
-   pointer to the MapEntry following the removed MapEntry should be stored.
-   Initialise this to be the address of the hash table element. */
-   link = &( this->table[ itab ] );
-
-/* Loop round until we have checked all entries. */
-   while( next && astOK ) {
+/* Find the hash table element holding the entry. */
+   bitmask = this->mapsize - 1;
+   itab = hash & bitmask;
+   while( this->table[ itab ] ) {
+      if( this->hashes[ itab ] == hash &&
+          !KeyCmp( this->table[ itab ]->key, key ) ) {
+         result = this->table[ itab ];
+         break;
+      }
+      itab = ( itab + 1 ) & bitmask;
+   }
 
-/* If the key for the current entry macthes the supplied key... */
-      if( !KeyCmp( next->key, key ) ) {
+/* If found... */
+   if( result ) {
 
 /* Remove the MapEntry from the list sorted by key. */
-         RemoveFromSortedList( this, next, status );
+      RemoveFromSortedList( this, result, status );
 
 /* If the entry is of type AST__OBJECTTYPE, remove it from the
    list of AST__OBJECTTYPE entries. */
-         RemoveFromObjectList( this, next, status );
-
-/* Store a pointer to the next MapEntry in the list, replacing the
-   original pointer to the MapEntry which is being deleted. */
-         *link = next->next;
-
-/* Return a pointer to the first matching MapEntry. Free any subsequent
-   matching MapEntries.  */
-         if( result ) {
-            FreeMapEntry( next, status );
-         } else {
-            result = next;
+      RemoveFromObjectList( this, result, status );
+
+/* Check each of the following entries, up to the next empty element. An
+   entry must be moved into the free element if the free element lies
+   cyclically between the element selected by the hash value of the entry
+   and the element currently holding the entry. Each entry moved leaves a
+   new free element. */
+      jtab = itab;
+      while( 1 ) {
+         jtab = ( jtab + 1 ) & bitmask;
+         if( !this->table[ jtab ] ) break;
+
+         ihome = this->hashes[ jtab ] & bitmask;
+         if( ( ( jtab - ihome ) & bitmask ) >= ( ( jtab - itab ) & bitmask ) ) {
+            this->table[ itab ] = this->table[ jtab ];
+            this->hashes[ itab ] = this->hashes[ jtab ];
+            itab = jtab;
          }
-
-/* Decrement the number of entries in the linked list. */
-         this->nentry[ itab ]--;
-
-/* Set up the next MapEntry to be freed. */
-         next = *link;
-
-/* If the key for the current entry does not match the supplied key... */
-      } else {
-
-/* Update the address at which to store the pointer to the next MapEntry
-   in the list. */
-         link = &(next->next);
-
-/* Update the address of the next MapEntry in the list. */
-         next = next->next;
       }
+
+/* Clear the last free element, and decrement the number of entries. */
+      this->table[ itab ] = NULL;
+      this->nentry--;
+      this->key_index = -1;
    }
 
 /* Return the result */
    return result;
 }
 
-static AstMapEntry *SearchTableEntry( AstKeyMap *this, int itab, const char *key, int *status ){
+static AstMapEntry *SearchTableEntry( AstKeyMap *this, unsigned long hash,
+                                      const char *key, int *status ){
 /*
 *  Name:
 *     SearchTableEntry
 
 *  Purpose:
-*     Search an element of a has table for a given key.
+*     Search the hash table of a KeyMap for a given key.
 
 *  Type:
 *     Private function.
 
 *  Synopsis:
 *     #include "keymap.h"
-*     AstMapEntry *SearchTableEntry( AstKeyMap *this, int itab, const char *key, int *status )
+*     AstMapEntry *SearchTableEntry( AstKeyMap *this, unsigned long hash,
+*                                    const char *key, int *status )
 
 *  Class Membership:
 *     KeyMap member function.
 
 *  Description:
-*     This function searches the specified element of the KeyMaps hash table
-*     until an element is found which has a key matching the supplied key.
-*     The address of this entry is returned. If no suitable entry is found,
-*     then NULL is returned.
+*     This function searches the KeyMaps hash table, starting at the
+*     element selected by the supplied hash value, until an entry is found
+*     which has a key matching the supplied key, or an empty element is
+*     found. The address of the matching entry is returned. If no suitable
+*     entry is found, then NULL is returned. Keys are only compared if the
+*     stored hash value for the entry matches the supplied hash value.
 
 *  Parameters:
 *     this
 *        Pointer to the KeyMap.
-*     itab
-*        The index of the hash table to be searched.
+*     hash
+*        The full width hash value for the key, as returned by HashFun.
 *     key
 *        The key string to be searched for. Trailing spaces are ignored.
 *     status
 *        Pointer to the inherited status variable.
 
 *  Returned Value:
-*     The address of the first MapEntry in the linked list which refers
-*     to the given key, or NULL if the key is not found.
+*     The address of the MapEntry which refers to the given key, or NULL
+*     if the key is not found.
 
 */
 
 /* Local Variables: */
-   AstMapEntry *next;     /* Pointer to next Entry to check */
    AstMapEntry *result;   /* Returned pointer */
+   int bitmask;           /* Mask to select table index from hash value */
+   int itab;              /* Index of hash table element to check */
 
 /* Initialise */
    result = NULL;
@@ -8623,23 +8536,22 @@ static AstMapEntry *SearchTableEntry( AstKeyMap *this, int itab, const char *key
 /* Check the global error status. */
    if ( !astOK ) return result;
 
-/* The "next" variable holds the address of the next MapEntry to be
-   checked. Initialise this to the supplied MapEntry. */
-   next = this->table[ itab ];
-
-/* Loop round until we have checked all entries. */
-   while( next ) {
+/* Check each element in turn, starting at the element selected by the
+   hash value, until an empty element is found. */
+   bitmask = this->mapsize - 1;
+   itab = hash & bitmask;
+   while( this->table[ itab ] ) {
 
 /* If the key for the current entry matches the supplied key, store the
    MapEntry pointer and break. */
-      if( !KeyCmp( next->key, key ) ) {
-         result = next;
+      if( this->hashes[ itab ] == hash &&
+          !KeyCmp( this->table[ itab ]->key, key ) ) {
+         result = this->table[ itab ];
          break;
       }
 
-/* Update the address of the next MapEntry in the list. */
-      next = next->next;
-
+/* Move on to the next element. */
+      itab = ( itab + 1 ) & bitmask;
    }
 
 /* Return the result. */
@@ -8784,7 +8696,6 @@ static void SetKeyCase( AstKeyMap *this, int keycase, int *status ) {
 
 /* Local Variables: */
    int ok;                    /* Can the KeyCase value be changed? */
-   int itab;                  /* Index into hash table */
    int newval;                /* New KeyCase value */
 
 /* Check the global error status. */
@@ -8795,14 +8706,7 @@ static void SetKeyCase( AstKeyMap *this, int keycase, int *status ) {
 
 /* If the KeyCase value is to be changed, see if the KeyMap is empty. */
    ok = 1;
-   if( astGetKeyCase( this ) != newval ) {
-      for( itab = 0; itab < this->mapsize; itab++ ) {
-         if( this->nentry[ itab ] > 0 ) {
-            ok = 0;
-            break;
-         }
-      }
-   }
+   if( astGetKeyCase( this ) != newval && this->nentry > 0 ) ok = 0;
 
 /* If not report an error. */
    if( !ok ) {
@@ -8863,11 +8767,9 @@ static void SetKeyError( AstKeyMap *this, int keyerror, int *status ) {
 /* Loop round each entry in the hash table. */
    for( i = 0; i < this->mapsize; i++ ) {
 
-/* Get a pointer to the next KeyMap entry. */
+/* Get a pointer to the KeyMap entry (if any) in this element. */
       next = this->table[ i ];
-
-/* Loop round all entries in this element of the hash table. */
-      while( next && astOK ) {
+      if( next && astOK ) {
 
 /* If this entry has an Object data type, see if holds any KeyMaps. */
          if( next->type == AST__OBJECTTYPE ) {
@@ -8890,9 +8792,6 @@ static void SetKeyError( AstKeyMap *this, int keyerror, int *status ) {
                }
             }
          }
-
-/* Get a pointer to the next entry. */
-         next = next->next;
       }
    }
 }
@@ -8945,11 +8844,9 @@ static void SetMapLocked( AstKeyMap *this, int maplocked, int *status ) {
 /* Loop round each entry in the hash table. */
    for( i = 0; i < this->mapsize; i++ ) {
 
-/* Get a pointer to the next KeyMap entry. */
+/* Get a pointer to the KeyMap entry (if any) in this element. */
       next = this->table[ i ];
-
-/* Loop round all entries in this element of the hash table. */
-      while( next && astOK ) {
+      if( next && astOK ) {
 
 /* If this entry has an Object data type, see if holds any KeyMaps. */
          if( next->type == AST__OBJECTTYPE ) {
@@ -8972,9 +8869,6 @@ static void SetMapLocked( AstKeyMap *this, int maplocked, int *status ) {
                }
             }
          }
-
-/* Get a pointer to the next entry. */
-         next = next->next;
       }
    }
 }
@@ -9013,19 +8907,12 @@ static void SetSizeGuess( AstKeyMap *this, int sizeguess, int *status ) {
 
 /* Local Variables: */
    int empty;                 /* Is the KeyMap empty? */
-   int itab;                  /* Index into hash table */
 
 /* Check the global error status. */
    if ( !astOK ) return;
 
 /* See if the KeyMap is empty. */
-   empty = 1;
-   for( itab = 0; itab < this->mapsize; itab++ ) {
-      if( this->nentry[ itab ] > 0 ) {
-         empty = 0;
-         break;
-      }
-   }
+   empty = ( this->nentry == 0 );
 
 /* If not report an error. */
    if( !empty ) {
@@ -9036,7 +8923,7 @@ static void SetSizeGuess( AstKeyMap *this, int sizeguess, int *status ) {
    table. */
    } else {
       this->sizeguess = sizeguess;
-      NewTable( this, sizeguess/MAX_ENTRIES_PER_TABLE_ENTRY, status );
+      NewTable( this, TABLE_SIZE_PER_ENTRY*sizeguess, status );
    }
 }
 
@@ -9384,6 +9271,7 @@ static void SortEntries( AstKeyMap *this, int *status ){
 /* Empty the sorted list. */
    this->nsorted = 0;
    this->first = NULL;
+   this->key_index = -1;
 
 /* Get the SortBy value. */
    sortby = astGetSortBy( this );
@@ -9406,20 +9294,15 @@ static void SortEntries( AstKeyMap *this, int *status ){
             pent = ents;
             for( i = 0; i < this->mapsize; i++ ) {
 
-/* Get a pointer to the next KeyMap entry. */
+/* Get a pointer to the KeyMap entry (if any) in this element. */
                entry = this->table[ i ];
-
-/* Loop round all entries in this element of the hash table. */
-               while( entry ) {
+               if( entry ) {
 
 /* Store the sorting method in the MapEntry. */
                   entry->sortby = sortby;
 
 /* Put a pointer to the MapEntry into the array. */
                   *(pent++) = entry;
-
-/* Update the address of the next MapEntry in the source. */
-                  entry = entry->next;
                }
             }
 
@@ -9870,24 +9753,32 @@ static void Copy( const AstObject *objin, AstObject *objout, int *status ) {
 /* For safety, first clear any references to the input memory from
    the output KeyMap. */
    out->table = NULL;
-   out->nentry = NULL;
+   out->hashes = NULL;
    out->first = NULL;
    out->firstA = NULL;
+   out->iter_itab = 0;
+   out->iter_entry = NULL;
+   out->key_index = -1;
 
 /* Make copies of the table entries. */
    out->table = astMalloc( sizeof( AstMapEntry * )*( out->mapsize ) );
-   out->nentry = astMalloc( sizeof( int )*( out->mapsize ) );
+   out->hashes = astMalloc( sizeof( unsigned long )*( out->mapsize ) );
 
-   for( i = 0; i < out->mapsize; i++ ) CopyTableEntry( in, out, i, status );
+   if( astOK ) {
+      for( i = 0; i < out->mapsize; i++ ) out->table[ i ] = NULL;
+      for( i = 0; i < out->mapsize; i++ ) CopyTableEntry( in, out, i, status );
+   }
 
 /* Create the required sorted key list in the new KeyMap. */
    SortEntries( out, status );
 
 /* If an error occurred, clean up by freeing all memory allocated above. */
    if ( !astOK ) {
-      for( i = 0; i < out->mapsize; i++ ) FreeTableEntry( out, i, status );
+      if( out->table ) {
+         for( i = 0; i < out->mapsize; i++ ) FreeTableEntry( out, i, status );
+      }
       out->table = astFree( out->table );
-      out->nentry = astFree( out->nentry );
+      out->hashes = astFree( out->hashes );
    }
 }
 
@@ -9936,7 +9827,7 @@ static void Delete( AstObject *obj, int *status ) {
 
 /* Free memory used to hold tables. */
    this->table = astFree( this->table );
-   this->nentry = astFree( this->nentry );
+   this->hashes = astFree( this->hashes );
 
 /* Nullify other pointers. */
    this->first = NULL;
@@ -10031,17 +9922,9 @@ static void Dump( AstObject *this_object, AstChannel *channel, int *status ) {
 /* Loop round each entry in the hash table. */
    for( i = 0; i < this->mapsize; i++ ) {
 
-/* Get a pointer to the next KeyMap entry to dump. */
+/* Dump the KeyMap entry (if any) in this element of the hash table. */
       next = this->table[ i ];
-
-/* Loop round dumping all KeyMap entries in this element of the hash table. */
-      while( next && astOK ) {
-         DumpEntry( next, channel, ++nentry, status );
-
-/* Get a pointer to the next entry to dump. */
-         next = next->next;
-
-      }
+      if( next && astOK ) DumpEntry( next, channel, ++nentry, status );
    }
 }
 
@@ -10335,7 +10218,8 @@ AstKeyMap *astInitKeyMap_( void *mem, size_t size, int init, AstKeyMapVtab *vtab
       new->sizeguess = INT_MAX;
       new->mapsize = 0;
       new->table = NULL;
-      new->nentry = NULL;
+      new->hashes = NULL;
+      new->nentry = 0;
       new->keycase = -1;
       new->keyerror = -INT_MAX;
       new->maplocked = -INT_MAX;
@@ -10346,6 +10230,7 @@ AstKeyMap *astInitKeyMap_( void *mem, size_t size, int init, AstKeyMapVtab *vtab
       new->firstA = NULL;
       new->iter_itab = 0;
       new->iter_entry = NULL;
+      new->key_index = -1;
 
       NewTable( new, MIN_TABLE_SIZE, status );
 
@@ -10491,10 +10376,12 @@ AstKeyMap *astLoadKeyMap_( void *mem, size_t size, AstKeyMapVtab *vtab,
 /* Inidicate the KeyMap is empty. */
       new->mapsize = 0;
       new->table = NULL;
-      new->nentry = NULL;
+      new->hashes = NULL;
+      new->nentry = 0;
       new->firstA = NULL;
       new->iter_itab = 0;
       new->iter_entry = NULL;
+      new->key_index = -1;
 
 /* Read input data. */
 /* ================ */
@@ -56,6 +56,8 @@
 *        Added support for single precision entries.
 *     7-MAR-2008 (DSB):
 *        Added support for pointer ("P") entries.
+*     17-OCT-2026 (DSB):
+*        Use an open addressing hash table.
 *-
 */
 
@@ -104,7 +106,6 @@
    specific data types. */
 
 typedef struct AstMapEntry {
-   struct AstMapEntry *next; /* Pointer to next structure in unsorted list. */
    const char *key;          /* The name used to identify the entry */
    unsigned long hash;       /* The full width hash value */
    int type;                 /* Data type. */
@@ -131,7 +132,9 @@ typedef struct AstKeyMap {
    int sizeguess;                  /* Guess at KeyMap size */
    AstMapEntry **table;            /* Hash table containing pointers to
                                       the KeyMap entries */
-   int *nentry;                    /* No. of Entries in each table element */
+   unsigned long *hashes;          /* Full width hash value for each entry
+                                      in the hash table */
+   int nentry;                     /* No. of entries in the hash table */
    int mapsize;                    /* Length of table */
    int keycase;                    /* Are keys case sensitive? */
    int keyerror;                   /* Report error if no key? */
@@ -143,6 +146,9 @@ typedef struct AstKeyMap {
    AstMapEntry *firstA;            /* Pointer to first "AST object"-type entry */
    int iter_itab;                  /* Next hash table entry to return */
    AstMapEntry *iter_entry;        /* Next entry to return */
+   int key_index;                  /* Index of last key returned by MapKey */
+   int key_itab;                   /* Hash table entry holding that key */
+   AstMapEntry *key_entry;         /* Entry holding that key */
 } AstKeyMap;
 
 /* Virtual function table. */
@@ -115,6 +115,11 @@ f     The LutMap class does not define any new routines beyond those
 *        The GetMonotonic function had a bug that caused all LutMaps
 *        to be considered monotonic, and thus have an inverse
 *        transformation.
+*     17-OCT-2026 (DSB):
+*        Use a coarse index into the inverse lookup table, created when
+*        the LutMap is created, to speed up the search for the table
+*        elements that bracket each input value in the inverse
+*        transformation.
 *class--
 */
 
@@ -216,11 +221,13 @@ AstLutMap *astLutMapId_( int, const double [], double, double, const char *, ...
 /* ======================================== */
 static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static int GetLinear( AstMapping *, int * );
+static int FindBracket( const double *, int, int, double, int, int * );
 static int GetMonotonic( int, const double *, int *, double **, int **, int **, int * );
 static int MapMerge( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
 static void Copy( const AstObject *, AstObject *, int * );
 static void Delete( AstObject *, int * );
 static void Dump( AstObject *, AstChannel *, int * );
+static void MakeIndex( AstLutMap *, int * );
 static int Equal( AstObject *, AstObject *, int * );
 static double *GetLutMapInfo( AstLutMap *, double *, double *, int *, int * );
 
@@ -407,6 +414,113 @@ static int Equal( AstObject *this_object, AstObject *that_object, int *status )
    return result;
 }
 
+static int FindBracket( const double *lut, int nlut, int up, double value,
+                        int guess, int *status ){
+/*
+*  Name:
+*     FindBracket
+
+*  Purpose:
+*     Find the lookup table elements that bracket a given value.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "lutmap.h"
+*     int FindBracket( const double *lut, int nlut, int up, double value,
+*                      int guess, int *status )
+
+*  Class Membership:
+*     LutMap member function.
+
+*  Description:
+*     This function searches a monotonic lookup table for the two adjacent
+*     elements whose values bracket a given value. The search starts at a
+*     supplied first guess, and proceeds in steps of increasing size until
+*     the bracketing elements are known to lie within a given range of
+*     elements. A binary search of this range is then performed. The
+*     number of table elements checked is thus proportional to the
+*     logarithm of the distance between the first guess and the returned
+*     element, rather than the logarithm of the table length.
+*
+*     The returned index is identical to that found by a binary search
+*     of the whole table.
+
+*  Parameters:
+*     lut
+*        Pointer to the lookup table. It should not contain any bad values.
+*     nlut
+*        The number of elements in the lookup table.
+*     up
+*        Non-zero if the table values increase with element index.
+*     value
+*        The value to search for.
+*     guess
+*        The index of the table element at which to start the search.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     The index of the lower of the two bracketing elements. This will
+*     be -1 if the value is beyond the first table element, and "nlut-2"
+*     if the value is beyond the last table element.
+*/
+
+/* Local Variables: */
+   int i1;                       /* Highest index known to be below value */
+   int i2;                       /* Lowest index known to be above value */
+   int i;                        /* Index of element being checked */
+   int nlutm1;                   /* Number of LUT entries minus one */
+   int step;                     /* Size of next step */
+
+/* Check the global error status. */
+   if ( !astOK ) return -1;
+
+/* Ensure the first guess is within the range of possible results. */
+   nlutm1 = nlut - 1;
+   if( guess < -1 ) guess = -1;
+   if( guess > nlutm1 - 1 ) guess = nlutm1 - 1;
+
+/* If the value is beyond the element at the first guess, step forwards
+   through the table until an element is found that the value is not
+   beyond. The step size is doubled after each step. The last element in
+   the table is never checked. */
+   if( guess < 0 || ( ( value >= lut[ guess ] ) == up ) ) {
+      i1 = guess;
+      i2 = guess + 1;
+      step = 1;
+      while( i2 < nlutm1 && ( ( value >= lut[ i2 ] ) == up ) ) {
+         i1 = i2;
+         step *= 2;
+         i2 = i1 + step;
+      }
+      if( i2 > nlutm1 ) i2 = nlutm1;
+
+/* Otherwise, step backwards through the table in the same way until an
+   element is found that the value is beyond. */
+   } else {
+      i2 = guess;
+      i1 = guess - 1;
+      step = 1;
+      while( i1 >= 0 && ( ( value >= lut[ i1 ] ) != up ) ) {
+         i2 = i1;
+         step *= 2;
+         i1 = i2 - step;
+      }
+      if( i1 < -1 ) i1 = -1;
+   }
+
+/* Perform a binary search between the two elements found above. */
+   while ( i2 > ( i1 + 1 ) ) {
+      i = ( i1 + i2 ) / 2;
+      *( ( ( value >= lut[ i ] ) == up ) ? &i1 : &i2 ) = i;
+   }
+
+/* Return the lower bracketing index. */
+   return i1;
+}
+
 static const char *GetAttrib( AstObject *this_object, const char *attrib, int *status ) {
 /*
 *  Name:
@@ -975,6 +1089,102 @@ void astInitLutMapVtab_(  AstLutMapVtab *vtab, const char *name, int *status ) {
    }
 }
 
+static void MakeIndex( AstLutMap *this, int *status ){
+/*
+*  Name:
+*     MakeIndex
+
+*  Purpose:
+*     Create a coarse index into the lookup table used by the inverse
+*     transformation.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "lutmap.h"
+*     void MakeIndex( AstLutMap *this, int *status )
+
+*  Class Membership:
+*     LutMap member function.
+
+*  Description:
+*     This function divides the range of values in the lookup table used
+*     by the inverse transformation into a set of equal sized cells, one
+*     for each table element. For each cell, it stores the index of the
+*     lower of the two adjacent table elements that bracket the value at
+*     the start of the cell. The inverse transformation uses this index
+*     to get a first guess at the elements that bracket each input value,
+*     so that only a few table elements usually need to be checked.
+*
+*     No index is created if the first and last table values are equal.
+
+*  Parameters:
+*     this
+*        Pointer to the LutMap. The lookup table should be monotonic.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   double *lut;                  /* Pointer to LUT */
+   double hi;                    /* Largest table value */
+   double lo;                    /* Smallest table value */
+   double scale;                 /* Number of cells per unit table value */
+   int *celli;                   /* Pointer to coarse index */
+   int i1;                       /* Lower bracketing LUT index */
+   int icell;                    /* Cell index */
+   int nlut;                     /* Number of LUT entries */
+   int up;                       /* LUT values are increasing? */
+
+/* Initialise. */
+   this->celli = NULL;
+   this->ncelli = 0;
+   this->cellzero = 0.0;
+   this->cellscale = 0.0;
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Get the lookup table used by the inverse transformation. This is the
+   forward lookup table with any bad values removed. */
+   if( this->luti ) {
+      lut = this->luti;
+      nlut = this->nluti;
+   } else {
+      lut = this->lut;
+      nlut = this->nlut;
+   }
+
+/* Get the range of table values, and return without action if there is
+   no usable range. */
+   if( !lut || nlut < 2 ) return;
+   up = ( lut[ nlut - 1 ] > lut[ 0 ] );
+   lo = up ? lut[ 0 ] : lut[ nlut - 1 ];
+   hi = up ? lut[ nlut - 1 ] : lut[ 0 ];
+   if( hi <= lo ) return;
+   scale = nlut/( hi - lo );
+   if( !astISFINITE( scale ) ) return;
+
+/* Allocate the index, and store the bracketing index for the start of each
+   cell. The values at the start of the cells are monotonic, so the search
+   for each cell can start at the result for the previous cell. */
+   celli = astMalloc( sizeof( int )*(size_t) nlut );
+   if( astOK ) {
+      i1 = up ? -1 : nlut - 2;
+      for( icell = 0; icell < nlut; icell++ ) {
+         i1 = FindBracket( lut, nlut, up, lo + icell/scale, i1, status );
+         celli[ icell ] = i1;
+      }
+
+/* Store the index in the LutMap. */
+      this->celli = celli;
+      this->ncelli = nlut;
+      this->cellzero = lo;
+      this->cellscale = scale;
+   }
+}
+
 static int MapMerge( AstMapping *this, int where, int series, int *nmap,
                      AstMapping ***map_list, int **invert_list, int *status ) {
 /*
@@ -1474,7 +1684,8 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
    int *index;                   /* Translates reduced to original indices */
    int i1;                       /* Lower adjacent LUT index */
    int i2;                       /* Upper adjacent LUT index */
-   int i;                        /* New LUT index */
+   int icell;                    /* Index of coarse index cell */
+   int ilast;                    /* Lower LUT index for previous point */
    int istart;                   /* Original LUT index at start of interval */
    int ix;                       /* "x" converted to an int */
    int near;                     /* Perform nearest neighbour interpolation? */
@@ -1522,6 +1733,11 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
          nlut = map->nlut;
          near = ( astGetLutInterp( map ) == NEAR );
          nlutm1 = nlut - 1;
+         up = ( lut[ nlutm1 ] > lut[ 0 ] );
+
+/* Indicate that no table elements have yet been found that bracket an
+   input value. */
+         ilast = -2;
 
 /* Calculate the scale factor required. */
          scale = 1.0 / map->inc;
@@ -1626,6 +1842,11 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
          }
          near = ( astGetLutInterp( map ) == NEAR );
          nlutm1 = nlut - 1;
+         up = ( lut[ nlutm1 ] > lut[ 0 ] );
+
+/* Indicate that no table elements have yet been found that bracket an
+   input value. */
+         ilast = -2;
 
 /* Loop to transform each input point. */
          for ( point = 0; point < npoint; point++ ) {
@@ -1648,16 +1869,36 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
    entries are monotonically increasing or decreasing, possibly with sections
    of equal or bad values. */
             } else {
-               up = ( lut[ nlutm1 ] > lut[ 0 ] );
-
-/* Perform a binary search to identify two adjacent lookup table
-   elements whose values bracket the input coordinate value. */
-               i1 = -1;
-               i2 = nlutm1;
-               while ( i2 > ( i1 + 1 ) ) {
-                  i = ( i1 + i2 ) / 2;
-                  *( ( ( value_in >= lut[ i ] ) == up ) ? &i1 : &i2 ) = i;
+
+/* Identify two adjacent lookup table elements whose values bracket the
+   input coordinate value. First check the elements that bracketed the
+   previous input value, since these will often be correct if the input
+   values are sorted. Otherwise, use the coarse index (if any) to get a
+   first guess, and search the table from there. */
+               if( ilast < -1 ||
+                   ( ilast >= 0 && ( ( value_in >= lut[ ilast ] ) != up ) ) ||
+                   ( ilast < nlutm1 - 1 &&
+                     ( ( value_in >= lut[ ilast + 1 ] ) == up ) ) ) {
+
+                  if( map->celli ) {
+                     x = ( value_in - map->cellzero )*map->cellscale;
+                     if( x >= 0.0 && x < map->ncelli ) {
+                        icell = (int) x;
+                     } else if( x >= map->ncelli ) {
+                        icell = map->ncelli - 1;
+                     } else {
+                        icell = 0;
+                     }
+                     ilast = map->celli[ icell ];
+                  } else {
+                     ilast = nlutm1/2;
+                  }
+
+                  ilast = FindBracket( lut, nlut, up, value_in, ilast,
+                                       status );
                }
+               i1 = ilast;
+               i2 = i1 + 1;
 
 /* If the lower table value is equal to the required value, and either of
    its neighbours is also equal to the required value, then we have been
@@ -1882,6 +2123,7 @@ static void Copy( const AstObject *objin, AstObject *objout, int *status ) {
    out->luti = NULL;
    out->flagsi = NULL;
    out->indexi = NULL;
+   out->celli = NULL;
 
 /* Allocate memory and store a copy of the lookup table data. */
    out->lut = astStore( NULL, in->lut,
@@ -1894,6 +2136,8 @@ static void Copy( const AstObject *objin, AstObject *objout, int *status ) {
                                         sizeof( double ) * (size_t) in->nluti );
    if( in->indexi ) out->indexi = astStore( NULL, in->indexi,
                                         sizeof( double ) * (size_t) in->nluti );
+   if( in->celli ) out->celli = astStore( NULL, in->celli,
+                                        sizeof( int ) * (size_t) in->ncelli );
 }
 
 /* Destructor. */
@@ -1933,6 +2177,7 @@ static void Delete( AstObject *obj, int *status ) {
    this->luti = astFree( this->luti );
    this->flagsi = astFree( this->flagsi );
    this->indexi = astFree( this->indexi );
+   this->celli = astFree( this->celli );
 }
 
 /* Dump function. */
@@ -2403,6 +2648,7 @@ AstLutMap *astInitLutMap_( void *mem, size_t size, int init,
          new->luti = luti;
          new->flagsi = flagsi;
          new->indexi = indexi;
+         new->celli = NULL;
 
 /* Allocate memory and store the lookup table. */
          new->lut = astStore( NULL, lut, sizeof( double ) * (size_t) nlut );
@@ -2418,6 +2664,10 @@ AstLutMap *astInitLutMap_( void *mem, size_t size, int init,
          new->last_fwd_out = AST__BAD;
          new->last_inv_in = AST__BAD;
          new->last_inv_out = AST__BAD;
+
+/* If the inverse transformation is defined, create a coarse index into
+   the lookup table it uses. */
+         if( dirn ) MakeIndex( new, status );
       }
 
 /* If an error occurred, clean up by deleting the new LutMap. */
@@ -2572,6 +2822,10 @@ AstLutMap *astLoadLutMap_( void *mem, size_t size,
       new->lutepsilon = astReadDouble( channel, "luteps", AST__BAD );
       if ( TestLutEpsilon( new, status ) ) SetLutEpsilon( new, new->lutepsilon, status );
 
+/* The coarse index into the inverse lookup table is not dumped. It is
+   re-created below. */
+      new->celli = NULL;
+
 /* Allocate memory to hold the lookup table elements. */
       new->lut = astMalloc( sizeof( double ) * (size_t) new->nlut );
 
@@ -2588,10 +2842,12 @@ AstLutMap *astLoadLutMap_( void *mem, size_t size,
          new->last_inv_in = AST__BAD;
          new->last_inv_out = AST__BAD;
 
-/* See if the array is monotonic increasing or decreasing. */
-         (void) GetMonotonic( new->nlut, new->lut, &(new->nluti),
-                              &(new->luti), &(new->flagsi), &(new->indexi),
-                              status );
+/* See if the array is monotonic increasing or decreasing. If so,
+   create a coarse index into the lookup table used by the inverse
+   transformation. */
+         if( GetMonotonic( new->nlut, new->lut, &(new->nluti),
+                           &(new->luti), &(new->flagsi), &(new->indexi),
+                           status ) ) MakeIndex( new, status );
       }
    }
 
@@ -114,6 +114,8 @@
 *        Original version.
 *     8-JAN-2003 (DSB):
 *        Added protected astInitLutMapVtab method.
+*     17-OCT-2026 (DSB):
+*        Added coarse index for the inverse lookup table.
 *-
 */
 
@@ -156,16 +158,20 @@ typedef struct AstLutMap {
 /* Attributes specific to objects in this class. */
    double *lut;                 /* Pointer to lookup table */
    double *luti;                /* Reduced lookup table for inverse trans. */
+   double cellscale;            /* No. of index cells per unit table value */
+   double cellzero;             /* Table value at start of first index cell */
    double inc;                  /* Input increment between table entries */
    double last_fwd_in;          /* Last input value (forward transfm.) */
    double last_fwd_out;         /* Last output value (forward transfm.) */
    double last_inv_in;          /* Last input value (inverse transfm.) */
    double last_inv_out;         /* Last output value (inverse transfm.) */
    double start;                /* Input value for first table entry */
+   int *celli;                  /* Coarse index into inverse table */
    int *flagsi;                 /* Flags indicating adjacent bad values */
    int *indexi;                 /* Translates reduced to original indices */
    double lutepsilon;           /* Relative error of table values */
    int lutinterp;               /* Interpolation method */
+   int ncelli;                  /* No. of cells in coarse index */
    int nlut;                    /* Number of table entries */
    int nluti;                   /* Reduced number of table entries */
 } AstLutMap;
@@ -43,6 +43,7 @@ c     following functions may also be applied to all Mappings:
 f     In addition to those routines applicable to all Objects, the
 f     following routines may also be applied to all Mappings:
 *
+c     - astCompile: Create a Mapping that retains work space for re-use
 c     - astDecompose: Decompose a Mapping into two component Mappings
 c     - astTranGrid: Transform a grid of positions
 c     - astInvert: Invert a Mapping
@@ -58,8 +59,10 @@ c     - astRemoveRegions: Remove any Regions from a Mapping
 c     - astSimplify: Simplify a Mapping
 c     - astTran1: Transform 1-dimensional coordinates
 c     - astTran2: Transform 2-dimensional coordinates
+c     - astTranI: Transform N-dimensional coordinates held in an interleaved array
 c     - astTranN: Transform N-dimensional coordinates
 c     - astTranP: Transform N-dimensional coordinates held in separate arrays
+f     - AST_COMPILE: Create a Mapping that retains work space for re-use
 f     - AST_DECOMPOSE: Decompose a Mapping into two component Mappings
 f     - AST_TRANGRID: Transform a grid of positions
 f     - AST_INVERT: Invert a Mapping
@@ -388,6 +391,30 @@ f     - AST_TRANN: Transform N-dimensional coordinates
 *        coeffs for the bad outputs are set bad.
 *     9-MAR-2018 (DSB):
 *        Added the AST__PARWGT flag in astRebinSeq.
+*     17-OCT-2026 (DSB):
+*        Allow astResample<X> to share the resampling of the leaf
+*        sections produced by ResampleAdaptively between a pool of worker
+*        threads, as controlled by the MaxThreads tuning parameter.
+*     17-OCT-2026 (DSB):
+*        Allow astRebin<X> and astRebinSeq<X> to share the pasting of
+*        floating point data between a pool of worker threads. Each thread
+*        pastes into private accumulation arrays, which are summed once all
+*        threads have finished.
+*     17-OCT-2026 (DSB):
+*        Avoid calls to floor() within the innermost loops of the linear
+*        and nearest-neighbour interpolation schemes used by
+*        astResample<X>. In 2-D linear interpolation without bad pixels
+*        or variances, form the sums for points away from the edges of
+*        the input grid without testing each pixel against the bounds.
+*     17-OCT-2026 (DSB):
+*        Added the option (controlled by the KernelTable tuning parameter)
+*        to evaluate 1-dimensional interpolation and spreading kernels by
+*        linear interpolation within a cached table of kernel values.
+*     17-OCT-2026 (DSB):
+*        Added method astTranI.
+*     17-OCT-2026 (DSB):
+*        Added method astCompile. Override astGetObjSize to include the
+*        PointSets retained by compiled Mappings.
 *
 *class--
 */
@@ -404,6 +431,27 @@ f     - AST_TRANN: Transform N-dimensional coordinates
 #define RATEFUN_MAX_CACHE  5
 #define RATE_ORDER 8
 
+/* The largest number of worker threads that may be used by
+   astResample<X> and astRebin<X>, and the smallest number of pixels for
+   which it is considered worthwhile to use more than one thread. */
+#define MAX_THREADS 256
+#define MIN_THREAD_PIX 16384
+
+/* Round a double value down to the nearest integer, returning an int.
+   This gives the same result as "(int) floor( x )" for any value within
+   the range of an int, but avoids a function call within the innermost
+   loops of the interpolation functions. */
+#define FLOOR_INT(x) ( (int) (x) - ( (double) (int) (x) > (x) ) )
+
+/* The number of tables of 1-dimensional kernel values that are retained
+   for re-use (see GetKernelTable), and the largest number of elements
+   allowed in any one table. */
+#define KERNEL_TABLE_CACHE 8
+#define KERNEL_TABLE_MAX 1048576
+
+/* The number of points transformed at once by astTranI. */
+#define TRANI_BLOCK 1024
+
 /* Include files. */
 /* ============== */
 
@@ -444,6 +492,10 @@ f     - AST_TRANN: Transform N-dimensional coordinates
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef THREAD_SAFE
+#include <pthread.h>
+#endif
+
 /* Module type definitions. */
 /* ======================== */
 /* Enum to represent the data type when resampling a grid of data. */
@@ -482,6 +534,87 @@ typedef struct MapData {
    int nout;                     /* Number of output coordinates per point */
 } MapData;
 
+/* Data structure to hold a list of sections of a grid, each of which can
+   be resampled or rebinned independently of the others (for instance, by
+   a separate thread). */
+typedef struct SectionList {
+   double **linear_fit;          /* Linear fit for each section (or NULL) */
+   int **lbnd;                   /* Lower pixel bounds of each section */
+   int **ubnd;                   /* Upper pixel bounds of each section */
+   int mxpix;                    /* Max. number of pixels in a section */
+   int nsection;                 /* Number of sections in the list */
+} SectionList;
+
+/* Data structure to hold a cached table of values for a 1-dimensional
+   interpolation kernel (see GetKernelTable). */
+typedef struct KernelTable {
+   double *table;                /* Table of kernel values (NULL if failed) */
+   double k;                     /* Kernel parameter value */
+   int digits;                   /* Decimal places of accuracy */
+   int neighb;                   /* Number of neighbouring pixels covered */
+   int nuse;                     /* Number of current users of the table */
+   int used;                     /* Time at which table was last requested */
+   void (* kernel)( double, const double [], int, double *, int * ); /* Kernel function */
+} KernelTable;
+
+/* Data structure describing a resampling operation that is to be shared
+   between a pool of worker threads. */
+typedef struct ResampleJob {
+   AstMapping **map;             /* Independent Mapping for each thread */
+   AstMapping *unsimplified;     /* Mapping supplied by the caller */
+   DataType type;                /* Data type of the grids */
+   SectionList *sections;        /* The output sections to resample */
+   const double *params;         /* Interpolation parameters */
+   const int *lbnd_in;           /* Input grid lower bounds */
+   const int *lbnd_out;          /* Output grid lower bounds */
+   const int *ubnd_in;           /* Input grid upper bounds */
+   const int *ubnd_out;          /* Output grid upper bounds */
+   const void *badval_ptr;       /* Pointer to bad value */
+   const void *in;               /* Input data array */
+   const void *in_var;           /* Input variance array */
+   int *nbad;                    /* Number of bad output pixels per section */
+   int flags;                    /* Resampling flags */
+   int interp;                   /* Interpolation scheme */
+   int ndim_in;                  /* Number of input grid dimensions */
+   int ndim_out;                 /* Number of output grid dimensions */
+   void (* finterp)( void );     /* User-supplied interpolation function */
+   void *out;                    /* Output data array */
+   void *out_var;                /* Output variance array */
+} ResampleJob;
+
+/* Data structure describing a rebinning operation that is to be shared
+   between a pool of worker threads. The input sections are divided into
+   "nchunk" contiguous chunks, each of which is pasted into a separate set
+   of accumulation arrays. The first set of arrays is the one supplied by
+   the caller. */
+typedef struct RebinJob {
+   AstMapping **map;             /* Independent Mapping for each thread */
+   AstMapping *unsimplified;     /* Mapping supplied by the caller */
+   DataType type;                /* Data type of the grids */
+   SectionList *sections;        /* The input sections to rebin */
+   const double *params;         /* Spreading parameters */
+   const int *lbnd_in;           /* Input grid lower bounds */
+   const int *lbnd_out;          /* Output grid lower bounds */
+   const int *ubnd_in;           /* Input grid upper bounds */
+   const int *ubnd_out;          /* Output grid upper bounds */
+   const void *badval_ptr;       /* Pointer to bad value */
+   const void *in;               /* Input data array */
+   const void *in_var;           /* Input variance array */
+   double **work;                /* Weights array for each chunk */
+   int *result;                  /* Flux conservation failure per section */
+   int64_t *nused;               /* No. of input values used by each chunk */
+   int flags;                    /* Rebinning flags */
+   int nchunk;                   /* Number of chunks */
+   int ndim_in;                  /* Number of input grid dimensions */
+   int ndim_out;                 /* Number of output grid dimensions */
+   int npix_out;                 /* Number of output pixels */
+   int nwork;                    /* Number of weights per output pixel */
+   int spread;                   /* Pixel spreading scheme */
+   size_t size;                  /* Size of each data value */
+   void **out;                   /* Output data array for each chunk */
+   void **out_var;               /* Output variance array for each chunk */
+} RebinJob;
+
 /* Convert from floating point to floating point or integer */
 #define CONV(IntType,val) ( ( IntType ) ? (int) ( (val) + (((val)>0)?0.5:-0.5) ) : (val) )
 
@@ -498,6 +631,39 @@ static int (* parent_testattrib)( AstObject *, const char *, int * );
 static void (* parent_clearattrib)( AstObject *, const char *, int * );
 static void (* parent_setattrib)( AstObject *, const char *, int * );
 static int (* parent_equal)( AstObject *, AstObject *, int * );
+static int (* parent_getobjsize)( AstObject *, int * );
+
+#if defined(THREAD_SAFE)
+static int (* parent_managelock)( AstObject *, int, int, AstObject **, int * );
+#endif
+
+/* Variables describing the pool of worker threads used to share the
+   processing of independent tasks (see RunTasks). These are shared by
+   all threads and so are guarded by a mutex. A second mutex ensures that
+   only one batch of tasks is being processed by the pool at any one time. */
+#ifdef THREAD_SAFE
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t batch_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_start = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t pool_finish = PTHREAD_COND_INITIALIZER;
+static int pool_batch = 0;       /* Identifier for the current batch */
+static int pool_nbusy = 0;       /* No. of tasks not yet completed */
+static int pool_next = 0;        /* Index of the next task to be started */
+static int pool_ntask = 0;       /* No. of tasks in the current batch */
+static int pool_nuse = 0;        /* No. of workers used by current batch */
+static int pool_nworker = 0;     /* No. of worker threads created so far */
+static int pool_status[ MAX_THREADS ]; /* Status value from each worker */
+static void *pool_data = NULL;   /* Data passed to each task */
+static void (* pool_task)( void *, int, int, int * ) = NULL; /* Task fn. */
+#endif
+
+/* A cache of tables of 1-dimensional kernel values (see GetKernelTable).
+   This is shared by all threads and so is guarded by a mutex. */
+#ifdef THREAD_SAFE
+static pthread_mutex_t kernel_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+static KernelTable kernel_cache[ KERNEL_TABLE_CACHE ];
+static int kernel_clock = 0;
 
 
 /* Define macros for accessing each item of thread specific global data. */
@@ -662,9 +828,13 @@ DECLARE_GENERIC(LD,long double)
 
 
 static AstMapping *RemoveRegions( AstMapping *, int * );
+static AstMapping *Compile( AstMapping *, int * );
 static AstMapping *Simplify( AstMapping *, int * );
+static AstPointSet *GetTranPoints( AstMapping *, int, int, int, const double **, const double *, int, int * );
+static AstPointSet *ReleaseTranPoints( AstMapping *, int, AstPointSet *, int * );
 static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static const char *GetAttrib( AstObject *, const char *, int * );
+static const double *GetKernelTable( void (*)( double, const double [], int, double *, int * ), const double *, int, int * );
 static double FindGradient( AstMapping *, double *, int, int, double, double, double *, int * );
 static double J1Bessel( double, int * );
 static double LocalMaximum( const MapData *, double, double, double [], int * );
@@ -682,6 +852,7 @@ static int GetIsLinear( AstMapping *, int * );
 static int GetIsSimple( AstMapping *, int * );
 static int GetNin( AstMapping *, int * );
 static int GetNout( AstMapping *, int * );
+static int GetObjSize( AstObject *, int * );
 static int GetReport( AstMapping *, int * );
 static int GetTranForward( AstMapping *, int * );
 static int GetTranInverse( AstMapping *, int * );
@@ -692,15 +863,20 @@ static int MaxI( int, int, int * );
 static int MinI( int, int, int * );
 static int DoNotSimplify( AstMapping *, int * );
 static int QuadApprox( AstMapping *, const double[2], const double[2], int, int, double *, double *, int * );
-static int RebinAdaptively( AstMapping *, int, const int *, const int *, const void *, const void *, DataType, int, const double *, int, double, int, const void *, int, const int *, const int *, const int *, const int *, int, void *, void *, double *, int64_t *, int * );
+static int RebinAdaptively( AstMapping *, int, const int *, const int *, const void *, const void *, DataType, int, const double *, int, double, int, const void *, int, const int *, const int *, const int *, const int *, int, void *, void *, double *, int64_t *, SectionList *, int * );
+static int RebinInThreads( AstMapping *, int, int, const int *, const int *, const void *, const void *, DataType, int, const double *, int, double, int, const void *, int, const int *, const int *, const int *, const int *, int, void *, void *, double *, int64_t *, int * );
 static int RebinWithBlocking( AstMapping *, const double *, int, const int *, const int *, const void *, const void *, DataType, int, const double *, int, const void *, int, const int *, const int *, const int *, const int *, int, void *, void *, double *, int64_t *, int * );
-static int ResampleAdaptively( AstMapping *, int, const int *, const int *, const void *, const void *, DataType, int, void (*)( void ), const double *, int, double, int, const void *, int, const int *, const int *, const int *, const int *, void *, void *, int * );
+static int ResampleAdaptively( AstMapping *, int, const int *, const int *, const void *, const void *, DataType, int, void (*)( void ), const double *, int, double, int, const void *, int, const int *, const int *, const int *, const int *, void *, void *, SectionList *, int * );
+static int ResampleInThreads( AstMapping *, int, int, const int *, const int *, const void *, const void *, DataType, int, void (*)( void ), const double *, int, double, int, const void *, int, const int *, const int *, const int *, const int *, void *, void *, int * );
 static int ResampleSection( AstMapping *, const double *, int, const int *, const int *, const void *, const void *, DataType, int, void (*)( void ), const double *, double, int, const void *, int, const int *, const int *, const int *, const int *, void *, void *, int * );
 static int ResampleWithBlocking( AstMapping *, const double *, int, const int *, const int *, const void *, const void *, DataType, int, void (*)( void ), const double *, int, const void *, int, const int *, const int *, const int *, const int *, void *, void *, int * );
+static int RunTasks( int, int, void (*)( void *, int, int, int * ), void *, int * );
 static int SpecialBounds( const MapData *, double *, double *, double [], double [], int * );
 static int TestAttrib( AstObject *, const char *, int * );
 static int TestInvert( AstMapping *, int * );
 static int TestReport( AstMapping *, int * );
+static int ThreadCount( int, int * );
+static void AddSections( SectionList *, int, const int *, const int *, int, const double *, int * );
 static void ClearAttrib( AstObject *, const char *, int * );
 static void ClearInvert( AstMapping *, int * );
 static void ClearReport( AstMapping *, int * );
@@ -714,8 +890,13 @@ static void Invert( AstMapping *, int * );
 static void MapBox( AstMapping *, const double [], const double [], int, int, double *, double *, double [], double [], int * );
 static void RateFun( AstMapping *, double *, int, int, int, double *, double *, int * );
 static void RebinSection( AstMapping *, const double *, int, const int *, const int *, const void *, const void *, double, DataType, int, const double *, int, const void *, int, const int *, const int *, const int *, const int *, int, void *, void *, double *, int64_t *, int * );
+static void RebinSumTask( void *, int, int, int * );
+static void RebinTask( void *, int, int, int * );
+static void ResampleTask( void *, int, int, int * );
+static void ReleaseKernelTable( const double *, int * );
 static void ReportPoints( AstMapping *, int, AstPointSet *, AstPointSet *, int * );
 static void SetAttrib( AstObject *, const char *, int * );
+static void SetCompiled( AstMapping *, int * );
 static void SetInvert( AstMapping *, int, int * );
 static void SetReport( AstMapping *, int, int * );
 static void Sinc( double, const double [], int, double *, int * );
@@ -724,20 +905,152 @@ static void SincGauss( double, const double [], int, double *, int * );
 static void SincSinc( double, const double [], int, double *, int * );
 static void Somb( double, const double [], int, double *, int * );
 static void SombCos( double, const double [], int, double *, int * );
+static void TabKernel( double, const double [], int, double *, int * );
 static void Tran1( AstMapping *, int, const double [], int, double [], int * );
 static void Tran2( AstMapping *, int, const double [], const double [], int, double [], double [], int * );
 static void TranGrid( AstMapping *, int, const int[], const int[], double, int, int, int, int, double *, int * );
 static void TranGridAdaptively( AstMapping *, int, const int[], const int[], const int[], const int[], double, int, int, double *[], int * );
 static void TranGridSection( AstMapping *, const double *, int, const int *, const int *, const int *, const int *, int, double *[], int * );
 static void TranGridWithBlocking( AstMapping *, const double *, int, const int *, const int *, const int *, const int *, int, double *[], int * );
+static void TranI( AstMapping *, int, int, const double [], int, int, double [], int * );
 static void TranN( AstMapping *, int, int, int, const double *, int, int, int, double *, int * );
 static void TranP( AstMapping *, int, int, const double *[], int, int, double *[], int * );
 static void ValidateMapping( AstMapping *, int, int, int, int, const char *, int * );
 
+#ifdef THREAD_SAFE
+static void *PoolWorker( void * );
+#endif
+
+#if defined(THREAD_SAFE)
+static int ManageLock( AstObject *, int, int, AstObject **, int * );
+#endif
+
 
 
 /* Member functions. */
 /* ================= */
+static void AddSections( SectionList *list, int ndim, const int *lbnd,
+                         const int *ubnd, int ncoord,
+                         const double *linear_fit, int *status ) {
+/*
+*  Name:
+*     AddSections
+
+*  Purpose:
+*     Add a section of a grid to a list of independent sections.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     void AddSections( SectionList *list, int ndim, const int *lbnd,
+*                       const int *ubnd, int ncoord,
+*                       const double *linear_fit, int *status )
+
+*  Class Membership:
+*     Mapping member function.
+
+*  Description:
+*     This function appends a description of a section of a grid (the
+*     output grid when resampling, or the input grid when rebinning) to
+*     the supplied list. If the section contains more than the maximum
+*     number of pixels allowed for a single section by the list, it is
+*     first divided into a number of smaller slabs along its most
+*     significant dimension (i.e. the dimension that varies most slowly
+*     in the grid's data array), and each slab is appended to the list
+*     separately.
+
+*  Parameters:
+*     list
+*        Pointer to the list to be extended.
+*     ndim
+*        The number of dimensions in the grid being divided.
+*     lbnd
+*        Pointer to an array of integers, with "ndim" elements, giving
+*        the coordinates of the first pixel in the section.
+*     ubnd
+*        Pointer to an array of integers, with "ndim" elements, giving
+*        the coordinates of the last pixel in the section.
+*     ncoord
+*        The number of dimensions in the other grid (i.e. the number of
+*        coordinates generated by the linear approximation).
+*     linear_fit
+*        Pointer to an array of "ncoord*(ndim+1)" coefficients
+*        describing a linear approximation to the Mapping over the
+*        section (as returned by astLinearApprox), or NULL if no linear
+*        approximation is to be used. A copy of this array is stored with
+*        each slab appended to the list.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   int dim;                      /* Extent of section on split dimension */
+   int idim;                     /* Loop counter for dimensions */
+   int islab;                    /* Index of current slab */
+   int isplit;                   /* Index of dimension to be split */
+   int new;                      /* Index of new list entry */
+   int npix;                     /* Number of pixels in section */
+   int nslab;                    /* Number of slabs to create */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Count the pixels in the section. */
+   npix = 1;
+   for ( idim = 0; idim < ndim; idim++ ) {
+      npix *= ubnd[ idim ] - lbnd[ idim ] + 1;
+   }
+
+/* Determine how many slabs are needed to keep each one within the
+   maximum size. */
+   nslab = ( npix + list->mxpix - 1 ) / list->mxpix;
+
+/* Split the section along its most significant dimension, provided that
+   dimension spans enough pixels. Otherwise use the dimension with the
+   largest extent (splitting into fewer slabs if necessary). */
+   isplit = ndim - 1;
+   dim = ubnd[ isplit ] - lbnd[ isplit ] + 1;
+   if ( dim < nslab ) {
+      for ( idim = 0; idim < ndim; idim++ ) {
+         if ( ubnd[ idim ] - lbnd[ idim ] + 1 > dim ) {
+            isplit = idim;
+            dim = ubnd[ idim ] - lbnd[ idim ] + 1;
+         }
+      }
+      if ( dim < nslab ) nslab = dim;
+   }
+   if ( nslab < 1 ) nslab = 1;
+
+/* Extend the arrays within the list to accommodate the new slabs. */
+   list->linear_fit = astGrow( list->linear_fit, list->nsection + nslab,
+                               sizeof( double * ) );
+   list->lbnd = astGrow( list->lbnd, list->nsection + nslab,
+                         sizeof( int * ) );
+   list->ubnd = astGrow( list->ubnd, list->nsection + nslab,
+                         sizeof( int * ) );
+
+/* Loop to add each slab to the list. Each slab has its own copy of the
+   bounds and the linear fit so that the slabs can be freed
+   independently. */
+   for ( islab = 0; islab < nslab && astOK; islab++ ) {
+      new = list->nsection++;
+      list->lbnd[ new ] = astStore( NULL, lbnd, sizeof( int )*(size_t) ndim );
+      list->ubnd[ new ] = astStore( NULL, ubnd, sizeof( int )*(size_t) ndim );
+      list->linear_fit[ new ] = linear_fit ?
+                   astStore( NULL, linear_fit,
+                   sizeof( double )*(size_t) ( ncoord*( ndim + 1 ) ) ) : NULL;
+
+/* Set the bounds of the slab on the dimension being split. */
+      if ( astOK ) {
+         list->lbnd[ new ][ isplit ] = lbnd[ isplit ] + ( islab*dim )/nslab;
+         list->ubnd[ new ][ isplit ] = lbnd[ isplit ] +
+                                       ( ( islab + 1 )*dim )/nslab - 1;
+      }
+   }
+}
+
 static void ClearAttrib( AstObject *this_object, const char *attrib, int *status ) {
 /*
 *  Name:
@@ -813,6 +1126,111 @@ static void ClearAttrib( AstObject *this_object, const char *attrib, int *status
    }
 }
 
+static AstMapping *Compile( AstMapping *this, int *status ) {
+/*
+*++
+*  Name:
+c     astCompile
+f     AST_COMPILE
+
+*  Purpose:
+*     Create a Mapping that retains work space for repeated use.
+
+*  Type:
+*     Public virtual function.
+
+*  Synopsis:
+c     #include "mapping.h"
+c     AstMapping *astCompile( AstMapping *this )
+f     RESULT = AST_COMPILE( THIS, STATUS )
+
+*  Class Membership:
+*     Mapping method.
+
+*  Description:
+*     This function returns a simplified, independent copy of a Mapping
+*     which is intended to be used to transform many small batches of
+*     points. Normally, each call to a function such as
+c     astTran2 or astTranN
+f     AST_TRAN2 or AST_TRANN
+*     creates (and then deletes) new objects to describe the supplied
+*     coordinate arrays and any intermediate results, and for small
+*     numbers of points this can take longer than the transformation
+*     itself. A compiled Mapping instead retains these objects, together
+*     with any work arrays and the transformation plans used by compound
+*     Mappings (CmpMaps), and re-uses them on subsequent calls. Once the
+*     work space has been created by the first call, further calls that
+*     transform the same number of points or fewer will usually not need
+*     to allocate any memory.
+*
+*     The returned Mapping may be used in exactly the same way as the
+*     original, and gives the same results.
+
+*  Parameters:
+c     this
+f     THIS = INTEGER (Given)
+*        Pointer to the original Mapping.
+f     STATUS = INTEGER (Given and Returned)
+f        The global status.
+
+*  Returned Value:
+c     astCompile()
+f     AST_COMPILE = INTEGER
+*        A pointer to the compiled Mapping.
+
+*  Applicability:
+*     Mapping
+*        This function applies to all Mappings.
+*     FrameSet
+*        If the supplied Mapping is a FrameSet, the returned Mapping
+*        will be a compiled copy of the Mapping from the base Frame to
+*        the current Frame of the FrameSet. It will not be a FrameSet.
+
+*  Notes:
+*     - The work space is retained by the
+c     astTran1, astTran2, astTranN and astTranP functions.
+f     AST_TRAN1, AST_TRAN2 and AST_TRANN routines.
+*     Some classes of Mapping (such as MathMaps and PolyMaps) may still
+*     allocate memory internally when transforming points.
+*     - The returned Mapping retains work space only while it is in use.
+*     Since a compiled Mapping stores intermediate results within itself,
+*     it should not be modified after it has been created (for instance,
+*     by changing the attributes of any of its component Mappings).
+*     Inverting it is permitted.
+*     - A copy of a compiled Mapping is also compiled, but does not
+*     share any work space with the original.
+*     - A null Object pointer (AST__NULL) will be returned if this
+c     function is invoked with the AST error status set, or if it
+f     function is invoked with STATUS set to an error value, or if it
+*     should fail for any reason.
+*--
+*/
+
+/* Local Variables: */
+   AstMapping *result;           /* Pointer to compiled Mapping */
+   AstMapping *simp;             /* Pointer to simplified Mapping */
+
+/* Check the global error status. */
+   if ( !astOK ) return NULL;
+
+/* Simplify the Mapping, and then take a deep copy of the result so that
+   the work space retained by the returned Mapping and its components is
+   not shared with any other Mapping. */
+   simp = astSimplify( this );
+   result = astCopy( simp );
+   simp = astAnnul( simp );
+
+/* Indicate that the returned Mapping, and any component Mappings, should
+   retain their work space. */
+   SetCompiled( result, status );
+
+/* Annul the result if an error occurred. */
+   if ( !astOK ) result = astAnnul( result );
+
+/* Return the result. */
+   return result;
+}
+
 /*
 *  Name:
 *     ConserveFlux<X>
@@ -1586,6 +2004,225 @@ static int GetIsLinear( AstMapping *this, int *status ) {
    return 0;
 }
 
+static const double *GetKernelTable( void (* kernel)( double, const double [],
+                                                      int, double *, int * ),
+                                     const double *params, int neighb,
+                                     int *status ) {
+/*
+*  Name:
+*     GetKernelTable
+
+*  Purpose:
+*     Obtain a table of values for a 1-dimensional interpolation kernel.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     const double *GetKernelTable( void (* kernel)( double, const double [],
+*                                                    int, double *, int * ),
+*                                   const double *params, int neighb,
+*                                   int *status )
+
+*  Class Membership:
+*     Mapping member function.
+
+*  Description:
+*     This function returns a table of values for one of the internal
+*     1-dimensional interpolation kernels (Sinc, SincSinc, etc), suitable
+*     for passing as the "params" array to the TabKernel function. The
+*     table is sampled finely enough to give the accuracy specified by the
+*     KernelTable tuning parameter (see astTune) when linear interpolation
+*     is used to obtain kernel values between samples.
+*
+*     Tables are retained in a small cache so that they can be re-used by
+*     subsequent calls that use the same kernel, parameter value and
+*     accuracy. Each table returned by this function must be released
+*     using ReleaseKernelTable when it is no longer needed. Tables are
+*     never removed from the cache while in use.
+
+*  Parameters:
+*     kernel
+*        Pointer to the kernel function. All internal kernel functions
+*        are even functions of the offset, and use at most one value
+*        from their "params" array.
+*     params
+*        The "params" array to pass to the kernel function (may be NULL).
+*     neighb
+*        The number of neighbouring pixels used on each side of the
+*        interpolation point. The table covers all offsets in the range
+*        zero to "neighb".
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     A pointer to the table, or NULL if the KernelTable tuning parameter
+*     is zero, or if the required accuracy cannot be achieved using a table
+*     of reasonable size, or if all cache entries are currently in use. In
+*     these cases, the kernel function should be used directly.
+
+*  Notes:
+*     - The first element of the returned array holds the number of
+*     samples per pixel, and the second holds the index of the last
+*     sample. The remaining elements hold the kernel values at offsets
+*     of zero, one sample, two samples, etc.
+*     - A NULL pointer will be returned if this function is invoked
+*     with the global error status set, or if it should fail for any
+*     reason.
+*/
+
+/* Local Variables: */
+   KernelTable *entry;           /* Pointer to cache entry */
+   const double *result;         /* Returned pointer */
+   double *mid;                  /* Kernel values at mid-points */
+   double *table;                /* Table being created */
+   double *values;               /* Kernel values within table */
+   double err;                   /* Max. error at mid-points */
+   double k;                     /* Kernel parameter value */
+   double tol;                   /* Required accuracy */
+   double x;                     /* Offset at which to evaluate kernel */
+   int digits;                   /* Number of decimal places required */
+   int i;                        /* Sample index */
+   int ientry;                   /* Index of cache entry */
+   int nlast;                    /* Index of last sample */
+   int nper;                     /* Number of samples per pixel */
+
+/* Initialise. */
+   result = NULL;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Get the required accuracy. Return without action if kernel tables are
+   not in use. */
+   digits = astTune( "KernelTable", AST__TUNULL );
+   if ( digits <= 0 ) return result;
+
+/* The internal kernel functions use at most one element of the params
+   array. */
+   k = params ? params[ 0 ] : 0.0;
+
+/* Search the cache for an entry describing the required kernel. If
+   found, increment the number of users of its table. An entry with a
+   NULL table records that the required accuracy could not be achieved
+   previously, in which case there is no point in trying again. If no
+   entry is found, find the least recently used entry that is not
+   currently in use, and reserve it so that no other thread can use it
+   while the new table is being created. */
+#ifdef THREAD_SAFE
+   pthread_mutex_lock( &kernel_mutex );
+#endif
+   entry = NULL;
+   for ( ientry = 0; ientry < KERNEL_TABLE_CACHE; ientry++ ) {
+      if ( kernel_cache[ ientry ].kernel == kernel &&
+           kernel_cache[ ientry ].k == k &&
+           kernel_cache[ ientry ].neighb == neighb &&
+           kernel_cache[ ientry ].digits == digits ) {
+         result = kernel_cache[ ientry ].table;
+         if ( result ) kernel_cache[ ientry ].nuse++;
+         kernel_cache[ ientry ].used = ++kernel_clock;
+         entry = NULL;
+         break;
+
+      } else if ( !kernel_cache[ ientry ].nuse &&
+                  ( !entry || kernel_cache[ ientry ].used < entry->used ) ) {
+         entry = kernel_cache + ientry;
+      }
+   }
+
+   if ( entry ) {
+      entry->kernel = NULL;
+      entry->table = astFree( entry->table );
+      entry->nuse = 1;
+      entry->used = ++kernel_clock;
+   }
+#ifdef THREAD_SAFE
+   pthread_mutex_unlock( &kernel_mutex );
+#endif
+
+/* If no entry was found for the required kernel, and a free cache entry
+   is available, create a new table. Start with a coarse sampling and repeatedly
+   evaluate the kernel at the mid-point of each pair of adjacent samples,
+   comparing the result with the linearly interpolated value. Merge the
+   mid-points into the table, so halving the sample spacing, until the
+   error at the mid-points is smaller than the required accuracy. Since
+   the error from linear interpolation is proportional to the square of
+   the sample spacing, this leaves a margin of roughly a factor of four.
+   Give up if the table becomes too large. */
+   if ( entry ) {
+      tol = pow( 10.0, -digits );
+      nper = 8;
+      nlast = nper*neighb;
+      table = astMalloc( sizeof( double )*( nlast + 3 ) );
+      if ( astOK ) {
+         values = table + 2;
+         for ( i = 0; i <= nlast; i++ ) {
+            ( *kernel )( (double) i / (double) nper, params, 0, values + i,
+                         status );
+         }
+      }
+
+      while ( astOK ) {
+         err = 0.0;
+         mid = astMalloc( sizeof( double )*nlast );
+         if ( astOK ) {
+            for ( i = 0; i < nlast; i++ ) {
+               x = ( (double) i + 0.5 ) / (double) nper;
+               ( *kernel )( x, params, 0, mid + i, status );
+               err = MaxD( err, fabs( mid[ i ] - 0.5*( values[ i ] +
+                                      values[ i + 1 ] ) ), status );
+            }
+
+            table = astGrow( table, 2*nlast + 3, sizeof( double ) );
+            if ( astOK ) {
+               values = table + 2;
+               for ( i = nlast; i >= 0; i-- ) values[ 2*i ] = values[ i ];
+               for ( i = 0; i < nlast; i++ ) values[ 2*i + 1 ] = mid[ i ];
+               nper *= 2;
+               nlast *= 2;
+            }
+         }
+         mid = astFree( mid );
+
+         if ( err <= tol ) {
+            break;
+         } else if ( 2*nlast + 3 > KERNEL_TABLE_MAX ) {
+            table = astFree( table );
+            break;
+         }
+      }
+
+/* Store the new table (or a NULL pointer if no table could be created)
+   in the cache entry. If no table was created, release the entry. */
+      if ( table && astOK ) {
+         table[ 0 ] = (double) nper;
+         table[ 1 ] = (double) nlast;
+         result = table;
+      } else {
+         table = astFree( table );
+      }
+
+#ifdef THREAD_SAFE
+      pthread_mutex_lock( &kernel_mutex );
+#endif
+      entry->table = table;
+      if ( astOK ) {
+         entry->kernel = kernel;
+         entry->k = k;
+         entry->neighb = neighb;
+         entry->digits = digits;
+      }
+      if ( !result ) entry->nuse = 0;
+#ifdef THREAD_SAFE
+      pthread_mutex_unlock( &kernel_mutex );
+#endif
+   }
+
+/* Return the result. */
+   return result;
+}
+
 static int GetNin( AstMapping *this, int *status ) {
 /*
 *+
@@ -1702,6 +2339,73 @@ static int GetNout( AstMapping *this, int *status ) {
    return result;
 }
 
+static int GetObjSize( AstObject *this_object, int *status ) {
+/*
+*  Name:
+*     GetObjSize
+
+*  Purpose:
+*     Return the in-memory size of an Object.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     int GetObjSize( AstObject *this, int *status )
+
+*  Class Membership:
+*     Mapping member function (over-rides the astGetObjSize protected
+*     method inherited from the Object class).
+
+*  Description:
+*     This function returns the in-memory size of the supplied Mapping,
+*     in bytes. This includes any PointSets retained by a compiled
+*     Mapping (see astCompile).
+
+*  Parameters:
+*     this
+*        Pointer to the Mapping.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     The Object size, in bytes.
+
+*  Notes:
+*     - A value of zero will be returned if this function is invoked
+*     with the global status set, or if it should fail for any reason.
+*/
+
+/* Local Variables: */
+   AstMapping *this;          /* Pointer to Mapping structure */
+   int i;                     /* Index of retained PointSet */
+   int result;                /* Result value to return */
+
+/* Initialise. */
+   result = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Obtain a pointers to the Mapping structure. */
+   this = (AstMapping *) this_object;
+
+/* Invoke the GetObjSize method inherited from the parent class, and then
+   add on the PointSets retained by a compiled Mapping. */
+   result = (*parent_getobjsize)( this_object, status );
+
+   for( i = 0; i < 4; i++ ) {
+      if( this->tran_ps[ i ] ) result += astGetObjSize( this->tran_ps[ i ] );
+   }
+
+/* If an error occurred, clear the result value. */
+   if ( !astOK ) result = 0;
+
+/* Return the result, */
+   return result;
+}
+
 static int GetTranForward( AstMapping *this, int *status ) {
 /*
 *+
@@ -1820,6 +2524,130 @@ static int GetTranInverse( AstMapping *this, int *status ) {
    return result;
 }
 
+static AstPointSet *GetTranPoints( AstMapping *this, int slot, int npoint,
+                                   int ncoord, const double **ptr,
+                                   const double *data, int dim, int *status ) {
+/*
+*  Name:
+*     GetTranPoints
+
+*  Purpose:
+*     Get a PointSet describing coordinates supplied to an astTran<X>
+*     function.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     AstPointSet *GetTranPoints( AstMapping *this, int slot, int npoint,
+*                                 int ncoord, const double **ptr,
+*                                 const double *data, int dim, int *status )
+
+*  Class Membership:
+*     Mapping member function.
+
+*  Description:
+*     This function returns a PointSet that refers to a set of
+*     externally supplied coordinate arrays (without copying them). If
+*     the Mapping has been compiled (see astCompile), a PointSet
+*     retained by a previous call is re-used if possible. The PointSet
+*     should be passed to ReleaseTranPoints when it is no longer needed.
+
+*  Parameters:
+*     this
+*        Pointer to the Mapping.
+*     slot
+*        The index (0 to 3) of the PointSet within the Mapping's list of
+*        retained PointSets.
+*     npoint
+*        The number of points.
+*     ncoord
+*        The number of coordinates.
+*     ptr
+*        Array of "ncoord" pointers to the coordinate arrays. If NULL,
+*        the coordinate arrays are instead located using "data" and
+*        "dim".
+*     data
+*        Pointer to the first element of a 2-dimensional array holding
+*        the coordinates, in which the value of coordinate "coord" for
+*        point "point" is stored at "data[coord*dim+point]". Only used
+*        if "ptr" is NULL.
+*     dim
+*        The number of elements along the second dimension of the
+*        "data" array.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Pointer to the PointSet.
+
+*  Notes:
+*     - A NULL pointer will be returned if this function is invoked with
+*     the global error status set, or if it should fail for any reason.
+*/
+
+/* Local Variables: */
+   AstPointSet *result;          /* Pointer to returned PointSet */
+   const double **ptrs;          /* Pointers to coordinate arrays */
+   double **points;              /* Pointers stored in retained PointSet */
+   int coord;                    /* Coordinate index */
+
+/* Check the global error status. */
+   if ( !astOK ) return NULL;
+
+/* If the Mapping has been compiled, take any PointSet retained by a
+   previous call out of the Mapping. It is removed so that it cannot
+   also be used by a nested call for the same Mapping. Discard it if it
+   has the wrong number of coordinates. */
+   result = NULL;
+   if ( this->flags & AST__COMPILED_FLAG ) {
+      result = this->tran_ps[ slot ];
+      this->tran_ps[ slot ] = NULL;
+      if ( result && astGetNcoord( result ) != ncoord ) {
+         result = astAnnul( result );
+      }
+   }
+
+/* A retained PointSet never holds internally allocated coordinate
+   values, so its size can be changed freely and the supplied pointers
+   can be stored directly in its existing array of pointers. */
+   if ( result ) {
+      astSetNpoint( result, npoint );
+      points = astGetPoints( result );
+      if ( astOK ) {
+         for ( coord = 0; coord < ncoord; coord++ ) {
+            points[ coord ] = (double *) ( ptr ? ptr[ coord ] :
+                                                 data + coord*dim );
+         }
+      }
+
+/* Otherwise, create a new PointSet and associate the coordinate arrays
+   with it (note we must explicitly remove the "const" qualifier from the
+   data here, although input values will not be modified). */
+   } else {
+      result = astPointSet( npoint, ncoord, "", status );
+      if ( ptr ) {
+         astSetPoints( result, (double **) ptr );
+      } else {
+         ptrs = astMalloc( sizeof( const double * )*(size_t) ncoord );
+         if ( astOK ) {
+            for ( coord = 0; coord < ncoord; coord++ ) {
+               ptrs[ coord ] = data + coord*dim;
+            }
+            astSetPoints( result, (double **) ptrs );
+         }
+         ptrs = astFree( (void *) ptrs );
+      }
+   }
+
+/* Annul the result if an error occurred. */
+   if ( !astOK ) result = astAnnul( result );
+
+/* Return the result. */
+   return result;
+}
+
 static void GlobalBounds( MapData *mapdata, double *lbnd, double *ubnd,
                           double xl[], double xu[], int *status ) {
 /*
@@ -2521,6 +3349,7 @@ VTAB_GENERIC(LD)
 
    vtab->ClearInvert = ClearInvert;
    vtab->ClearReport = ClearReport;
+   vtab->Compile = Compile;
    vtab->Decompose = Decompose;
    vtab->DoNotSimplify = DoNotSimplify;
    vtab->GetInvert = GetInvert;
@@ -2550,6 +3379,7 @@ VTAB_GENERIC(LD)
    vtab->Tran2 = Tran2;
    vtab->TranGrid = TranGrid;
    vtab->TranN = TranN;
+   vtab->TranI = TranI;
    vtab->TranP = TranP;
    vtab->Transform = Transform;
 
@@ -2567,6 +3397,13 @@ VTAB_GENERIC(LD)
    object->TestAttrib = TestAttrib;
    parent_equal = object->Equal;
    object->Equal = Equal;
+   parent_getobjsize = object->GetObjSize;
+   object->GetObjSize = GetObjSize;
+
+#if defined(THREAD_SAFE)
+   parent_managelock = object->ManageLock;
+   object->ManageLock = ManageLock;
+#endif
 
 /* Declare the destructor, copy constructor and dump function. */
    astSetDelete( vtab, Delete );
@@ -4288,7 +5125,7 @@ static int InterpolateLinear##X( int ndim_in, \
    current coordinate and calculate this pixel's offset from the start \
    of the input array. */ \
       if ( Usebad ) { \
-         pixel = (int) floor( x + 0.5 ) - lbnd_in[ 0 ]; \
+         pixel = FLOOR_INT( x + 0.5 ) - lbnd_in[ 0 ]; \
 \
 /* Test if the pixel is bad. */ \
          bad = ( in[ pixel ] == badval ); \
@@ -4299,7 +5136,7 @@ static int InterpolateLinear##X( int ndim_in, \
    result. Also obtain the fractional weight to be applied to each of \
    these pixels. */ \
       if ( !bad ) { \
-         lo_x = (int) floor( x ); \
+         lo_x = FLOOR_INT( x ); \
          hi_x = lo_x + 1; \
          frac_lo_x = (double) hi_x - x; \
          frac_hi_x = 1.0 - frac_lo_x; \
@@ -4352,8 +5189,8 @@ static int InterpolateLinear##X( int ndim_in, \
    each input grid dimension of the input pixel which contains the \
    current coordinates. */ \
          if ( Usebad ) { \
-            ix = (int) floor( x + 0.5 ); \
-            iy = (int) floor( y + 0.5 ); \
+            ix = FLOOR_INT( x + 0.5 ); \
+            iy = FLOOR_INT( y + 0.5 ); \
 \
 /* Calculate this pixel's offset from the start of the input array. */ \
             pixel = ix - lbnd_in[ 0 ] + ystride * ( iy - lbnd_in[ 1 ] ); \
@@ -4367,13 +5204,13 @@ static int InterpolateLinear##X( int ndim_in, \
    result. Also obtain the fractional weight to be applied to each of \
    these pixels. */ \
          if ( !bad ) { \
-            lo_x = (int) floor( x ); \
+            lo_x = FLOOR_INT( x ); \
             hi_x = lo_x + 1; \
             frac_lo_x = (double) hi_x - x; \
             frac_hi_x = 1.0 - frac_lo_x; \
 \
 /* Repeat this process for the y dimension. */ \
-            lo_y = (int) floor( y ); \
+            lo_y = FLOOR_INT( y ); \
             hi_y = lo_y + 1; \
             frac_lo_y = (double) hi_y - y; \
             frac_hi_y = 1.0 - frac_lo_y; \
@@ -4391,37 +5228,63 @@ static int InterpolateLinear##X( int ndim_in, \
                if ( ( Xsigned ) || ( Usebad ) ) bad_var = 0; \
             } \
 \
-/* For each of the four pixels which may contribute to the result, \
-   test if the pixel indices lie within the input grid. Where they do, \
-   accumulate the sums required for forming the interpolated \
+/* If input bad pixels and variances are not being processed, and all \
+   four pixels which may contribute to the result lie within the input \
+   grid (as they do everywhere except at its edges), form the sums \
+   directly. The terms are added in the same order as below, so the \
+   sums are unchanged. */ \
+            if ( !( Usebad ) && !( Usevar ) && \
+                 lo_x >= lbnd_in[ 0 ] && hi_x <= ubnd_in[ 0 ] && \
+                 lo_y >= lbnd_in[ 1 ] && hi_y <= ubnd_in[ 1 ] ) { \
+               pixwt = frac_lo_x * frac_lo_y; \
+               sum = ( (Xfloattype) in[ off_lo ] ) * ( (Xfloattype) pixwt ); \
+               wtsum = (Xfloattype) pixwt; \
+               pixwt = frac_hi_x * frac_lo_y; \
+               sum += ( (Xfloattype) in[ off_lo + 1 ] ) * \
+                      ( (Xfloattype) pixwt ); \
+               wtsum += (Xfloattype) pixwt; \
+               pixwt = frac_lo_x * frac_hi_y; \
+               sum += ( (Xfloattype) in[ off_lo + ystride ] ) * \
+                      ( (Xfloattype) pixwt ); \
+               wtsum += (Xfloattype) pixwt; \
+               pixwt = frac_hi_x * frac_hi_y; \
+               sum += ( (Xfloattype) in[ off_lo + ystride + 1 ] ) * \
+                      ( (Xfloattype) pixwt ); \
+               wtsum += (Xfloattype) pixwt; \
+\
+/* Otherwise, for each of the four pixels which may contribute to the \
+   result, test if the pixel indices lie within the input grid. Where \
+   they do, accumulate the sums required for forming the interpolated \
    result. In each case, we supply the pixel's offset within the input \
    array and the weight to be applied to it. */ \
-            if ( lo_y >= lbnd_in[ 1 ] ) { \
-               if ( lo_x >= lbnd_in[ 0 ] ) { \
-                  FORM_LINEAR_INTERPOLATION_SUM(off_lo, \
-                                                frac_lo_x * frac_lo_y,Xtype, \
-                                                Xfloattype, Xsigned, \
-                                                Usebad,Usevar) \
-               } \
-               if ( hi_x <= ubnd_in[ 0 ] ) { \
-                  FORM_LINEAR_INTERPOLATION_SUM(off_lo + 1, \
-                                                frac_hi_x * frac_lo_y,Xtype, \
-                                                Xfloattype,Xsigned, \
-                                                Usebad,Usevar) \
-               } \
-            } \
-            if ( hi_y <= ubnd_in[ 1 ] ) { \
-               if ( lo_x >= lbnd_in[ 0 ] ) { \
-                  FORM_LINEAR_INTERPOLATION_SUM(off_lo + ystride, \
-                                                frac_lo_x * frac_hi_y,Xtype, \
-                                                Xfloattype,Xsigned, \
-                                                Usebad,Usevar) \
+            } else { \
+               if ( lo_y >= lbnd_in[ 1 ] ) { \
+                  if ( lo_x >= lbnd_in[ 0 ] ) { \
+                     FORM_LINEAR_INTERPOLATION_SUM(off_lo, \
+                                                   frac_lo_x * frac_lo_y,Xtype, \
+                                                   Xfloattype, Xsigned, \
+                                                   Usebad,Usevar) \
+                  } \
+                  if ( hi_x <= ubnd_in[ 0 ] ) { \
+                     FORM_LINEAR_INTERPOLATION_SUM(off_lo + 1, \
+                                                   frac_hi_x * frac_lo_y,Xtype, \
+                                                   Xfloattype,Xsigned, \
+                                                   Usebad,Usevar) \
+                  } \
                } \
-               if ( hi_x <= ubnd_in[ 0 ] ) { \
-                  FORM_LINEAR_INTERPOLATION_SUM(off_lo + ystride + 1, \
-                                                frac_hi_x * frac_hi_y,Xtype, \
-                                                Xfloattype,Xsigned, \
-                                                Usebad,Usevar) \
+               if ( hi_y <= ubnd_in[ 1 ] ) { \
+                  if ( lo_x >= lbnd_in[ 0 ] ) { \
+                     FORM_LINEAR_INTERPOLATION_SUM(off_lo + ystride, \
+                                                   frac_lo_x * frac_hi_y,Xtype, \
+                                                   Xfloattype,Xsigned, \
+                                                   Usebad,Usevar) \
+                  } \
+                  if ( hi_x <= ubnd_in[ 0 ] ) { \
+                     FORM_LINEAR_INTERPOLATION_SUM(off_lo + ystride + 1, \
+                                                   frac_hi_x * frac_hi_y,Xtype, \
+                                                   Xfloattype,Xsigned, \
+                                                   Usebad,Usevar) \
+                  } \
                } \
             } \
          } \
@@ -4453,7 +5316,7 @@ static int InterpolateLinear##X( int ndim_in, \
    input array. */ \
       if ( Usebad ) { \
          pixel += stride[ idim ] * \
-                  ( (int) floor( xn + 0.5 ) - lbnd_in[ idim ] ); \
+                  ( FLOOR_INT( xn + 0.5 ) - lbnd_in[ idim ] ); \
       } \
 \
 /* Obtain the indices along the current dimension of the input grid of \
@@ -4462,7 +5325,7 @@ static int InterpolateLinear##X( int ndim_in, \
    it does not lie outside the input grid. Also calculate the \
    fractional weight to be given to each pixel in order to interpolate \
    linearly between them. */ \
-      ixn = (int) floor( xn ); \
+      ixn = FLOOR_INT( xn ); \
       lo[ idim ] = MaxI( ixn, lbnd_in[ idim ], status ); \
       hi[ idim ] = MinI( ixn + 1, ubnd_in[ idim ], status ); \
       frac_lo[ idim ] = 1.0 - fabs( xn - (double) lo[ idim ] ); \
@@ -5160,7 +6023,7 @@ static int InterpolateNearest##X( int ndim_in, \
 \
 /* If not, then obtain the offset within the input grid of the pixel \
    which contains the current point. */ \
-      off_in = (int) floor( x + 0.5 ) - lbnd_in[ 0 ]; \
+      off_in = FLOOR_INT( x + 0.5 ) - lbnd_in[ 0 ]; \
 \
 /* If necessary, test if the input pixel is bad. */ \
       if ( Usebad ) bad = ( in[ off_in ] == badval ); \
@@ -5184,8 +6047,8 @@ static int InterpolateNearest##X( int ndim_in, \
 \
 /* Obtain the offsets along each input grid dimension of the input \
    pixel which contains the current point. */ \
-         ix = (int) floor( x + 0.5 ) - lbnd_in[ 0 ]; \
-         iy = (int) floor( y + 0.5 ) - lbnd_in[ 1 ]; \
+         ix = FLOOR_INT( x + 0.5 ) - lbnd_in[ 0 ]; \
+         iy = FLOOR_INT( y + 0.5 ) - lbnd_in[ 1 ]; \
 \
 /* Calculate this pixel's offset from the start of the input array. */ \
          off_in = ix + ystride * iy; \
@@ -5215,7 +6078,7 @@ static int InterpolateNearest##X( int ndim_in, \
 \
 /* Obtain the offset along the current input grid dimension of the \
    input pixel which contains the current point. */ \
-      ixn = (int) floor( xn + 0.5 ) - lbnd_in[ idim ]; \
+      ixn = FLOOR_INT( xn + 0.5 ) - lbnd_in[ idim ]; \
 \
 /* Accumulate this pixel's offset from the start of the input \
    array. */ \
@@ -7002,45 +7865,144 @@ static double LocalMaximum( const MapData *mapdata, double acc, double fract,
          if ( x[ coord ] > middle ) dx[ coord ] = -dx[ coord ];
       }
 
-/* Find an approximation to a local maximum using the simplex method
-   and check for errors. */
-      maximum = UphillSimplex( mapdata, acc, maxcall, dx, x, &err, &ncall, status );
-      if ( astOK ) {
+/* Find an approximation to a local maximum using the simplex method
+   and check for errors. */
+      maximum = UphillSimplex( mapdata, acc, maxcall, dx, x, &err, &ncall, status );
+      if ( astOK ) {
+
+/* Use this maximum value if no previous maximum has been found. */
+         if ( result == AST__BAD ) {
+            result = maximum;
+
+/* Otherwise use it only if it improves on the previous maximum. */
+         } else if ( maximum >= result ) {
+
+/* We iterate, re-starting the simplex algorithm from its previous
+   best position so as to guard against premature false
+   convergence. Iterations continue until the improvement in the
+   maximum is no greater than the required accuracy (and the simplex
+   algorithm itself has converged to the required accuracy). Note when
+   iterations should cease. */
+            done = ( ( ( maximum - result ) <= acc ) && ( err <= acc ) );
+
+/* Store the best maximum and quit iterating if appropriate. */
+            result = maximum;
+            if ( done ) break;
+         }
+
+/* Otherwise, decrement the initial step size for the next iteration. */
+         fract /= 1000.0;
+      }
+   }
+
+/* Free the workspace. */
+   dx = astFree( dx );
+
+/* If an error occurred, clear the result value. */
+   if ( !astOK ) result = AST__BAD;
+
+/* return the result. */
+   return result;
+}
+
+#if defined(THREAD_SAFE)
+static int ManageLock( AstObject *this_object, int mode, int extra,
+                       AstObject **fail, int *status ) {
+/*
+*  Name:
+*     ManageLock
+
+*  Purpose:
+*     Manage the thread lock on an Object.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "object.h"
+*     AstObject *ManageLock( AstObject *this, int mode, int extra,
+*                            AstObject **fail, int *status )
+
+*  Class Membership:
+*     Mapping member function (over-rides the astManageLock protected
+*     method inherited from the parent class).
+
+*  Description:
+*     This function manages the thread lock on the supplied Object. The
+*     lock can be locked, unlocked or checked by this function as
+*     deteremined by parameter "mode". See astLock for details of the way
+*     these locks are used.
+
+*  Parameters:
+*     this
+*        Pointer to the Object.
+*     mode
+*        An integer flag indicating what the function should do:
+*
+*        AST__LOCK: Lock the Object for exclusive use by the calling
+*        thread. The "extra" value indicates what should be done if the
+*        Object is already locked (wait or report an error - see astLock).
+*
+*        AST__UNLOCK: Unlock the Object for use by other threads.
+*
+*        AST__CHECKLOCK: Check that the object is locked for use by the
+*        calling thread (report an error if not).
+*     extra
+*        Extra mode-specific information.
+*     fail
+*        If a non-zero function value is returned, a pointer to the
+*        Object that caused the failure is returned at "*fail". This may
+*        be "this" or it may be an Object contained within "this". Note,
+*        the Object's reference count is not incremented, and so the
+*        returned pointer should not be annulled. A NULL pointer is
+*        returned if this function returns a value of zero.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*    A local status value:
+*        0 - Success
+*        1 - Could not lock or unlock the object because it was already
+*            locked by another thread.
+*        2 - Failed to lock a POSIX mutex
+*        3 - Failed to unlock a POSIX mutex
+*        4 - Bad "mode" value supplied.
 
-/* Use this maximum value if no previous maximum has been found. */
-         if ( result == AST__BAD ) {
-            result = maximum;
+*  Notes:
+*     - This function attempts to execute even if an error has already
+*     occurred.
+*/
 
-/* Otherwise use it only if it improves on the previous maximum. */
-         } else if ( maximum >= result ) {
+/* Local Variables: */
+   AstMapping *this;      /* Pointer to Mapping structure */
+   int i;                 /* Index of retained PointSet */
+   int result;            /* Returned status value */
 
-/* We iterate, re-starting the simplex algorithm from its previous
-   best position so as to guard against premature false
-   convergence. Iterations continue until the improvement in the
-   maximum is no greater than the required accuracy (and the simplex
-   algorithm itself has converged to the required accuracy). Note when
-   iterations should cease. */
-            done = ( ( ( maximum - result ) <= acc ) && ( err <= acc ) );
+/* Initialise */
+   result = 0;
 
-/* Store the best maximum and quit iterating if appropriate. */
-            result = maximum;
-            if ( done ) break;
-         }
+/* Check the supplied pointer is not NULL. */
+   if( !this_object ) return result;
 
-/* Otherwise, decrement the initial step size for the next iteration. */
-         fract /= 1000.0;
-      }
-   }
+/* Obtain a pointers to the Mapping structure. */
+   this = (AstMapping *) this_object;
 
-/* Free the workspace. */
-   dx = astFree( dx );
+/* Invoke the ManageLock method inherited from the parent class. */
+   if( !result ) result = (*parent_managelock)( this_object, mode, extra,
+                                                fail, status );
 
-/* If an error occurred, clear the result value. */
-   if ( !astOK ) result = AST__BAD;
+/* Invoke the astManageLock method on any PointSets retained by a
+   compiled Mapping. */
+   for( i = 0; i < 4 && !result; i++ ) {
+      if( this->tran_ps[ i ] ) {
+         result = astManageLock( this->tran_ps[ i ], mode, extra, fail );
+      }
+   }
 
-/* return the result. */
    return result;
+
 }
+#endif
 
 static void MapBox( AstMapping *this,
                     const double lbnd_in[], const double ubnd_in[],
@@ -8304,6 +9266,94 @@ static double NewVertex( const MapData *mapdata, int lo, double scale,
    return fnew;
 }
 
+#ifdef THREAD_SAFE
+static void *PoolWorker( void *arg ) {
+/*
+*  Name:
+*     PoolWorker
+
+*  Purpose:
+*     The main function for a worker thread in the pool.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     void *PoolWorker( void *arg )
+
+*  Class Membership:
+*     Mapping member function.
+
+*  Description:
+*     This function is executed by each worker thread created by
+*     RunTasks. It waits until a batch of tasks is available, and then
+*     repeatedly claims and performs the next unclaimed task in the
+*     batch until none are left. It then waits for the next batch. It
+*     never returns.
+
+*  Parameters:
+*     arg
+*        The zero-based index of the worker thread, cast to a pointer.
+*        Threads with an index greater than or equal to the number of
+*        threads requested for a batch do not take part in the batch.
+
+*  Returned Value:
+*     NULL.
+*/
+
+/* Local Variables: */
+   int *status;                  /* Pointer to thread's inherited status */
+   int batch;                    /* Identifier for most recent batch */
+   int ithread;                  /* Index of this worker thread */
+   int itask;                    /* Index of task to perform */
+   void (* task)( void *, int, int, int * ); /* Task function */
+   void *data;                   /* Data for task function */
+
+/* Get the index of this worker thread, and a pointer to its status
+   variable (this also creates the thread-specific AST data for the
+   thread). */
+   ithread = (int) (size_t) arg;
+   status = astGetStatusPtr;
+   batch = 0;
+
+/* Loop forever, claiming tasks. */
+   pthread_mutex_lock( &pool_mutex );
+   while ( 1 ) {
+
+/* If this thread is taking part in the current batch and there is an
+   unclaimed task, claim it. Clear the status at the start of each new
+   batch. */
+      if ( ithread < pool_nuse && pool_next < pool_ntask ) {
+         itask = pool_next++;
+         task = pool_task;
+         data = pool_data;
+         if ( batch != pool_batch ) {
+            batch = pool_batch;
+            astClearStatus;
+         }
+
+/* Perform the task without the pool mutex locked. Tasks are skipped if
+   an earlier task in the batch failed. */
+         pthread_mutex_unlock( &pool_mutex );
+         if ( astOK ) ( *task )( data, ithread, itask, status );
+         pthread_mutex_lock( &pool_mutex );
+
+/* Record any error, and signal the thread that started the batch if
+   this was the last task to complete. */
+         if ( !astOK ) pool_status[ ithread ] = astStatus;
+         if ( --pool_nbusy == 0 ) pthread_cond_signal( &pool_finish );
+
+/* Otherwise, wait for more tasks. */
+      } else {
+         pthread_cond_wait( &pool_start, &pool_mutex );
+      }
+   }
+
+   return NULL;
+}
+#endif
+
 static int QuadApprox( AstMapping *this,  const double lbnd[2],
                        const double ubnd[2], int nx, int ny, double *fit,
                        double *rms, int *status ){
@@ -9627,6 +10677,18 @@ f        used. A dummy (e.g. one-element) array may then be supplied.
 f     STATUS = INTEGER (Given and Returned)
 f        The global status.
 
+*  Notes:
+*     - If AST has been built with support for POSIX threads, the work
+*     of rebinning a large floating point input array may be shared
+*     between several threads. The maximum number of threads to use is
+c     set by the "MaxThreads" tuning parameter (see astTune), which
+f     set by the "MaxThreads" tuning parameter (see AST_TUNE), which
+*     defaults to one. Each extra thread pastes its input pixels into a
+*     private copy of the output arrays, which are added together once
+*     all threads have finished. The results may therefore differ from
+*     those obtained using a single thread by an amount comparable with
+*     the rounding error of the data type, and more memory is needed.
+
 *  Data Type Codes:
 *     To select the appropriate rebinning function, you should
 c     replace <X> in the generic function name astRebin<X> with a
@@ -9798,6 +10860,8 @@ static void Rebin##X( AstMapping *this, double wlim, int ndim_in, \
    int nout;                     /* Number of Mapping output coordinates */ \
    int npix;                     /* Number of pixels in input region */ \
    int npix_out;                 /* Number of pixels in output array */ \
+   int nthread;                  /* Number of threads to use */ \
+   int nofit;                    /* Flux conservation not possible? */ \
    int64_t mpix;                 /* Number of pixels for testing */ \
 \
 /* Check the global error status. */ \
@@ -10038,21 +11102,46 @@ static void Rebin##X( AstMapping *this, double wlim, int ndim_in, \
       } \
    } \
 \
+/* Decide how many threads to use. Multiple threads are only used if \
+   requested via the MaxThreads tuning parameter, if there are enough \
+   input pixels to make it worthwhile, and if the data are floating \
+   point (so that the partial sums formed by different threads can be \
+   combined without loss of precision). Reporting of transformed \
+   positions is also restricted to a single thread so that the reports \
+   appear in the usual order. */ \
+   nthread = 1; \
+   if ( astOK && !IntType && !astGetReport( simple ) ) { \
+      nthread = ThreadCount( npix, status ); \
+   } \
+\
 /* Perform the rebinning. Note that we pass all gridded data, the \
    spread function and the bad pixel value by means of pointer \
    types that obscure the underlying data type. This is to avoid \
    having to replicate functions unnecessarily for each data \
    type. However, we also pass an argument that identifies the data \
    type we have obscured. */ \
-   if( RebinAdaptively( simple, ndim_in, lbnd_in, ubnd_in, \
-                        (const void *) in, (const void *) in_var, \
-                        TYPE_##X, spread, \
-                        params, flags, tol, maxpix, \
-                        (const void *) &badval, \
-                        ndim_out, lbnd_out, ubnd_out, \
-                        lbnd, ubnd, npix_out, \
-                        (void *) out, (void *) out_var, work, \
-                        NULL, status ) && astOK ) { \
+   if ( nthread > 1 ) { \
+      nofit = RebinInThreads( simple, nthread, ndim_in, lbnd_in, ubnd_in, \
+                              (const void *) in, (const void *) in_var, \
+                              TYPE_##X, spread, \
+                              params, flags, tol, maxpix, \
+                              (const void *) &badval, \
+                              ndim_out, lbnd_out, ubnd_out, \
+                              lbnd, ubnd, npix_out, \
+                              (void *) out, (void *) out_var, work, \
+                              NULL, status ); \
+   } else { \
+      nofit = RebinAdaptively( simple, ndim_in, lbnd_in, ubnd_in, \
+                               (const void *) in, (const void *) in_var, \
+                               TYPE_##X, spread, \
+                               params, flags, tol, maxpix, \
+                               (const void *) &badval, \
+                               ndim_out, lbnd_out, ubnd_out, \
+                               lbnd, ubnd, npix_out, \
+                               (void *) out, (void *) out_var, work, \
+                               NULL, NULL, status ); \
+   } \
+   if( nofit && astOK ) { \
       astError( AST__CNFLX, "astRebin"#X"(%s): Flux conservation was " \
                 "requested but could not be performed because the " \
                 "forward transformation of the supplied Mapping " \
@@ -10111,7 +11200,8 @@ static int RebinAdaptively( AstMapping *this, int ndim_in,
                             const int *ubnd_out, const int *lbnd,
                             const int *ubnd, int npix_out,
                             void *out, void *out_var, double *work,
-                            int64_t *nused, int *status ){
+                            int64_t *nused, SectionList *sections,
+                            int *status ){
 /*
 *  Name:
 *     RebinAdaptively
@@ -10134,7 +11224,7 @@ static int RebinAdaptively( AstMapping *this, int ndim_in,
 *                          const int *ubnd_out, const int *lbnd,
 *                          const int *ubnd, int npix_out, void *out,
 *                          void *out_var, double *work, int64_t *nused,
-*                          int *status )
+*                          SectionList *sections, int *status )
 
 *  Class Membership:
 *     Mapping member function.
@@ -10156,6 +11246,11 @@ static int RebinAdaptively( AstMapping *this, int ndim_in,
 *     approximation to the Mapping may be used.  This reduces the number of
 *     Mapping evaluations, thereby improving efficiency particularly when
 *     complicated Mappings are involved.
+*
+*     If a SectionList is supplied, the sections are not rebinned.
+*     Instead, each section (together with any linear approximation) is
+*     appended to the list so that it can be rebinned later (see
+*     RebinInThreads).
 
 *  Parameters:
 *     this
@@ -10322,6 +11417,10 @@ static int RebinAdaptively( AstMapping *this, int ndim_in,
 *     nused
 *        An optional pointer to a int64_t which will be incremented by the
 *        number of input values pasted into the output array. Ignored if NULL.
+*     sections
+*        Pointer to a list to receive the sections into which the input
+*        region is divided, or NULL if the sections should be rebinned
+*        immediately.
 *     status
 *        Pointer to the inherited status variable.
 
@@ -10330,7 +11429,7 @@ static int RebinAdaptively( AstMapping *this, int ndim_in,
 *     flux conservation was requested), but the forward transformation of the
 *     supplied Mapping had zero determinant everywhere within the region
 *     being binned (no error is reported if this happens). Zero is returned
-*     otherwise.
+*     otherwise, or if "sections" is not NULL.
 
 */
 
@@ -10477,12 +11576,19 @@ static int RebinAdaptively( AstMapping *this, int ndim_in,
       if( linear_fit ) divide = 0;
    }
 
+/* If no sub-division is required and a list of sections has been
+   supplied, append the section to the list so that it can be rebinned
+   later. */
+   if ( astOK ) {
+      if ( !divide && sections ) {
+         AddSections( sections, ndim_in, lbnd, ubnd, ndim_out, linear_fit,
+                      status );
+
 /* If no sub-division is required, perform rebinning (in a
    memory-efficient manner, since the section we are rebinning might
    still be very large). This will use the linear fit, if obtained
    above. */
-   if ( astOK ) {
-      if ( !divide ) {
+      } else if ( !divide ) {
          result = RebinWithBlocking( this, linear_fit, ndim_in, lbnd_in,
                                      ubnd_in, in, in_var, type, spread,
                                      params, flags, badval_ptr, ndim_out,
@@ -10513,7 +11619,7 @@ static int RebinAdaptively( AstMapping *this, int ndim_in,
                                     in_var, type, spread, params,
                                     flags, tol, maxpix, badval_ptr, ndim_out,
                                     lbnd_out, ubnd_out, lo, hi, npix_out, out,
-                                    out_var, work, nused, status );
+                                    out_var, work, nused, sections, status );
 
 /* Now set up a second section which covers the remaining half of the
    original input section. */
@@ -10528,7 +11634,7 @@ static int RebinAdaptively( AstMapping *this, int ndim_in,
                                        flags, tol, maxpix, badval_ptr,
                                        ndim_out, lbnd_out, ubnd_out,
                                        lo, hi, npix_out, out, out_var, work,
-                                       nused, status );
+                                       nused, sections, status );
             } else {
                res2 = 0;
             }
@@ -10553,6 +11659,279 @@ static int RebinAdaptively( AstMapping *this, int ndim_in,
    return result;
 }
 
+static int RebinInThreads( AstMapping *this, int nthread, int ndim_in,
+                           const int *lbnd_in, const int *ubnd_in,
+                           const void *in, const void *in_var,
+                           DataType type, int spread,
+                           const double *params, int flags, double tol,
+                           int maxpix, const void *badval_ptr,
+                           int ndim_out, const int *lbnd_out,
+                           const int *ubnd_out, const int *lbnd,
+                           const int *ubnd, int npix_out,
+                           void *out, void *out_var, double *work,
+                           int64_t *nused, int *status ){
+/*
+*  Name:
+*     RebinInThreads
+
+*  Purpose:
+*     Rebin a section of a data grid using several threads.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     int RebinInThreads( AstMapping *this, int nthread, int ndim_in,
+*                         const int *lbnd_in, const int *ubnd_in,
+*                         const void *in, const void *in_var,
+*                         DataType type, int spread,
+*                         const double *params, int flags, double tol,
+*                         int maxpix, const void *badval_ptr,
+*                         int ndim_out, const int *lbnd_out,
+*                         const int *ubnd_out, const int *lbnd,
+*                         const int *ubnd, int npix_out, void *out,
+*                         void *out_var, double *work, int64_t *nused,
+*                         int *status )
+
+*  Class Membership:
+*     Mapping member function.
+
+*  Description:
+*     This function is equivalent to RebinAdaptively, except that the
+*     work is shared between a pool of worker threads.
+*
+*     RebinAdaptively is first used (in the calling thread) to divide
+*     the input region into the same sections, with the same linear
+*     approximations, that it would use if it were rebinning the data
+*     itself. Any large sections are further divided into slabs. Since
+*     neighbouring input pixels may contribute to the same output pixel,
+*     the resulting list of sections is divided into "nthread" chunks of
+*     contiguous sections, and each chunk is pasted by a worker thread
+*     into a private set of accumulation arrays (the first chunk uses
+*     the arrays supplied by the caller). When all chunks have been
+*     pasted, the private arrays are added into the arrays supplied by
+*     the caller, with each worker thread summing a different range of
+*     output pixels.
+*
+*     Since the values from each chunk are summed in a fixed order, the
+*     results do not depend on how the chunks are allocated to threads.
+*     However, they may differ from those produced by RebinAdaptively by
+*     an amount comparable with the rounding error of the data type.
+*
+*     Each worker thread uses its own independent copy of the supplied
+*     Mapping.
+
+*  Parameters:
+*     this
+*        Pointer to the Mapping to be used (see RebinAdaptively).
+*     nthread
+*        The maximum number of threads to use.
+*     ndim_in - nused
+*        See RebinAdaptively.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     A non-zero value is returned if "flags" included AST__CONSERVEFLUX (i.e.
+*     flux conservation was requested), but the forward transformation of the
+*     supplied Mapping had zero determinant everywhere within the region
+*     being binned (no error is reported if this happens). Zero is returned
+*     otherwise.
+
+*  Notes:
+*     - Only floating point data types are supported.
+*     - Each extra thread requires a private copy of the output arrays,
+*     and so the memory required increases with the number of threads.
+*     - If the pool of worker threads is already being used (for
+*     instance by another thread), the sections are rebinned by the
+*     calling thread instead.
+*/
+
+/* Local Variables: */
+   astDECLARE_GLOBALS            /* Thread-specific data */
+   RebinJob job;                 /* Description of the rebinning job */
+   SectionList sections;         /* Sections to be rebinned */
+   int ichunk;                   /* Loop counter for chunks */
+   int idim;                     /* Loop counter for dimensions */
+   int isection;                 /* Loop counter for sections */
+   int ithread;                  /* Loop counter for threads */
+   int npix;                     /* Number of pixels in input region */
+   int result;                   /* Returned value */
+
+/* Initialise. */
+   result = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Get a pointer to a structure holding thread-specific global data. */
+   astGET_GLOBALS(this);
+
+/* Count the pixels in the input region, and choose a maximum section
+   size that will give each thread several sections to process. */
+   npix = 1;
+   for ( idim = 0; idim < ndim_in; idim++ ) {
+      npix *= ubnd[ idim ] - lbnd[ idim ] + 1;
+   }
+   sections.mxpix = MaxI( npix/( 4*nthread ), MIN_THREAD_PIX/4, status );
+   sections.nsection = 0;
+   sections.linear_fit = NULL;
+   sections.lbnd = NULL;
+   sections.ubnd = NULL;
+
+/* Divide the input region up into sections, obtaining a linear fit for
+   each one if possible. */
+   (void) RebinAdaptively( this, ndim_in, lbnd_in, ubnd_in, in, in_var,
+                           type, spread, params, flags, tol, maxpix,
+                           badval_ptr, ndim_out, lbnd_out, ubnd_out, lbnd,
+                           ubnd, npix_out, out, out_var, work, nused,
+                           &sections, status );
+
+/* There is no point in using more threads than there are sections. Each
+   thread processes one chunk of sections. */
+   if ( nthread > sections.nsection ) nthread = sections.nsection;
+
+/* Store the details of the job in a structure that can be passed to each
+   worker thread. */
+   job.map = astMalloc( sizeof( AstMapping * )*(size_t) nthread );
+   job.out = astMalloc( sizeof( void * )*(size_t) nthread );
+   job.out_var = astMalloc( sizeof( void * )*(size_t) nthread );
+   job.work = astMalloc( sizeof( double * )*(size_t) nthread );
+   job.nused = nused ? astCalloc( nthread, sizeof( int64_t ) ) : NULL;
+   job.result = astMalloc( sizeof( int )*(size_t) sections.nsection );
+   job.unsimplified = unsimplified_mapping;
+   job.type = type;
+   job.sections = &sections;
+   job.params = params;
+   job.lbnd_in = lbnd_in;
+   job.lbnd_out = lbnd_out;
+   job.ubnd_in = ubnd_in;
+   job.ubnd_out = ubnd_out;
+   job.badval_ptr = badval_ptr;
+   job.in = in;
+   job.in_var = in_var;
+   job.flags = flags;
+   job.nchunk = nthread;
+   job.ndim_in = ndim_in;
+   job.ndim_out = ndim_out;
+   job.npix_out = npix_out;
+   job.nwork = ( flags & AST__GENVAR ) ? 2 : 1;
+   job.spread = spread;
+   switch ( type ) {
+#if HAVE_LONG_DOUBLE     /* Not normally implemented */
+      case ( TYPE_LD ): job.size = sizeof( long double ); break;
+#endif
+      case ( TYPE_F ): job.size = sizeof( float ); break;
+      default: job.size = sizeof( double );
+   }
+
+/* The first chunk is pasted directly into the arrays supplied by the
+   caller. Allocate private accumulation arrays for the other chunks.
+   These are initialised by the worker thread that uses them. */
+   if ( job.out && job.out_var && job.work ) {
+      for ( ichunk = 0; ichunk < nthread; ichunk++ ) {
+         if ( ichunk == 0 ) {
+            job.out[ ichunk ] = out;
+            job.out_var[ ichunk ] = out_var;
+            job.work[ ichunk ] = work;
+         } else {
+            job.out[ ichunk ] = astMalloc( job.size*(size_t) npix_out );
+            job.out_var[ ichunk ] = out_var ?
+                            astMalloc( job.size*(size_t) npix_out ) : NULL;
+            job.work[ ichunk ] = work ? astMalloc( sizeof( double )*
+                           (size_t) ( job.nwork*npix_out ) ) : NULL;
+         }
+      }
+   }
+
+/* Create an independent copy of the Mapping for each thread, unlocking
+   each copy so that the worker thread that uses it can lock it. */
+   if ( astOK ) {
+      for ( ithread = 0; ithread < nthread; ithread++ ) {
+         job.map[ ithread ] = astCopy( this );
+         astManageLock( job.map[ ithread ], AST__UNLOCK, 1, NULL );
+      }
+
+/* Paste the chunks using the pool of worker threads, and then add the
+   private accumulation arrays into the arrays supplied by the caller.
+   If the pool has become unavailable by the time the summation is
+   performed, do it in this thread instead. */
+      if ( RunTasks( nthread, nthread, RebinTask, &job, status ) ) {
+         if ( nthread > 1 && astOK &&
+              !RunTasks( nthread, nthread, RebinSumTask, &job, status ) ) {
+            for ( ichunk = 0; ichunk < nthread; ichunk++ ) {
+               RebinSumTask( &job, 0, ichunk, status );
+            }
+         }
+         if ( nused && astOK ) {
+            for ( ichunk = 0; ichunk < nthread; ichunk++ ) {
+               *nused += job.nused[ ichunk ];
+            }
+         }
+
+/* If the pool is not available, paste the sections in this thread
+   directly into the arrays supplied by the caller. */
+      } else {
+         for ( isection = 0; isection < sections.nsection && astOK;
+               isection++ ) {
+            job.result[ isection ] = RebinWithBlocking( this,
+                                          sections.linear_fit[ isection ],
+                                          ndim_in, lbnd_in, ubnd_in, in,
+                                          in_var, type, spread, params,
+                                          flags, badval_ptr, ndim_out,
+                                          lbnd_out, ubnd_out,
+                                          sections.lbnd[ isection ],
+                                          sections.ubnd[ isection ],
+                                          npix_out, out, out_var, work,
+                                          nused, status );
+         }
+      }
+
+/* Return a non-zero result if none of the sections could be rebinned
+   because of an indeterminate Mapping. */
+      if ( astOK ) {
+         result = ( sections.nsection > 0 );
+         for ( isection = 0; isection < sections.nsection; isection++ ) {
+            if ( !job.result[ isection ] ) result = 0;
+         }
+      }
+
+/* Lock the Mapping copies for use by this thread again, and then
+   annul them. */
+      for ( ithread = 0; ithread < nthread; ithread++ ) {
+         astManageLock( job.map[ ithread ], AST__LOCK, 1, NULL );
+         job.map[ ithread ] = astAnnul( job.map[ ithread ] );
+      }
+   }
+
+/* Free resources. */
+   if ( job.out && job.out_var && job.work ) {
+      for ( ichunk = 1; ichunk < nthread; ichunk++ ) {
+         job.out[ ichunk ] = astFree( job.out[ ichunk ] );
+         job.out_var[ ichunk ] = astFree( job.out_var[ ichunk ] );
+         job.work[ ichunk ] = astFree( job.work[ ichunk ] );
+      }
+   }
+   for ( isection = 0; isection < sections.nsection; isection++ ) {
+      sections.linear_fit[ isection ] = astFree( sections.linear_fit[ isection ] );
+      sections.lbnd[ isection ] = astFree( sections.lbnd[ isection ] );
+      sections.ubnd[ isection ] = astFree( sections.ubnd[ isection ] );
+   }
+   sections.linear_fit = astFree( sections.linear_fit );
+   sections.lbnd = astFree( sections.lbnd );
+   sections.ubnd = astFree( sections.ubnd );
+   job.map = astFree( job.map );
+   job.out = astFree( job.out );
+   job.out_var = astFree( job.out_var );
+   job.work = astFree( job.work );
+   job.nused = astFree( job.nused );
+   job.result = astFree( job.result );
+
+/* Return the result. */
+   return result;
+}
+
 static void RebinSection( AstMapping *this, const double *linear_fit,
                           int ndim_in, const int *lbnd_in, const int *ubnd_in,
                           const void *in, const void *in_var, double infac,
@@ -10780,6 +12159,7 @@ static void RebinSection( AstMapping *this, const double *linear_fit,
    int off;                      /* Final pixel offset into output array */
    int point;                    /* Counter for output points (pixels ) */
    int s;                        /* Temporary variable for strides */
+   const double *ktab;           /* Pointer to table of kernel values */
    const double *par;            /* Pointer to parameter array */
    double fwhm;                  /* Full width half max. of gaussian */
    double lpar[ 1 ];             /* Local parameter array */
@@ -11386,6 +12766,14 @@ static void RebinSection( AstMapping *this, const double *linear_fit,
                   break;
             }
 
+/* If required, replace the internal kernel function with one that uses
+   linear interpolation within a cached table of kernel values. */
+            ktab = kernel ? GetKernelTable( kernel, par, neighb, status ) : NULL;
+            if ( ktab ) {
+               kernel = TabKernel;
+               par = ktab;
+            }
+
 /* Define a macro to use a "case" statement to invoke the 1-d kernel
    interpolation function appropriate to a given data type, passing it
    the pointer to the kernel function obtained above. */
@@ -11421,6 +12809,9 @@ static void RebinSection( AstMapping *this, const double *linear_fit,
                case ( TYPE_UK ): break;
                case ( TYPE_US ): break;
             }
+
+/* Release any table of kernel values. */
+            ReleaseKernelTable( ktab, status );
             break;
 
 /* Undefine the macro. */
@@ -11889,6 +13280,18 @@ f        FLAGS.
 f     STATUS = INTEGER (Given and Returned)
 f        The global status.
 
+*  Notes:
+*     - If AST has been built with support for POSIX threads, the work
+*     of rebinning a large floating point input array may be shared
+*     between several threads. The maximum number of threads to use is
+c     set by the "MaxThreads" tuning parameter (see astTune), which
+f     set by the "MaxThreads" tuning parameter (see AST_TUNE), which
+*     defaults to one. Each extra thread pastes its input pixels into a
+*     private copy of the output arrays, which are added together once
+*     all threads have finished. The results may therefore differ from
+*     those obtained using a single thread by an amount comparable with
+*     the rounding error of the data type, and more memory is needed.
+
 *  Data Type Codes:
 *     To select the appropriate rebinning function, you should
 c     replace <X> in the generic function name astRebinSeq<X> with a
@@ -12111,6 +13514,8 @@ static void RebinSeq##X( AstMapping *this, double wlim, int ndim_in, \
    int nout;                     /* Number of Mapping output coordinates */ \
    int npix;                     /* Number of pixels in input region */ \
    int npix_out;                 /* Number of pixels in output array */ \
+   int nthread;                  /* Number of threads to use */ \
+   int nofit;                    /* Flux conservation not possible? */ \
    int64_t mpix;                 /* Number of pixels for testing */ \
 \
 /* Check the global error status. */ \
@@ -12408,14 +13813,34 @@ static void RebinSeq##X( AstMapping *this, double wlim, int ndim_in, \
          if( nused ) *nused = 0; \
       } \
 \
+/* Decide how many threads to use, using the same criteria as \
+   astRebin<X>. */ \
+      nthread = 1; \
+      if ( astOK && !IntType && !astGetReport( simple ) ) { \
+         nthread = ThreadCount( npix, status ); \
+      } \
+\
 /* Paste the input values into the supplied output arrays. */ \
-      if( RebinAdaptively( simple, ndim_in, lbnd_in, ubnd_in, \
-                          (const void *) in, (const void *) in_var, \
-                          TYPE_##X, spread, params, flags, \
-                          tol, maxpix, (const void *) &badval, \
-                          ndim_out, lbnd_out, ubnd_out, lbnd, \
-                          ubnd, npix_out, (void *) out, \
-                          (void *) out_var, weights, nused, status ) ) { \
+      if ( nthread > 1 ) { \
+         nofit = RebinInThreads( simple, nthread, ndim_in, lbnd_in, \
+                                 ubnd_in, (const void *) in, \
+                                 (const void *) in_var, TYPE_##X, spread, \
+                                 params, flags, tol, maxpix, \
+                                 (const void *) &badval, ndim_out, \
+                                 lbnd_out, ubnd_out, lbnd, ubnd, npix_out, \
+                                 (void *) out, (void *) out_var, weights, \
+                                 nused, status ); \
+      } else { \
+         nofit = RebinAdaptively( simple, ndim_in, lbnd_in, ubnd_in, \
+                                  (const void *) in, (const void *) in_var, \
+                                  TYPE_##X, spread, params, flags, \
+                                  tol, maxpix, (const void *) &badval, \
+                                  ndim_out, lbnd_out, ubnd_out, lbnd, \
+                                  ubnd, npix_out, (void *) out, \
+                                  (void *) out_var, weights, nused, NULL, \
+                                  status ); \
+      } \
+      if( nofit ) { \
          astError( AST__CNFLX, "astRebinSeq"#X"(%s): Flux conservation was " \
                    "requested but could not be performed because the " \
                    "forward transformation of the supplied Mapping " \
@@ -12527,8 +13952,225 @@ MAKE_REBINSEQ(I,int,1)
 MAKE_REBINSEQ(B,signed char,1)
 MAKE_REBINSEQ(UB,unsigned char,1)
 
-/* Undefine the macro. */
-#undef MAKE_REBINSEQ
+/* Undefine the macro. */
+#undef MAKE_REBINSEQ
+
+static void RebinSumTask( void *data, int ithread, int itask, int *status ) {
+/*
+*  Name:
+*     RebinSumTask
+
+*  Purpose:
+*     Sum the private accumulation arrays used by a rebinning job.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     void RebinSumTask( void *data, int ithread, int itask, int *status )
+
+*  Class Membership:
+*     Mapping member function.
+
+*  Description:
+*     This function is invoked by a worker thread (see RunTasks) once all
+*     the chunks of a rebinning job have been pasted (see RebinTask). It
+*     adds the values in the private accumulation arrays used by the
+*     second and subsequent chunks into the arrays supplied by the
+*     caller (which were used by the first chunk). The output pixels are
+*     divided into "nchunk" contiguous ranges, and this function sums a
+*     single range. Values are always added in order of increasing chunk
+*     index.
+
+*  Parameters:
+*     data
+*        Pointer to the RebinJob structure describing the job.
+*     ithread
+*        The zero-based index of the worker thread (not used).
+*     itask
+*        The zero-based index of the range of output pixels to sum.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   RebinJob *job;                /* Description of the rebinning job */
+   double *w;                    /* Pointer to caller's weights array */
+   int hi;                       /* Index of last pixel to sum, plus one */
+   int i;                        /* Loop counter for pixels */
+   int ichunk;                   /* Loop counter for chunks */
+   int iw;                       /* Loop counter for weights planes */
+   int lo;                       /* Index of first pixel to sum */
+   int off;                      /* Offset to start of weights plane */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Get the job description and the range of pixels to be summed. */
+   job = (RebinJob *) data;
+   lo = (int) ( ( (int64_t) itask*job->npix_out )/job->nchunk );
+   hi = (int) ( ( (int64_t) ( itask + 1 )*job->npix_out )/job->nchunk );
+
+/* Sum the weights (including the squared weights if AST__GENVAR is being
+   used). */
+   w = job->work[ 0 ];
+   if ( w ) {
+      for ( ichunk = 1; ichunk < job->nchunk; ichunk++ ) {
+         for ( iw = 0; iw < job->nwork; iw++ ) {
+            off = iw*job->npix_out;
+            for ( i = lo + off; i < hi + off; i++ ) {
+               w[ i ] += job->work[ ichunk ][ i ];
+            }
+         }
+      }
+   }
+
+/* Define a macro to use a "case" statement to sum the data and variance
+   arrays for a given data type. */
+#define CASE_SUM(X,Xtype) \
+      case ( TYPE_##X ): \
+         for ( ichunk = 1; ichunk < job->nchunk; ichunk++ ) { \
+            for ( i = lo; i < hi; i++ ) { \
+               ( (Xtype *) job->out[ 0 ] )[ i ] += \
+                                     ( (Xtype *) job->out[ ichunk ] )[ i ]; \
+            } \
+            if ( job->out_var[ 0 ] ) { \
+               for ( i = lo; i < hi; i++ ) { \
+                  ( (Xtype *) job->out_var[ 0 ] )[ i ] += \
+                                 ( (Xtype *) job->out_var[ ichunk ] )[ i ]; \
+               } \
+            } \
+         } \
+         break;
+
+/* Use the above macro to sum the arrays. Only floating point types are
+   rebinned using multiple threads. */
+   switch ( job->type ) {
+#if HAVE_LONG_DOUBLE     /* Not normally implemented */
+      CASE_SUM(LD,long double)
+#endif
+      CASE_SUM(D,double)
+      CASE_SUM(F,float)
+
+      case ( TYPE_L ): break;
+      case ( TYPE_K ): break;
+      case ( TYPE_I ): break;
+      case ( TYPE_S ): break;
+      case ( TYPE_B ): break;
+      case ( TYPE_UL ): break;
+      case ( TYPE_UK ): break;
+      case ( TYPE_UI ): break;
+      case ( TYPE_US ): break;
+      case ( TYPE_UB ): break;
+   }
+
+/* Undefine the macro. */
+#undef CASE_SUM
+}
+
+static void RebinTask( void *data, int ithread, int itask, int *status ) {
+/*
+*  Name:
+*     RebinTask
+
+*  Purpose:
+*     Paste one chunk of input sections within a worker thread.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     void RebinTask( void *data, int ithread, int itask, int *status )
+
+*  Class Membership:
+*     Mapping member function.
+
+*  Description:
+*     This function is invoked by a worker thread (see RunTasks) to paste
+*     a single chunk of the input sections described by a RebinJob
+*     structure into the accumulation arrays used by the chunk. Private
+*     accumulation arrays (i.e. those used by all chunks except the
+*     first) are first initialised to zero. A flag indicating whether
+*     flux conservation failed is stored for each section in the "result"
+*     array within the RebinJob structure.
+
+*  Parameters:
+*     data
+*        Pointer to the RebinJob structure describing the job.
+*     ithread
+*        The zero-based index of the worker thread. This selects the
+*        copy of the Mapping to be used.
+*     itask
+*        The zero-based index of the chunk to be pasted.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   astDECLARE_GLOBALS            /* Thread-specific data */
+   AstMapping *map;              /* Mapping to be used by this thread */
+   RebinJob *job;                /* Description of the rebinning job */
+   SectionList *sections;        /* The sections to be rebinned */
+   int hi;                       /* Index of last section, plus one */
+   int isection;                 /* Loop counter for sections */
+   int lo;                       /* Index of first section */
+   size_t npix;                  /* Number of output pixels */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Get the job description and the Mapping to be used by this thread. */
+   job = (RebinJob *) data;
+   sections = job->sections;
+   map = job->map[ ithread ];
+   npix = (size_t) job->npix_out;
+
+/* Lock the Mapping for use by this thread. */
+   astManageLock( map, AST__LOCK, 1, NULL );
+
+/* Get a pointer to a structure holding thread-specific global data
+   values, and record the Mapping supplied by the caller so that it can
+   be used in any error messages. */
+   astGET_GLOBALS(map);
+   unsimplified_mapping = job->unsimplified;
+
+/* Initialise any private accumulation arrays to zero. */
+   if ( itask > 0 ) {
+      memset( job->out[ itask ], 0, job->size*npix );
+      if ( job->out_var[ itask ] ) {
+         memset( job->out_var[ itask ], 0, job->size*npix );
+      }
+      if ( job->work[ itask ] ) {
+         memset( job->work[ itask ], 0, sizeof( double )*job->nwork*npix );
+      }
+   }
+
+/* Paste each section in the chunk. */
+   lo = ( itask*sections->nsection )/job->nchunk;
+   hi = ( ( itask + 1 )*sections->nsection )/job->nchunk;
+   for ( isection = lo; isection < hi && astOK; isection++ ) {
+      job->result[ isection ] = RebinWithBlocking( map,
+                                       sections->linear_fit[ isection ],
+                                       job->ndim_in, job->lbnd_in,
+                                       job->ubnd_in, job->in, job->in_var,
+                                       job->type, job->spread, job->params,
+                                       job->flags, job->badval_ptr,
+                                       job->ndim_out, job->lbnd_out,
+                                       job->ubnd_out,
+                                       sections->lbnd[ isection ],
+                                       sections->ubnd[ isection ],
+                                       job->npix_out, job->out[ itask ],
+                                       job->out_var[ itask ],
+                                       job->work[ itask ],
+                                       job->nused ? job->nused + itask : NULL,
+                                       status );
+   }
+
+/* Unlock the Mapping so that it can be used by other threads. */
+   astManageLock( map, AST__UNLOCK, 1, NULL );
+}
 
 static int RebinWithBlocking( AstMapping *this, const double *linear_fit,
                                int ndim_in, const int *lbnd_in,
@@ -12902,6 +14544,128 @@ static int RebinWithBlocking( AstMapping *this, const double *linear_fit,
    return result;
 }
 
+static void ReleaseKernelTable( const double *table, int *status ) {
+/*
+*  Name:
+*     ReleaseKernelTable
+
+*  Purpose:
+*     Release a table of kernel values obtained using GetKernelTable.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     void ReleaseKernelTable( const double *table, int *status )
+
+*  Class Membership:
+*     Mapping member function.
+
+*  Description:
+*     This function indicates that a table of kernel values returned by
+*     GetKernelTable is no longer needed by the caller. The table is
+*     retained in the cache for re-use by later calls to GetKernelTable.
+
+*  Parameters:
+*     table
+*        Pointer to the table. No action is taken if this is NULL.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Notes:
+*     - This function attempts to execute even if the global error
+*     status is set.
+*/
+
+/* Local Variables: */
+   int ientry;                   /* Index of cache entry */
+
+/* Check a table was supplied. */
+   if ( !table ) return;
+
+/* Find the cache entry holding the table and decrement the number of
+   users. */
+#ifdef THREAD_SAFE
+   pthread_mutex_lock( &kernel_mutex );
+#endif
+   for ( ientry = 0; ientry < KERNEL_TABLE_CACHE; ientry++ ) {
+      if ( kernel_cache[ ientry ].table == table ) {
+         kernel_cache[ ientry ].nuse--;
+         break;
+      }
+   }
+#ifdef THREAD_SAFE
+   pthread_mutex_unlock( &kernel_mutex );
+#endif
+}
+
+static AstPointSet *ReleaseTranPoints( AstMapping *this, int slot,
+                                       AstPointSet *ps, int *status ) {
+/*
+*  Name:
+*     ReleaseTranPoints
+
+*  Purpose:
+*     Release a PointSet obtained using GetTranPoints.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     AstPointSet *ReleaseTranPoints( AstMapping *this, int slot,
+*                                     AstPointSet *ps, int *status )
+
+*  Class Membership:
+*     Mapping member function.
+
+*  Description:
+*     This function indicates that a PointSet returned by GetTranPoints
+*     is no longer needed. If the Mapping has been compiled (see
+*     astCompile), the PointSet is retained within the Mapping for
+*     re-use by later calls to GetTranPoints. Otherwise it is deleted.
+
+*  Parameters:
+*     this
+*        Pointer to the Mapping.
+*     slot
+*        The index (0 to 3) of the PointSet within the Mapping's list of
+*        retained PointSets. This should be the value supplied to
+*        GetTranPoints.
+*     ps
+*        Pointer to the PointSet. No action is taken if this is NULL.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     A NULL pointer.
+
+*  Notes:
+*     - This function attempts to execute even if the global error
+*     status is set.
+*/
+
+/* Check a PointSet was supplied. */
+   if ( !ps ) return NULL;
+
+/* If the Mapping has been compiled, store the PointSet in the Mapping,
+   deleting any PointSet that was stored by a nested call. */
+   if ( ( this->flags & AST__COMPILED_FLAG ) && astOK ) {
+      if ( this->tran_ps[ slot ] ) {
+         this->tran_ps[ slot ] = astDelete( this->tran_ps[ slot ] );
+      }
+      this->tran_ps[ slot ] = ps;
+
+/* Otherwise, delete the PointSet. */
+   } else {
+      ps = astDelete( ps );
+   }
+
+/* Return a NULL pointer. */
+   return NULL;
+}
+
 static AstMapping *RemoveRegions( AstMapping *this, int *status ) {
 /*
 *++
@@ -13527,6 +15291,14 @@ c        "badval" and "flags" parameters.
 f        BADVAL and FLAGS arguments.
 
 *  Notes:
+*     - If AST has been built with support for POSIX threads, the work
+*     of resampling a large output grid may be shared between several
+*     threads. The maximum number of threads to use is set by the
+c     "MaxThreads" tuning parameter (see astTune), which defaults to one.
+f     "MaxThreads" tuning parameter (see AST_TUNE), which defaults to one.
+*     The results are identical regardless of the number of threads used.
+*     A single thread is always used if a user-supplied interpolation
+*     scheme is selected, or if the Mapping's Report attribute is set.
 *     - A value of zero will be returned if this function is invoked
 *     with the global error status set, or if it should fail for any
 *     reason.
@@ -13987,11 +15759,13 @@ static int Resample##X( AstMapping *this, int ndim_in, \
    int nin;                      /* Number of Mapping input coordinates */ \
    int nout;                     /* Number of Mapping output coordinates */ \
    int npix;                     /* Number of pixels in output region */ \
+   int nthread;                  /* Number of threads to use */ \
    int result;                   /* Result value to return */ \
    int64_t mpix;                 /* Number of pixels for testing */ \
 \
 /* Initialise. */ \
    result = 0; \
+   npix = 0; \
 \
 /* Check the global error status. */ \
    if ( !astOK ) return result; \
@@ -14189,20 +15963,42 @@ static int Resample##X( AstMapping *this, int ndim_in, \
                 astGetClass( unsimplified_mapping ) ); \
    } \
 \
+/* Decide how many threads to use. Multiple threads are only used if \
+   requested via the MaxThreads tuning parameter, if there are enough \
+   output pixels to make it worthwhile, and if no user-supplied \
+   interpolation function (which may not be thread-safe) is involved. \
+   Reporting of transformed positions is also restricted to a single \
+   thread so that the reports appear in the usual order. */ \
+   nthread = 1; \
+   if ( astOK && interp != AST__UKERN1 && interp != AST__UINTERP && \
+        !astGetReport( simple ) ) nthread = ThreadCount( npix, status ); \
+\
 /* Perform the resampling. Note that we pass all gridded data, the \
    interpolation function and the bad pixel value by means of pointer \
    types that obscure the underlying data type. This is to avoid \
    having to replicate functions unnecessarily for each data \
    type. However, we also pass an argument that identifies the data \
    type we have obscured. */ \
-   result = ResampleAdaptively( simple, ndim_in, lbnd_in, ubnd_in, \
-                                (const void *) in, (const void *) in_var, \
-                                TYPE_##X, interp, finterp, \
-                                params, flags, tol, maxpix, \
-                                (const void *) &badval, \
-                                ndim_out, lbnd_out, ubnd_out, \
-                                lbnd, ubnd, \
-                                (void *) out, (void *) out_var, status ); \
+   if ( nthread > 1 ) { \
+      result = ResampleInThreads( simple, nthread, ndim_in, lbnd_in, \
+                                  ubnd_in, (const void *) in, \
+                                  (const void *) in_var, TYPE_##X, \
+                                  interp, finterp, params, flags, tol, \
+                                  maxpix, (const void *) &badval, \
+                                  ndim_out, lbnd_out, ubnd_out, \
+                                  lbnd, ubnd, (void *) out, \
+                                  (void *) out_var, status ); \
+   } else { \
+      result = ResampleAdaptively( simple, ndim_in, lbnd_in, ubnd_in, \
+                                   (const void *) in, (const void *) in_var, \
+                                   TYPE_##X, interp, finterp, \
+                                   params, flags, tol, maxpix, \
+                                   (const void *) &badval, \
+                                   ndim_out, lbnd_out, ubnd_out, \
+                                   lbnd, ubnd, \
+                                   (void *) out, (void *) out_var, NULL, \
+                                   status ); \
+   } \
 \
 /* Annul the pointer to the simplified/cloned Mapping. */ \
    simple = astAnnul( simple ); \
@@ -14243,7 +16039,8 @@ static int ResampleAdaptively( AstMapping *this, int ndim_in,
                                int maxpix, const void *badval_ptr,
                                int ndim_out, const int *lbnd_out,
                                const int *ubnd_out, const int *lbnd,
-                               const int *ubnd, void *out, void *out_var, int *status ) {
+                               const int *ubnd, void *out, void *out_var,
+                               SectionList *sections, int *status ) {
 /*
 *  Name:
 *     ResampleAdaptively
@@ -14264,7 +16061,8 @@ static int ResampleAdaptively( AstMapping *this, int ndim_in,
 *                             int maxpix, const void *badval_ptr,
 *                             int ndim_out, const int *lbnd_out,
 *                             const int *ubnd_out, const int *lbnd,
-*                             const int *ubnd, void *out, void *out_var )
+*                             const int *ubnd, void *out, void *out_var,
+*                             SectionList *sections, int *status )
 
 *  Class Membership:
 *     Mapping member function.
@@ -14287,6 +16085,11 @@ static int ResampleAdaptively( AstMapping *this, int ndim_in,
 *     Mapping may be used.  This reduces the number of Mapping
 *     evaluations, thereby improving efficiency particularly when
 *     complicated Mappings are involved.
+*
+*     If a SectionList is supplied, the sections are not resampled.
+*     Instead, each final section (together with any linear fit
+*     obtained for it) is appended to the list so that the sections can
+*     be resampled later, possibly by several threads in parallel.
 
 *  Parameters:
 *     this
@@ -14453,10 +16256,16 @@ static int ResampleAdaptively( AstMapping *this, int ndim_in,
 *
 *        If no output variance estimates are required, a NULL pointer
 *        should be given.
+*     sections
+*        Pointer to a list to receive the sections into which the output
+*        grid is divided, or NULL if the sections should be resampled
+*        immediately.
+*     status
+*        Pointer to the inherited status variable.
 
 *  Returned Value:
 *     The number of output grid points for which no valid output value
-*     could be obtained.
+*     could be obtained. Zero is returned if "sections" is not NULL.
 
 *  Notes:
 *     - A value of zero will be returned if this function is invoked
@@ -14598,12 +16407,19 @@ static int ResampleAdaptively( AstMapping *this, int ndim_in,
       divide = !linear_fit;
    }
 
+/* If no sub-division is required and a list of sections has been
+   supplied, append the section to the list so that it can be resampled
+   later. */
+   if ( astOK ) {
+      if ( !divide && sections ) {
+         AddSections( sections, ndim_out, lbnd, ubnd, ndim_in, linear_fit,
+                      status );
+
 /* If no sub-division is required, perform resampling (in a
    memory-efficient manner, since the section we are resampling might
    still be very large). This will use the linear fit, if obtained
    above. */
-   if ( astOK ) {
-      if ( !divide ) {
+      } else if ( !divide ) {
          result = ResampleWithBlocking( this, linear_fit,
                                         ndim_in, lbnd_in, ubnd_in,
                                         in, in_var, type, interp, finterp,
@@ -14637,7 +16453,8 @@ static int ResampleAdaptively( AstMapping *this, int ndim_in,
                                          params, flags, tol, maxpix,
                                          badval_ptr, ndim_out,
                                          lbnd_out, ubnd_out,
-                                         lo, hi, out, out_var, status );
+                                         lo, hi, out, out_var, sections,
+                                         status );
 
 /* Now set up a second section which covers the remaining half of the
    original output section. */
@@ -14652,7 +16469,8 @@ static int ResampleAdaptively( AstMapping *this, int ndim_in,
                                              params, flags, tol, maxpix,
                                              badval_ptr,  ndim_out,
                                              lbnd_out, ubnd_out,
-                                             lo, hi, out, out_var, status );
+                                             lo, hi, out, out_var, sections,
+                                             status );
             }
          }
 
@@ -14673,6 +16491,209 @@ static int ResampleAdaptively( AstMapping *this, int ndim_in,
    return result;
 }
 
+static int ResampleInThreads( AstMapping *this, int nthread, int ndim_in,
+                              const int *lbnd_in, const int *ubnd_in,
+                              const void *in, const void *in_var,
+                              DataType type, int interp, void (* finterp)( void ),
+                              const double *params, int flags, double tol,
+                              int maxpix, const void *badval_ptr,
+                              int ndim_out, const int *lbnd_out,
+                              const int *ubnd_out, const int *lbnd,
+                              const int *ubnd, void *out, void *out_var,
+                              int *status ) {
+/*
+*  Name:
+*     ResampleInThreads
+
+*  Purpose:
+*     Resample a section of a data grid using several threads.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     int ResampleInThreads( AstMapping *this, int nthread, int ndim_in,
+*                            const int *lbnd_in, const int *ubnd_in,
+*                            const void *in, const void *in_var,
+*                            DataType type, int interp, void (* finterp)( void ),
+*                            const double *params, int flags, double tol,
+*                            int maxpix, const void *badval_ptr,
+*                            int ndim_out, const int *lbnd_out,
+*                            const int *ubnd_out, const int *lbnd,
+*                            const int *ubnd, void *out, void *out_var,
+*                            int *status )
+
+*  Class Membership:
+*     Mapping member function.
+
+*  Description:
+*     This function is equivalent to ResampleAdaptively, except that the
+*     work is shared between a pool of worker threads.
+*
+*     ResampleAdaptively is first used (in the calling thread) to divide
+*     the output section into the same sections, with the same linear
+*     approximations, that it would use if it were resampling the data
+*     itself. Any large sections are further divided into slabs so that
+*     each thread receives several sections, thus balancing the load
+*     between threads. Each section is then resampled by one of the
+*     worker threads using ResampleWithBlocking. Since every section
+*     writes to a different part of the output arrays and the pixel
+*     values within a section do not depend on how the sections are
+*     divided up, the results are identical to those produced by
+*     ResampleAdaptively.
+*
+*     Each worker thread uses its own independent copy of the supplied
+*     Mapping.
+
+*  Parameters:
+*     this
+*        Pointer to the Mapping to be used (see ResampleAdaptively).
+*     nthread
+*        The maximum number of threads to use.
+*     ndim_in - out_var
+*        See ResampleAdaptively.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     The number of output grid points for which no valid output value
+*     could be obtained.
+
+*  Notes:
+*     - If the pool of worker threads is already being used (for
+*     instance by another thread), the sections are resampled by the
+*     calling thread instead.
+*     - A value of zero will be returned if this function is invoked
+*     with the global error status set, or if it should fail for any
+*     reason.
+*/
+
+/* Local Variables: */
+   astDECLARE_GLOBALS            /* Thread-specific data */
+   ResampleJob job;              /* Description of the resampling job */
+   SectionList sections;         /* Sections to be resampled */
+   int idim;                     /* Loop counter for dimensions */
+   int isection;                 /* Loop counter for sections */
+   int ithread;                  /* Loop counter for threads */
+   int npix;                     /* Number of pixels in output section */
+   int result;                   /* Result value to return */
+
+/* Initialise. */
+   result = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Get a pointer to a structure holding thread-specific global data. */
+   astGET_GLOBALS(this);
+
+/* Count the pixels in the output section, and choose a maximum section
+   size that will give each thread several sections to process. */
+   npix = 1;
+   for ( idim = 0; idim < ndim_out; idim++ ) {
+      npix *= ubnd[ idim ] - lbnd[ idim ] + 1;
+   }
+   sections.mxpix = MaxI( npix/( 4*nthread ), MIN_THREAD_PIX/4, status );
+   sections.nsection = 0;
+   sections.linear_fit = NULL;
+   sections.lbnd = NULL;
+   sections.ubnd = NULL;
+
+/* Divide the output section up into independent sections, obtaining a
+   linear fit for each one if possible. */
+   (void) ResampleAdaptively( this, ndim_in, lbnd_in, ubnd_in, in, in_var,
+                              type, interp, finterp, params, flags, tol,
+                              maxpix, badval_ptr, ndim_out, lbnd_out,
+                              ubnd_out, lbnd, ubnd, out, out_var,
+                              &sections, status );
+
+/* There is no point in using more threads than there are sections. */
+   if ( nthread > sections.nsection ) nthread = sections.nsection;
+
+/* Store the details of the job in a structure that can be passed to each
+   worker thread. */
+   job.map = astMalloc( sizeof( AstMapping * )*(size_t) nthread );
+   job.nbad = astMalloc( sizeof( int )*(size_t) sections.nsection );
+   job.unsimplified = unsimplified_mapping;
+   job.type = type;
+   job.sections = &sections;
+   job.params = params;
+   job.lbnd_in = lbnd_in;
+   job.lbnd_out = lbnd_out;
+   job.ubnd_in = ubnd_in;
+   job.ubnd_out = ubnd_out;
+   job.badval_ptr = badval_ptr;
+   job.in = in;
+   job.in_var = in_var;
+   job.flags = flags;
+   job.interp = interp;
+   job.ndim_in = ndim_in;
+   job.ndim_out = ndim_out;
+   job.finterp = finterp;
+   job.out = out;
+   job.out_var = out_var;
+
+/* Create an independent copy of the Mapping for each thread. Mappings
+   may cache information, or be inverted temporarily, while they are in
+   use and so cannot be shared between threads. Unlock each copy so
+   that the worker thread that uses it can lock it. */
+   if ( astOK ) {
+      for ( ithread = 0; ithread < nthread; ithread++ ) {
+         job.map[ ithread ] = astCopy( this );
+         astManageLock( job.map[ ithread ], AST__UNLOCK, 1, NULL );
+      }
+
+/* Resample the sections using the pool of worker threads. If the pool
+   is not available, resample them in this thread instead. */
+      if ( RunTasks( nthread, sections.nsection, ResampleTask, &job,
+                     status ) ) {
+         for ( isection = 0; isection < sections.nsection; isection++ ) {
+            result += job.nbad[ isection ];
+         }
+
+      } else {
+         for ( isection = 0; isection < sections.nsection && astOK;
+               isection++ ) {
+            result += ResampleWithBlocking( this,
+                                            sections.linear_fit[ isection ],
+                                            ndim_in, lbnd_in, ubnd_in, in,
+                                            in_var, type, interp, finterp,
+                                            params, flags, badval_ptr,
+                                            ndim_out, lbnd_out, ubnd_out,
+                                            sections.lbnd[ isection ],
+                                            sections.ubnd[ isection ], out,
+                                            out_var, status );
+         }
+      }
+
+/* Lock the Mapping copies for use by this thread again, and then
+   annul them. */
+      for ( ithread = 0; ithread < nthread; ithread++ ) {
+         astManageLock( job.map[ ithread ], AST__LOCK, 1, NULL );
+         job.map[ ithread ] = astAnnul( job.map[ ithread ] );
+      }
+   }
+
+/* Free resources. */
+   for ( isection = 0; isection < sections.nsection; isection++ ) {
+      sections.linear_fit[ isection ] = astFree( sections.linear_fit[ isection ] );
+      sections.lbnd[ isection ] = astFree( sections.lbnd[ isection ] );
+      sections.ubnd[ isection ] = astFree( sections.ubnd[ isection ] );
+   }
+   sections.linear_fit = astFree( sections.linear_fit );
+   sections.lbnd = astFree( sections.lbnd );
+   sections.ubnd = astFree( sections.ubnd );
+   job.map = astFree( job.map );
+   job.nbad = astFree( job.nbad );
+
+/* If an error occurred, clear the returned result. */
+   if ( !astOK ) result = 0;
+
+/* Return the result. */
+   return result;
+}
+
 static int ResampleSection( AstMapping *this, const double *linear_fit,
                             int ndim_in,
                             const int *lbnd_in, const int *ubnd_in,
@@ -14882,6 +16903,7 @@ static int ResampleSection( AstMapping *this, const double *linear_fit,
    AstPointSet *pset_in;         /* Input PointSet for transformation */
    AstPointSet *pset_out;        /* Output PointSet for transformation */
    const double *grad;           /* Pointer to gradient matrix of linear fit */
+   const double *ktab;           /* Pointer to table of kernel values */
    const double *par;            /* Pointer to parameter array */
    const double *zero;           /* Pointer to zero point array of fit */
    double **ptr_in;              /* Pointer to input PointSet coordinates */
@@ -15531,6 +17553,14 @@ static int ResampleSection( AstMapping *this, const double *linear_fit,
                   break;
             }
 
+/* If required, replace the internal kernel function with one that uses
+   linear interpolation within a cached table of kernel values. */
+            ktab = kernel ? GetKernelTable( kernel, par, neighb, status ) : NULL;
+            if ( ktab ) {
+               kernel = TabKernel;
+               par = ktab;
+            }
+
 /* Define a macro to use a "case" statement to invoke the 1-d kernel
    interpolation function appropriate to a given data type, passing it
    the pointer to the kernel function obtained above. */
@@ -15564,6 +17594,9 @@ static int ResampleSection( AstMapping *this, const double *linear_fit,
                CASE_KERNEL1(B,signed char)
                CASE_KERNEL1(UB,unsigned char)
             }
+
+/* Release any table of kernel values. */
+            ReleaseKernelTable( ktab, status );
             break;
 
 /* Undefine the macro. */
@@ -15745,6 +17778,85 @@ static int ResampleSection( AstMapping *this, const double *linear_fit,
    return result;
 }
 
+static void ResampleTask( void *data, int ithread, int itask, int *status ) {
+/*
+*  Name:
+*     ResampleTask
+
+*  Purpose:
+*     Resample one section of a data grid within a worker thread.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     void ResampleTask( void *data, int ithread, int itask, int *status )
+
+*  Class Membership:
+*     Mapping member function.
+
+*  Description:
+*     This function is invoked by a worker thread (see RunTasks) to
+*     resample a single section of the output grid described by a
+*     ResampleJob structure. The number of output pixels that could not
+*     be given a valid value is stored in the "nbad" array within the
+*     ResampleJob structure.
+
+*  Parameters:
+*     data
+*        Pointer to the ResampleJob structure describing the job.
+*     ithread
+*        The zero-based index of the worker thread. This selects the
+*        copy of the Mapping to be used.
+*     itask
+*        The zero-based index of the section to be resampled.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   astDECLARE_GLOBALS            /* Thread-specific data */
+   AstMapping *map;              /* Mapping to be used by this thread */
+   ResampleJob *job;             /* Description of the resampling job */
+   SectionList *sections;        /* The sections to be resampled */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Get the job description and the Mapping to be used by this thread. */
+   job = (ResampleJob *) data;
+   sections = job->sections;
+   map = job->map[ ithread ];
+
+/* Lock the Mapping for use by this thread. */
+   astManageLock( map, AST__LOCK, 1, NULL );
+
+/* Get a pointer to a structure holding thread-specific global data
+   values, and record the Mapping supplied by the caller so that it can
+   be used in any error messages. */
+   astGET_GLOBALS(map);
+   unsimplified_mapping = job->unsimplified;
+
+/* Resample the section. */
+   job->nbad[ itask ] = ResampleWithBlocking( map,
+                                              sections->linear_fit[ itask ],
+                                              job->ndim_in, job->lbnd_in,
+                                              job->ubnd_in, job->in,
+                                              job->in_var, job->type,
+                                              job->interp, job->finterp,
+                                              job->params, job->flags,
+                                              job->badval_ptr, job->ndim_out,
+                                              job->lbnd_out, job->ubnd_out,
+                                              sections->lbnd[ itask ],
+                                              sections->ubnd[ itask ],
+                                              job->out, job->out_var,
+                                              status );
+
+/* Unlock the Mapping so that it can be used by other threads. */
+   astManageLock( map, AST__UNLOCK, 1, NULL );
+}
+
 static int ResampleWithBlocking( AstMapping *this, const double *linear_fit,
                                  int ndim_in,
                                  const int *lbnd_in, const int *ubnd_in,
@@ -16108,13 +18220,161 @@ static int ResampleWithBlocking( AstMapping *this, const double *linear_fit,
       }
    }
 
-/* Free the workspace. */
-   lbnd_block = astFree( lbnd_block );
-   ubnd_block = astFree( ubnd_block );
-   dim_block = astFree( dim_block );
+/* Free the workspace. */
+   lbnd_block = astFree( lbnd_block );
+   ubnd_block = astFree( ubnd_block );
+   dim_block = astFree( dim_block );
+
+/* If an error occurred, clear the returned value. */
+   if ( !astOK ) result = 0;
+
+/* Return the result. */
+   return result;
+}
+
+static int RunTasks( int nthread, int ntask,
+                     void (* task)( void *, int, int, int * ), void *data,
+                     int *status ) {
+/*
+*  Name:
+*     RunTasks
+
+*  Purpose:
+*     Perform a set of independent tasks using a pool of worker threads.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     int RunTasks( int nthread, int ntask,
+*                   void (* task)( void *, int, int, int * ), void *data,
+*                   int *status )
+
+*  Class Membership:
+*     Mapping member function.
+
+*  Description:
+*     This function performs a set of "ntask" independent tasks by
+*     invoking the supplied task function once for each task, sharing
+*     the invocations between "nthread" worker threads. It does not
+*     return until all tasks have been completed. The worker threads are
+*     created when first needed and are then retained for use by later
+*     invocations of this function.
+*
+*     Each task is performed by whichever worker thread becomes free
+*     first, and so the task function should not write to any memory
+*     that is also written by another task (memory that is private to a
+*     single worker thread may be selected using the thread index passed
+*     to the task function).
+
+*  Parameters:
+*     nthread
+*        The number of worker threads to use. This should be no more than
+*        MAX_THREADS.
+*     ntask
+*        The number of tasks to perform.
+*     task
+*        The function that performs a single task. It is invoked as
+*        "(*task)( data, ithread, itask, status )", where "ithread" is
+*        the zero-based index of the worker thread (in the range 0 to
+*        "nthread"-1), "itask" is the zero-based index of the task (in
+*        the range 0 to "ntask"-1), and "status" is a pointer to the
+*        worker thread's inherited status variable.
+*     data
+*        A pointer that is passed unchanged to the task function.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Non-zero if the tasks were performed. Zero if the tasks were not
+*     performed because the pool of worker threads is currently in use
+*     (for instance by another thread), or is not available because AST
+*     was built without support for POSIX threads. In these cases the
+*     caller should perform the tasks itself.
+
+*  Notes:
+*     - If an error occurs within a worker thread, the remaining tasks
+*     allocated to that thread are skipped, and an error is reported
+*     using the first such status value when all tasks have completed.
+*     - A value of zero will be returned if this function is invoked
+*     with the global error status set.
+*/
+
+/* Local Variables: */
+   int result;                   /* Returned value */
+#ifdef THREAD_SAFE
+   int ithread;                  /* Loop counter for threads */
+   int wstatus;                  /* Status value from a worker thread */
+   pthread_t thread;             /* Identifier for a new worker thread */
+#endif
+
+/* Initialise. */
+   result = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+#ifdef THREAD_SAFE
+
+/* If the pool is already in use, return without action so that the
+   caller can perform the tasks itself. This also prevents a task from
+   deadlocking if it attempts to use the pool recursively. */
+   if ( pthread_mutex_trylock( &batch_mutex ) ) return result;
+   pthread_mutex_lock( &pool_mutex );
+
+/* Create any extra worker threads that are needed. Each worker thread
+   is passed its own zero-based index. The worker threads are never
+   terminated. */
+   while ( pool_nworker < nthread ) {
+      if ( pthread_create( &thread, NULL, PoolWorker,
+                           (void *) (size_t) pool_nworker ) ) break;
+      pthread_detach( thread );
+      pool_nworker++;
+   }
+   if ( nthread > pool_nworker ) nthread = pool_nworker;
+
+/* If any worker threads are available, describe the new batch of tasks
+   and then wake up the workers. */
+   wstatus = 0;
+   if ( nthread > 0 ) {
+      pool_task = task;
+      pool_data = data;
+      pool_ntask = ntask;
+      pool_next = 0;
+      pool_nbusy = ntask;
+      pool_nuse = nthread;
+      pool_batch++;
+      for ( ithread = 0; ithread < nthread; ithread++ ) {
+         pool_status[ ithread ] = 0;
+      }
+      pthread_cond_broadcast( &pool_start );
+
+/* Wait until all the tasks have been completed. */
+      while ( pool_nbusy > 0 ) pthread_cond_wait( &pool_finish, &pool_mutex );
+
+/* Clear the batch description and note the first error status (if any)
+   reported by a worker thread. */
+      pool_ntask = 0;
+      pool_nuse = 0;
+      pool_task = NULL;
+      pool_data = NULL;
+      for ( ithread = 0; ithread < nthread && !wstatus; ithread++ ) {
+         wstatus = pool_status[ ithread ];
+      }
+      result = 1;
+   }
+
+/* Release the pool. */
+   pthread_mutex_unlock( &pool_mutex );
+   pthread_mutex_unlock( &batch_mutex );
 
-/* If an error occurred, clear the returned value. */
-   if ( !astOK ) result = 0;
+/* Report an error if any worker thread failed. */
+   if ( wstatus ) {
+      astError( wstatus, "Failed to complete a task using a pool of %d "
+                "worker threads.", status, nthread );
+   }
+#endif
 
 /* Return the result. */
    return result;
@@ -16225,6 +18485,59 @@ static void SetAttrib( AstObject *this_object, const char *setting, int *status
 #undef MATCH
 }
 
+static void SetCompiled( AstMapping *this, int *status ) {
+/*
+*  Name:
+*     SetCompiled
+
+*  Purpose:
+*     Indicate that a Mapping and its components should retain work space.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     void SetCompiled( AstMapping *this, int *status )
+
+*  Class Membership:
+*     Mapping member function.
+
+*  Description:
+*     This function sets the flag that causes a Mapping to retain the
+*     work space used when transforming points (see astCompile). It is
+*     also set recursively within any component Mappings returned by
+*     astDecompose.
+
+*  Parameters:
+*     this
+*        Pointer to the Mapping.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   AstMapping *map1;             /* Pointer to first component Mapping */
+   AstMapping *map2;             /* Pointer to second component Mapping */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Set the flag. */
+   this->flags |= AST__COMPILED_FLAG;
+
+/* If the Mapping has two component Mappings, set the flag in each of them
+   too. Other Mappings are returned as the first component by astDecompose,
+   so there is no need to recurse into them. */
+   astDecompose( this, &map1, &map2, NULL, NULL, NULL );
+   if ( map2 ) {
+      SetCompiled( map1, status );
+      SetCompiled( map2, status );
+      map2 = astAnnul( map2 );
+   }
+   if ( map1 ) map1 = astAnnul( map1 );
+}
+
 static void Sinc( double offset, const double params[], int flags,
                   double *value, int *status ) {
 /*
@@ -19909,6 +22222,74 @@ MAKE_SPREAD_NEAREST(UB,unsigned char,1)
 
 
 
+static void TabKernel( double offset, const double params[], int flags,
+                       double *value, int *status ) {
+/*
+*  Name:
+*     TabKernel
+
+*  Purpose:
+*     1-dimensional interpolation kernel defined by a table of values.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     void TabKernel( double offset, const double params[], int flags,
+*                     double *value, int *status )
+
+*  Class Membership:
+*     Mapping member function.
+
+*  Description:
+*     This function calculates the value of a 1-dimensional sub-pixel
+*     interpolation kernel by linear interpolation within a table of
+*     kernel values created by GetKernelTable. The kernel is assumed to
+*     be an even function of the offset.
+
+*  Parameters:
+*     offset
+*        The offset of a pixel from the interpolation point, measured
+*        in pixels.
+*     params
+*        The table of kernel values, as returned by GetKernelTable.
+*     flags
+*        Not used.
+*     value
+*        Pointer to a double to receive the calculated kernel value.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Notes:
+*     - Offsets beyond the end of the table are given the value of the
+*     last sample in the table. This does not occur in practice since
+*     the table covers all offsets for which the kernel is evaluated.
+*     - This function does not perform error checking and does not
+*     generate errors.
+*/
+
+/* Local Variables: */
+   const double *values;         /* Pointer to first kernel value */
+   double x;                     /* Offset in units of samples */
+   int i;                        /* Index of sample below offset */
+   int nlast;                    /* Index of last sample */
+
+/* Convert the offset into a (positive) number of samples, and find the
+   index of the sample just below it. */
+   x = fabs( offset )*params[ 0 ];
+   i = (int) x;
+
+/* Interpolate linearly between the adjacent samples. */
+   values = params + 2;
+   nlast = (int) params[ 1 ];
+   if ( i < nlast ) {
+      *value = values[ i ] + ( x - (double) i )*( values[ i + 1 ] - values[ i ] );
+   } else {
+      *value = values[ nlast ];
+   }
+}
+
 static int TestAttrib( AstObject *this_object, const char *attrib, int *status ) {
 /*
 *  Name:
@@ -19996,6 +22377,64 @@ static int TestAttrib( AstObject *this_object, const char *attrib, int *status )
    return result;
 }
 
+static int ThreadCount( int npix, int *status ) {
+/*
+*  Name:
+*     ThreadCount
+
+*  Purpose:
+*     Determine how many threads to use for a gridded data operation.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     int ThreadCount( int npix, int *status )
+
+*  Class Membership:
+*     Mapping member function.
+
+*  Description:
+*     This function returns the number of threads that should be used to
+*     process a grid of data containing the given number of pixels. It
+*     is determined by the MaxThreads tuning parameter (see astTune),
+*     but a single thread is always used if the grid is small, or if AST
+*     was built without support for POSIX threads.
+
+*  Parameters:
+*     npix
+*        The number of pixels to be processed.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     The number of threads to use (at least one).
+*/
+
+/* Local Variables: */
+   int result;                   /* Returned value */
+
+/* Initialise. */
+   result = 1;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Get the maximum number of threads allowed, if the grid is big enough
+   to be worth sharing between several threads. */
+#ifdef THREAD_SAFE
+   if ( npix >= MIN_THREAD_PIX ) {
+      result = astTune( "MaxThreads", AST__TUNULL );
+      if ( result > MAX_THREADS ) result = MAX_THREADS;
+      if ( result < 1 ) result = 1;
+   }
+#endif
+
+/* Return the result. */
+   return result;
+}
+
 static void Tran1( AstMapping *this, int npoint, const double xin[],
                    int forward, double xout[], int *status ) {
 /*
@@ -20064,7 +22503,8 @@ f        The global status.
    AstPointSet *in_points;       /* Pointer to input PointSet */
    AstPointSet *out_points;      /* Pointer to output PointSet */
    const double *in_ptr[ 1 ];    /* Array of input data pointers */
-   double *out_ptr[ 1 ];         /* Array of output data pointers */
+   const double *out_ptr[ 1 ];   /* Array of output data pointers */
+   int slot;                     /* Index of retained input PointSet */
 
 /* Check the global error status. */
    if ( !astOK ) return;
@@ -20077,15 +22517,13 @@ f        The global status.
       in_ptr[ 0 ] = xin;
       out_ptr[ 0 ] = xout;
 
-/* Create PointSets to describe the input and output points. */
-      in_points = astPointSet( npoint, 1, "", status );
-      out_points = astPointSet( npoint, 1, "", status );
-
-/* Associate the data pointers with the PointSets (note we must
-   explicitly remove the "const" qualifier from the input data here,
-   although they will not be modified).  */
-      astSetPoints( in_points, (double **) in_ptr );
-      astSetPoints( out_points, out_ptr );
+/* Get PointSets to describe the input and output points. A compiled
+   Mapping retains separate PointSets for each direction. */
+      slot = forward ? 0 : 2;
+      in_points = GetTranPoints( this, slot, npoint, 1, in_ptr, NULL, 0,
+                                 status );
+      out_points = GetTranPoints( this, slot + 1, npoint, 1, out_ptr, NULL,
+                                  0, status );
 
 /* Apply the required transformation to the coordinates. */
       (void) astTransform( this, in_points, forward, out_points );
@@ -20095,9 +22533,9 @@ f        The global status.
       if ( astGetReport( this ) ) astReportPoints( this, forward,
                                                    in_points, out_points );
 
-/* Delete the two PointSets. */
-      in_points = astDelete( in_points );
-      out_points = astDelete( out_points );
+/* Release the two PointSets. */
+      in_points = ReleaseTranPoints( this, slot, in_points, status );
+      out_points = ReleaseTranPoints( this, slot + 1, out_points, status );
    }
 }
 
@@ -20181,7 +22619,8 @@ f        The global status.
    AstPointSet *in_points;       /* Pointer to input PointSet */
    AstPointSet *out_points;      /* Pointer to output PointSet */
    const double *in_ptr[ 2 ];    /* Array of input data pointers */
-   double *out_ptr[ 2 ];         /* Array of output data pointers */
+   const double *out_ptr[ 2 ];   /* Array of output data pointers */
+   int slot;                     /* Index of retained input PointSet */
 
 /* Check the global error status. */
    if ( !astOK ) return;
@@ -20196,15 +22635,13 @@ f        The global status.
       out_ptr[ 0 ] = xout;
       out_ptr[ 1 ] = yout;
 
-/* Create PointSets to describe the input and output points. */
-      in_points = astPointSet( npoint, 2, "", status );
-      out_points = astPointSet( npoint, 2, "", status );
-
-/* Associate the data pointers with the PointSets (note we must
-   explicitly remove the "const" qualifier from the input data here,
-   although they will not be modified).  */
-      astSetPoints( in_points, (double **) in_ptr );
-      astSetPoints( out_points, out_ptr );
+/* Get PointSets to describe the input and output points. A compiled
+   Mapping retains separate PointSets for each direction. */
+      slot = forward ? 0 : 2;
+      in_points = GetTranPoints( this, slot, npoint, 2, in_ptr, NULL, 0,
+                                 status );
+      out_points = GetTranPoints( this, slot + 1, npoint, 2, out_ptr, NULL,
+                                  0, status );
 
 /* Apply the required transformation to the coordinates. */
       (void) astTransform( this, in_points, forward, out_points );
@@ -20214,9 +22651,9 @@ f        The global status.
       if ( astGetReport( this ) ) astReportPoints( this, forward,
                                                    in_points, out_points );
 
-/* Delete the two PointSets. */
-      in_points = astDelete( in_points );
-      out_points = astDelete( out_points );
+/* Release the two PointSets. */
+      in_points = ReleaseTranPoints( this, slot, in_points, status );
+      out_points = ReleaseTranPoints( this, slot + 1, out_points, status );
    }
 }
 
@@ -21567,6 +24004,166 @@ static void TranGridWithBlocking( AstMapping *this, const double *linear_fit,
    dim_block = astFree( dim_block );
 }
 
+static void TranI( AstMapping *this, int npoint, int ncoord_in,
+                   const double in[], int forward, int ncoord_out,
+                   double out[], int *status ) {
+/*
+c++
+*  Name:
+*     astTranI
+
+*  Purpose:
+*     Transform N-dimensional coordinates held in an interleaved array.
+
+*  Type:
+*     Public virtual function.
+
+*  Synopsis:
+*     #include "mapping.h"
+*     void astTranI( AstMapping *this, int npoint, int ncoord_in,
+*                    const double in[], int forward, int ncoord_out,
+*                    double out[] )
+
+*  Class Membership:
+*     Mapping method.
+
+*  Description:
+*     This function applies a Mapping to transform the coordinates of
+*     a set of points in an arbitrary number of dimensions. It is the
+*     appropriate routine to use if the coordinates of each point are
+*     stored together in a single array, so that all the coordinates
+*     of the first point are followed by all the coordinates of the
+*     second point, etc (e.g. "x1,y1,x2,y2,x3,y3,...").
+*
+*     If each coordinate is stored in a separate array, or in a separate
+*     row of a 2-dimensional array, then the astTranP or astTranN
+*     function might be more suitable.
+
+*  Parameters:
+*     this
+*        Pointer to the Mapping to be applied.
+*     npoint
+*        The number of points to be transformed.
+*     ncoord_in
+*        The number of coordinates being supplied for each input point
+*        (i.e. the number of dimensions of the space in which the
+*        input points reside).
+*     in
+*        An array of double, with "npoint*ncoord_in" elements, containing
+*        the coordinates of the input (untransformed) points. The value
+*        of coordinate number "coord" for input point number "point" is
+*        given by "in[point*ncoord_in+coord]" (assuming both indices are
+*        zero-based).
+*     forward
+*        A non-zero value indicates that the Mapping's forward
+*        coordinate transformation is to be applied, while a zero
+*        value indicates that the inverse transformation should be
+*        used.
+*     ncoord_out
+*        The number of coordinates being generated by the Mapping for
+*        each output point (i.e. the number of dimensions of the space
+*        in which the output points reside). This need not be the same
+*        as "ncoord_in".
+*     out
+*        An array of double, with "npoint*ncoord_out" elements, into
+*        which the coordinates of the output (transformed) points will be
+*        written. The value of coordinate number "coord" for output point
+*        number "point" will be found in "out[point*ncoord_out+coord]".
+*        If "ncoord_out" is equal to "ncoord_in", this may be the same
+*        array as "in", in which case the input coordinates are replaced
+*        by the output coordinates.
+
+*  Notes:
+*     - If the forward coordinate transformation is being applied, the
+*     Mapping supplied must have the value of "ncoord_in" for its Nin
+*     attribute and the value of "ncoord_out" for its Nout
+*     attribute. If the inverse transformation is being applied, these
+*     values should be reversed.
+*     - The points are transformed in blocks, so no work arrays with
+*     the same size as the supplied arrays are needed.
+*     - This routine is not available in the Fortran 77 interface to
+*     the AST library.
+c--
+*/
+
+/* Local Variables: */
+   AstPointSet *in_points;       /* Pointer to input PointSet */
+   AstPointSet *out_points;      /* Pointer to output PointSet */
+   const double *pin;            /* Pointer to next input value */
+   double **ptr_in;              /* Pointers to input block coordinates */
+   double **ptr_out;             /* Pointers to output block coordinates */
+   double *pout;                 /* Pointer to next output value */
+   int coord;                    /* Loop counter for coordinates */
+   int nblock;                   /* Number of points in each block */
+   int npblock;                  /* Number of points in current block */
+   int point;                    /* Loop counter for points */
+   int point0;                   /* Index of first point in current block */
+   int report;                   /* Report the transformed points? */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Validate the Mapping and number of points/coordinates. */
+   ValidateMapping( this, forward, npoint, ncoord_in, ncoord_out, "astTranI", status );
+
+/* The points are transformed in blocks of up to TRANI_BLOCK points.
+   Each block is copied into PointSets holding the coordinates in
+   separate arrays, transformed, and then copied back into the output
+   array. The blocks are small enough to remain in the processor's
+   cache. Since the input values for each block are copied before any
+   output values are stored, the input and output arrays may be the
+   same. Create PointSets to hold the input and output coordinates for
+   a single block. As with astTranN, an error is reported by astPointSet
+   if there are no points to transform. */
+   if ( astOK ) {
+      nblock = ( npoint < TRANI_BLOCK ) ? npoint : TRANI_BLOCK;
+      in_points = astPointSet( nblock, ncoord_in, "", status );
+      out_points = astPointSet( nblock, ncoord_out, "", status );
+      ptr_in = astGetPoints( in_points );
+      ptr_out = astGetPoints( out_points );
+      report = astGetReport( this );
+
+/* Loop round each block. Reduce the size of the PointSets if the final
+   block is smaller than the others. */
+      pin = in;
+      pout = out;
+      for ( point0 = 0; point0 < npoint && astOK; point0 += nblock ) {
+         npblock = npoint - point0;
+         if ( npblock < nblock ) {
+            astSetNpoint( in_points, npblock );
+            astSetNpoint( out_points, npblock );
+         } else {
+            npblock = nblock;
+         }
+
+/* Copy the input coordinates for the block into the input PointSet. */
+         for ( point = 0; point < npblock; point++ ) {
+            for ( coord = 0; coord < ncoord_in; coord++ ) {
+               ptr_in[ coord ][ point ] = *(pin++);
+            }
+         }
+
+/* Apply the required transformation to the coordinates. */
+         (void) astTransform( this, in_points, forward, out_points );
+
+/* If the Mapping's Report attribute is set, report the effect the
+   Mapping has had on the coordinates. */
+         if ( report ) astReportPoints( this, forward, in_points, out_points );
+
+/* Copy the output coordinates for the block into the output array. */
+         for ( point = 0; point < npblock; point++ ) {
+            for ( coord = 0; coord < ncoord_out; coord++ ) {
+               *(pout++) = ptr_out[ coord ][ point ];
+            }
+         }
+      }
+
+/* Delete the two PointSets. */
+      in_points = astDelete( in_points );
+      out_points = astDelete( out_points );
+   }
+}
+
 static void TranN( AstMapping *this, int npoint,
                    int ncoord_in, int indim, const double *in,
                    int forward,
@@ -21698,9 +24295,7 @@ f     be reversed.
 /* Local Variables: */
    AstPointSet *in_points;       /* Pointer to input PointSet */
    AstPointSet *out_points;      /* Pointer to output PointSet */
-   const double **in_ptr;        /* Pointer to array of input data pointers */
-   double **out_ptr;             /* Pointer to array of output data pointers */
-   int coord;                    /* Loop counter for coordinates */
+   int slot;                     /* Index of retained input PointSet */
 
 /* Check the global error status. */
    if ( !astOK ) return;
@@ -21724,13 +24319,7 @@ f     be reversed.
                 "points being transformed (%d).", status, npoint );
    }
 
-/* Allocate memory to hold the arrays of input and output data
-   pointers. */
    if ( astOK ) {
-      in_ptr = (const double **) astMalloc( sizeof( const double * ) *
-                                            (size_t) ncoord_in );
-      out_ptr = astMalloc( sizeof( double * ) * (size_t) ncoord_out );
-
 
 #ifdef DEBUG
       { int i, ns;
@@ -21739,46 +24328,26 @@ f     be reversed.
       }
 #endif
 
-
-/* Initialise the input data pointers to locate the coordinate data in
-   the "in" array. */
-      if ( astOK ) {
-         for ( coord = 0; coord < ncoord_in; coord++ ) {
-            in_ptr[ coord ] = in + coord * indim;
-         }
-
-/* Similarly initialise the output data pointers to point into the
-   "out" array. */
-         for ( coord = 0; coord < ncoord_out; coord++ ) {
-            out_ptr[ coord ] = out + coord * outdim;
-         }
-
-/* Create PointSets to describe the input and output points. */
-         in_points = astPointSet( npoint, ncoord_in, "", status );
-         out_points = astPointSet( npoint, ncoord_out, "", status );
-
-/* Associate the data pointers with the PointSets (note we must
-   explicitly remove the "const" qualifier from the input data here,
-   although they will not be modified).  */
-         astSetPoints( in_points, (double **) in_ptr );
-         astSetPoints( out_points, out_ptr );
+/* Get PointSets to describe the input and output points, locating the
+   coordinate data for each axis within the "in" and "out" arrays. A
+   compiled Mapping retains separate PointSets for each direction. */
+      slot = forward ? 0 : 2;
+      in_points = GetTranPoints( this, slot, npoint, ncoord_in, NULL, in,
+                                 indim, status );
+      out_points = GetTranPoints( this, slot + 1, npoint, ncoord_out, NULL,
+                                  out, outdim, status );
 
 /* Apply the required transformation to the coordinates. */
-         (void) astTransform( this, in_points, forward, out_points );
+      (void) astTransform( this, in_points, forward, out_points );
 
 /* If the Mapping's Report attribute is set, report the effect the
    Mapping has had on the coordinates. */
-         if ( astGetReport( this ) ) astReportPoints( this, forward,
-                                                      in_points, out_points );
-
-/* Delete the two PointSets. */
-         in_points = astDelete( in_points );
-         out_points = astDelete( out_points );
-      }
+      if ( astGetReport( this ) ) astReportPoints( this, forward,
+                                                   in_points, out_points );
 
-/* Free the memory used for the data pointers. */
-      in_ptr = (const double **) astFree( (void *) in_ptr );
-      out_ptr = astFree( out_ptr );
+/* Release the two PointSets. */
+      in_points = ReleaseTranPoints( this, slot, in_points, status );
+      out_points = ReleaseTranPoints( this, slot + 1, out_points, status );
    }
 }
 
@@ -21867,6 +24436,7 @@ c--
 /* Local Variables: */
    AstPointSet *in_points;       /* Pointer to input PointSet */
    AstPointSet *out_points;      /* Pointer to output PointSet */
+   int slot;                     /* Index of retained input PointSet */
 
 /* Check the global error status. */
    if ( !astOK ) return;
@@ -21874,16 +24444,15 @@ c--
 /* Validate the Mapping and number of points/coordinates. */
    ValidateMapping( this, forward, npoint, ncoord_in, ncoord_out, "astTranP", status );
 
-/* Create PointSets to describe the input and output points. */
+/* Get PointSets to describe the input and output points. A compiled
+   Mapping retains separate PointSets for each direction. */
    if ( astOK ) {
-      in_points = astPointSet( npoint, ncoord_in, "", status );
-      out_points = astPointSet( npoint, ncoord_out, "", status );
-
-/* Associate the data pointers with the PointSets (note we must
-   explicitly remove the "const" qualifier from the input data here,
-   although they will not be modified).  */
-      astSetPoints( in_points, (double **) ptr_in );
-      astSetPoints( out_points, ptr_out );
+      slot = forward ? 0 : 2;
+      in_points = GetTranPoints( this, slot, npoint, ncoord_in, ptr_in,
+                                 NULL, 0, status );
+      out_points = GetTranPoints( this, slot + 1, npoint, ncoord_out,
+                                  (const double **) ptr_out, NULL, 0,
+                                  status );
 
 /* Apply the required transformation to the coordinates. */
       (void) astTransform( this, in_points, forward, out_points );
@@ -21893,9 +24462,9 @@ c--
       if ( astGetReport( this ) ) astReportPoints( this, forward,
                                                    in_points, out_points );
 
-/* Delete the two PointSets. */
-      in_points = astDelete( in_points );
-      out_points = astDelete( out_points );
+/* Release the two PointSets. */
+      in_points = ReleaseTranPoints( this, slot, in_points, status );
+      out_points = ReleaseTranPoints( this, slot + 1, out_points, status );
    }
 }
 
@@ -23285,6 +25854,7 @@ static void Copy( const AstObject *objin, AstObject *objout, int *status ) {
 
 /* Local Variables: */
    AstMapping *out;              /* Pointer to output Mapping */
+   int i;                        /* Index of retained PointSet */
 
 /* Check the global error status. */
    if ( !astOK ) return;
@@ -23294,6 +25864,10 @@ static void Copy( const AstObject *objin, AstObject *objout, int *status ) {
 
 /* Clear the output Report attribute. */
    out->report = CHAR_MAX;
+
+/* The output Mapping does not share any PointSets retained by a compiled
+   input Mapping. */
+   for ( i = 0; i < 4; i++ ) out->tran_ps[ i ] = NULL;
 }
 
 /* Destructor. */
@@ -23320,14 +25894,19 @@ static void Delete( AstObject *obj, int *status ) {
 *        Pointer to the Mapping to be deleted.
 *     status
 *        Pointer to the inherited status variable.
-
-*  Notes:
-*     - This destructor does nothing and exists only to maintain a
-*     one-to-one correspondence between destructors and copy
-*     constructors.
 */
 
-/* Return without action. */
+/* Local Variables: */
+   AstMapping *this;             /* Pointer to Mapping */
+   int i;                        /* Index of retained PointSet */
+
+/* Obtain a pointer to the Mapping structure. */
+   this = (AstMapping *) obj;
+
+/* Delete any PointSets retained by a compiled Mapping. */
+   for ( i = 0; i < 4; i++ ) {
+      if ( this->tran_ps[ i ] ) this->tran_ps[ i ] = astDelete( this->tran_ps[ i ] );
+   }
 }
 
 /* Dump function. */
@@ -23567,6 +26146,7 @@ AstMapping *astInitMapping_( void *mem, size_t size, int init,
 
 /* Local Variables: */
    AstMapping *new;              /* Pointer to new Mapping */
+   int i;                        /* Index of retained PointSet */
 
 /* Check the global status. */
    if ( !astOK ) return NULL;
@@ -23611,6 +26191,7 @@ AstMapping *astInitMapping_( void *mem, size_t size, int init,
       new->invert = CHAR_MAX;
       new->report = CHAR_MAX;
       new->flags = 0;
+      for ( i = 0; i < 4; i++ ) new->tran_ps[ i ] = NULL;
 
 /* If an error occurred, clean up by deleting the new object. */
       if ( !astOK ) new = astDelete( new );
@@ -23699,6 +26280,7 @@ AstMapping *astLoadMapping_( void *mem, size_t size,
 /* Local Variables: */
    astDECLARE_GLOBALS            /* Pointer to thread-specific global data */
    AstMapping *new;              /* Pointer to the new Mapping */
+   int i;                        /* Index of retained PointSet */
 
 /* Initialise. */
    new = NULL;
@@ -23750,6 +26332,9 @@ AstMapping *astLoadMapping_( void *mem, size_t size,
 /* Initialise bitwise flags to zero. */
       new->flags = 0;
 
+/* Compiled Mappings are not dumped, so there are no retained PointSets. */
+      for ( i = 0; i < 4; i++ ) new->tran_ps[ i ] = NULL;
+
 /* Nin. */
 /* ---- */
       new->nin = astReadInt( channel, "nin", 0 );
@@ -24004,6 +26589,10 @@ double astRate_( AstMapping *this, double *at, int ax1, int ax2, int *status ){
       return (**astMEMBER(this,Mapping,Rate))( this, at, ax1, ax2, status );
    }
 }
+AstMapping *astCompile_( AstMapping *this, int *status ) {
+   if ( !astOK ) return NULL;
+   return (**astMEMBER(this,Mapping,Compile))( this, status );
+}
 AstMapping *astRemoveRegions_( AstMapping *this, int *status ) {
    if ( !astOK ) return NULL;
    return (**astMEMBER(this,Mapping,RemoveRegions))( this, status );
@@ -24089,6 +26678,13 @@ void astTranN_( AstMapping *this, int npoint,
                                       ncoord_in, indim, in,
                                       forward, ncoord_out, outdim, out, status );
 }
+void astTranI_( AstMapping *this, int npoint, int ncoord_in,
+                const double in[], int forward, int ncoord_out,
+                double out[], int *status ) {
+   if ( !astOK ) return;
+   (**astMEMBER(this,Mapping,TranI))( this, npoint, ncoord_in, in,
+                                      forward, ncoord_out, out, status );
+}
 void astTranP_( AstMapping *this, int npoint,
                 int ncoord_in, const double *ptr_in[],
                 int forward, int ncoord_out, double *ptr_out[], int *status ) {
@@ -99,6 +99,8 @@
 
 *  New Methods Defined:
 *     Public:
+*        astCompile
+*           Create a Mapping that retains work space for repeated use.
 *        astDecompose
 *           Decompose a Mapping into two component Mappings.
 *        astInvert
@@ -125,6 +127,8 @@
 *           Transform 2-dimensional coordinates.
 *        astTranGrid
 *           Transform an N-dimensional regular grid of positions.
+*        astTranI (C only)
+*           Transform N-dimensional coordinates held in an interleaved array.
 *        astTranN
 *           Transform N-dimensional coordinates.
 *        astTranP (C only)
@@ -309,6 +313,10 @@
 *        Add astRemoveRegions.
 *     26-FEB-2010 (DSB):
 *        Added method astQuadApprox.
+*     17-OCT-2026 (DSB):
+*        Added method astTranI.
+*     17-OCT-2026 (DSB):
+*        Added method astCompile.
 *--
 */
 
@@ -409,6 +417,7 @@ typedef unsigned long long int UINT_BIG;
 #if defined(astCLASS)         /* Protected */
 #define AST__ISSIMPLE_FLAG 1  /* Mapping has been simplified */
 #define AST__FROZEN_FLAG 2    /* Mapping cannot be nominated for simplification */
+#define AST__COMPILED_FLAG 4  /* Mapping retains work space between calls */
 #endif
 
 
@@ -431,6 +440,7 @@ typedef struct AstMapping {
    char report;                   /* Report when converting coordinates? */
    char tran_forward;             /* Forward transformation defined? */
    char tran_inverse;             /* Inverse transformation defined? */
+   AstPointSet *tran_ps[ 4 ];     /* PointSets retained by compiled Mappings */
 } AstMapping;
 
 /* Virtual function table. */
@@ -447,6 +457,7 @@ typedef struct AstMappingVtab {
    AstClassIdentifier id;
 
 /* Properties (e.g. methods) specific to this class. */
+   AstMapping *(* Compile)( AstMapping *, int * );
    AstMapping *(* RemoveRegions)( AstMapping *, int * );
    AstMapping *(* Simplify)( AstMapping *, int * );
    AstPointSet *(* Transform)( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
@@ -478,6 +489,7 @@ typedef struct AstMappingVtab {
    void (* Tran1)( AstMapping *, int, const double [], int, double [], int * );
    void (* Tran2)( AstMapping *, int, const double [], const double [], int, double [], double [], int * );
    void (* TranGrid)( AstMapping *, int, const int[], const int[], double, int, int, int, int, double *, int * );
+   void (* TranI)( AstMapping *, int, int, const double [], int, int, double [], int * );
    void (* TranN)( AstMapping *, int, int, int, const double *, int, int, int, double *, int * );
    void (* TranP)( AstMapping *, int, int, const double *[], int, int, double *[], int * );
 
@@ -631,6 +643,7 @@ PROTO_GENERIC_DFI(LD,long double)
 
 #undef PROTO_GENERIC_DFI
 
+AstMapping *astCompile_( AstMapping *, int * );
 AstMapping *astRemoveRegions_( AstMapping *, int * );
 AstMapping *astSimplify_( AstMapping *, int * );
 void astInvert_( AstMapping *, int * );
@@ -639,6 +652,7 @@ int astQuadApprox_( AstMapping *, const double[2], const double[2], int, int, do
 void astTran1_( AstMapping *, int, const double [], int, double [], int * );
 void astTran2_( AstMapping *, int, const double [], const double [], int, double [], double [], int * );
 void astTranGrid_( AstMapping *, int, const int[], const int[], double, int, int, int, int, double *, int * );
+void astTranI_( AstMapping *, int, int, const double [], int, int, double [], int * );
 void astTranN_( AstMapping *, int, int, int, const double *, int, int, int, double *, int * );
 void astTranP_( AstMapping *, int, int, const double *[], int, int, double *[], int * );
 
@@ -771,6 +785,7 @@ astINVOKE(V,astResampleUS_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_v
 astINVOKE(V,astResampleB_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
 #define astResampleUB(this,ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var) \
 astINVOKE(V,astResampleUB_(astCheckMapping(this),ndim_in,lbnd_in,ubnd_in,in,in_var,interp,finterp,params,flags,tol,maxpix,badval,ndim_out,lbnd_out,ubnd_out,lbnd,ubnd,out,out_var,STATUS_PTR))
+#define astCompile(this) astINVOKE(O,astCompile_(astCheckMapping(this),STATUS_PTR))
 #define astRemoveRegions(this) astINVOKE(O,astRemoveRegions_(astCheckMapping(this),STATUS_PTR))
 #define astSimplify(this) astINVOKE(O,astSimplify_(astCheckMapping(this),STATUS_PTR))
 #define astTran1(this,npoint,xin,forward,xout) \
@@ -779,6 +794,8 @@ astINVOKE(V,astTran1_(astCheckMapping(this),npoint,xin,forward,xout,STATUS_PTR))
 astINVOKE(V,astTran2_(astCheckMapping(this),npoint,xin,yin,forward,xout,yout,STATUS_PTR))
 #define astTranGrid(this,ncoord_in,lbnd,ubnd,tol,maxpix,forward,ncoord_out,outdim,out) \
 astINVOKE(V,astTranGrid_(astCheckMapping(this),ncoord_in,lbnd,ubnd,tol,maxpix,forward,ncoord_out,outdim,out,STATUS_PTR))
+#define astTranI(this,npoint,ncoord_in,in,forward,ncoord_out,out) \
+astINVOKE(V,astTranI_(astCheckMapping(this),npoint,ncoord_in,in,forward,ncoord_out,out,STATUS_PTR))
 #define astTranN(this,npoint,ncoord_in,indim,in,forward,ncoord_out,outdim,out) \
 astINVOKE(V,astTranN_(astCheckMapping(this),npoint,ncoord_in,indim,in,forward,ncoord_out,outdim,out,STATUS_PTR))
 #define astTranP(this,npoint,ncoord_in,ptr_in,forward,ncoord_out,ptr_out) \
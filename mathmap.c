@@ -85,6 +85,11 @@ f     The MathMap class does not define any new routines beyond those
 *        Re-implement the Equal method to avoid use of astSimplify.
 *     30-AUG-2012 (DSB):
 *        Fix bug in undocumented Gaussian noise function.
+*     17-OCT-2026 (DSB):
+*        Optimise the compiled transformation functions. Constant
+*        sub-expressions are folded, sub-expressions shared between
+*        functions are evaluated only once, and integer powers,
+*        polynomials and multiply-add sequences use specialised opcodes.
 *class--
 */
 
@@ -95,6 +100,11 @@ f     The MathMap class does not define any new routines beyond those
    "protected" symbols available. */
 #define astCLASS MathMap
 
+/* The largest integer power (and polynomial degree) for which the
+   specialised opcodes generated when optimising compiled expressions
+   will be used. */
+#define MAX_POWER 32
+
 /* Allocate pointer array. */
 /* ----------------------- */
 /* This macro allocates an array of pointers. If successful, each element
@@ -333,6 +343,15 @@ typedef enum {
    OP_OR,                        /* Boolean OR */
    OP_XOR,                       /* Boolean exclusive OR */
 
+/* Operations generated only when optimising compiled expressions. */
+   OP_ADDMUL,                    /* Add product ("a+b*c") */
+   OP_MULADD,                    /* Multiply and add ("a*b+c") */
+   OP_MULSUB,                    /* Multiply and subtract ("a*b-c") */
+   OP_POLY,                      /* Polynomial with constant coefficients */
+   OP_POWI,                      /* Raise to a constant integer power */
+   OP_STO,                       /* Store copy of top of stack */
+   OP_SUBMUL,                    /* Subtract product ("a-b*c") */
+
 /* Null operation. */
    OP_NULL                       /* Null operation */
 } Oper;
@@ -354,6 +373,19 @@ typedef struct {
    const Oper opcode;            /* Resulting operation code */
 } Symbol;
 
+/* This structure describes a node in the graph which represents a set
+   of compiled expressions while they are being optimised. */
+typedef struct {
+   Oper opcode;                  /* Operation code */
+   double *con;                  /* Constants consumed by the opcode */
+   int *arg;                     /* Indices of argument nodes */
+   int home;                     /* Variable holding node's value (or -1) */
+   int narg;                     /* Number of argument nodes */
+   int ncon;                     /* Number of constants */
+   int nuse;                     /* Number of references to the node */
+   int pure;                     /* Value depends only on the arguments? */
+} ExprNode;
+
 /* This initialises an array of Symbol structures to hold data on all
    the supported symbols. The order is not important, but symbols are
    arranged here in approximate order of descending evaluation
@@ -602,7 +634,10 @@ static int Equal( AstObject *, AstObject *, int * );
 static int GetSeed( AstMathMap *, int * );
 static int GetSimpFI( AstMathMap *, int * );
 static int GetSimpIF( AstMathMap *, int * );
+static int MakeNode( ExprNode **, int *, Oper, int, const int [], int, const double [], int * );
 static int MapMerge( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
+static int OptimiseNode( ExprNode **, int *, Oper, int, const int [], int, const double [], int * );
+static int PolyTerms( const ExprNode *, int, double, int *, double [], int *, int * );
 static int TestAttrib( AstObject *, const char *, int * );
 static int TestSeed( AstMathMap *, int * );
 static int TestSimpFI( AstMathMap *, int * );
@@ -613,14 +648,17 @@ static void ClearSeed( AstMathMap *, int * );
 static void ClearSimpFI( AstMathMap *, int * );
 static void ClearSimpIF( AstMathMap *, int * );
 static void CompileExpression( const char *, const char *, const char *, int, const char *[], int **, double **, int *, int * );
-static void CompileMapping( const char *, const char *, int, int, int, const char *[], int, const char *[], int ***, int ***, double ***, double ***, int *, int *, int * );
+static void CompileMapping( const char *, const char *, int, int, int, const char *[], int, const char *[], int ***, int ***, double ***, double ***, int *, int *, int *, int *, int * );
 static void Copy( const AstObject *, AstObject *, int * );
+static void CountUses( ExprNode *, int, int * );
 static void Delete( AstObject *, int * );
 static void Dump( AstObject *, AstChannel *, int * );
+static void EmitNode( ExprNode *, int, int, int, int **, int *, double **, int *, int *, int *, int *, int * );
 static void EvaluateFunction( Rcontext *, int, const double **, const int *, const double *, int, double *, int * );
 static void EvaluationSort( const double [], int, int [], int **, int *, int * );
 static void ExtractExpressions( const char *, const char *, int, const char *[], int, char ***, int * );
 static void ExtractVariables( const char *, const char *, int, const char *[], int, int, int, int, int, char ***, int * );
+static void OptimiseFunctions( int, int, int **, double **, int *, int *, int * );
 static void ParseConstant( const char *, const char *, const char *, int, int *, double *, int * );
 static void ParseName( const char *, int, int *, int * );
 static void ParseVariable( const char *, const char *, const char *, int, int, const char *[], int *, int *, int * );
@@ -1138,7 +1176,8 @@ static void CompileMapping( const char *method, const char *class,
                             int ninv, const char *invfun[],
                             int ***fwdcode, int ***invcode,
                             double ***fwdcon, double ***invcon,
-                            int *fwdstack, int *invstack, int *status ) {
+                            int *fwdstack, int *invstack,
+                            int *fwdtmp, int *invtmp, int *status ) {
 /*
 *  Name:
 *     CompileMapping
@@ -1157,7 +1196,8 @@ static void CompileMapping( const char *method, const char *class,
 *                          int ninv, const char *invfun[],
 *                          int ***fwdcode, int ***invcode,
 *                          double ***fwdcon, double ***invcon,
-*                          int *fwdstack, int *invstack, int *status )
+*                          int *fwdstack, int *invstack,
+*                          int *fwdtmp, int *invtmp, int *status )
 
 *  Class Membership:
 *     MathMap member function.
@@ -1166,7 +1206,8 @@ static void CompileMapping( const char *method, const char *class,
 *     This function checks and compiles the transformation functions required
 *     to create a MathMap. It produces sequences of operation codes (opcodes)
 *     and numerical constants which may subsequently be used to evaluate the
-*     functions on a push-down stack.
+*     functions on a push-down stack. The compiled functions for each
+*     direction are optimised as a group using OptimiseFunctions.
 
 *  Parameters:
 *     method
@@ -1259,14 +1300,23 @@ static void CompileMapping( const char *method, const char *class,
 *     invstack
 *        Pointer to an int in which to return the size of the push-down stack
 *        required to evaluate the inverse transformation functions.
+*     fwdtmp
+*        Pointer to an int in which to return the number of temporary
+*        variables required to evaluate the forward transformation
+*        functions.
+*     invtmp
+*        Pointer to an int in which to return the number of temporary
+*        variables required to evaluate the inverse transformation
+*        functions.
 *     status
 *        Pointer to the inherited status variable.
 
 *  Notes:
 *     - A value of NULL will be returned for the "*fwdcode", "*invcode",
 *     "*fwdcon" and "*invcon" pointers and a value of zero will be returned
-*     for the "*fwdstack" and "*invstack" values if this function is invoked
-*     with the global error status set, or if it should fail for any reason.
+*     for the "*fwdstack", "*invstack", "*fwdtmp" and "*invtmp" values if
+*     this function is invoked with the global error status set, or if it
+*     should fail for any reason.
 */
 
 /* Local Variables: */
@@ -1284,6 +1334,8 @@ static void CompileMapping( const char *method, const char *class,
    *invcon = NULL;
    *fwdstack = 0;
    *invstack = 0;
+   *fwdtmp = 0;
+   *invtmp = 0;
    nvar = 0;
 
 /* Check the global error status. */
@@ -1360,6 +1412,11 @@ static void CompileMapping( const char *method, const char *class,
             *fwdstack = ( *fwdstack > stacksize ) ? *fwdstack : stacksize;
          }
       }
+
+/* Optimise the compiled functions. This also determines the stack size
+   they require. */
+      OptimiseFunctions( nin, nfwd, *fwdcode, *fwdcon, fwdstack, fwdtmp,
+                         status );
    }
 
 /* Free the memory containing the extracted expressions and variables. */
@@ -1433,6 +1490,10 @@ static void CompileMapping( const char *method, const char *class,
             *invstack = ( *invstack > stacksize ) ? *invstack : stacksize;
          }
       }
+
+/* Optimise the compiled functions. */
+      OptimiseFunctions( nout, ninv, *invcode, *invcon, invstack, invtmp,
+                         status );
    }
 
 /* Free the memory containing the extracted expressions and variables. */
@@ -1448,6 +1509,59 @@ static void CompileMapping( const char *method, const char *class,
       FREE_POINTER_ARRAY( *invcon, ninv )
       *fwdstack = 0;
       *invstack = 0;
+      *fwdtmp = 0;
+      *invtmp = 0;
+   }
+}
+
+static void CountUses( ExprNode *nodes, int inode, int *status ) {
+/*
+*  Name:
+*     CountUses
+
+*  Purpose:
+*     Count the references to the nodes in an expression graph.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mathmap.h"
+*     void CountUses( ExprNode *nodes, int inode, int *status )
+
+*  Class Membership:
+*     MathMap member function.
+
+*  Description:
+*     This function records a reference to a node in an expression
+*     graph by incrementing its "nuse" component. If this is the first
+*     reference, the function then invokes itself to record a reference
+*     to each of the node's arguments. On exit, the "nuse" component of
+*     each node holds the number of distinct nodes (or functions) which
+*     use its value.
+
+*  Parameters:
+*     nodes
+*        Pointer to the array of nodes in the graph. The "nuse" component
+*        of each node should be zero before the first invocation.
+*     inode
+*        Index of the node being referenced.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   int iarg;                     /* Loop counter for arguments */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Count the reference. If this is the first, also count the references
+   made by the node to its arguments. */
+   if ( nodes[ inode ].nuse++ == 0 ) {
+      for ( iarg = 0; iarg < nodes[ inode ].narg; iarg++ ) {
+         CountUses( nodes, nodes[ inode ].arg[ iarg ], status );
+      }
    }
 }
 
@@ -1561,6 +1675,180 @@ static int DefaultSeed( const Rcontext *context, int *status ) {
    return (int) bits;
 }
 
+static void EmitNode( ExprNode *nodes, int inode, int root, int tmpvar,
+                      int **code, int *ncode, double **con, int *ncon,
+                      int *depth, int *stacksize, int *ntmp, int *status ) {
+/*
+*  Name:
+*     EmitNode
+
+*  Purpose:
+*     Generate opcodes to evaluate a node in an expression graph.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mathmap.h"
+*     void EmitNode( ExprNode *nodes, int inode, int root, int tmpvar,
+*                    int **code, int *ncode, double **con, int *ncon,
+*                    int *depth, int *stacksize, int *ntmp, int *status )
+
+*  Class Membership:
+*     MathMap member function.
+
+*  Description:
+*     This function appends the opcodes and constants needed to evaluate
+*     a node in an optimised expression graph to the arrays that describe
+*     a compiled expression. It invokes itself to generate the opcodes
+*     for the node's arguments first.
+*
+*     If the node's value is already held in a variable (because it has
+*     been evaluated by an earlier expression, or earlier in the current
+*     one), the value is simply loaded from that variable. Otherwise, if
+*     the value is used more than once, it is stored in a new temporary
+*     variable after being evaluated so that later uses need not
+*     re-evaluate it.
+*
+*     A multiplication which is used only by an addition or subtraction
+*     is combined with it into a single opcode.
+
+*  Parameters:
+*     nodes
+*        Pointer to the array of nodes in the graph. The "nuse" component
+*        of each node should have been set up using CountUses. The "home"
+*        component is updated if a temporary variable is allocated.
+*     inode
+*        Index of the node to be evaluated.
+*     root
+*        Non-zero if the node gives the final result of the expression. A
+*        temporary variable is never allocated for such a node, since its
+*        value will be stored in the variable assigned by the expression.
+*     tmpvar
+*        The index of the variable which holds the first temporary value.
+*        Further temporary variables follow it.
+*     code
+*        Address of a pointer to a dynamically allocated array of int
+*        holding the opcodes. The first element is reserved for the count
+*        of opcodes, which is not updated by this function. The array is
+*        extended as required and the pointer updated.
+*     ncode
+*        Pointer to an int holding the number of opcodes in "*code". It
+*        is updated to include the opcodes appended.
+*     con
+*        Address of a pointer to a dynamically allocated array of double
+*        holding the constants consumed by the opcodes. The array is
+*        extended as required and the pointer updated.
+*     ncon
+*        Pointer to an int holding the number of constants in "*con". It
+*        is updated to include the constants appended.
+*     depth
+*        Pointer to an int holding the current evaluation stack size. It
+*        is updated to include the effect of the opcodes appended.
+*     stacksize
+*        Pointer to an int holding the maximum evaluation stack size
+*        required. It is increased if necessary.
+*     ntmp
+*        Pointer to an int holding the number of temporary variables
+*        allocated so far. It is updated to include any new ones.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   ExprNode *node;               /* Pointer to node */
+   ExprNode *prod;               /* Pointer to fused multiplication node */
+   Oper opcode;                  /* Opcode to emit */
+   double var;                   /* Variable index as a constant */
+   int iarg;                     /* Loop counter for arguments */
+   int icon;                     /* Loop counter for constants */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* This macro appends an opcode, together with any constants it
+   consumes, and notes the resulting change in the evaluation stack
+   size. */
+#define EMIT_OPCODE(oper,nopcon,opcon,increment) \
+   *code = astGrow( *code, *ncode + 2, sizeof( int ) ); \
+   *con = astGrow( *con, *ncon + (nopcon) + 1, sizeof( double ) ); \
+   if ( astOK ) { \
+      ( *code )[ ++( *ncode ) ] = (int) (oper); \
+      for ( icon = 0; icon < (nopcon); icon++ ) { \
+         ( *con )[ ( *ncon )++ ] = (opcon)[ icon ]; \
+      } \
+      *depth += (increment); \
+      if ( *depth > *stacksize ) *stacksize = *depth; \
+   }
+
+/* Obtain a pointer to the node. */
+   node = nodes + inode;
+
+/* If the node's value is already held in a variable, load it. */
+   if ( node->home >= 0 ) {
+      var = (double) node->home;
+      EMIT_OPCODE( OP_LDVAR, 1, &var, 1 )
+
+/* Otherwise, see if the node is an addition or subtraction one of whose
+   arguments is a multiplication that is not used elsewhere. If so,
+   evaluate the arguments of the multiplication in place of the product,
+   preserving the original order of evaluation, and note the fused
+   opcode to use. */
+   } else {
+      opcode = node->opcode;
+      prod = NULL;
+      if ( opcode == OP_ADD || opcode == OP_SUB ) {
+         if ( nodes[ node->arg[ 0 ] ].opcode == OP_MUL &&
+              nodes[ node->arg[ 0 ] ].nuse == 1 ) {
+            prod = nodes + node->arg[ 0 ];
+            EmitNode( nodes, prod->arg[ 0 ], 0, tmpvar, code, ncode, con,
+                      ncon, depth, stacksize, ntmp, status );
+            EmitNode( nodes, prod->arg[ 1 ], 0, tmpvar, code, ncode, con,
+                      ncon, depth, stacksize, ntmp, status );
+            EmitNode( nodes, node->arg[ 1 ], 0, tmpvar, code, ncode, con,
+                      ncon, depth, stacksize, ntmp, status );
+            opcode = ( opcode == OP_ADD ) ? OP_MULADD : OP_MULSUB;
+
+         } else if ( nodes[ node->arg[ 1 ] ].opcode == OP_MUL &&
+                     nodes[ node->arg[ 1 ] ].nuse == 1 ) {
+            prod = nodes + node->arg[ 1 ];
+            EmitNode( nodes, node->arg[ 0 ], 0, tmpvar, code, ncode, con,
+                      ncon, depth, stacksize, ntmp, status );
+            EmitNode( nodes, prod->arg[ 0 ], 0, tmpvar, code, ncode, con,
+                      ncon, depth, stacksize, ntmp, status );
+            EmitNode( nodes, prod->arg[ 1 ], 0, tmpvar, code, ncode, con,
+                      ncon, depth, stacksize, ntmp, status );
+            opcode = ( opcode == OP_ADD ) ? OP_ADDMUL : OP_SUBMUL;
+         }
+      }
+
+/* Emit the opcode, preceded by the opcodes for its arguments if they
+   have not been emitted above. A fused opcode replaces three stack
+   elements with one. */
+      if ( prod ) {
+         EMIT_OPCODE( opcode, node->ncon, node->con, -2 )
+      } else {
+         for ( iarg = 0; iarg < node->narg; iarg++ ) {
+            EmitNode( nodes, node->arg[ iarg ], 0, tmpvar, code, ncode, con,
+                      ncon, depth, stacksize, ntmp, status );
+         }
+         EMIT_OPCODE( opcode, node->ncon, node->con, 1 - node->narg )
+      }
+
+/* If the value of a node with arguments is used more than once, store
+   it in a new temporary variable and note that it should be loaded from
+   there in future. */
+      if ( !root && node->nuse > 1 && node->narg > 0 && astOK ) {
+         node->home = tmpvar + ( *ntmp )++;
+         var = (double) node->home;
+         EMIT_OPCODE( OP_STO, 1, &var, 0 )
+      }
+   }
+
+/* Undefine macros local to this function. */
+#undef EMIT_OPCODE
+}
+
 static int Equal( AstObject *this_object, AstObject *that_object, int *status ) {
 /*
 *  Name:
@@ -1614,9 +1902,11 @@ static int Equal( AstObject *this_object, AstObject *that_object, int *status )
    int icode;                 /* Opcode index */
    int icon;                  /* Constant index */
    int ifun;                  /* Function index */
+   int jcon;                  /* Constant index for current opcode */
    int ncode;                 /* No. of opcodes for current "this" function */
    int ncode_that;            /* No. of opcodes for current "that" function */
    int nin;                   /* Number of inputs */
+   int nopcon;                /* No. of constants for current opcode */
    int nout;                  /* Number of outputs */
    int pass;                  /* Check fwd or inv */
    int result;                /* Result value to return */
@@ -1714,24 +2004,34 @@ static int Equal( AstObject *this_object, AstObject *that_object, int *status )
 
 /* Compare the following opcodes. Some opcodes consume constants from the
    list of constants associated with the MathMap. Compare the constants
-   for such opcodes. */
+   for such opcodes. OP_POLY consumes a count of coefficients followed by
+   the coefficients themselves. */
                icon = 0;
-               for( icode = 0; icode < ncode && result; icode++ ){
+               for( icode = 1; icode <= ncode && result; icode++ ){
                   code = this_code[ ifun ][ icode ];
                   if( that_code[ ifun ][ icode ] != code ) {
                      result = 0;
 
-                  } else if( code == OP_LDCON ||
-                             code == OP_LDVAR ||
-                             code == OP_MAX ||
-                             code == OP_MIN ) {
-
-                     if( this_con[ ifun ][ icon ] !=
-                         that_con[ ifun ][ icon ] ) {
-                        result = 0;
+                  } else {
+                     if( code == OP_LDCON ||
+                         code == OP_LDVAR ||
+                         code == OP_MAX ||
+                         code == OP_MIN ||
+                         code == OP_POWI ||
+                         code == OP_STO ) {
+                        nopcon = 1;
+                     } else if( code == OP_POLY ) {
+                        nopcon = (int) ( this_con[ ifun ][ icon ] + 0.5 ) + 1;
                      } else {
-                        icon++;
+                        nopcon = 0;
+                     }
+
+                     for( jcon = icon; jcon < icon + nopcon && result;
+                          jcon++ ) {
+                        if( this_con[ ifun ][ jcon ] !=
+                            that_con[ ifun ][ jcon ] ) result = 0;
                      }
+                     icon += nopcon;
                   }
                }
             }
@@ -1788,7 +2088,9 @@ static void EvaluateFunction( Rcontext *rcontext, int npoint,
 *        Pointer to an array of pointers to arrays of double (with "npoint"
 *        elements). These arrays should contain the input coordinate values,
 *        such that coordinate number "coord" for point number "point" can be
-*        found in "ptr_in[coord][point]".
+*        found in "ptr_in[coord][point]". Any arrays that receive the
+*        values of shared sub-expressions (stored by the OP_STO opcode)
+*        should follow the arrays of input coordinate values.
 *     code
 *        Pointer to an array of int containing the set of opcodes (cast to int)
 *        for the operations to be performed. The first element of this array
@@ -1828,6 +2130,7 @@ static void EvaluateFunction( Rcontext *rcontext, int npoint,
       1UL << ( bits - 1 );
 
 /* Local Variables: */
+   const double *coeff;          /* Pointer to polynomial coefficients */
    double **stack;               /* Array of pointers to stack elements */
    double *work;                 /* Pointer to stack workspace */
    double *xv1;                  /* Pointer to first argument vector */
@@ -2118,6 +2421,49 @@ static void EvaluateFunction( Rcontext *rcontext, int npoint,
 /* Break out of the "case" block. */ \
       break;
 
+/* Three-argument operation. */
+/* ------------------------- */
+/* This macro is similar in function to ARG_3B above, except that the
+   result is bad if any of the arguments is bad. */
+#define ARG_3(oper,function) \
+\
+/* Test for the required opcode value. */ \
+   case oper: \
+\
+/* Obtain pointers to the top three stack elements (vectors), decreasing \
+   the top of stack index by two. */ \
+      xv3 = stack[ tos-- ]; \
+      xv2 = stack[ tos-- ]; \
+      xv1 = stack[ tos ]; \
+\
+/* Loop to access each vector element, obtaining the value of the \
+   first argument and checking that it is not bad. */ \
+      for ( point = 0; point < npoint; point++ ) { \
+         if ( ( x1 = xv1[ point ] ) != AST__BAD ) { \
+\
+/* Also obtain a pointer to the element which is to receive the \
+   result. */ \
+            y = xv1 + point; \
+\
+/* Obtain the values of the second and third arguments, again checking \
+   that they are not bad. */ \
+            if ( ( ( x2 = xv2[ point ] ) != AST__BAD ) && \
+                 ( ( x3 = xv3[ point ] ) != AST__BAD ) ) { \
+\
+/* Perform the processing, which uses the three argument values and then \
+   assigns the result to the appropriate top of stack element. */ \
+               {function;} \
+\
+/* If the second or third argument was bad, so is the result. */ \
+            } else { \
+               *y = AST__BAD; \
+            } \
+         } \
+      } \
+\
+/* Break out of the "case" block. */ \
+      break;
+
 /* Define arithmetic operations. */
 /* ============================= */
 /* We now define macros for performing some of the arithmetic
@@ -2720,6 +3066,80 @@ static void EvaluateFunction( Rcontext *rcontext, int npoint,
             ARG_2( OP_EQV,      *y = ( ( x1 != 0.0 ) == ( x2 != 0.0 ) ) )
             ARG_2B( OP_OR,      *y = TRISTATE_OR( x1, x2 ) )
             ARG_2( OP_XOR,      *y = ( ( x1 != 0.0 ) != ( x2 != 0.0 ) ) )
+
+/* Operations generated by the optimiser. */
+/* -------------------------------------- */
+/* These combine a multiplication with a following addition or
+   subtraction. The two operations are performed separately, in the
+   same way as the unfused opcodes, so the results are identical. */
+            ARG_3( OP_ADDMUL,   result = SAFE_MUL( x2, x3 );
+                                *y = ( result == AST__BAD ) ?
+                                     AST__BAD : SAFE_ADD( x1, result ) )
+            ARG_3( OP_MULADD,   result = SAFE_MUL( x1, x2 );
+                                *y = ( result == AST__BAD ) ?
+                                     AST__BAD : SAFE_ADD( result, x3 ) )
+            ARG_3( OP_MULSUB,   result = SAFE_MUL( x1, x2 );
+                                *y = ( result == AST__BAD ) ?
+                                     AST__BAD : SAFE_SUB( result, x3 ) )
+            ARG_3( OP_SUBMUL,   result = SAFE_MUL( x2, x3 );
+                                *y = ( result == AST__BAD ) ?
+                                     AST__BAD : SAFE_SUB( x1, result ) )
+
+/* Evaluate a polynomial in the top of stack element using Horner's
+   method. The number of coefficients is obtained by consuming a
+   constant, and the coefficients themselves (highest power first) are
+   the constants which follow. */
+            case OP_POLY:
+               narg = (int) ( con[ icon++ ] + 0.5 );
+               coeff = con + icon;
+               icon += narg;
+               xv = stack[ tos ];
+               for ( point = 0; point < npoint; point++ ) {
+                  if ( ( x = xv[ point ] ) != AST__BAD ) {
+                     result = coeff[ 0 ];
+                     for ( iarg = 1; iarg < narg; iarg++ ) {
+                        result = SAFE_MUL( result, x );
+                        if ( result == AST__BAD ) break;
+                        result = SAFE_ADD( result, coeff[ iarg ] );
+                        if ( result == AST__BAD ) break;
+                     }
+                     xv[ point ] = result;
+                  }
+               }
+               break;
+
+/* Raise the top of stack element to a positive integer power (obtained
+   by consuming a constant) by repeated squaring. */
+            case OP_POWI:
+               narg = (int) ( con[ icon++ ] + 0.5 );
+               xv = stack[ tos ];
+               for ( point = 0; point < npoint; point++ ) {
+                  if ( ( x = xv[ point ] ) != AST__BAD ) {
+                     result = ( narg & 1 ) ? x : 1.0;
+                     for ( iarg = narg / 2; iarg; iarg /= 2 ) {
+                        x = SAFE_MUL( x, x );
+                        if ( x == AST__BAD ) {
+                           result = AST__BAD;
+                           break;
+                        } else if ( iarg & 1 ) {
+                           result = SAFE_MUL( result, x );
+                           if ( result == AST__BAD ) break;
+                        }
+                     }
+                     xv[ point ] = result;
+                  }
+               }
+               break;
+
+/* Store a copy of the top of stack element in the variable whose index
+   is obtained by consuming a constant, so that later expressions can
+   use it without re-evaluating it. The vectors that hold such
+   variables are supplied (through "ptr_in") by the caller. */
+            case OP_STO:
+               ivar = (int) ( con[ icon++ ] + 0.5 );
+               (void) memcpy( (double *) ptr_in[ ivar ], stack[ tos ],
+                              sizeof( double ) * (size_t) npoint );
+               break;
          }
       }
    }
@@ -2739,6 +3159,7 @@ static void EvaluateFunction( Rcontext *rcontext, int npoint,
 #undef DO_ARG_2
 #undef ARG_2
 #undef ARG_2B
+#undef ARG_3
 #undef ABS
 #undef INT
 #undef CATCH_MATHS_OVERFLOW
@@ -3852,6 +4273,129 @@ static double LogGamma( double x, int *status ) {
    return result;
 }
 
+static int MakeNode( ExprNode **nodes, int *nnode, Oper opcode, int narg,
+                     const int arg[], int ncon, const double con[],
+                     int *status ) {
+/*
+*  Name:
+*     MakeNode
+
+*  Purpose:
+*     Find or create a node in an expression graph.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mathmap.h"
+*     int MakeNode( ExprNode **nodes, int *nnode, Oper opcode, int narg,
+*                   const int arg[], int ncon, const double con[],
+*                   int *status )
+
+*  Class Membership:
+*     MathMap member function.
+
+*  Description:
+*     This function returns the index of a node in an expression graph
+*     which applies a given operation to a given set of arguments. If the
+*     result of the operation depends only on its arguments and an
+*     identical node already exists, the index of the existing node is
+*     returned, so that sub-expressions which appear more than once in
+*     the graph are represented by a single node. Otherwise, a new node
+*     is appended to the graph.
+
+*  Parameters:
+*     nodes
+*        Address of a pointer to a dynamically allocated array holding the
+*        nodes in the graph. The array is extended if a new node is
+*        required and the pointer updated.
+*     nnode
+*        Pointer to an int holding the number of nodes in the graph. It is
+*        incremented if a new node is appended.
+*     opcode
+*        The operation code.
+*     narg
+*        The number of arguments.
+*     arg
+*        Array holding the indices of the "narg" argument nodes.
+*     ncon
+*        The number of constants consumed by the operation.
+*     con
+*        Array holding the "ncon" constants.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     The index of the node.
+
+*  Notes:
+*     - A value of -1 will be returned if this function is invoked with
+*     the global error status set, or if it should fail for any reason.
+*/
+
+/* Local Variables: */
+   ExprNode *node;               /* Pointer to node */
+   int iarg;                     /* Loop counter for arguments */
+   int inode;                    /* Loop counter for nodes */
+   int pure;                     /* Result depends only on the arguments? */
+   int result;                   /* Returned node index */
+
+/* Initialise. */
+   result = -1;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* The random number functions give a different result each time they
+   are evaluated, as does any operation which uses their results. */
+   pure = ( opcode != OP_GAUSS && opcode != OP_POISS && opcode != OP_RAND );
+   for ( iarg = 0; iarg < narg; iarg++ ) {
+      if ( !( *nodes )[ arg[ iarg ] ].pure ) pure = 0;
+   }
+
+/* If the result depends only on the arguments, search for an existing
+   node which applies the same operation to the same arguments. The
+   constants are compared bit by bit so that (for instance) 0.0 and -0.0
+   are treated as different values. */
+   if ( pure ) {
+      for ( inode = 0; inode < *nnode; inode++ ) {
+         node = *nodes + inode;
+         if ( node->pure && ( node->opcode == opcode ) &&
+              ( node->narg == narg ) && ( node->ncon == ncon ) &&
+              ( !narg || !memcmp( node->arg, arg,
+                                  sizeof( int ) * (size_t) narg ) ) &&
+              ( !ncon || !memcmp( node->con, con,
+                                  sizeof( double ) * (size_t) ncon ) ) ) {
+            result = inode;
+            break;
+         }
+      }
+   }
+
+/* If no suitable node was found, extend the array of nodes and
+   initialise a new one. */
+   if ( result == -1 ) {
+      *nodes = astGrow( *nodes, *nnode + 1, sizeof( ExprNode ) );
+      if ( astOK ) {
+         node = *nodes + ( *nnode )++;
+         node->opcode = opcode;
+         node->arg = narg ? astStore( NULL, arg,
+                                      sizeof( int ) * (size_t) narg ) : NULL;
+         node->con = ncon ? astStore( NULL, con,
+                                      sizeof( double ) * (size_t) ncon ) : NULL;
+         node->home = -1;
+         node->narg = narg;
+         node->ncon = ncon;
+         node->nuse = 0;
+         node->pure = pure;
+         if ( astOK ) result = *nnode - 1;
+      }
+   }
+
+/* Return the result. */
+   return result;
+}
+
 static int MapMerge( AstMapping *this, int where, int series, int *nmap,
                      AstMapping ***map_list, int **invert_list, int *status ) {
 /*
@@ -4164,6 +4708,415 @@ static int MapMerge( AstMapping *this, int where, int series, int *nmap,
    return result;
 }
 
+static void OptimiseFunctions( int nvar, int nfun, int **code, double **con,
+                               int *stacksize, int *ntmp, int *status ) {
+/*
+*  Name:
+*     OptimiseFunctions
+
+*  Purpose:
+*     Optimise the compiled functions for one direction of a MathMap.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mathmap.h"
+*     void OptimiseFunctions( int nvar, int nfun, int **code, double **con,
+*                             int *stacksize, int *ntmp, int *status )
+
+*  Class Membership:
+*     MathMap member function.
+
+*  Description:
+*     This function replaces the opcodes and constants produced by
+*     CompileExpression for each of the functions which implement one
+*     direction of a MathMap's transformation with an equivalent set that
+*     may be evaluated more efficiently. The functions are first
+*     converted into a single graph in which identical sub-expressions
+*     are represented by a single node, and in which the following
+*     changes are made:
+*
+*     - Sub-expressions whose arguments are all constant are evaluated
+*     and replaced by their values.
+*     - Raising to a constant positive integer power, and multiplying a
+*     value by itself, use the specialised OP_SQR and OP_POWI opcodes.
+*     - Sums of terms which form a polynomial with constant coefficients
+*     in a single sub-expression use the OP_POLY opcode.
+*
+*     Opcodes are then generated from the graph. The value of any
+*     sub-expression which is used more than once (in the same function
+*     or in different functions) is stored in a temporary variable
+*     using the OP_STO opcode when it is first evaluated, and simply
+*     loaded thereafter. Multiplications followed by an addition or
+*     subtraction are combined into a single opcode.
+
+*  Parameters:
+*     nvar
+*        The number of variables available to the first function (i.e.
+*        the number of input coordinates for this direction).
+*     nfun
+*        The number of functions.
+*     code
+*        Pointer to an array of "nfun" pointers to the dynamically
+*        allocated opcode arrays for each function, as produced by
+*        CompileExpression. On exit, each array will have been replaced
+*        by one holding the optimised opcodes.
+*     con
+*        Pointer to an array of "nfun" pointers to the dynamically
+*        allocated arrays of constants for each function, as produced by
+*        CompileExpression. On exit, each array will have been replaced
+*        by one holding the constants for the optimised opcodes.
+*     stacksize
+*        Pointer to an int in which to return the evaluation stack size
+*        required by the optimised functions.
+*     ntmp
+*        Pointer to an int in which to return the number of temporary
+*        variables required. When the functions are evaluated, arrays
+*        for these variables should be supplied following those for the
+*        input coordinates and the "nfun" function results.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Notes:
+*     - Sub-expressions are evaluated in the same order as in the
+*     original opcodes, and most of the changes above deliver identical
+*     results. However, integer powers and polynomials are evaluated
+*     using multiplication rather than the C "pow" function, and using
+*     Horner's method, so their results may differ in the last few bits.
+*/
+
+/* Local Variables: */
+   ExprNode *nodes;              /* Array of nodes in the graph */
+   Oper opcode;                  /* Opcode value */
+   double *newcon;               /* Optimised constants for a function */
+   int *newcode;                 /* Optimised opcodes for a function */
+   int *root;                    /* Index of node giving each function */
+   int *stack;                   /* Stack of node indices */
+   int depth;                    /* Current evaluation stack size */
+   int icode;                    /* Loop counter for opcodes */
+   int icon;                     /* Counter for constants used */
+   int ifun;                     /* Loop counter for functions */
+   int inode;                    /* Index of node */
+   int isym;                     /* Loop counter for symbols */
+   int narg;                     /* Number of arguments for an opcode */
+   int ncode;                    /* Number of optimised opcodes */
+   int ncon;                     /* Number of optimised constants */
+   int nnode;                    /* Number of nodes in the graph */
+   int nopcon;                   /* Number of constants for an opcode */
+   int tos;                      /* Top of stack index */
+
+/* Initialise. */
+   *stacksize = 0;
+   *ntmp = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Further initialisation. */
+   nodes = NULL;
+   nnode = 0;
+   stack = NULL;
+   root = astMalloc( sizeof( int ) * (size_t) nfun );
+
+/* Build the graph. */
+/* ---------------- */
+/* Loop through the opcodes for each function, simulating their
+   evaluation on a stack which holds node indices. */
+   for ( ifun = 0; astOK && ( ifun < nfun ); ifun++ ) {
+      icon = 0;
+      tos = -1;
+      for ( icode = 1; astOK && ( icode <= code[ ifun ][ 0 ] ); icode++ ) {
+         opcode = (Oper) code[ ifun ][ icode ];
+         if ( opcode == OP_NULL ) continue;
+
+/* Determine how many constants the opcode consumes and how many
+   arguments it takes. For functions with a variable number of
+   arguments, the argument count is the constant. Otherwise, it is
+   determined by the change in stack size given in the symbol data. */
+         nopcon = ( opcode == OP_LDCON || opcode == OP_LDVAR ||
+                    opcode == OP_MAX || opcode == OP_MIN );
+         if ( opcode == OP_MAX || opcode == OP_MIN ) {
+            narg = (int) ( con[ ifun ][ icon ] + 0.5 );
+         } else {
+            for ( isym = 0; symbol[ isym ].opcode != opcode; isym++ );
+            narg = 1 - symbol[ isym ].stackincrement;
+         }
+
+/* Obtain the node which applies the operation to the nodes on the top
+   of the stack, and replace them with it. */
+         inode = OptimiseNode( &nodes, &nnode, opcode, narg,
+                               stack + tos + 1 - narg, nopcon,
+                               con[ ifun ] + icon, status );
+         icon += nopcon;
+         tos -= narg - 1;
+         stack = astGrow( stack, tos + 1, sizeof( int ) );
+         if ( astOK ) stack[ tos ] = inode;
+      }
+
+/* The final node gives the function's value. */
+      if ( astOK ) root[ ifun ] = stack[ 0 ];
+   }
+
+/* Count the references to each node. */
+   if ( astOK ) {
+      for ( ifun = 0; ifun < nfun; ifun++ ) {
+         CountUses( nodes, root[ ifun ], status );
+      }
+   }
+
+/* Generate the optimised opcodes. */
+/* ------------------------------- */
+/* Loop to generate the opcodes and constants for each function in
+   turn, allocating temporary variables (following the input and
+   function variables) as required. */
+   for ( ifun = 0; astOK && ( ifun < nfun ); ifun++ ) {
+      newcode = NULL;
+      newcon = NULL;
+      ncode = 0;
+      ncon = 0;
+      depth = 0;
+      EmitNode( nodes, root[ ifun ], 1, nvar + nfun, &newcode, &ncode,
+                &newcon, &ncon, &depth, stacksize, ntmp, status );
+
+/* Later functions can obtain the value of this function's final node
+   from the variable it assigns. */
+      if ( nodes[ root[ ifun ] ].home < 0 && nodes[ root[ ifun ] ].narg ) {
+         nodes[ root[ ifun ] ].home = nvar + ifun;
+      }
+
+/* If OK, store the opcode count and replace the original arrays. */
+      if ( astOK ) {
+         newcode[ 0 ] = ncode;
+         code[ ifun ] = astFree( code[ ifun ] );
+         code[ ifun ] = astRealloc( newcode, sizeof( int ) *
+                                             (size_t) ( ncode + 1 ) );
+         con[ ifun ] = astFree( con[ ifun ] );
+         if ( ncon ) {
+            con[ ifun ] = astRealloc( newcon, sizeof( double ) *
+                                              (size_t) ncon );
+         } else {
+            newcon = astFree( newcon );
+         }
+
+/* Otherwise, free the new arrays. */
+      } else {
+         newcode = astFree( newcode );
+         newcon = astFree( newcon );
+      }
+   }
+
+/* Free the workspace. */
+   if ( nodes ) {
+      for ( inode = 0; inode < nnode; inode++ ) {
+         nodes[ inode ].arg = astFree( nodes[ inode ].arg );
+         nodes[ inode ].con = astFree( nodes[ inode ].con );
+      }
+      nodes = astFree( nodes );
+   }
+   root = astFree( root );
+   stack = astFree( stack );
+
+/* If an error occurred, reset the returned values. */
+   if ( !astOK ) {
+      *stacksize = 0;
+      *ntmp = 0;
+   }
+}
+
+static int OptimiseNode( ExprNode **nodes, int *nnode, Oper opcode,
+                         int narg, const int arg[], int ncon,
+                         const double con[], int *status ) {
+/*
+*  Name:
+*     OptimiseNode
+
+*  Purpose:
+*     Add an operation to an expression graph, simplifying it if possible.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mathmap.h"
+*     int OptimiseNode( ExprNode **nodes, int *nnode, Oper opcode,
+*                       int narg, const int arg[], int ncon,
+*                       const double con[], int *status )
+
+*  Class Membership:
+*     MathMap member function.
+
+*  Description:
+*     This function returns the index of a node in an expression graph
+*     which evaluates a given operation applied to a given set of
+*     argument nodes. Where possible, the operation is replaced by a
+*     simpler equivalent. In particular:
+*
+*     - If all the arguments are constant (and the operation does not
+*     generate random numbers), the operation is evaluated and a node
+*     which loads the resulting constant is returned.
+*     - Raising to a constant positive integer power uses the OP_SQR or
+*     OP_POWI opcode.
+*     - Multiplying a value by itself uses the OP_SQR opcode.
+*     - An addition or subtraction which completes a polynomial of
+*     degree two or more with constant coefficients uses the OP_POLY
+*     opcode.
+
+*  Parameters:
+*     nodes
+*        Address of a pointer to a dynamically allocated array holding the
+*        nodes in the graph. The array is extended if a new node is
+*        required and the pointer updated.
+*     nnode
+*        Pointer to an int holding the number of nodes in the graph. It is
+*        updated if new nodes are appended.
+*     opcode
+*        The operation code.
+*     narg
+*        The number of arguments.
+*     arg
+*        Array holding the indices of the "narg" argument nodes.
+*     ncon
+*        The number of constants consumed by the operation.
+*     con
+*        Array holding the "ncon" constants.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     The index of the node.
+
+*  Notes:
+*     - A value of -1 will be returned if this function is invoked with
+*     the global error status set, or if it should fail for any reason.
+*/
+
+/* Local Variables: */
+   double *fcon;                 /* Constants for evaluating the operation */
+   double coeff[ MAX_POWER + 1 ]; /* Polynomial coefficients */
+   double pcon[ MAX_POWER + 2 ]; /* Constants for OP_POLY opcode */
+   double power;                 /* Constant power */
+   double value;                 /* Constant value of operation */
+   int *fcode;                   /* Opcodes for evaluating the operation */
+   int base;                     /* Index of polynomial argument node */
+   int iarg;                     /* Loop counter for arguments */
+   int icon;                     /* Loop counter for constants */
+   int ideg;                     /* Loop counter for polynomial terms */
+   int isconst;                  /* Are all arguments constant? */
+   int ndeg;                     /* Degree of polynomial */
+   int nterm;                    /* Number of non-zero polynomial terms */
+   int result;                   /* Returned node index */
+
+/* Initialise. */
+   result = -1;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Constant folding. */
+/* ----------------- */
+/* See if the operation can be evaluated now. This requires that it
+   does not load a variable or generate a random number, and that all its
+   arguments are constants. */
+   isconst = ( opcode != OP_LDCON && opcode != OP_LDVAR &&
+               opcode != OP_GAUSS && opcode != OP_POISS &&
+               opcode != OP_RAND );
+   for ( iarg = 0; isconst && ( iarg < narg ); iarg++ ) {
+      isconst = ( ( *nodes )[ arg[ iarg ] ].opcode == OP_LDCON );
+   }
+
+/* If so, construct opcodes which load the argument values and apply
+   the operation, and evaluate them at a single point. Using
+   EvaluateFunction ensures that the value is exactly the same as would
+   be obtained when evaluating the original expression. */
+   if ( isconst ) {
+      fcode = astMalloc( sizeof( int ) * (size_t) ( narg + 2 ) );
+      fcon = astMalloc( sizeof( double ) * (size_t) ( narg + ncon + 1 ) );
+      if ( astOK ) {
+         fcode[ 0 ] = narg + 1;
+         for ( iarg = 0; iarg < narg; iarg++ ) {
+            fcode[ iarg + 1 ] = (int) OP_LDCON;
+            fcon[ iarg ] = ( *nodes )[ arg[ iarg ] ].con[ 0 ];
+         }
+         fcode[ narg + 1 ] = (int) opcode;
+         for ( icon = 0; icon < ncon; icon++ ) {
+            fcon[ narg + icon ] = con[ icon ];
+         }
+         EvaluateFunction( NULL, 1, NULL, fcode, fcon, narg ? narg : 1,
+                           &value, status );
+
+/* Replace the operation with a node that loads the result. */
+         result = MakeNode( nodes, nnode, OP_LDCON, 0, NULL, 1, &value,
+                            status );
+      }
+      fcode = astFree( fcode );
+      fcon = astFree( fcon );
+
+/* Integer powers. */
+/* --------------- */
+/* Raising to the power one leaves the value unchanged, and squaring
+   uses OP_SQR. Other small positive integer powers use OP_POWI. */
+   } else if ( opcode == OP_POW &&
+               ( *nodes )[ arg[ 1 ] ].opcode == OP_LDCON &&
+               ( power = ( *nodes )[ arg[ 1 ] ].con[ 0 ] ) >= 1.0 &&
+               power <= (double) MAX_POWER && power == floor( power ) ) {
+      if ( power == 1.0 ) {
+         result = arg[ 0 ];
+      } else if ( power == 2.0 ) {
+         result = OptimiseNode( nodes, nnode, OP_SQR, 1, arg, 0, NULL,
+                                status );
+      } else {
+         result = MakeNode( nodes, nnode, OP_POWI, 1, arg, 1, &power,
+                            status );
+      }
+
+/* A value multiplied by itself is squared. */
+   } else if ( opcode == OP_MUL && ( arg[ 0 ] == arg[ 1 ] ) ) {
+      result = MakeNode( nodes, nnode, OP_SQR, 1, arg, 0, NULL, status );
+
+/* Polynomials. */
+/* ------------ */
+/* Otherwise, for an addition or subtraction, see if the terms being
+   combined (including those of any sums or polynomials among the
+   arguments) form a polynomial in a single node. */
+   } else if ( opcode == OP_ADD || opcode == OP_SUB ) {
+      for ( ideg = 0; ideg <= MAX_POWER; ideg++ ) coeff[ ideg ] = 0.0;
+      base = -1;
+      ndeg = 0;
+      if ( PolyTerms( *nodes, arg[ 0 ], 1.0, &base, coeff, &ndeg, status ) &&
+           PolyTerms( *nodes, arg[ 1 ], ( opcode == OP_ADD ) ? 1.0 : -1.0,
+                      &base, coeff, &ndeg, status ) ) {
+
+/* Only use OP_POLY for polynomials of degree two or more with at least
+   two non-zero terms (others are adequately handled by the multiply-add
+   opcodes). Store the number of coefficients, followed by the
+   coefficients in order of decreasing power. */
+         nterm = 0;
+         for ( ideg = 0; ideg <= ndeg; ideg++ ) {
+            if ( coeff[ ideg ] != 0.0 ) nterm++;
+         }
+         if ( ndeg >= 2 && nterm >= 2 ) {
+            pcon[ 0 ] = (double) ( ndeg + 1 );
+            for ( ideg = 0; ideg <= ndeg; ideg++ ) {
+               pcon[ ideg + 1 ] = coeff[ ndeg - ideg ];
+            }
+            result = MakeNode( nodes, nnode, OP_POLY, 1, &base, ndeg + 2,
+                               pcon, status );
+         }
+      }
+   }
+
+/* If the operation has not been simplified, simply add it to the
+   graph. */
+   if ( result == -1 && astOK ) {
+      result = MakeNode( nodes, nnode, opcode, narg, arg, ncon, con,
+                         status );
+   }
+
+/* Return the result. */
+   return result;
+}
+
 static void ParseConstant( const char *method, const char *class,
                            const char *exprs, int istart, int *iend,
                            double *con, int *status ) {
@@ -4749,6 +5702,181 @@ static double Poisson( Rcontext *context, double mean, int *status ) {
    return result;
 }
 
+static int PolyTerms( const ExprNode *nodes, int inode, double sign,
+                      int *base, double coeff[], int *ndeg, int *status ) {
+/*
+*  Name:
+*     PolyTerms
+
+*  Purpose:
+*     Extract the terms of a polynomial from an expression graph.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "mathmap.h"
+*     int PolyTerms( const ExprNode *nodes, int inode, double sign,
+*                    int *base, double coeff[], int *ndeg, int *status )
+
+*  Class Membership:
+*     MathMap member function.
+
+*  Description:
+*     This function determines whether a node in an expression graph
+*     represents a sum of terms, each of which is either a constant or a
+*     constant multiple of a positive integer power of a single "base"
+*     node. If so, the coefficient of each term is added into an array of
+*     polynomial coefficients.
+*
+*     Sums, differences and negations are handled by invoking this
+*     function recursively on their arguments. Nodes which use the
+*     OP_POLY opcode contribute all their coefficients.
+
+*  Parameters:
+*     nodes
+*        Pointer to the array of nodes in the graph.
+*     inode
+*        Index of the node to be examined.
+*     sign
+*        The factor (+1.0 or -1.0) by which the node is multiplied in
+*        the polynomial.
+*     base
+*        Pointer to an int holding the index of the base node. This should
+*        be -1 on the first invocation, in which case it is set to the
+*        base of the first non-constant term found. Subsequent terms must
+*        use the same base node.
+*     coeff
+*        Array with (MAX_POWER+1) elements holding the polynomial
+*        coefficients, with the coefficient of power "i" in element "i".
+*        These should be zero on the first invocation.
+*     ndeg
+*        Pointer to an int holding the highest power found so far. It is
+*        updated if a higher power is found.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Non-zero if the node is a polynomial in the base node. Zero is
+*     returned if it is not, or if any constant is bad, or if two non-zero
+*     terms have the same power (combining them would change the
+*     rounding of the result).
+
+*  Notes:
+*     - A value of zero will be returned if this function is invoked
+*     with the global error status set.
+*/
+
+/* Local Variables: */
+   const ExprNode *node;         /* Pointer to node */
+   const ExprNode *term;         /* Pointer to node raised to a power */
+   double c;                     /* Coefficient of term */
+   int deg;                      /* Power of term */
+   int icoeff;                   /* Loop counter for coefficients */
+   int result;                   /* Returned value */
+   int termbase;                 /* Index of base node for term */
+
+/* Check the global error status. */
+   if ( !astOK ) return 0;
+
+/* Obtain a pointer to the node. */
+   node = nodes + inode;
+
+/* Sums, differences and negations. */
+/* -------------------------------- */
+   if ( node->opcode == OP_ADD ) {
+      result = PolyTerms( nodes, node->arg[ 0 ], sign, base, coeff, ndeg,
+                          status ) &&
+               PolyTerms( nodes, node->arg[ 1 ], sign, base, coeff, ndeg,
+                          status );
+
+   } else if ( node->opcode == OP_SUB ) {
+      result = PolyTerms( nodes, node->arg[ 0 ], sign, base, coeff, ndeg,
+                          status ) &&
+               PolyTerms( nodes, node->arg[ 1 ], -sign, base, coeff, ndeg,
+                          status );
+
+   } else if ( node->opcode == OP_NEG ) {
+      result = PolyTerms( nodes, node->arg[ 0 ], -sign, base, coeff, ndeg,
+                          status );
+
+/* Existing polynomials. */
+/* --------------------- */
+/* Check that the base node is the same and add in each coefficient
+   (these are stored in order of decreasing power, following their
+   count). */
+   } else if ( node->opcode == OP_POLY ) {
+      result = ( *base == -1 || *base == node->arg[ 0 ] );
+      *base = node->arg[ 0 ];
+      deg = (int) ( node->con[ 0 ] + 0.5 ) - 1;
+      for ( icoeff = 1; result && ( icoeff <= deg + 1 ); icoeff++ ) {
+         c = sign * node->con[ icoeff ];
+         if ( coeff[ deg + 1 - icoeff ] != 0.0 && c != 0.0 ) {
+            result = 0;
+         } else {
+            coeff[ deg + 1 - icoeff ] += c;
+         }
+      }
+      if ( deg > *ndeg ) *ndeg = deg;
+
+/* Single terms. */
+/* ------------- */
+/* Otherwise, the node must be a single term. Obtain its coefficient
+   and the node which is raised to a power, allowing for multiplication
+   by a constant on either side. */
+   } else {
+      result = 1;
+      c = sign;
+      term = node;
+      termbase = inode;
+      if ( node->opcode == OP_MUL ) {
+         if ( nodes[ node->arg[ 0 ] ].opcode == OP_LDCON ) {
+            c *= nodes[ node->arg[ 0 ] ].con[ 0 ];
+            result = ( nodes[ node->arg[ 0 ] ].con[ 0 ] != AST__BAD );
+            termbase = node->arg[ 1 ];
+         } else if ( nodes[ node->arg[ 1 ] ].opcode == OP_LDCON ) {
+            c *= nodes[ node->arg[ 1 ] ].con[ 0 ];
+            result = ( nodes[ node->arg[ 1 ] ].con[ 0 ] != AST__BAD );
+            termbase = node->arg[ 0 ];
+         }
+         term = nodes + termbase;
+      }
+
+/* Determine the power to which the base node is raised. A constant is
+   the zeroth power of any node. */
+      if ( term->opcode == OP_LDCON ) {
+         c *= term->con[ 0 ];
+         result = result && ( term->con[ 0 ] != AST__BAD );
+         deg = 0;
+      } else if ( term->opcode == OP_SQR ) {
+         termbase = term->arg[ 0 ];
+         deg = 2;
+      } else if ( term->opcode == OP_POWI ) {
+         termbase = term->arg[ 0 ];
+         deg = (int) ( term->con[ 0 ] + 0.5 );
+      } else {
+         deg = 1;
+      }
+
+/* Check the base node and add in the coefficient. */
+      if ( result && deg > 0 ) {
+         result = ( *base == -1 || *base == termbase );
+         *base = termbase;
+      }
+      if ( result ) {
+         if ( coeff[ deg ] != 0.0 && c != 0.0 ) {
+            result = 0;
+         } else {
+            coeff[ deg ] += c;
+            if ( deg > *ndeg ) *ndeg = deg;
+         }
+      }
+   }
+
+/* Return the result. */
+   return result;
+}
+
 static double Rand( Rcontext *context, int *status ) {
 /*
 *  Name:
@@ -5198,6 +6326,7 @@ static AstPointSet *Transform( AstMapping *map, AstPointSet *in,
    int ndata;                    /* Number of data pointer elements filled */
    int nfun;                     /* Number of functions to evaluate */
    int npoint;                   /* Number of points */
+   int ntmp;                     /* Number of temporary variables */
 
 /* Check the global error status. */
    if ( !astOK ) return NULL;
@@ -5237,17 +6366,22 @@ static AstPointSet *Transform( AstMapping *map, AstPointSet *in,
    calculated. */
    nfun = forward ? this->nfwd : this->ninv;
 
+/* Also obtain the number of temporary variables used to hold the
+   values of sub-expressions that are shared between functions. */
+   ntmp = forward ? this->fwdtmp : this->invtmp;
+
 /* If intermediate results are to be calculated, then allocate
-   workspace to hold them (each intermediate result being a vector of
-   "npoint" double values). */
-   if ( nfun > ncoord_out ) {
+   workspace to hold them and the temporary variables (each being a
+   vector of "npoint" double values). */
+   if ( nfun + ntmp > ncoord_out ) {
       work = astMalloc( sizeof( double) *
-                        (size_t) ( npoint * ( nfun - ncoord_out ) ) );
+                        (size_t) ( npoint * ( nfun + ntmp - ncoord_out ) ) );
    }
 
 /* Also allocate space for an array to hold pointers to the input
-   data, intermediate results and output data. */
-   data_ptr = astMalloc( sizeof( double * ) * (size_t) ( ncoord_in + nfun ) );
+   data, intermediate results, output data and temporary variables. */
+   data_ptr = astMalloc( sizeof( double * ) *
+                         (size_t) ( ncoord_in + nfun + ntmp ) );
 
 /* We now set up the "data_ptr" array to locate the data to be
    processed. */
@@ -5274,6 +6408,12 @@ static AstPointSet *Transform( AstMapping *map, AstPointSet *in,
          data_ptr[ ndata++ ] = ptr_out[ idata ];
       }
 
+/* Any temporary variables use the remainder of the workspace. */
+      for ( idata = 0; idata < ntmp; idata++ ) {
+         data_ptr[ ndata++ ] = work + ( ( nfun - ncoord_out + idata ) *
+                                        npoint );
+      }
+
 /* Perform coordinate transformation. */
 /* ---------------------------------- */
 /* Loop to evaluate each transformation function in turn. */
@@ -5299,7 +6439,7 @@ static AstPointSet *Transform( AstMapping *map, AstPointSet *in,
 /* Free the array of data pointers and any workspace allocated for
    intermediate results. */
    data_ptr = astFree( data_ptr );
-   if ( nfun > ncoord_out ) work = astFree( work );
+   if ( nfun + ntmp > ncoord_out ) work = astFree( work );
 
 /* If an error occurred, then return a NULL pointer. If no output
    PointSet was supplied, also delete any new one that may have been
@@ -7076,7 +8216,9 @@ AstMathMap *astInitMathMap_( void *mem, size_t size, int init,
    int **fwdcode;                /* Code for forward functions */
    int **invcode;                /* Code for inverse functions */
    int fwdstack;                 /* Stack size for forward functions */
+   int fwdtmp;                   /* Temporaries for forward functions */
    int invstack;                 /* Stack size for inverse functions */
+   int invtmp;                   /* Temporaries for inverse functions */
 
 /* Initialise. */
    new = NULL;
@@ -7136,7 +8278,7 @@ AstMathMap *astInitMathMap_( void *mem, size_t size, int init,
                       nfwd, (const char **) fwdfun,
                       ninv, (const char **) invfun,
                       &fwdcode, &invcode, &fwdcon, &invcon,
-                      &fwdstack, &invstack, status );
+                      &fwdstack, &invstack, &fwdtmp, &invtmp, status );
 
 /* Initialise a Mapping structure (the parent class) as the first
    component within the MathMap structure, allocating memory if
@@ -7173,6 +8315,8 @@ AstMathMap *astInitMathMap_( void *mem, size_t size, int init,
          new->invcon = invcon;
          new->fwdstack = fwdstack;
          new->invstack = invstack;
+         new->fwdtmp = fwdtmp;
+         new->invtmp = invtmp;
          new->nfwd = nfwd;
          new->ninv = ninv;
          new->simp_fi = -INT_MAX;
@@ -7400,7 +8544,8 @@ AstMathMap *astLoadMathMap_( void *mem, size_t size,
                             new->ninv, (const char **) new->invfun,
                             &new->fwdcode, &new->invcode,
                             &new->fwdcon, &new->invcon,
-                            &new->fwdstack, &new->invstack, status );
+                            &new->fwdstack, &new->invstack,
+                            &new->fwdtmp, &new->invtmp, status );
          }
 
 /* If an error occurred, clean up by deleting the new MathMap. */
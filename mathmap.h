@@ -153,6 +153,8 @@
 *        Original version.
 *     8-JAN-2003 (DSB):
 *        Added protected astInitMathMapVtab method.
+*     17-OCT-2026 (DSB):
+*        Added fwdtmp and invtmp components.
 *-
 */
 
@@ -228,7 +230,9 @@ typedef struct AstMathMap {
    int **fwdcode;                /* Array of opcodes for forward functions */
    int **invcode;                /* Array of opcodes for inverse functions */
    int fwdstack;                 /* Stack size required by forward functions */
+   int fwdtmp;                   /* No. of temporaries for forward functions */
    int invstack;                 /* Stack size required by inverse functions */
+   int invtmp;                   /* No. of temporaries for inverse functions */
    int nfwd;                     /* Number of forward functions */
    int ninv;                     /* Number of inverse functions */
    int simp_fi;                  /* Forward-inverse MathMap pairs simplify? */
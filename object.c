@@ -236,6 +236,15 @@ f     - AST_VERSION: Return the verson of the AST library being used.
 *        Add function astCreatedAt. This increases the size of a Handle
 *        structure by 20 bytes. If this turns out to be problematic
 *        this facility could be controlled using a configure option.
+*     17-OCT-2026 (DSB):
+*        Add the "MaxThreads" tuning parameter to astTune.
+*     17-OCT-2026 (DSB):
+*        Add the "KernelTable" tuning parameter to astTune.
+*     17-OCT-2026 (DSB):
+*        Add the "LeapFile" tuning parameter to astTuneC, and the
+*        protected function astTuneCGen.
+*     17-OCT-2026 (DSB):
+*        Add the "TDBInterp" tuning parameter to astTune.
 *class--
 */
 
@@ -314,6 +323,11 @@ static char dgdel[ MAXLEN_TUNEC ] = "%-%^53+%s60+o%+";
 static char amdel[ MAXLEN_TUNEC ] = "%-%^20+%s85+'%+";
 static char asdel[ MAXLEN_TUNEC ] = "%-%^20+%s85+\"%+";
 static char exdel[ MAXLEN_TUNEC ] = "10%-%^50+%s70+";
+static char leapfile[ MAXLEN_TUNEC ] = "";
+
+/* The number of times a new value has been stored for any character-valued
+   tuning parameter (see astTuneCGen). */
+static int tunec_gen = 0;
 
 /* A pointer full of zeros. */
 static AstObject *zero_ptr;
@@ -330,6 +344,27 @@ static AstObject *zero_ptr;
    caching is switched off via the astTune function. */
 static int object_caching = 0;
 
+/* The maximum number of threads that may be used by functions such as
+   astResample<X> that can divide their work up between a pool of worker
+   threads. This is controlled using the MaxThreads tuning parameter (see
+   astTune). A value of one (the default) means that all work is done by
+   the calling thread. */
+static int max_threads = 1;
+
+/* The number of decimal places of accuracy required in 1-dimensional
+   interpolation and spreading kernel values that are obtained by linear
+   interpolation within a cached table, rather than by evaluating the
+   kernel function directly. This is controlled using the KernelTable
+   tuning parameter (see astTune). A value of zero (the default) means
+   that kernel functions are always evaluated directly. */
+static int kernel_table = 0;
+
+/* A flag indicating if the TimeMap class may find TDB-TT by
+   interpolation between a grid of nodes, rather than by evaluating the
+   full series for every point. This is controlled using the TDBInterp
+   tuning parameter (see astTune). */
+static int tdb_interp = 0;
+
 /* Set up global data access, mutexes, etc, needed for thread safety. */
 #ifdef THREAD_SAFE
 
@@ -4237,6 +4272,53 @@ f        AST_DELETE).
 *        that it controls caching of all memory blocks of less than 300 bytes
 *        allocated by AST (whether for internal or external use), not just
 *        memory used to store AST Objects.
+*     MaxThreads
+*        The maximum number of threads that may be used to perform
+*        computationally intensive operations that can be divided into
+*        independent sections, such as
+c        astResample<X>, astRebin<X> and astRebinSeq<X>.
+f        AST_RESAMPLE<X>, AST_REBIN<X> and AST_REBINSEQ<X>.
+*        If this is greater than one, such operations will be shared
+*        between a pool of worker threads (created as needed and retained
+*        for re-use in subsequent calls). The results of resampling are
+*        identical to those produced when a single thread is used. The
+*        results of rebinning may differ by an amount comparable with the
+*        rounding error of the data type (see
+c        astRebin<X>). The default value
+f        AST_REBIN<X>). The default value
+*        is one, meaning that all work is performed by the calling thread.
+*        Values less than one are treated as one. Note, this tuning
+*        parameter is ignored if AST was built without support for POSIX
+*        threads.
+*     KernelTable
+*        Controls the evaluation of the 1-dimensional kernel functions
+*        used by the AST__SINC, AST__SINCSINC, AST__SINCCOS,
+*        AST__SINCGAUSS, AST__SOMB, AST__SOMBCOS and AST__GAUSS schemes
+c        within astResample<X>, astRebin<X> and astRebinSeq<X>.
+f        within AST_RESAMPLE<X>, AST_REBIN<X> and AST_REBINSEQ<X>.
+*        If this is zero (the default), the kernel function is evaluated
+*        directly for every contributing pixel. If it is greater than
+*        zero, kernel values are instead found by linear interpolation
+*        within a table of kernel values. The table is sampled finely
+*        enough to give an absolute error in each kernel value of no
+*        more than 10 to the power of minus KernelTable (the value is
+*        limited to a maximum of 12), and is retained for re-use by
+*        subsequent calls that use the same kernel. If the required
+*        accuracy cannot be achieved using a table of reasonable size,
+*        the kernel function is evaluated directly. Values less than
+*        zero are treated as zero.
+*     TDBInterp
+*        A boolean flag which controls how TimeMaps convert between the
+*        TT and TDB timescales. If it is zero (the default), the series
+*        giving TDB-TT is evaluated separately for every point. If it is
+*        non-zero, and the points being transformed are closely spaced
+*        in time, the geocentric part of the series is instead evaluated
+*        at nodes spaced half a day apart covering the range of the
+*        points, and cubic interpolation is used to find the value at
+*        each point. The topocentric part is still evaluated directly.
+*        The interpolation error is less than 0.01 nanoseconds for epochs
+*        between 1500 and 2500. This can greatly speed up the conversion
+*        of long, densely sampled time series.
 
 *  Notes:
 c     - This function attempts to execute even if the AST error
@@ -4266,6 +4348,21 @@ f     error value
       } else if( astChrMatch( name, "MemoryCaching" ) ) {
          result = astMemCaching( value );
 
+      } else if( astChrMatch( name, "MaxThreads" ) ) {
+         result = max_threads;
+         if( value != AST__TUNULL ) max_threads = ( value > 1 ) ? value : 1;
+
+      } else if( astChrMatch( name, "KernelTable" ) ) {
+         result = kernel_table;
+         if( value != AST__TUNULL ) {
+            kernel_table = ( value > 0 ) ? value : 0;
+            if( kernel_table > 12 ) kernel_table = 12;
+         }
+
+      } else if( astChrMatch( name, "TDBInterp" ) ) {
+         result = tdb_interp;
+         if( value != AST__TUNULL ) tdb_interp = ( value != 0 );
+
       } else if( astOK ) {
          astError( AST__TUNAM, "astTune: Unknown AST tuning parameter "
                    "specified \"%s\".", status, name );
@@ -4361,6 +4458,17 @@ f        The global status.
 *        A string to be drawn to introduce the exponent in a value when "g"
 *        format is in use. The default value is "10%-%^50+%s70+" which
 *        produces "10" followed by the exponent as a super-script.
+*     LeapFile
+*        The path to a local file holding an updated list of leap
+*        seconds, to be used by the TimeMap class in place of its
+*        built-in list when converting between UTC and TAI. The file may
+*        be in the format of the USNO "tai-utc.dat" file, or the IERS
+*        "Leap_Second.dat" file. Any leap seconds in the built-in list
+*        that pre-date the first entry in the file are retained. The file
+*        is read when a TimeMap next needs to convert between UTC and
+*        TAI, and is read again only if a different value is assigned to
+*        this tuning parameter. The default value is an empty string,
+*        which causes the built-in list to be used.
 
 *  Notes:
 c     - This function attempts to execute even if the AST error
@@ -4401,6 +4509,8 @@ f     error value
          p = asdel;
       } else if( astChrMatch( name, "exdel" ) ) {
          p = exdel;
+      } else if( astChrMatch( name, "leapfile" ) ) {
+         p = leapfile;
 
 /* Report an error if an the tuning parameter name is unknown. */
       } else if( astOK ) {
@@ -4437,9 +4547,11 @@ f     error value
                          "(%s) is too long - must not be longer than %d "
                          "characters.", status, name, value, MAXLEN_TUNEC );
 
-/* Otherwise, copy the new value into the static buffer. */
+/* Otherwise, copy the new value into the static buffer, and note that
+   a tuning parameter may have changed. */
             } else {
                strcpy( p, value );
+               tunec_gen++;
             }
          }
       }
@@ -4448,6 +4560,55 @@ f     error value
    }
 }
 
+int astTuneCGen_( int *status ) {
+/*
+*+
+*  Name:
+*     astTuneCGen
+
+*  Purpose:
+*     Detect changes to the character-valued tuning parameters.
+
+*  Type:
+*     Protected function.
+
+*  Synopsis:
+*     #include "object.h"
+*     int astTuneCGen( void )
+
+*  Class Membership:
+*     Object class function.
+
+*  Description:
+*     This function returns the number of times that a new value has been
+*     stored for any character-valued tuning parameter using astTuneC. A
+*     class that derives data from a tuning parameter can compare this
+*     value with the value returned when the data was derived, and so
+*     avoid obtaining the value of the tuning parameter again if none of
+*     the tuning parameters have changed.
+
+*  Returned Value:
+*     The number of times a tuning parameter value has been stored.
+
+*  Notes:
+*     - This function attempts to execute even if the global error
+*     status is set.
+*-
+*/
+
+/* Local Variables: */
+   int result;
+
+/* Serialise access to the tuning parameters since they are common to all
+   threads. */
+   LOCK_MUTEX1;
+   result = tunec_gen;
+   UNLOCK_MUTEX1;
+
+/* Return the result. */
+   return result;
+}
+
 AstObject *astFromString_( const char *string, int *status ) {
 /*
 c++
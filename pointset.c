@@ -68,6 +68,10 @@
 *        Check for Infs as well as NaNs.
 *     24-MAY-2016 (DSB):
 *        Added astShowPoints.
+*     17-OCT-2026 (DSB):
+*        - Allow astSetNpoint to increase the number of points in a
+*        PointSet that refers to externally supplied coordinate arrays.
+*        - astSetPoints re-uses any existing array of pointers.
 */
 
 /* Module Macros. */
@@ -1991,7 +1995,7 @@ static void SetNpoint( AstPointSet *this, int npoint, int *status ) {
 *     astSetNpoint
 
 *  Purpose:
-*     Reduce the number of points in a PointSet.
+*     Change the number of points in a PointSet.
 
 *  Type:
 *     Protected virtual function.
@@ -2006,14 +2010,22 @@ static void SetNpoint( AstPointSet *this, int npoint, int *status ) {
 *  Description:
 *     This function reduces the number of points stored in a PointSet.
 *     Points with indices beyond the new size will be discarded.
+*
+*     If the PointSet does not hold any internally allocated coordinate
+*     values (i.e. it either has no values yet, or refers to values
+*     supplied using astSetPoints), the number of points may also be
+*     increased. In this case it is the caller's responsibility to
+*     ensure that any coordinate arrays associated with the PointSet
+*     are large enough.
 
 *  Parameters:
 *     this
 *        Pointer to the PointSet.
 *     npoint
 *        The new value for the number of points in the PointSet. Must be
-*        less than or equal to the original size of the PointSet, and
-*        greater than zero.
+*        greater than zero and, if the PointSet holds internally
+*        allocated coordinate values, less than or equal to the original
+*        size of the PointSet.
 *-
 */
 
@@ -2021,7 +2033,7 @@ static void SetNpoint( AstPointSet *this, int npoint, int *status ) {
    if ( !astOK ) return;
 
 /* Check the new size is valid. */
-   if( npoint < 1 || npoint > this->npoint ) {
+   if( npoint < 1 || ( npoint > this->npoint && this->values ) ) {
       astError( AST__NPTIN, "astSetNpoint(%s): Number of points (%d) is "
                 "not valid.", status, astGetClass( this ), npoint );
       astError( AST__NPTIN, "Should be in the range 1 to %d.", status, this->npoint );
@@ -2124,10 +2136,17 @@ static void SetPoints( AstPointSet *this, double **ptr, int *status ) {
 /* Free any memory previously allocated to store coordinate values. */
       this->values = (double *) astFree( (void *) this->values );
 
-/* If a new array of pointers has been provided, (re)allocate memory and store
-   a copy of the array in it, saving a pointer to this copy in the PointSet
-   structure. */
-      if ( ptr ) {
+/* If a new array of pointers has been provided, store a copy of it in the
+   PointSet structure. Any existing pointer array always has room for
+   "ncoord" elements, so it can be over-written. This avoids re-allocating
+   memory when a PointSet is re-used to describe different arrays. */
+      if ( ptr && this->ptr ) {
+         (void) memcpy( this->ptr, ptr, sizeof( double * )
+                                        * (size_t) this->ncoord );
+
+/* Otherwise, allocate memory and store a copy of the array in it, saving
+   a pointer to this copy in the PointSet structure. */
+      } else if ( ptr ) {
          this->ptr = (double **) astStore( (void *) this->ptr,
                                            (const void *) ptr,
                                            sizeof( double * )
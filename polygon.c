@@ -112,6 +112,12 @@ f     - AST_OUTLINE<X>: Create a Polygon outlining values in a pixel array
 *        rounding errors in subsequent code may push the vertices into
 *        neighbouring pixels, which may have bad WCS coords (e.g.
 *        vertices on the boundary of a polar cusp in an HPX map).
+*     17-OCT-2026 (DSB):
+*        Added RegScan.
+*     17-OCT-2026 (DSB):
+*        Use a cached index of the edges crossing each horizontal slab to
+*        speed up the Transform method for Polygons defined in a simple
+*        2-dimensional Frame.
 *class--
 */
 
@@ -434,11 +440,13 @@ static double Polywidth( AstFrame *, AstLineDef **, int, int, double[ 2 ], int *
 static int GetBounded( AstRegion *, int * );
 static int IntCmp( const void *, const void * );
 static int RegPins( AstRegion *, AstPointSet *, AstRegion *, int **, int * );
+static int RegScan( AstRegion *, double, int *, double **, int * );
 static int RegTrace( AstRegion *, int, double *, double **, int * );
 static void Cache( AstPolygon *, int * );
 static void Copy( const AstObject *, AstObject *, int * );
 static void Delete( AstObject *, int * );
 static void Dump( AstObject *, AstChannel *, int * );
+static void EdgeIndex( AstPolygon *, int * );
 static void EnsureInside( AstPolygon *, int * );
 static void FindMax( Segment *, AstFrame *, double *, double *, int, int, int * );
 static void RegBaseBox( AstRegion *this, double *, double *, int * );
@@ -1687,6 +1695,195 @@ static AstPointSet *DownsizePoly( AstPointSet *pset, double maxerr,
    return result;
 }
 
+static void EdgeIndex( AstPolygon *this, int *status ){
+/*
+*  Name:
+*     EdgeIndex
+
+*  Purpose:
+*     Create an index of the Polygon edges that cross each horizontal slab.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "polygon.h"
+*     void EdgeIndex( AstPolygon *this, int *status )
+
+*  Class Membership:
+*     Polygon member function
+
+*  Description:
+*     This function divides the range of the second base Frame axis
+*     covered by the Polygon into a set of equal width slabs, and
+*     records the indices of the edges that touch each slab. The index
+*     is stored in the Polygon structure, and is used by the Transform
+*     method to avoid testing each point against every edge. The parity
+*     of the cached interior point (i.e. the number of edges crossed
+*     by a line from the interior point towards minus infinity on the
+*     first axis) is also stored.
+*
+*     The extent of each edge on the second axis is increased by the
+*     tolerance used by astLineContains, so that all edges that may
+*     contain a point are included in the slab holding the point.
+*
+*     The function returns without action if an index already exists.
+*     The index assumes plane geometry and so should only be used with
+*     Polygons defined within a simple 2-dimensional Frame.
+
+*  Parameters:
+*     this
+*        Pointer to the Polygon.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Notes:
+*     - The slab offsets are stored in the first "nslab+1" elements of
+*     the "slabs" array, and the edge indices follow them. The edges
+*     touching slab "k" are given by elements "slabs[k]" to
+*     "slabs[k+1]-1" of the edge indices.
+
+*/
+
+/* Local Variables: */
+   double **ptr;        /* Pointer to vertex coordinates */
+   double *px;          /* Pointer to first axis values */
+   double *py;          /* Pointer to second axis values */
+   double tol;          /* Tolerance for current edge */
+   double w;            /* Slab width */
+   double ya;           /* Second axis value at start of edge */
+   double yb;           /* Second axis value at end of edge */
+   double yhi;          /* Upper limit of edge on second axis */
+   double ylo;          /* Lower limit of edge on second axis */
+   double ymax;         /* Upper limit of polygon on second axis */
+   double ymin;         /* Lower limit of polygon on second axis */
+   int *idx;            /* Pointer to start of edge indices */
+   int i;               /* Edge index */
+   int ia;              /* Index of vertex at start of edge */
+   int k;               /* Slab index */
+   int ka;              /* First slab touched by edge */
+   int kb;              /* Last slab touched by edge */
+   int nslab;           /* Number of slabs */
+   int ntot;            /* Total number of edge indices in all slabs */
+   int nv;              /* Number of vertices in Polygon */
+
+/* Check the global error status. Also return if an index is already
+   available. */
+   if ( !astOK || this->slabs ) return;
+
+/* Ensure cached information is available. */
+   Cache( this, status );
+
+/* Get the vertices. */
+   nv = astGetNpoint( ((AstRegion *) this)->points );
+   ptr = astGetPoints( ((AstRegion *) this)->points );
+   if( astOK && nv > 0 ) {
+      px = ptr[ 0 ];
+      py = ptr[ 1 ];
+
+/* Find the range of the second axis spanned by the edges (including
+   the tolerance used by astLineContains), and the parity of the interior
+   point. Edge "i" joins vertex "i-1" to vertex "i". */
+      ymin = DBL_MAX;
+      ymax = -DBL_MAX;
+      this->inpar = 0;
+      ia = nv - 1;
+      for( i = 0; i < nv; i++ ) {
+         ya = py[ ia ];
+         yb = py[ i ];
+         tol = 1.0E-7*this->edges[ i ]->length;
+         ylo = astMIN( ya, yb ) - tol;
+         yhi = astMAX( ya, yb ) + tol;
+         if( ylo < ymin ) ymin = ylo;
+         if( yhi > ymax ) ymax = yhi;
+
+         if( ( ya <= this->in[ 1 ] ) != ( yb <= this->in[ 1 ] ) &&
+             px[ ia ] + ( this->in[ 1 ] - ya )*( px[ i ] - px[ ia ] )/
+             ( yb - ya ) < this->in[ 0 ] ) this->inpar = !this->inpar;
+
+         ia = i;
+      }
+
+/* Start with one slab per edge. If this results in too many edge
+   indices (because many edges are long compared to the slab width),
+   halve the number of slabs until the total number of indices is
+   acceptable. */
+      nslab = nv;
+      ntot = 0;
+      w = 1.0;
+      while( 1 ) {
+         w = ( ymax - ymin )/nslab;
+         if( w <= 0.0 ) {
+            nslab = 1;
+            w = 1.0;
+         }
+
+         ntot = 0;
+         ia = nv - 1;
+         for( i = 0; i < nv; i++ ) {
+            tol = 1.0E-7*this->edges[ i ]->length;
+            ylo = astMIN( py[ ia ], py[ i ] ) - tol;
+            yhi = astMAX( py[ ia ], py[ i ] ) + tol;
+            ka = (int) floor( ( ylo - ymin )/w );
+            kb = (int) floor( ( yhi - ymin )/w );
+            if( ka < 0 ) ka = 0;
+            if( kb >= nslab ) kb = nslab - 1;
+            ntot += kb - ka + 1;
+            if( ntot > 16*nv ) break;
+            ia = i;
+         }
+
+         if( ntot <= 16*nv || nslab == 1 ) break;
+         nslab /= 2;
+      }
+
+/* Allocate the index. */
+      this->slabs = astMalloc( sizeof( int )*( nslab + 1 + ntot ) );
+      if( astOK ) {
+         idx = this->slabs + nslab + 1;
+
+/* Count the edges touching each slab, and then form the cumulative sum
+   so that each element holds the offset of the end of the slab. */
+         for( k = 0; k <= nslab; k++ ) this->slabs[ k ] = 0;
+
+         ia = nv - 1;
+         for( i = 0; i < nv; i++ ) {
+            tol = 1.0E-7*this->edges[ i ]->length;
+            ylo = astMIN( py[ ia ], py[ i ] ) - tol;
+            yhi = astMAX( py[ ia ], py[ i ] ) + tol;
+            ka = (int) floor( ( ylo - ymin )/w );
+            kb = (int) floor( ( yhi - ymin )/w );
+            if( ka < 0 ) ka = 0;
+            if( kb >= nslab ) kb = nslab - 1;
+            for( k = ka; k <= kb; k++ ) this->slabs[ k ]++;
+            ia = i;
+         }
+
+         for( k = 1; k <= nslab; k++ ) this->slabs[ k ] += this->slabs[ k - 1 ];
+
+/* Store the edge indices, working backwards through the edges so that
+   each slab ends up holding its edges in increasing order, and each
+   offset ends up holding the start of its slab. */
+         for( i = nv - 1; i >= 0; i-- ) {
+            ia = i ? i - 1 : nv - 1;
+            tol = 1.0E-7*this->edges[ i ]->length;
+            ylo = astMIN( py[ ia ], py[ i ] ) - tol;
+            yhi = astMAX( py[ ia ], py[ i ] ) + tol;
+            ka = (int) floor( ( ylo - ymin )/w );
+            kb = (int) floor( ( yhi - ymin )/w );
+            if( ka < 0 ) ka = 0;
+            if( kb >= nslab ) kb = nslab - 1;
+            for( k = ka; k <= kb; k++ ) idx[ --(this->slabs[ k ]) ] = i;
+         }
+
+/* Store the other information describing the index. */
+         this->slablo = ymin;
+         this->slabw = w;
+         this->nslab = nslab;
+      }
+   }
+}
+
 static void EnsureInside( AstPolygon *this, int *status ){
 /*
 *  Name:
@@ -2810,6 +3007,7 @@ void astInitPolygonVtab_(  AstPolygonVtab *vtab, const char *name, int *status )
    region->RegPins = RegPins;
    region->RegBaseMesh = RegBaseMesh;
    region->RegBaseBox = RegBaseBox;
+   region->RegScan = RegScan;
    region->RegTrace = RegTrace;
    region->GetBounded = GetBounded;
 
@@ -4647,6 +4845,202 @@ static int RegPins( AstRegion *this_region, AstPointSet *pset, AstRegion *unc,
    return result;
 }
 
+static int RegScan( AstRegion *this_region, double y, int *nx, double **x,
+                    int *status ){
+/*
+*+
+*  Name:
+*     RegScan
+
+*  Purpose:
+*     Find where a row of constant Y crosses the boundary of a 2D Region.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "polygon.h"
+*     int RegScan( AstRegion *this, double y, int *nx, double **x,
+*                  int *status )
+
+*  Class Membership:
+*     Polygon member function (overrides the astRegScan method
+*     inherited from the parent Region class).
+
+*  Description:
+*     This function finds the places at which a line of constant value
+*     on the second axis of the base Frame of the supplied 2-dimensional
+*     Region crosses the boundary of the Region. Each crossing is
+*     returned as an interval along the first base Frame axis that is
+*     guaranteed to contain the crossing. See the description of
+*     astRegScan in the parent Region class for further details.
+*
+*     Each edge that passes within one unit of the row contributes an
+*     interval covering the part of the edge that is within one unit of
+*     the row, padded by one unit at each end. Edges that cross the row
+*     contribute their interval once, and edges that merely come close
+*     to the row contribute it twice (so that the parity of points
+*     outside the interval is not changed).
+*
+*     Only Polygons defined within a simple 2-dimensional Frame (in
+*     which plane geometry applies) are supported.
+
+*  Parameters:
+*     this
+*        Pointer to the Region.
+*     y
+*        The value on the second base Frame axis at which the crossings
+*        are required. If this is AST__BAD, the function returns
+*        without action (but the returned function value still
+*        indicates if the method is supported or not).
+*     nx
+*        Pointer to an int in which to return the number of intervals.
+*     x
+*        Address of a pointer to an array in which to return the lower
+*        and upper bounds of each interval. The array is extended if
+*        necessary using astGrow.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Non-zero if the crossings can be found, and zero otherwise.
+
+*-
+*/
+
+/* Local Variables; */
+   AstFrame *frm;
+   AstPolygon *this;
+   const char *class;
+   double **ptr;
+   double *px;
+   double *py;
+   double t0;
+   double t1;
+   double x0;
+   double x1;
+   double xa;
+   double xb;
+   double xl;
+   double xr;
+   double ya;
+   double yb;
+   double yhi;
+   double ylo;
+   int i;
+   int inpar;
+   int n;
+   int ncopy;
+   int nv;
+   int result;
+
+/* Initialise */
+   result = 0;
+
+/* Check inherited status. */
+   if( ! astOK ) return result;
+
+/* Get a pointer to the base Frame in the encapsulated FrameSet. Check it
+   is a simple 2-dimensional Frame, so that we can assume plane geometry. */
+   frm = astGetFrame( this_region->frameset, AST__BASE );
+   class = astGetClass( frm );
+   if( astGetNaxes( frm ) == 2 && class && !strcmp( class, "Frame" ) ) {
+      result = 1;
+   }
+   frm = astAnnul( frm );
+
+/* Check we have a row to scan. */
+   if( result && y != AST__BAD ) {
+
+/* Get a pointer to the Polygon structure. */
+      this = (AstPolygon *) this_region;
+
+/* Ensure cached information is available. */
+      Cache( this, status );
+
+/* Get the vertices, and ensure the returned array is large enough to
+   hold two intervals for every edge, plus one extra. */
+      nv = astGetNpoint( this_region->points );
+      ptr = astGetPoints( this_region->points );
+      *x = astGrow( *x, 4*nv + 2, sizeof( double ) );
+      *nx = 0;
+      if( astOK ) {
+         px = ptr[ 0 ];
+         py = ptr[ 1 ];
+
+/* Loop round each edge, starting with the edge that joins the last
+   vertex to the first. Also count the edges crossed by a line from the
+   cached interior point ("in") towards negative infinity on the first
+   axis. */
+         n = 0;
+         inpar = 0;
+         xa = px[ nv - 1 ];
+         ya = py[ nv - 1 ];
+         for( i = 0; i < nv; i++ ) {
+            xb = px[ i ];
+            yb = py[ i ];
+
+            if( ( ya <= this->in[ 1 ] ) != ( yb <= this->in[ 1 ] ) &&
+                xa + ( this->in[ 1 ] - ya )*( xb - xa )/( yb - ya ) <
+                this->in[ 0 ] ) inpar = !inpar;
+
+/* Skip edges that do not come within one unit of the row. */
+            ylo = astMIN( ya, yb );
+            yhi = astMAX( ya, yb );
+            if( y >= ylo - 1.0 && y <= yhi + 1.0 ) {
+
+/* Find the range of X covered by the part of the edge that is within
+   one unit of the row. */
+               if( yhi > ylo ) {
+                  t0 = ( y - 1.0 - ya )/( yb - ya );
+                  t1 = ( y + 1.0 - ya )/( yb - ya );
+                  t0 = astMAX( 0.0, astMIN( 1.0, t0 ) );
+                  t1 = astMAX( 0.0, astMIN( 1.0, t1 ) );
+                  x0 = xa + t0*( xb - xa );
+                  x1 = xa + t1*( xb - xa );
+               } else {
+                  x0 = xa;
+                  x1 = xb;
+               }
+               xl = astMIN( x0, x1 ) - 1.0;
+               xr = astMAX( x0, x1 ) + 1.0;
+
+/* Store the interval once if the edge crosses the row (including its
+   lower end but not its upper end), and twice otherwise. */
+               ncopy = ( ylo <= y && y < yhi ) ? 1 : 2;
+               while( ncopy-- ) {
+                  (*x)[ 2*n ] = xl;
+                  (*x)[ 2*n + 1 ] = xr;
+                  n++;
+               }
+            }
+
+            xa = xb;
+            ya = yb;
+         }
+
+/* The Transform method treats points as inside the Polygon if they have
+   the same parity as the interior point. This will be the infinite
+   region outside the boundary if the vertices are stored in clockwise
+   order. If the interior point has even parity, add an interval below
+   all other points to invert the parity of every point. */
+         if( !inpar ) {
+            (*x)[ 2*n ] = -DBL_MAX;
+            (*x)[ 2*n + 1 ] = -DBL_MAX;
+            n++;
+         }
+
+         *nx = n;
+      }
+   }
+
+/* If an error occurred, return zero. */
+   if( !astOK ) result = 0;
+
+/* Return the result. */
+   return result;
+}
+
 static int RegTrace( AstRegion *this_region, int n, double *dist, double **ptr,
                      int *status ){
 /*
@@ -4938,6 +5332,9 @@ static void ResetCache( AstRegion *this_region, int *status ){
          this->edges = astFree( this->edges );
       }
 
+/* Free any edge index. */
+      this->slabs = astFree( this->slabs );
+
 /* Clear the cache of the parent class. */
       (*parent_resetcache)( this_region, status );
    }
@@ -6029,21 +6426,34 @@ static AstPointSet *Transform( AstMapping *this_mapping, AstPointSet *in,
    AstPointSet *in_base;         /* PointSet holding base Frame input positions*/
    AstPointSet *result;          /* Pointer to output PointSet */
    AstPolygon *this;             /* Pointer to Polygon */
+   const char *class;            /* Base Frame class */
    double **ptr_in;              /* Pointer to input base Frame coordinate data */
    double **ptr_out;             /* Pointer to output current Frame coordinate data */
+   double **ptr_v;               /* Pointer to vertex coordinate data */
    double *px;                   /* Pointer to array of first axis values */
    double *py;                   /* Pointer to array of second axis values */
    double p[ 2 ];                /* Current test position */
+   double slab;                  /* Slab containing current test position */
+   double xa;                    /* First axis value at start of edge */
+   double xb;                    /* First axis value at end of edge */
+   double ya;                    /* Second axis value at start of edge */
+   double yb;                    /* Second axis value at end of edge */
+   int *idx;                     /* Pointer to edge indices in edge index */
    int closed;                   /* Is the boundary part of the Region? */
    int i;                        /* Edge index */
+   int ia;                       /* Index of vertex at start of edge */
    int icoord;                   /* Coordinate index */
    int in_region;                /* Is the point inside the Region? */
+   int j;                        /* Index within edge index */
+   int jhi;                      /* End of slab within edge index */
+   int k;                        /* Slab index */
    int ncoord_out;               /* No. of current Frame axes */
    int ncross;                   /* Number of crossings */
    int neg;                      /* Has the Region been negated? */
    int npoint;                   /* No. of input points */
    int nv;                       /* No. of vertices */
    int point;                    /* Loop counter for input points */
+   int plane;                    /* Does plane geometry apply? */
    int pos;                      /* Is test position in, on, or outside boundary? */
 
 /* Check the global error status. */
@@ -6081,8 +6491,10 @@ static AstPointSet *Transform( AstMapping *this_mapping, AstPointSet *in,
    in_base = astRegTransform( this, in, 0, NULL, &frm );
    ptr_in = astGetPoints( in_base );
 
-/* Get the number of vertices in the polygon. */
+/* Get the number of vertices in the polygon, and a pointer to their
+   coordinates. */
    nv = astGetNpoint( ((AstRegion *) this)->points );
+   ptr_v = astGetPoints( ((AstRegion *) this)->points );
 
 /* See if the boundary is part of the Region. */
    closed = astGetClosed( this );
@@ -6090,6 +6502,13 @@ static AstPointSet *Transform( AstMapping *this_mapping, AstPointSet *in,
 /* See if the Region has been negated. */
    neg = astGetNegated( this );
 
+/* See if the base Frame is a simple 2-dimensional Frame. If so, plane
+   geometry applies and we can use an index of the edges that touch each
+   horizontal slab to find the edges that need to be checked for each
+   point. */
+   class = astGetClass( frm );
+   plane = ( class && !strcmp( class, "Frame" ) );
+
 /* Perform coordinate arithmetic. */
 /* ------------------------------ */
    if ( astOK ) {
@@ -6110,44 +6529,91 @@ static AstPointSet *Transform( AstMapping *this_mapping, AstPointSet *in,
 
 /* Ensure cached information is available.*/
             Cache( this, status );
+            if( plane ) EdgeIndex( this, status );
+            if( !astOK ) break;
+
+            p[ 0 ] = *px;
+            p[ 1 ] = *py;
+            pos = UNKNOWN;
+
+/* If an edge index is available, count the edges crossed by a line from
+   the supplied point towards minus infinity on the first axis. Only the
+   edges in the slab containing the point need be checked, since no other
+   edges can cross the line or contain the point. The point is inside the
+   polygon if the number of crossings has the same parity as the interior
+   point. */
+            if( this->slabs ) {
+               ncross = 0;
+               slab = floor( ( *py - this->slablo )/this->slabw );
+               if( slab >= 0.0 ) {
+                  k = ( slab < this->nslab ) ? (int) slab : this->nslab - 1;
+                  idx = this->slabs + this->nslab + 1;
+                  jhi = this->slabs[ k + 1 ];
+                  for( j = this->slabs[ k ]; j < jhi; j++ ) {
+                     i = idx[ j ];
+
+/* If this point is on the current edge, then we need do no more checks
+   since we know it is either inside or outside the polygon (depending on
+   whether the polygon is closed or not). */
+                     if( astLineContains( frm, this->edges[ i ], 0, p ) ) {
+                        pos = ON;
+                        break;
+                     }
+
+/* Otherwise, see if the edge crosses the line (including its lower end
+   but not its upper end). */
+                     ia = i ? i - 1 : nv - 1;
+                     xa = ptr_v[ 0 ][ ia ];
+                     ya = ptr_v[ 1 ][ ia ];
+                     xb = ptr_v[ 0 ][ i ];
+                     yb = ptr_v[ 1 ][ i ];
+                     if( ( ya <= *py ) != ( yb <= *py ) &&
+                         xa + ( *py - ya )*( xb - xa )/( yb - ya ) < *px ) {
+                        ncross++;
+                     }
+                  }
+               }
+
+               if( pos == UNKNOWN ) {
+                  pos = ( ncross % 2 == this->inpar )? IN : OUT;
+               }
 
-/* Create a definition of the line from a point which is inside the
+/* Otherwise, create a definition of the line from a point which is inside the
    polygon to the supplied point. This is a structure which includes
    cached intermediate information which can be used to speed up
    subsequent calculations. */
-            p[ 0 ] = *px;
-            p[ 1 ] = *py;
-            a = astLineDef( frm, this->in, p );
+            } else {
+               a = astLineDef( frm, this->in, p );
 
 /* We now determine the number of times this line crosses the polygon
    boundary. Initialise the number of crossings to zero. */
-            ncross = 0;
-            pos = UNKNOWN;
+               ncross = 0;
 
 /* Loop rouind all edges of the polygon. */
-            for( i = 0; i < nv; i++ ) {
-               b = this->edges[ i ];
+               for( i = 0; i < nv; i++ ) {
+                  b = this->edges[ i ];
 
 /* If this point is on the current edge, then we need do no more checks
    since we know it is either inside or outside the polygon (depending on
    whether the polygon is closed or not). */
-               if( astLineContains( frm, b, 0, p ) ) {
-                  pos = ON;
-                  break;
+                  if( astLineContains( frm, b, 0, p ) ) {
+                     pos = ON;
+                     break;
 
 /* Otherwise, see if the two lines cross within their extent. If so,
    increment the number of crossings. */
-               } else if( astLineCrossing( frm, b, a, NULL ) ) {
-                  ncross++;
+                  } else if( astLineCrossing( frm, b, a, NULL ) ) {
+                     ncross++;
+                  }
                }
-            }
 
 /* Free resources */
-            a = astFree( a );
+               a = astFree( a );
 
 /* If the position is not on the boundary, it is inside the boundary if
    the number of crossings is even, and outside otherwise. */
-            if( pos == UNKNOWN ) pos = ( ncross % 2 == 0 )? IN : OUT;
+               if( pos == UNKNOWN ) pos = ( ncross % 2 == 0 )? IN : OUT;
+            }
 
 /* Whether the point is in the Region depends on whether the point is
    inside the polygon boundary, whether the Polygon has been negated, and
@@ -6289,6 +6755,7 @@ static void Copy( const AstObject *objin, AstObject *objout, int *status ) {
    the output Polygon. */
    out->edges = NULL;
    out->startsat = NULL;
+   out->slabs = NULL;
 
 /* Indicate cached information needs nre-calculating. */
    astResetCache( (AstPolygon *) out );
@@ -6358,6 +6825,7 @@ static void Delete( AstObject *obj, int *status ) {
 
    this->edges = astFree( this->edges );
    this->startsat = astFree( this->startsat );
+   this->slabs = astFree( this->slabs );
 }
 
 /* Dump function. */
@@ -6883,6 +7351,8 @@ AstPolygon *astInitPolygon_( void *mem, size_t size, int init, AstPolygonVtab *v
          new->simp_vertices = -INT_MAX;
          new->edges = NULL;
          new->startsat = NULL;
+         new->slabs = NULL;
+         new->nslab = 0;
          new->totlen = 0.0;
          new->acw = 1;
          new->stale = 1;
@@ -7043,6 +7513,8 @@ AstPolygon *astLoadPolygon_( void *mem, size_t size, AstPolygonVtab *vtab,
       new->ubnd[ 1 ] = AST__BAD;
       new->edges = NULL;
       new->startsat = NULL;
+      new->slabs = NULL;
+      new->nslab = 0;
       new->totlen = 0.0;
       new->acw = 1;
       new->stale = 1;
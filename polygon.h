@@ -59,6 +59,8 @@
 *  History:
 *     26-OCT-2004 (DSB):
 *        Original version.
+*     17-OCT-2026 (DSB):
+*        Added the cached edge index used by the Transform method.
 *-
 */
 
@@ -115,6 +117,11 @@ typedef struct AstPolygon {
    AstLineDef **edges;     /* Cached description of edges */
    double *startsat;       /* Perimeter distance to each vertex */
    double totlen;          /* Total perimeter distance round polygon */
+   double slablo;          /* Lower axis 2 limit of edge index */
+   double slabw;           /* Axis 2 width of each slab in edge index */
+   int *slabs;             /* Slab offsets and edge indices in edge index */
+   int nslab;              /* Number of slabs in edge index */
+   int inpar;              /* Crossing parity of the interior point */
    int acw;                /* Are vertices stored in anti-clockwise order? */
    int stale;              /* Is cached information stale? */
    int simp_vertices;      /* Simplify by transforming vertices? */
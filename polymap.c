@@ -129,6 +129,17 @@ f     - AST_POLYTRAN: Fit a PolyMap inverse or forward transformation
 *     27-APR-2018 (DSB):
 *        When calculating the iterative inverse, use an initial guess based
 *        on the linear truncation of the PolyMap rather than a UnitMap.
+*     17-OCT-2026 (DSB):
+*        Re-write IterInverse so that it iterates blocks of points in
+*        lockstep, evaluating the forward polynomials and their Jacobian
+*        together from a single table of axis powers, and dropping
+*        converged points from each block. This replaces the PolyMaps
+*        previously used to describe the Jacobian. Positions with bad axis
+*        values are now returned bad by the iterative inverse.
+*     17-OCT-2026 (DSB):
+*        Store a dense nested form of each polynomial with one or two
+*        inputs. Transform now uses the new protected astPolyBlock method
+*        to evaluate it for blocks of points using Horner's scheme.
 *class--
 */
 
@@ -139,6 +150,10 @@ f     - AST_POLYTRAN: Fit a PolyMap inverse or forward transformation
    "protected" symbols available. */
 #define astCLASS PolyMap
 
+/* The maximum number of points iterated together by the iterative
+   inverse transformation. */
+#define ITER_BLOCK 256
+
 /* Include files. */
 /* ============== */
 /* Interface definitions. */
@@ -234,7 +249,6 @@ AstPolyMap *astPolyMapId_( int, int, int, const double[], int, const double[], c
 /* ======================================== */
 static AstMapping *LinearGuess( AstPolyMap *, int * );
 static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
-static AstPolyMap **GetJacobian( AstPolyMap *, int * );
 static AstPolyMap *PolyTran( AstPolyMap *, int, double, double, int, const double *, const double *, int * );
 static double **SamplePoly1D( AstPolyMap *, int, double **, double, double, int, int *, double[2], int * );
 static double **SamplePoly2D( AstPolyMap *, int, double **, const double *, const double *, int, int *, double[4], int * );
@@ -247,6 +261,7 @@ static int GetTranInverse( AstMapping *, int * );
 static int MPFunc1D( void *, int, int, const double *, double *, double *, int, int );
 static int MPFunc2D( void *, int, int, const double *, double *, double *, int, int );
 static int MapMerge( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
+static int PolyBlock( AstPolyMap *, AstPointSet *, AstPointSet *, int, int * );
 static int ReplaceTransformation( AstPolyMap *, int, double, double, int, const double *, const double *, int * );
 static void Copy( const AstObject *, AstObject *, int * );
 static void Delete( AstObject *obj, int * );
@@ -259,6 +274,7 @@ static void LMFunc1D(  const double *, double *, int, int, void * );
 static void LMFunc2D(  const double *, double *, int, int, void * );
 static void LMJacob1D( const double *, double *, int, int, void * );
 static void LMJacob2D( const double *, double *, int, int, void * );
+static void NestArrays( AstPolyMap *, int, int * );
 static void PolyCoeffs( AstPolyMap *, int, int, double *, int *, int * );
 static void PolyPowers( AstPolyMap *, double **, int, const int *, double **, int, int, int * );
 static void StoreArrays( AstPolyMap *, int, int, const double *, int * );
@@ -1298,6 +1314,20 @@ static void FreeArrays( AstPolyMap *this, int forward, int *status ) {
          this->power_f = astFree( this->power_f );
       }
 
+      if( this->nestcof_f ) {
+         for( i = 0; i < nout; i++ ) {
+            this->nestcof_f[ i ] = astFree( this->nestcof_f[ i ] );
+         }
+         this->nestcof_f = astFree( this->nestcof_f );
+      }
+
+      if( this->nestlen_f ) {
+         for( i = 0; i < nout; i++ ) {
+            this->nestlen_f[ i ] = astFree( this->nestlen_f[ i ] );
+         }
+         this->nestlen_f = astFree( this->nestlen_f );
+      }
+
       this->ncoeff_f = astFree( this->ncoeff_f );
       this->mxpow_f = astFree( this->mxpow_f );
 
@@ -1323,6 +1353,20 @@ static void FreeArrays( AstPolyMap *this, int forward, int *status ) {
          this->power_i = astFree( this->power_i );
       }
 
+      if( this->nestcof_i ) {
+         for( i = 0; i < nin; i++ ) {
+            this->nestcof_i[ i ] = astFree( this->nestcof_i[ i ] );
+         }
+         this->nestcof_i = astFree( this->nestcof_i );
+      }
+
+      if( this->nestlen_i ) {
+         for( i = 0; i < nin; i++ ) {
+            this->nestlen_i[ i ] = astFree( this->nestlen_i[ i ] );
+         }
+         this->nestlen_i = astFree( this->nestlen_i );
+      }
+
       this->ncoeff_i = astFree( this->ncoeff_i );
       this->mxpow_i = astFree( this->mxpow_i );
    }
@@ -1439,158 +1483,6 @@ static const char *GetAttrib( AstObject *this_object, const char *attrib, int *s
 
 }
 
-static AstPolyMap **GetJacobian( AstPolyMap *this, int *status ){
-/*
-*  Name:
-*     GetJacobian
-
-*  Purpose:
-*     Get a description of a Jacobian matrix for the fwd transformation
-*     of a PolyMap.
-
-*  Type:
-*     Private function.
-
-*  Synopsis:
-*     AstPolyMap **GetJacobian( AstPolyMap *this, int *status )
-
-*  Description:
-*     This function returns a set of PolyMaps which define the Jacobian
-*     matrix of the forward transformation of the supplied PolyMap.
-*
-*     The Jacobian matrix has "nout" rows and "nin" columns, where "nin"
-*     and "nout" are the number of inputs and outputs of the supplied PolyMap.
-*     Row "i", column "j" of the matrix holds the rate of change of the
-*     i'th PolyMap output with respect to the j'th PolyMap input.
-*
-*     Since the values in the Jacobian matrix vary across the input space
-*     of the PolyMap, the matrix is returned in the form of a set of new
-*     PolyMaps which generate the elements of the Jacobian for any given
-*     position in the input space. The "nout" values in a single column of
-*     the Jacobian matrix are generated by the "nout" outputs from a single
-*     new PolyMap. The whole matrix is described by "nin" PolyMaps.
-*
-*     The returned PolyMaps are cached in the supplied PolyMap object in
-*     order to speed up subsequent calls to this function.
-
-*  Parameters:
-*     this
-*        The PolyMap for which the Jacbian is required.
-*     status
-*        Pointer to the inherited status variable.
-
-*  Returned Value:
-*     A pointer to an array of "nin" PolyMap pointers, where "nin" is the number
-*     of inputs for the sipplied PolyMap. The returned array should not be changed
-*     in any way, and the PolyMaps should not be freed (they will be freed when
-*     the supplied PolyMap is deleted).
-
-*/
-
-/* Local Variables: */
-   double *coeffs;
-   double *pc;
-   int icof;
-   int icol;
-   int iin;
-   int irow;
-   int ncof;
-   int ncof_row;
-   int ncof_total;
-   int nin;
-   int nout;
-   int power;
-
-/* Check inherited status */
-   if( !astOK ) return NULL;
-
-/* Ensure there is a Jacobian stored in the PolyMap. */
-   if( !this->jacobian ) {
-
-/* Get the number of inputs and outputs. */
-      nin = astGetNin( this );
-      nout = astGetNout( this );
-
-/* Allocate memory to hold pointers to the PolyMaps used to describe the
-   Jacobian matrix. */
-      this->jacobian = astCalloc( nin, sizeof(AstPolyMap *) );
-
-/* Find the total number of coefficients used to describe the supplied
-   PolyMap (forward transformation) and allocate work space to hold the
-   coefficients for a single new PolyMap forward transformation. */
-      ncof = 0;
-      for( irow = 0; irow <  nout; irow++ ) {
-         ncof += this->ncoeff_f[ irow ];
-      }
-      coeffs = astMalloc( ncof*( 2 + nin )*sizeof( double ) );
-
-/* Check pointers can be used safely. */
-      if( astOK ) {
-
-/* The Jacobian matrix has "nout" rows and "nin" columns. The "nout" values
-   in a single column of the Jacobian matrix corresponds to the "nout" outputs
-   from a single PolyMap. The whole matrix is described by "nin" PolyMaps.
-   Loop over each column of the Matrix, creating the corresponding PolyMap
-   for each. */
-         for( icol = 0; icol <  nin; icol++ ) {
-
-/* Initialise the total number of coefficients used to describe the
-   element of the PolyMap. */
-            ncof_total = 0;
-
-/* Loop over each row of the Jacobian matrix (i.e. each PolyMap output). */
-            pc = coeffs;
-            for( irow = 0; irow <  nout; irow++ ) {
-
-/* Loop over each coefficient used in the polynomial that generates the
-   current PolyMap output. */
-               ncof_row = this->ncoeff_f[ irow ];
-               for( icof = 0; icof <  ncof_row; icof++ ) {
-
-/* Get the power of input "icol" associated with the current coefficient. */
-                  power = (int)( this->power_f[ irow ][ icof ][ icol ] + 0.5 );
-
-/* We can skip the coefficient if the power is zero. */
-                  if( power > 0 ) {
-                     ncof_total++;
-
-/* Store the coefficient value, modified so that it describes a
-   polynomial that has been differentiated with respect to input "icol". */
-                     *(pc++) = this->coeff_f[ irow ][ icof ]*power;
-
-/* Store the output PolyMap to which the coeff relates. */
-                     *(pc++) = irow + 1;
-
-/* Store the powers of the inputs associated with the coeff. These are
-   the same as the original powers, except that the power of "icol"
-   (the input with respect to which the output has been differentiated)
-   is reduced by one. */
-                     for( iin = 0; iin <  nin; iin++ ) {
-                        if( iin != icol ) {
-                           *(pc++) = this->power_f[ irow ][ icof ][ iin ];
-                        } else {
-                           *(pc++) = this->power_f[ irow ][ icof ][ iin ] - 1;
-                        }
-                     }
-                  }
-               }
-            }
-
-/* Create the PolyMap and store a pointer to it in the jacobian array in
-   the supplied PolyMap. */
-            (this->jacobian)[ icol ] = astPolyMap( nin, nout, ncof_total, coeffs,
-                                                   0, NULL, " ", status );
-         }
-      }
-
-/* Free resources */
-      coeffs = astFree( coeffs );
-   }
-
-/* Return the Jacobian. */
-   return this->jacobian;
-}
-
 static int GetObjSize( AstObject *this_object, int *status ) {
 /*
 *  Name:
@@ -1630,8 +1522,6 @@ static int GetObjSize( AstObject *this_object, int *status ) {
 
 /* Local Variables: */
    AstPolyMap *this;
-   int ic;
-   int nc;
    int result;
 
 /* Initialise. */
@@ -1648,13 +1538,7 @@ static int GetObjSize( AstObject *this_object, int *status ) {
    which are stored in dynamically allocated memory. */
    result = (*parent_getobjsize)( this_object, status );
 
-   if( this->jacobian ) {
-      nc = astGetNin( this );
-      for( ic = 0; ic < nc; ic++ ) {
-         result +=  astGetObjSize( (this->jacobian)[ ic ] );
-      }
-      result += sizeof( AstPolyMap * )*nc;
-   }
+   if( this->lintrunc ) result += astGetObjSize( this->lintrunc );
 
 /* If an error occurred, clear the result value. */
    if ( !astOK ) result = 0;
@@ -1871,6 +1755,7 @@ void astInitPolyMapVtab_(  AstPolyMapVtab *vtab, const char *name, int *status )
 /* Store pointers to the member functions (implemented here) that provide
    virtual methods for this class. */
    vtab->PolyPowers = PolyPowers;
+   vtab->PolyBlock = PolyBlock;
    vtab->FitPoly1DInit = FitPoly1DInit;
    vtab->FitPoly2DInit = FitPoly2DInit;
    vtab->PolyTran = PolyTran;
@@ -1961,6 +1846,14 @@ static void IterInverse( AstPolyMap *this, AstPointSet *out, AstPointSet *result
 *     the inverse transformation of the PolyMap, to generate the corresponding
 *     input positions. An iterative Newton-Raphson method is used which
 *     only required the forward transformation of the PolyMap to be deifned.
+*
+*     The points are processed in blocks of up to ITER_BLOCK points. All
+*     the points in a block are iterated together. At each iteration, the
+*     required powers of the current input axis values are found for the
+*     whole block, and are then used to evaluate both the forward
+*     polynomials and the elements of their Jacobian matrix. Points are
+*     removed from the block as soon as they converge, so that later
+*     iterations only involve the points that have not yet converged.
 
 *  Parameters:
 *     this
@@ -1974,39 +1867,60 @@ static void IterInverse( AstPolyMap *this, AstPointSet *out, AstPointSet *result
 *     status
 *        Pointer to the inherited status variable.
 
+*  Notes:
+*     - Bad input axis values are returned for any position that has one
+*     or more bad output axis values, or for which the Jacobian matrix of
+*     the forward transformation is singular at any stage.
+
 */
 
 /* Local Variables: */
-   AstMapping *lintrunc;
-   AstPointSet *work;
-   AstPointSet **ps_jac;
-   AstPolyMap **jacob;
-   double *vec;
-   double *pb;
-   double **ptr_work;
-   double ***ptr_jac;
-   double *mat;
-   double **ptr_out;
-   double **ptr_in;
-   double *pa;
-   double det;
-   double maxerr;
-   double vlensq;
-   double xlensq;
-   double xx;
-   int *flags;
-   int *iw;
-   int fwd;
-   int icol;
-   int icoord;
-   int ipoint;
-   int irow;
-   int iter;
-   int maxiter;
-   int nconv;
-   int ncoord;
-   int npoint;
-   int sing;
+   AstMapping *lintrunc;         /* Linear truncation of the PolyMap */
+   double **coeff;               /* Coefficients of each forward polynomial */
+   double **ptr_in;              /* Returned input axis values */
+   double **ptr_out;             /* Supplied output axis values */
+   double **pwr;                 /* Powers of each input axis value */
+   double *jac;                  /* Jacobian elements at each active point */
+   double *mat;                  /* Jacobian matrix at a single point */
+   double *off;                  /* Offsets from the required outputs */
+   double *pa;                   /* Pointer to work array element */
+   double *pb;                   /* Pointer to work array element */
+   double *pj;                   /* Pointer to row of Jacobian elements */
+   double *pw;                   /* Pointer to powers of an input axis */
+   double *tv;                   /* Value of a single term at each point */
+   double *vec;                  /* Offset vector at a single point */
+   double *work;                 /* Work space for a block of points */
+   double cof;                   /* Coefficient value */
+   double det;                   /* Determinant of Jacobian (unused) */
+   double maxerr;                /* Squared target relative error */
+   double vlensq;                /* Squared length of input offset */
+   double xlensq;                /* Squared length of input position */
+   double xx;                    /* Updated input axis value */
+   int ***power;                 /* Powers used by each coefficient */
+   int *active;                  /* Indices of unconverged points */
+   int *iw;                      /* Work space for palDmat */
+   int *mxpow;                   /* Max power of each input axis */
+   int *ncoeff;                  /* No. of coefficients per output */
+   int *pow;                     /* Powers used by current coefficient */
+   int bad;                      /* Bad value found? */
+   int block;                    /* Index of first point in block */
+   int icoord;                   /* Axis index */
+   int ico;                      /* Coefficient index */
+   int icol;                     /* Jacobian column index */
+   int ip;                       /* Power index */
+   int ipoint;                   /* Point index */
+   int irow;                     /* Output (Jacobian row) index */
+   int iter;                     /* Iteration count */
+   int k;                        /* Index of point within block */
+   int maxiter;                  /* Max. number of iterations */
+   int nact;                     /* No. of active points in block */
+   int nb;                       /* No. of points in a block */
+   int ncoord;                   /* No. of axes */
+   int newact;                   /* No. of points still active */
+   int npoint;                   /* Total no. of points */
+   int npow;                     /* Total no. of axis powers */
+   int p;                        /* Power of current axis */
+   int sing;                     /* Is the Jacobian singular? */
 
 /* Check inherited status */
    if( !astOK ) return;
@@ -2020,48 +1934,41 @@ static void IterInverse( AstPolyMap *this, AstPointSet *out, AstPointSet *result
                 astGetClass(this), astGetClass(this) );
    }
 
-/* Get information about the Jacobian matrix for the forward polynomial
-   transformation. This matrix is a ncoord X ncoord matrix, in which
-   element (row=I,col=J) is the rate of change of output coord I with
-   respect to input coord J, of the supplied PolyMap's forward transformation.
-   The numerical values of the matrix vary depending on where it is
-   evaluated within the input space of the PolyMap. For this reason, the
-   "jacob" variable holds a vector of "ncoord" PolyMaps. The outputs of
-   each of these PolyMaps corresponds to a single column in the Jacobian
-   matrix. */
-   jacob = GetJacobian( this, status );
-
-/* Get the number of points to be transformed. */
-   npoint = astGetNpoint( out );
-
-/* Get another PointSet to hold intermediate results. */
-   work = astPointSet( npoint, ncoord, " ", status );
+/* Get pointers to the arrays describing the forward polynomials. */
+   ncoeff = this->ncoeff_f;
+   coeff = this->coeff_f;
+   power = this->power_f;
+   mxpow = this->mxpow_f;
 
-/* See if the PolyMap has been inverted. */
-   fwd = !astGetInvert( this );
+/* Get the number of points to be transformed, and the number of points
+   in each block. */
+   npoint = astGetNpoint( out );
+   nb = astMIN( npoint, ITER_BLOCK );
 
-/* Get pointers to the data arrays for all PointSets. Note, here "in" and
+/* Get pointers to the data arrays for both PointSets. Note, here "in" and
    "out" refer to inputs and outputs of the PolyMap (i.e. the forward
    transformation). These are respectively *outputs* and *inputs* of the
    inverse transformation. */
    ptr_in = astGetPoints( result );  /* Returned input positions */
    ptr_out = astGetPoints( out );    /* Supplied output positions */
-   ptr_work = astGetPoints( work );  /* Work space */
 
-/* Allocate an array of PointSets to hold the elements of the Jacobian
-   matrix. */
-   ptr_jac = astMalloc( sizeof( double ** )*ncoord );
-   ps_jac = astCalloc( ncoord, sizeof( AstPointSet * ) );
+/* Find the total number of axis powers needed for each point, including
+   the zeroth power of each axis. */
+   npow = 0;
    if( astOK ) {
-      for( icoord = 0; icoord < ncoord; icoord++ ) {
-         ps_jac[ icoord ] = astPointSet( npoint, ncoord, " ", status );
-         ptr_jac[ icoord ] = astGetPoints( ps_jac[ icoord ] );
-      }
+      for( icoord = 0; icoord < ncoord; icoord++ ) npow += mxpow[ icoord ] + 1;
    }
 
-/* Allocate an array to hold flags indicating if each position has
-   converged. Initialise it to hold zero at every element. */
-   flags = astCalloc( npoint, sizeof( int ) );
+/* Allocate work space for a single block of points. This holds the
+   powers of each input axis value, the offsets from the required output
+   positions, the elements of the Jacobian matrix and the value of a
+   single polynomial term, for every point in the block. */
+   work = astMalloc( sizeof( double )*nb*( npow + ncoord + ncoord*ncoord + 1 ) );
+   pwr = astMalloc( sizeof( double * )*ncoord );
+
+/* Allocate an array to hold the indices of the points in the current
+   block that have not yet converged. */
+   active = astMalloc( sizeof( int )*nb );
 
 /* Allocate memory to hold the Jacobian matrix at a single point. */
    mat = astMalloc( sizeof( double )*ncoord*ncoord );
@@ -2075,6 +1982,20 @@ static void IterInverse( AstPolyMap *this, AstPointSet *out, AstPointSet *result
 /* Check pointers can be used safely. */
    if( astOK ) {
 
+/* Partition the work space. Element "k" of row "ip" of array pwr[icoord]
+   holds power "ip" of input axis "icoord" at the k'th active point.
+   Element "k" of row "irow" of "off" holds the offset to the required
+   value of output "irow". Element "k" of row "irow*ncoord+icol" of "jac"
+   holds element (irow,icol) of the Jacobian matrix. */
+      pa = work;
+      for( icoord = 0; icoord < ncoord; icoord++ ) {
+         pwr[ icoord ] = pa;
+         pa += nb*( mxpow[ icoord ] + 1 );
+      }
+      off = pa;
+      jac = off + nb*ncoord;
+      tv = jac + nb*ncoord*ncoord;
+
 /* Store the initial guess at the required input positions. These are
    determined by transforming the supplied output positions using the
    inverse of a linear truncation of the PolyMap's forward
@@ -2091,79 +2012,152 @@ static void IterInverse( AstPolyMap *this, AstPointSet *out, AstPointSet *result
       maxerr = astGetTolInverse( this );
       maxerr *= maxerr;
 
-/* Initialise the number of positions which have reached the required
-   accuracy. */
-      nconv = 0;
+/* Loop round each block of points. */
+      for( block = 0; block < npoint && astOK; block += nb ) {
+
+/* Form the list of points in the block that are to be iterated. Points
+   that have any bad output axis values (and hence bad initial guesses)
+   are given bad input axis values and are not iterated. */
+         nact = 0;
+         for( ipoint = block; ipoint < block + nb && ipoint < npoint; ipoint++ ) {
+            bad = 0;
+            for( icoord = 0; icoord < ncoord; icoord++ ) {
+               if( ptr_out[ icoord ][ ipoint ] == AST__BAD ||
+                   ptr_in[ icoord ][ ipoint ] == AST__BAD ) bad = 1;
+            }
+            if( bad ) {
+               for( icoord = 0; icoord < ncoord; icoord++ ) {
+                  ptr_in[ icoord ][ ipoint ] = AST__BAD;
+               }
+            } else {
+               active[ nact++ ] = ipoint;
+            }
+         }
 
 /* Loop round doing iterations of a Newton-Raphson algorithm, until
-   all points have achieved the required relative error, or the
-   maximum number of iterations have been performed. */
-      for( iter = 0; iter < maxiter && nconv < npoint && astOK; iter++ ) {
-
-/* Use the forward transformation of the supplied PolyMap to transform
-   the current guesses at the required input positions into the
-   corresponding output positions. Store the results in the "work"
-   PointSet. */
-         (void) astTransform( this, result, fwd, work );
-
-/* Modify the work PointSet so that it holds the offsets from the output
-   positions produced by the current input position guesses, and the
-   required output positions. */
-         for( icoord = 0; icoord < ncoord; icoord++ ) {
-            pa = ptr_out[ icoord ];
-            pb = ptr_work[ icoord ];
-            for( ipoint = 0; ipoint< npoint; ipoint++,pa++,pb++ ) {
-               if( *pa != AST__BAD && *pb != AST__BAD ){
-                  *pb = *pa - *pb;
-               } else {
-                  *pb = AST__BAD;
+   all points in the block have achieved the required relative error, or
+   the maximum number of iterations have been performed. */
+         for( iter = 0; iter < maxiter && nact > 0; iter++ ) {
+
+/* Find the required powers of the current guesses at the input axis
+   values, for every active point. */
+            for( icoord = 0; icoord < ncoord; icoord++ ) {
+               pw = pwr[ icoord ];
+               for( k = 0; k < nact; k++ ) pw[ k ] = 1.0;
+               if( mxpow[ icoord ] > 0 ) {
+                  pa = ptr_in[ icoord ];
+                  pb = pw + nb;
+                  for( k = 0; k < nact; k++ ) pb[ k ] = pa[ active[ k ] ];
+                  for( ip = 2; ip <= mxpow[ icoord ]; ip++ ) {
+                     pa = pw + ip*nb;
+                     pb = pa - nb;
+                     for( k = 0; k < nact; k++ ) pa[ k ] = pb[ k ]*pw[ nb + k ];
+                  }
                }
             }
-         }
 
-/* Evaluate the elements of the Jacobian matrix at the current input
-   position guesses. */
-         for( icoord = 0; icoord < ncoord; icoord++ ) {
-            (void) astTransform( jacob[ icoord ], result, 1, ps_jac[ icoord ] );
-         }
+/* Loop round each output of the forward transformation (i.e. each row
+   of the Jacobian matrix). */
+            for( irow = 0; irow < ncoord; irow++ ) {
+
+/* Initialise the output value and the elements of the current row of the
+   Jacobian to zero. */
+               pa = off + irow*nb;
+               pj = jac + irow*ncoord*nb;
+               for( k = 0; k < nact; k++ ) pa[ k ] = 0.0;
+               for( icol = 0; icol < ncoord; icol++ ) {
+                  for( k = 0; k < nact; k++ ) pj[ icol*nb + k ] = 0.0;
+               }
 
-/* For each position, we now invert the matrix equation
+/* Loop round all the coefficients for the current output. */
+               bad = 0;
+               for( ico = 0; ico < ncoeff[ irow ]; ico++ ) {
+                  cof = coeff[ irow ][ ico ];
+                  pow = power[ irow ][ ico ];
+
+/* A bad coefficient produces bad output values. */
+                  if( cof == AST__BAD ) {
+                     bad = 1;
+                     break;
+                  }
+
+/* Add the current term into the output value at every active point. */
+                  for( k = 0; k < nact; k++ ) tv[ k ] = cof;
+                  for( icoord = 0; icoord < ncoord; icoord++ ) {
+                     p = pow[ icoord ];
+                     if( p > 0 ) {
+                        pw = pwr[ icoord ] + p*nb;
+                        for( k = 0; k < nact; k++ ) tv[ k ] *= pw[ k ];
+                     }
+                  }
+                  for( k = 0; k < nact; k++ ) pa[ k ] += tv[ k ];
+
+/* Add the derivative of the current term with respect to each input
+   into the corresponding element of the Jacobian. */
+                  for( icol = 0; icol < ncoord; icol++ ) {
+                     if( pow[ icol ] > 0 ) {
+                        for( k = 0; k < nact; k++ ) tv[ k ] = cof*pow[ icol ];
+                        for( icoord = 0; icoord < ncoord; icoord++ ) {
+                           p = pow[ icoord ];
+                           if( icoord == icol ) p--;
+                           if( p > 0 ) {
+                              pw = pwr[ icoord ] + p*nb;
+                              for( k = 0; k < nact; k++ ) tv[ k ] *= pw[ k ];
+                           }
+                        }
+                        pb = pj + icol*nb;
+                        for( k = 0; k < nact; k++ ) pb[ k ] += tv[ k ];
+                     }
+                  }
+               }
+
+/* Replace the output value with the offset from the output value
+   produced by the current guess to the required output value. */
+               if( bad ) {
+                  for( k = 0; k < nact; k++ ) pa[ k ] = AST__BAD;
+               } else {
+                  pb = ptr_out[ irow ];
+                  for( k = 0; k < nact; k++ ) pa[ k ] = pb[ active[ k ] ] - pa[ k ];
+               }
+            }
+
+/* For each active point, we now invert the matrix equation
 
     Dy = Jacobian.Dx
 
    to find a guess at the vector (dx) holding the offsets from the
-   current input positions guesses to their required values. Loop over all
-   points. */
-         for( ipoint = 0; ipoint < npoint; ipoint++ ) {
-
-/* Do not change positions that have already converged. */
-            if( !flags[ ipoint ] ) {
+   current input positions guesses to their required values. Points that
+   have not yet converged are retained in the list of active points. */
+            newact = 0;
+            for( k = 0; k < nact; k++ ) {
+               ipoint = active[ k ];
 
 /* Get the numerical values for the elements of the Jacobian matrix at
-   the current point. */
+   the current point, and the offset from the current output position to
+   the required output position. */
+               bad = 0;
                pa = mat;
                for( irow = 0; irow < ncoord; irow++ ) {
+                  pj = jac + irow*ncoord*nb + k;
                   for( icol = 0; icol < ncoord; icol++ ) {
-                     *(pa++) = ptr_jac[ icol ][ irow ][ ipoint ];
+                     *(pa++) = pj[ icol*nb ];
                   }
-
-/* Store the offset from the current output position to the required
-   output position. */
-                  vec[ irow ] = ptr_work[ irow ][ ipoint ];
+                  vec[ irow ] = off[ irow*nb + k ];
+                  if( vec[ irow ] == AST__BAD ) bad = 1;
                }
 
-/* Find the corresponding offset from the current input position to the required
-   input position. */
-               palDmat( ncoord, mat, vec, &det, &sing, iw );
+/* Find the corresponding offset from the current input position to the
+   required input position. */
+               sing = 0;
+               if( !bad ) palDmat( ncoord, mat, vec, &det, &sing, iw );
 
-/* If the matrix was singular, the input position cannot be evaluated so
-   store a bad value for it and indicate it has converged. */
-               if( sing ) {
+/* If the output position was bad or the matrix was singular, the input
+   position cannot be evaluated so store a bad value for it. It is not
+   retained in the list of active points. */
+               if( bad || sing ) {
                   for( icoord = 0; icoord < ncoord; icoord++ ) {
                      ptr_in[ icoord ][ ipoint ] = AST__BAD;
                   }
-                  flags[ ipoint ] = 1;
-                  nconv++;
 
 /* Otherwise, update the input position guess. */
                } else {
@@ -2177,13 +2171,12 @@ static void IterInverse( AstPolyMap *this, AstPointSet *out, AstPointSet *result
                      vlensq += (*pa)*(*pa);
                   }
 
-/* Check for convergence. */
-                  if( vlensq <= maxerr*xlensq ) {
-                     flags[ ipoint ] = 1;
-                     nconv++;
-                  }
+/* Retain the point in the list of active points if it has not yet
+   converged. */
+                  if( vlensq > maxerr*xlensq ) active[ newact++ ] = ipoint;
                }
             }
+            nact = newact;
          }
       }
    }
@@ -2192,17 +2185,9 @@ static void IterInverse( AstPolyMap *this, AstPointSet *out, AstPointSet *result
    vec = astFree( vec );
    iw = astFree( iw );
    mat = astFree( mat );
-   flags = astFree( flags );
-   work = astAnnul( work );
-
-   if( ps_jac ) {
-      for( icoord = 0; icoord < ncoord; icoord++ ) {
-         ps_jac[ icoord ] = astAnnul( ps_jac[ icoord ] );
-      }
-      ps_jac = astFree( ps_jac );
-   }
-
-   ptr_jac = astFree( ptr_jac );
+   active = astFree( active );
+   pwr = astFree( pwr );
+   work = astFree( work );
 
 }
 
@@ -2869,9 +2854,7 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
 
 /* Local Variables: */
    AstPolyMap *this;
-   int ic;
    int result;
-   int nc;
 
 /* Initialise */
    result = 0;
@@ -2888,13 +2871,8 @@ static int ManageLock( AstObject *this_object, int mode, int extra,
 
 /* Invoke the astManageLock method on any Objects contained within
    the supplied Object. */
-   if( this->jacobian ) {
-      nc = astGetNin( this );
-      for( ic = 0; ic < nc && result; ic++ ) {
-         result = astManageLock( (this->jacobian)[ ic ], mode,
-                                 extra, fail );
-      }
-   }
+   if( !result && this->lintrunc ) result = astManageLock( this->lintrunc,
+                                                          mode, extra, fail );
 
    return result;
 
@@ -3256,6 +3234,180 @@ static int MPFunc2D( void *p, int m, int n, const double *x, double *fvec,
    return 0;
 }
 
+static void NestArrays( AstPolyMap *this, int forward, int *status ){
+/*
+*  Name:
+*     NestArrays
+
+*  Purpose:
+*     Store the nested form of the polynomials for a single transformation.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "polymap.h"
+*     void NestArrays( AstPolyMap *this, int forward, int *status )
+
+*  Class Membership:
+*     PolyMap member function.
+
+*  Description:
+*     This function re-arranges the coefficients of each polynomial in
+*     the specified transformation into a dense array that can be used
+*     to evaluate the polynomial using Horner's scheme (see
+*     astPolyBlock). Nothing is stored if the transformation has more
+*     than two inputs, if any coefficient is bad, or if the polynomials
+*     are so sparse that a nested scheme would be slower than evaluating
+*     each term separately.
+*
+*     For a transformation with two inputs, element (i,j) of the dense
+*     array for an output holds the sum of the coefficients that use
+*     power "i" of the first input and power "j" of the second input.
+*     Each row of the dense array has "mxpow[1]+1" elements. For a
+*     transformation with one input, the dense array holds a single row.
+*
+*     An associated integer array is also stored for each output. The
+*     first element is the number of rows used by any coefficient, and
+*     element "i+1" is one more than the highest power of the last input
+*     used by any coefficient in row "i" (zero if row "i" is not used).
+
+*  Parameters:
+*     this
+*        The PolyMap.
+*     forward
+*        If non-zero, store the nested form of the forward transformation.
+*        Otherwise, store the nested form of the inverse transformation.
+*     status
+*        Pointer to inherited status.
+*/
+
+/* Local Variables: */
+   double **coeff;               /* Pointer to coefficient value arrays */
+   double **nestcof;             /* Dense coefficient arrays for each output */
+   double *cof;                  /* Dense coefficient array for current output */
+   int ***power;                 /* Pointer to coefficient power arrays */
+   int **nestlen;                /* Row lengths for each output */
+   int *len;                     /* Row lengths for current output */
+   int *mxpow;                   /* Pointer to max used power for each input */
+   int *ncoeff;                  /* Pointer to no. of coefficients */
+   int *pow;                     /* Powers for current coefficient */
+   int i;                        /* Row index */
+   int ico;                      /* Coefficient index */
+   int iout;                     /* Output index */
+   int j;                        /* Column index */
+   int ncol;                     /* No. of columns in each dense array */
+   int ncoord_in;                /* No. of inputs for the transformation */
+   int ncoord_out;               /* No. of outputs for the transformation */
+   int ntot;                     /* Total no. of coefficients */
+   int nnest;                    /* Total no. of nested coefficients */
+   int nrow;                     /* No. of rows in each dense array */
+   int ok;                       /* Can the nested form be used? */
+
+/* Check the global status. */
+   if ( !astOK ) return;
+
+/* Get pointers to the arrays describing the required transformation. */
+   if( forward ) {
+      ncoeff = this->ncoeff_f;
+      coeff = this->coeff_f;
+      power = this->power_f;
+      mxpow = this->mxpow_f;
+      ncoord_in = astGetNin( this );
+      ncoord_out = astGetNout( this );
+   } else {
+      ncoeff = this->ncoeff_i;
+      coeff = this->coeff_i;
+      power = this->power_i;
+      mxpow = this->mxpow_i;
+      ncoord_in = astGetNout( this );
+      ncoord_out = astGetNin( this );
+   }
+
+/* Return without action if the transformation is undefined or has more
+   than two inputs. */
+   if( !ncoeff || !coeff || !power || !mxpow || ncoord_in < 1 ||
+       ncoord_in > 2 ) return;
+
+/* Get the dimensions of the dense coefficient arrays. */
+   nrow = ( ncoord_in == 2 ) ? mxpow[ 0 ] + 1 : 1;
+   ncol = mxpow[ ncoord_in - 1 ] + 1;
+
+/* Allocate arrays to hold pointers to the dense coefficient arrays and
+   row lengths for each output. */
+   nestcof = astCalloc( ncoord_out, sizeof( double * ) );
+   nestlen = astCalloc( ncoord_out, sizeof( int * ) );
+
+/* Loop round each output. */
+   ok = astOK;
+   ntot = 0;
+   nnest = 0;
+   for( iout = 0; iout < ncoord_out && ok; iout++ ) {
+
+/* Allocate the dense coefficient array and row lengths for the current
+   output, initialised to zero. */
+      cof = astCalloc( nrow*ncol, sizeof( double ) );
+      len = astCalloc( nrow + 1, sizeof( int ) );
+      nestcof[ iout ] = cof;
+      nestlen[ iout ] = len;
+      if( !astOK ) {
+         ok = 0;
+         break;
+      }
+
+/* Add each coefficient into the dense array, and record the extent of
+   each row, and the number of rows, used by the coefficients. A bad
+   coefficient prevents the nested form being used. */
+      len[ 0 ] = 1;
+      for( ico = 0; ico < ncoeff[ iout ]; ico++ ) {
+         if( coeff[ iout ][ ico ] == AST__BAD ) {
+            ok = 0;
+            break;
+         }
+         pow = power[ iout ][ ico ];
+         i = ( ncoord_in == 2 ) ? pow[ 0 ] : 0;
+         j = pow[ ncoord_in - 1 ];
+         cof[ i*ncol + j ] += coeff[ iout ][ ico ];
+         if( j + 1 > len[ i + 1 ] ) len[ i + 1 ] = j + 1;
+         if( i + 1 > len[ 0 ] ) len[ 0 ] = i + 1;
+      }
+
+/* Update the total number of coefficients, and the total number of
+   elements that will be used by the nested scheme. */
+      ntot += ncoeff[ iout ];
+      for( i = 0; i < len[ 0 ]; i++ ) nnest += len[ i + 1 ];
+   }
+
+/* The nested form is only used if it does not require many more
+   operations than evaluating each term separately. */
+   if( ok && nnest > 2*ntot ) ok = 0;
+
+/* Store the arrays in the PolyMap, or free them if they cannot be used. */
+   if( ok ) {
+      if( forward ) {
+         this->nestcof_f = nestcof;
+         this->nestlen_f = nestlen;
+      } else {
+         this->nestcof_i = nestcof;
+         this->nestlen_i = nestlen;
+      }
+
+   } else {
+      if( nestcof ) {
+         for( iout = 0; iout < ncoord_out; iout++ ) {
+            nestcof[ iout ] = astFree( nestcof[ iout ] );
+         }
+         nestcof = astFree( nestcof );
+      }
+      if( nestlen ) {
+         for( iout = 0; iout < ncoord_out; iout++ ) {
+            nestlen[ iout ] = astFree( nestlen[ iout ] );
+         }
+         nestlen = astFree( nestlen );
+      }
+   }
+}
+
 static void PolyCoeffs( AstPolyMap *this, int forward, int nel, double *coeffs,
                         int *ncoeff, int *status ){
 /*
@@ -3421,6 +3573,189 @@ f        The global status.
    }
 }
 
+static int PolyBlock( AstPolyMap *this, AstPointSet *in, AstPointSet *out,
+                      int fwd, int *status ){
+/*
+*+
+*  Name:
+*     astPolyBlock
+
+*  Purpose:
+*     Transform a set of points a block at a time.
+
+*  Type:
+*     Protected function.
+
+*  Synopsis:
+*     #include "polymap.h"
+*     int astPolyBlock( AstPolyMap *this, AstPointSet *in, AstPointSet *out,
+*                       int fwd )
+
+*  Class Membership:
+*     PolyMap virtual function.
+
+*  Description:
+*     This function is used by astTransform to evaluate the polynomials
+*     of a transformation for blocks of points, rather than one point at
+*     a time. Each step of the evaluation is applied to every point in a
+*     block before moving on to the next step.
+*
+*     For the base PolyMap class, this is only possible if the
+*     transformation has one or two inputs, in which case the nested form
+*     of each polynomial created when the coefficients were stored (see
+*     function NestArrays) is evaluated using Horner's scheme. Sub-classes
+*     that do not use simple powers of the axis values (e.g. ChebyMap)
+*     must over-ride this method.
+
+*  Parameters:
+*     this
+*        Pointer to the PolyMap.
+*     in
+*        Pointer to the PointSet holding the input positions.
+*     out
+*        Pointer to the PointSet in which to store the output positions.
+*     fwd
+*        Use the foward transformation of the PolyMap? Otherwise, the
+*        inverse transformation is used.
+
+*  Returned Value:
+*     Non-zero if the points were transformed. Zero if astTransform
+*     should transform the points one at a time instead.
+*-
+*/
+
+/* Local Variables: */
+   double **nestcof;                 /* Dense coefficients per output */
+   double **ptr_in;                  /* Input axis values */
+   double **ptr_out;                 /* Output axis values */
+   double *c;                        /* Dense coefficients for output */
+   double *po;                       /* Pointer to output axis values */
+   double *pu;                       /* Pointer to first input axis values */
+   double *pv;                       /* Pointer to last input axis values */
+   double acc[ AST__POLYMAP_BLOCK ]; /* Polynomial in "v" for a row */
+   double cj;                        /* Coefficient value */
+   double res[ AST__POLYMAP_BLOCK ]; /* Output values for the block */
+   double u[ AST__POLYMAP_BLOCK ];   /* Block of first input values */
+   double v[ AST__POLYMAP_BLOCK ];   /* Block of last input values */
+   double x;                         /* Input axis value */
+   int **nestlen;                    /* Row lengths for each output */
+   int *len;                         /* Row lengths for current output */
+   int *mxpow;                       /* Max used power for each input */
+   int badu[ AST__POLYMAP_BLOCK ];   /* Flags for bad "u" values */
+   int badv[ AST__POLYMAP_BLOCK ];   /* Flags for bad "v" values */
+   int block;                        /* Index of first point in block */
+   int i;                            /* Row index */
+   int iout;                         /* Output index */
+   int j;                            /* Column index */
+   int k;                            /* Index of point within block */
+   int n;                            /* No. of coefficients in row */
+   int nb;                           /* No. of points in block */
+   int ncol;                         /* No. of columns in dense arrays */
+   int ncoord_in;                    /* No. of inputs */
+   int ncoord_out;                   /* No. of outputs */
+   int npoint;                       /* Total no. of points */
+   int nrow;                         /* No. of rows in dense array */
+   int usesu;                        /* Does output depend on "u"? */
+   int usesv;                        /* Does output depend on "v"? */
+
+/* Check the local error status. */
+   if ( !astOK ) return 0;
+
+/* Get pointers to the nested form of the required transformation.
+   Return without action if there is no nested form. */
+   nestcof = fwd ? this->nestcof_f : this->nestcof_i;
+   nestlen = fwd ? this->nestlen_f : this->nestlen_i;
+   mxpow = fwd ? this->mxpow_f : this->mxpow_i;
+   if( !nestcof || !nestlen ) return 0;
+
+/* Get the number of points and axes, and pointers to the axis values. */
+   npoint = astGetNpoint( in );
+   ncoord_in = astGetNcoord( in );
+   ncoord_out = astGetNcoord( out );
+   ptr_in = astGetPoints( in );
+   ptr_out = astGetPoints( out );
+   if( !astOK ) return 0;
+
+/* Get the length of each row of the dense coefficient arrays. */
+   ncol = mxpow[ ncoord_in - 1 ] + 1;
+
+/* Get pointers to the input axis values. The polynomials are nested
+   with the first input ("u") on the outside and the last input ("v") on
+   the inside. There is no "u" if there is only one input. */
+   pu = ( ncoord_in == 2 ) ? ptr_in[ 0 ] : NULL;
+   pv = ptr_in[ ncoord_in - 1 ];
+
+/* Loop round each block of points. */
+   for( block = 0; block < npoint; block += AST__POLYMAP_BLOCK ) {
+      nb = astMIN( AST__POLYMAP_BLOCK, npoint - block );
+
+/* Copy the input axis values for the block, noting which are bad and
+   replacing them with zero. */
+      for( k = 0; k < nb; k++ ) {
+         x = pv[ block + k ];
+         badv[ k ] = ( x == AST__BAD );
+         v[ k ] = badv[ k ] ? 0.0 : x;
+         if( pu ) {
+            x = pu[ block + k ];
+            badu[ k ] = ( x == AST__BAD );
+            u[ k ] = badu[ k ] ? 0.0 : x;
+         } else {
+            badu[ k ] = 0;
+            u[ k ] = 0.0;
+         }
+      }
+
+/* Loop round each output. */
+      for( iout = 0; iout < ncoord_out; iout++ ) {
+         c = nestcof[ iout ];
+         len = nestlen[ iout ];
+         nrow = len[ 0 ];
+
+/* Loop round each row of the dense coefficient array, starting with the
+   highest power of "u". Evaluate the polynomial in "v" for the row using
+   Horner's scheme, and then use it as the next coefficient in Horner's
+   scheme for "u". */
+         usesu = ( nrow > 1 );
+         usesv = 0;
+         for( i = nrow - 1; i >= 0; i-- ) {
+            n = len[ i + 1 ];
+            if( n > 1 ) usesv = 1;
+
+            if( n > 0 ) {
+               cj = c[ i*ncol + n - 1 ];
+               for( k = 0; k < nb; k++ ) acc[ k ] = cj;
+               for( j = n - 2; j >= 0; j-- ) {
+                  cj = c[ i*ncol + j ];
+                  for( k = 0; k < nb; k++ ) acc[ k ] = acc[ k ]*v[ k ] + cj;
+               }
+            } else {
+               for( k = 0; k < nb; k++ ) acc[ k ] = 0.0;
+            }
+
+            if( i == nrow - 1 ) {
+               for( k = 0; k < nb; k++ ) res[ k ] = acc[ k ];
+            } else {
+               for( k = 0; k < nb; k++ ) res[ k ] = res[ k ]*u[ k ] + acc[ k ];
+            }
+         }
+
+/* Store the output values. An output value is bad if it depends on any
+   bad input value. */
+         po = ptr_out[ iout ] + block;
+         for( k = 0; k < nb; k++ ) {
+            if( ( usesu && badu[ k ] ) || ( usesv && badv[ k ] ) ) {
+               po[ k ] = AST__BAD;
+            } else {
+               po[ k ] = res[ k ];
+            }
+         }
+      }
+   }
+
+/* Indicate the points have been transformed. */
+   return 1;
+}
+
 static void PolyPowers( AstPolyMap *this, double **work, int ncoord,
                         const int *mxpow, double **ptr, int point,
                         int fwd, int *status ){
@@ -4625,6 +4960,9 @@ static void StoreArrays( AstPolyMap *this, int forward, int ncoeff,
          }
       }
    }
+
+/* Store the nested form of the new polynomials. */
+   NestArrays( this, forward, status );
 }
 
 static int TestAttrib( AstObject *this_object, const char *attrib, int *status ) {
@@ -4815,6 +5153,10 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
    if( !forward && astGetIterInverse(map) ) {
       IterInverse( map, in, result, status );
 
+/* Otherwise, transform blocks of points together if possible, since it
+   is much faster than transforming the points one at a time. */
+   } else if( astPolyBlock( map, in, result, forward ) ) {
+
 /* Otherwise, determine the numbers of points and coordinates per point from
    the input and output PointSets and obtain pointers for accessing the input
    and output coordinate values. */
@@ -5172,7 +5514,11 @@ static void Copy( const AstObject *objin, AstObject *objout, int *status ) {
    out->coeff_i = NULL;
    out->mxpow_i = NULL;
 
-   out->jacobian = NULL;
+   out->nestcof_f = NULL;
+   out->nestlen_f = NULL;
+   out->nestcof_i = NULL;
+   out->nestlen_i = NULL;
+
    out->lintrunc = NULL;
 
 /* Get the number of inputs and outputs of the uninverted Mapping. */
@@ -5253,6 +5599,10 @@ static void Copy( const AstObject *objin, AstObject *objout, int *status ) {
       }
    }
 
+/* Create the nested form of the polynomials. */
+   NestArrays( out, 1, status );
+   NestArrays( out, 0, status );
+
 /* Copy the linear truncation of the PolyMap - if it has been found. */
    if( in->lintrunc ) out->lintrunc = astCopy( in->lintrunc );
 
@@ -5301,10 +5651,6 @@ static void Delete( AstObject *obj, int *status ) {
 
 /* Local Variables: */
    AstPolyMap *this;
-   int nc;
-   int ic;
-   int lstat;
-   int error;
 
 /* Obtain a pointer to the PolyMap structure. */
    this = (AstPolyMap *) obj;
@@ -5313,28 +5659,6 @@ static void Delete( AstObject *obj, int *status ) {
    FreeArrays( this, 1, status );
    FreeArrays( this, 0, status );
 
-/* Free the resources used to store the Jacobian of the forward
-   transformation. */
-   if( this->jacobian ) {
-
-/* Get the number of PolyMap inputs. We need to clear any error status
-   first since astGetNin returns zero if an error has occurred. The
-   Jacobian will only be non-NULL if the number of inputs and outputs
-   are equal. */
-      error = !astOK;
-      if( error ) {
-         lstat = astStatus;
-         astClearStatus;
-      }
-      nc = astGetNin( this );
-      if( error ) astSetStatus( lstat );
-
-      for( ic = 0; ic < nc; ic++ ) {
-         (this->jacobian)[ ic ] = astAnnul( (this->jacobian)[ ic ] );
-      }
-      this->jacobian = astFree( this->jacobian );
-   }
-
 /* Free the linear truncation. */
    if( this->lintrunc ) this->lintrunc = astAnnul( this->lintrunc );
 }
@@ -5912,6 +6236,11 @@ AstPolyMap *astInitPolyMap_( void *mem, size_t size, int init,
       new->coeff_i = NULL;
       new->mxpow_i = NULL;
 
+      new->nestcof_f = NULL;
+      new->nestlen_f = NULL;
+      new->nestcof_i = NULL;
+      new->nestlen_i = NULL;
+
 /* Store the forward transformation. */
       StoreArrays( new, 1, ncoeff_f, coeff_f, status );
 
@@ -5922,7 +6251,6 @@ AstPolyMap *astInitPolyMap_( void *mem, size_t size, int init,
       new->iterinverse = -INT_MAX;
       new->niterinverse = -INT_MAX;
       new->tolinverse = AST__BAD;
-      new->jacobian = NULL;
       new->lintrunc = NULL;
 
 /* If an error occurred, clean up by deleting the new PolyMap. */
@@ -6060,6 +6388,12 @@ AstPolyMap *astLoadPolyMap_( void *mem, size_t size,
    nin = ( (AstMapping *) new )->nin;
    nout = ( (AstMapping *) new )->nout;
 
+/* Initialise the pointers to the nested form of the polynomials. */
+      new->nestcof_f = NULL;
+      new->nestlen_f = NULL;
+      new->nestcof_i = NULL;
+      new->nestlen_i = NULL;
+
 /* Read input data. */
 /* ================ */
 /* Request the input Channel to read all the input data appropriate to
@@ -6237,9 +6571,9 @@ AstPolyMap *astLoadPolyMap_( void *mem, size_t size,
       new->tolinverse = astReadDouble( channel, "tolinv", AST__BAD );
       if ( TestTolInverse( new, status ) ) SetTolInverse( new, new->tolinverse, status );
 
-/* The Jacobian of the PolyMap's forward transformation has not yet been
-   found. */
-      new->jacobian = NULL;
+/* Create the nested form of the polynomials. */
+      NestArrays( new, 1, status );
+      NestArrays( new, 0, status );
 
 /* The linear truncation of the PolyMap has not yet been found. */
       new->lintrunc = NULL;
@@ -6275,6 +6609,12 @@ void astPolyPowers_( AstPolyMap *this, double **work, int ncoord,
                                            point, fwd, status );
 }
 
+int astPolyBlock_( AstPolyMap *this, AstPointSet *in, AstPointSet *out,
+                   int fwd, int *status ){
+   if ( !astOK ) return 0;
+   return (**astMEMBER(this,PolyMap,PolyBlock))( this, in, out, fwd, status );
+}
+
 AstPolyMap *astPolyTran_( AstPolyMap *this, int forward, double acc,
                           double maxacc, int maxorder, const double *lbnd,
                           const double *ubnd, int *status ){
@@ -112,6 +112,13 @@
 *  History:
 *     28-SEP-2003 (DSB):
 *        Original version.
+*     17-OCT-2026 (DSB):
+*        Remove the "jacobian" component. The iterative inverse now
+*        evaluates the Jacobian directly from the forward coefficients.
+*     17-OCT-2026 (DSB):
+*        Add components holding the nested form of each polynomial, the
+*        protected astPolyBlock method, and the AST__POLYMAP_BLOCK
+*        constant.
 *-
 */
 
@@ -140,6 +147,11 @@
 #  define  __attribute__(x)  /*NOTHING*/
 #endif
 
+#if defined(astCLASS)            /* Protected */
+/* The maximum number of points transformed together by astPolyBlock. */
+#define AST__POLYMAP_BLOCK 128
+#endif
+
 /* Type Definitions. */
 /* ================= */
 /* PolyMap structure. */
@@ -163,7 +175,10 @@ typedef struct AstPolyMap {
    int iterinverse;           /* Use an iterative inverse? */
    int niterinverse;          /* Max number of iterations for iterative inverse */
    double tolinverse;         /* Target relative error for iterative inverse */
-   struct AstPolyMap **jacobian;/* PolyMaps defining Jacobian of forward transformation */
+   double **nestcof_f;        /* Dense nested form of each forward polynomial */
+   int **nestlen_f;           /* Row lengths for each forward nested form */
+   double **nestcof_i;        /* Dense nested form of each inverse polynomial */
+   int **nestlen_i;           /* Row lengths for each inverse nested form */
    AstMapping *lintrunc;      /* A linear truncation of the PolyMap */
 } AstPolyMap;
 
@@ -196,6 +211,7 @@ typedef struct AstPolyMapVtab {
 /* Properties (e.g. methods) specific to this class. */
    AstPolyMap *(* PolyTran)( AstPolyMap *, int, double, double, int, const double *, const double *, int * );
    void (* PolyPowers)( AstPolyMap *, double **, int, const int *, double **, int, int, int * );
+   int (* PolyBlock)( AstPolyMap *, AstPointSet *, AstPointSet *, int, int * );
    void (* PolyCoeffs)( AstPolyMap *, int, int, double *, int *, int *);
    void (* FitPoly1DInit)( AstPolyMap *, int, double **, AstMinPackData *, double *, int *);
    void (* FitPoly2DInit)( AstPolyMap *, int, double **, AstMinPackData *, double *, int *);
@@ -271,6 +287,7 @@ void astPolyCoeffs_( AstPolyMap *, int, int, double *, int *, int *);
 
 # if defined(astCLASS)           /* Protected */
    void astPolyPowers_( AstPolyMap *, double **, int, const int *, double **, int, int, int * );
+   int astPolyBlock_( AstPolyMap *, AstPointSet *, AstPointSet *, int, int * );
    void astFitPoly1DInit_( AstPolyMap *, int, double **, AstMinPackData *, double *, int *);
    void astFitPoly2DInit_( AstPolyMap *, int, double **, AstMinPackData *, double *, int *);
 
@@ -347,6 +364,8 @@ astINVOKE(V,astPolyCoeffs_(astCheckPolyMap(this),forward,nel,coeffs,ncoeff,STATU
 
 #define astPolyPowers(this,work,ncoord,mxpow,ptr,offset,fwd) \
         astINVOKE(V,astPolyPowers_(astCheckPolyMap(this),work,ncoord,mxpow,ptr,point,fwd,STATUS_PTR))
+#define astPolyBlock(this,in,out,fwd) \
+        astINVOKE(V,astPolyBlock_(astCheckPolyMap(this),astCheckPointSet(in),astCheckPointSet(out),fwd,STATUS_PTR))
 #define astFitPoly1DInit(this,forward,table,data,scales) \
         astINVOKE(V,astFitPoly1DInit_(astCheckPolyMap(this),forward,table,data,scales,STATUS_PTR))
 #define astFitPoly2DInit(this,forward,table,data,scales) \
@@ -64,6 +64,9 @@
 *        been conditioned differently to the WCSLIB code in order to improve
 *        accuracy of the floor function for arguments very slightly below an
 *        integer value.
+*     -  Added array versions of the forward and reverse functions for the
+*        TAN, SIN, ARC, ZEA, CAR, AIT and HPX projections (astTANfwdN,
+*        astTANrevN, etc), which transform many points in a single call.
 
 *=============================================================================
 *
@@ -194,6 +197,43 @@
 *                           2: Invalid value of (x,y).
 *                           1: Invalid projection parameters.
 *
+*   Array transformations; *fwdN() and *revN()
+*   -------------------------------------------
+*   The TAN, SIN, ARC, ZEA, CAR, AIT and HPX projections also have array
+*   versions of the forward and reverse routines (e.g. astTANfwdN() and
+*   astTANrevN()), which transform "n" points in a single call. They give
+*   the same results as calling the scalar routines for each point in
+*   turn, but avoid the per-point function call and set-up overheads.
+*
+*   Given:
+*      n        const int
+*                        Number of points.
+*      phi,     const double[]
+*      theta             (*fwdN) Native longitudes and latitudes, in degrees.
+*      x,y      const double[]
+*                        (*revN) Projected coordinates.
+*
+*   Given and returned:
+*      prj      AstPrjPrm*  Projection parameters.
+*      stat     int[]    Status for each point. On entry, this should be
+*                        zero for each point that is to be transformed.
+*                        Points with a non-zero entry are not transformed,
+*                        and the corresponding output values are undefined.
+*                        On exit, holds 2 for each point that could not be
+*                        transformed (with undefined output values).
+*
+*   Returned:
+*      x,y      double[] (*fwdN) Projected coordinates.
+*      phi,     double[] (*revN) Native longitudes and latitudes, in
+*      theta             degrees.
+*
+*   The output arrays may be the same as the input arrays.
+*
+*   Function return value:
+*               int      Error status
+*                           0: Success.
+*                           1: Invalid projection parameters.
+*
 *   Projection parameters
 *   ---------------------
 *   The AstPrjPrm struct consists of the following:
@@ -914,6 +954,84 @@ double *phi, *theta;
    return 0;
 }
 
+/*--------------------------------------------------------------------------*/
+
+int astTANfwdN(n, phi, theta, prj, x, y, stat)
+
+const int n;
+const double phi[], theta[];
+struct AstPrjPrm *prj;
+double x[], y[];
+int stat[];
+
+{
+   int i;
+   double cphi, cthe, r, r0, s, sphi, the;
+
+   if (abs(prj->flag) != WCS__TAN) {
+      if (astTANset(prj)) return 1;
+   }
+
+   r0 = prj->r0;
+   for (i = 0; i < n; i++) {
+      if (stat[i]) continue;
+
+      the = theta[i];
+      astSinCosd(phi[i], &sphi, &cphi);
+      astSinCosd(the, &s, &cthe);
+      if (s == 0.0) {
+         stat[i] = 2;
+         continue;
+      }
+
+      r =  r0*cthe/s;
+      x[i] =  r*sphi;
+      y[i] = -r*cphi;
+
+      if (prj->flag > 0 && s < 0.0) {
+         stat[i] = 2;
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------*/
+
+int astTANrevN(n, x, y, prj, phi, theta, stat)
+
+const int n;
+const double x[], y[];
+struct AstPrjPrm *prj;
+double phi[], theta[];
+int stat[];
+
+{
+   int i;
+   double r, r0, xi, yi;
+
+   if (abs(prj->flag) != WCS__TAN) {
+      if (astTANset(prj)) return 1;
+   }
+
+   r0 = prj->r0;
+   for (i = 0; i < n; i++) {
+      if (stat[i]) continue;
+
+      xi = x[i];
+      yi = y[i];
+      r = sqrt(xi*xi + yi*yi);
+      if (r == 0.0) {
+         phi[i] = 0.0;
+      } else {
+         phi[i] = astATan2d(xi, -yi);
+      }
+      theta[i] = astATan2d(r0, r);
+   }
+
+   return 0;
+}
+
 /*============================================================================
 *   STG: stereographic projection.
 *
@@ -1204,6 +1322,175 @@ double *phi, *theta;
    return 0;
 }
 
+/*--------------------------------------------------------------------------*/
+
+int astSINfwdN(n, phi, theta, prj, x, y, stat)
+
+const int n;
+const double phi[], theta[];
+struct AstPrjPrm *prj;
+double x[], y[];
+int stat[];
+
+{
+   int i;
+   double cphi, cthe, p1, p2, r0, sphi, t, the, z;
+
+   if (abs(prj->flag) != WCS__SIN) {
+      if (astSINset(prj)) return 1;
+   }
+
+   r0 = prj->r0;
+   p1 = prj->p[1];
+   p2 = prj->p[2];
+   for (i = 0; i < n; i++) {
+      if (stat[i]) continue;
+
+      the = theta[i];
+      t = (90.0 - fabs(the))*D2R;
+      if (t < 1.0e-5) {
+         if (the > 0.0) {
+            z = t*t/2.0;
+         } else {
+            z = 2.0 - t*t/2.0;
+         }
+         cthe = t;
+      } else {
+         astSinCosd(the, &z, &cthe);
+         z = 1.0 - z;
+      }
+
+      astSinCosd(phi[i], &sphi, &cphi);
+      x[i] =  r0*(cthe*sphi + p1*z);
+      y[i] = -r0*(cthe*cphi - p2*z);
+
+      /* Validate this solution. */
+      if (prj->flag > 0) {
+         if (prj->w[1] == 0.0) {
+            /* Orthographic projection. */
+            if (the < 0.0) {
+               stat[i] = 2;
+            }
+         } else {
+            /* "Synthesis" projection. */
+            t = -astATand(p1*sphi - p2*cphi);
+            if (the < t) {
+               stat[i] = 2;
+            }
+         }
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------*/
+
+int astSINrevN(n, x, y, prj, phi, theta, stat)
+
+const int n;
+const double x[], y[];
+struct AstPrjPrm *prj;
+double phi[], theta[];
+int stat[];
+
+{
+   const double tol = 1.0e-13;
+   int i;
+   double a, b, c, d, r2, sth1, sth2, sthe, sxy, x0, x1, xp, y0, y1, yp, z;
+
+   if (abs(prj->flag) != WCS__SIN) {
+      if (astSINset(prj)) return 1;
+   }
+
+   x1 = prj->p[1];
+   y1 = prj->p[2];
+   for (i = 0; i < n; i++) {
+      if (stat[i]) continue;
+
+      /* Compute intermediaries. */
+      x0 = x[i]*prj->w[0];
+      y0 = y[i]*prj->w[0];
+      r2 = x0*x0 + y0*y0;
+
+      if (prj->w[1] == 0.0) {
+         /* Orthographic projection. */
+         if (r2 != 0.0) {
+            phi[i] = astATan2d(x0, -y0);
+         } else {
+            phi[i] = 0.0;
+         }
+
+         if (r2 < 0.5) {
+            theta[i] = astACosd(sqrt(r2));
+         } else if (r2 <= 1.0) {
+            theta[i] = astASind(sqrt(1.0 - r2));
+         } else {
+            stat[i] = 2;
+         }
+
+      } else {
+         /* "Synthesis" projection. */
+         sxy = x0*x1 + y0*y1;
+
+         if (r2 < 1.0e-10) {
+            /* Use small angle formula. */
+            z = r2/2.0;
+            theta[i] = 90.0 - R2D*sqrt(r2/(1.0 + sxy));
+
+         } else {
+            a = prj->w[2];
+            b = sxy - prj->w[1];
+            c = r2 - sxy - sxy + prj->w[3];
+            d = b*b - a*c;
+
+            /* Check for a solution. */
+            if (d < 0.0) {
+               stat[i] = 2;
+               continue;
+            }
+            d = sqrt(d);
+
+            /* Choose solution closest to pole. */
+            sth1 = (-b + d)/a;
+            sth2 = (-b - d)/a;
+            sthe = (sth1 > sth2) ? sth1 : sth2;
+            if (sthe > 1.0) {
+               if (sthe-1.0 < tol) {
+                  sthe = 1.0;
+               } else {
+                  sthe = (sth1 < sth2) ? sth1 : sth2;
+               }
+            }
+
+            if (sthe < -1.0) {
+               if (sthe+1.0 > -tol) {
+                  sthe = -1.0;
+               }
+            }
+
+            if (sthe > 1.0 || sthe < -1.0) {
+               stat[i] = 2;
+               continue;
+            }
+
+            theta[i] = astASind(sthe);
+            z = 1.0 - sthe;
+         }
+
+         xp = -y0 + y1*z;
+         yp =  x0 - x1*z;
+         if (xp == 0.0 && yp == 0.0) {
+            phi[i] = 0.0;
+         } else {
+            phi[i] = astATan2d(yp,xp);
+         }
+      }
+   }
+
+   return 0;
+}
+
 /*============================================================================
 *   ARC: zenithal/azimuthal equidistant projection.
 *
@@ -1294,6 +1581,73 @@ double *phi, *theta;
    return 0;
 }
 
+/*--------------------------------------------------------------------------*/
+
+int astARCfwdN(n, phi, theta, prj, x, y, stat)
+
+const int n;
+const double phi[], theta[];
+struct AstPrjPrm *prj;
+double x[], y[];
+int stat[];
+
+{
+   int i;
+   double cphi, r, sphi, w0;
+
+   if (prj->flag != WCS__ARC) {
+      if (astARCset(prj)) return 1;
+   }
+
+   w0 = prj->w[0];
+   for (i = 0; i < n; i++) {
+      if (stat[i]) continue;
+
+      r =  w0*(90.0 - theta[i]);
+      astSinCosd(phi[i], &sphi, &cphi);
+      x[i] =  r*sphi;
+      y[i] = -r*cphi;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------*/
+
+int astARCrevN(n, x, y, prj, phi, theta, stat)
+
+const int n;
+const double x[], y[];
+struct AstPrjPrm *prj;
+double phi[], theta[];
+int stat[];
+
+{
+   int i;
+   double r, w1, xi, yi;
+
+   if (prj->flag != WCS__ARC) {
+      if (astARCset(prj)) return 1;
+   }
+
+   w1 = prj->w[1];
+   for (i = 0; i < n; i++) {
+      if (stat[i]) continue;
+
+      xi = x[i];
+      yi = y[i];
+      r = sqrt(xi*xi + yi*yi);
+      if (r == 0.0) {
+         phi[i] = 0.0;
+      } else {
+         phi[i] = astATan2d(xi, -yi);
+      }
+      theta[i] = 90.0 - r*w1;
+   }
+
+   return 0;
+}
+
 /*============================================================================
 *   ZPN: zenithal/azimuthal polynomial projection.
 *
@@ -1647,6 +2001,85 @@ double *phi, *theta;
    return 0;
 }
 
+/*--------------------------------------------------------------------------*/
+
+int astZEAfwdN(n, phi, theta, prj, x, y, stat)
+
+const int n;
+const double phi[], theta[];
+struct AstPrjPrm *prj;
+double x[], y[];
+int stat[];
+
+{
+   int i;
+   double cphi, r, sphi, w0;
+
+   if (prj->flag != WCS__ZEA) {
+      if (astZEAset(prj)) return 1;
+   }
+
+   w0 = prj->w[0];
+   for (i = 0; i < n; i++) {
+      if (stat[i]) continue;
+
+      r =  w0*astSind((90.0 - theta[i])/2.0);
+      astSinCosd(phi[i], &sphi, &cphi);
+      x[i] =  r*sphi;
+      y[i] = -r*cphi;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------*/
+
+int astZEArevN(n, x, y, prj, phi, theta, stat)
+
+const int n;
+const double x[], y[];
+struct AstPrjPrm *prj;
+double phi[], theta[];
+int stat[];
+
+{
+   int i;
+   double r, s, w0, w1, xi, yi;
+   const double tol = 1.0e-12;
+
+   if (prj->flag != WCS__ZEA) {
+      if (astZEAset(prj)) return 1;
+   }
+
+   w0 = prj->w[0];
+   w1 = prj->w[1];
+   for (i = 0; i < n; i++) {
+      if (stat[i]) continue;
+
+      xi = x[i];
+      yi = y[i];
+      r = sqrt(xi*xi + yi*yi);
+      if (r == 0.0) {
+         phi[i] = 0.0;
+      } else {
+         phi[i] = astATan2d(xi, -yi);
+      }
+
+      s = r*w1;
+      if (fabs(s) > 1.0) {
+         if (fabs(r - w0) < tol) {
+            theta[i] = -90.0;
+         } else {
+            stat[i] = 2;
+         }
+      } else {
+         theta[i] = 90.0 - 2.0*astASind(s);
+      }
+   }
+
+   return 0;
+}
+
 /*============================================================================
 *   AIR: Airy's projection.
 *
@@ -2148,6 +2581,62 @@ double *phi, *theta;
    return 0;
 }
 
+/*--------------------------------------------------------------------------*/
+
+int astCARfwdN(n, phi, theta, prj, x, y, stat)
+
+const int n;
+const double phi[], theta[];
+struct AstPrjPrm *prj;
+double x[], y[];
+int stat[];
+
+{
+   int i;
+   double w0;
+
+   if (prj->flag != WCS__CAR) {
+      if (astCARset(prj)) return 1;
+   }
+
+   /* No point can be invalid, so transform every point (including any
+      that are to be ignored) in a single loop with no branches. */
+   w0 = prj->w[0];
+   for (i = 0; i < n; i++) {
+      x[i] = w0*phi[i];
+      y[i] = w0*theta[i];
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------*/
+
+int astCARrevN(n, x, y, prj, phi, theta, stat)
+
+const int n;
+const double x[], y[];
+struct AstPrjPrm *prj;
+double phi[], theta[];
+int stat[];
+
+{
+   int i;
+   double w1;
+
+   if (prj->flag != WCS__CAR) {
+      if (astCARset(prj)) return 1;
+   }
+
+   w1 = prj->w[1];
+   for (i = 0; i < n; i++) {
+      phi[i]   = w1*x[i];
+      theta[i] = w1*y[i];
+   }
+
+   return 0;
+}
+
 /*============================================================================
 *   MER: Mercator's projection.
 *
@@ -2682,6 +3171,95 @@ double *phi, *theta;
    return 0;
 }
 
+/*--------------------------------------------------------------------------*/
+
+int astAITfwdN(n, phi, theta, prj, x, y, stat)
+
+const int n;
+const double phi[], theta[];
+struct AstPrjPrm *prj;
+double x[], y[];
+int stat[];
+
+{
+   int i;
+   double chphi, cthe, shphi, sthe, w, w0;
+
+   if (prj->flag != WCS__AIT) {
+      if (astAITset(prj)) return 1;
+   }
+
+   w0 = prj->w[0];
+   for (i = 0; i < n; i++) {
+      if (stat[i]) continue;
+
+      astSinCosd(phi[i]/2.0, &shphi, &chphi);
+      astSinCosd(theta[i], &sthe, &cthe);
+      w = sqrt(w0/(1.0 + cthe*chphi));
+      x[i] = 2.0*w*cthe*shphi;
+      y[i] = w*sthe;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------*/
+
+int astAITrevN(n, x, y, prj, phi, theta, stat)
+
+const int n;
+const double x[], y[];
+struct AstPrjPrm *prj;
+double phi[], theta[];
+int stat[];
+
+{
+   int i;
+   double s, u, xi, xp, yi, yp, z;
+   const double tol = 1.0e-13;
+
+   if (prj->flag != WCS__AIT) {
+      if (astAITset(prj)) return 1;
+   }
+
+   for (i = 0; i < n; i++) {
+      if (stat[i]) continue;
+
+      xi = x[i];
+      yi = y[i];
+      u = 1.0 - xi*xi*prj->w[2] - yi*yi*prj->w[1];
+      if (u < 0.0) {
+         if (u < -tol) {
+            stat[i] = 2;
+            continue;
+         }
+
+         u = 0.0;
+      }
+
+      z = sqrt(u);
+      s = z*yi/prj->r0;
+      if (fabs(s) > 1.0) {
+         if (fabs(s) > 1.0+tol) {
+            stat[i] = 2;
+            continue;
+         }
+         s = copysign(1.0,s);
+      }
+
+      xp = 2.0*z*z - 1.0;
+      yp = z*xi*prj->w[3];
+      if (xp == 0.0 && yp == 0.0) {
+         phi[i] = 0.0;
+      } else {
+         phi[i] = 2.0*astATan2d(yp, xp);
+      }
+      theta[i] = astASind(s);
+   }
+
+   return 0;
+}
+
 /*============================================================================
 *   COP: conic perspective projection.
 *
@@ -4611,6 +5189,140 @@ double *phi, *theta;
    return 0;
 }
 
+/*--------------------------------------------------------------------------*/
+
+int astHPXfwdN(n, phi, theta, prj, x, y, stat)
+
+const int n;
+const double phi[], theta[];
+struct AstPrjPrm *prj;
+double x[], y[];
+int stat[];
+
+{
+   double abssin, p1, phic, phii, sigma, sinthe, the;
+   int hodd, hodd0, i;
+
+   if( prj->flag != WCS__HPX ) {
+      if( astHPXset( prj ) ) return 1;
+   }
+
+   p1 = prj->p[1];
+   hodd0 = ((int)p1) % 2;
+   for( i = 0; i < n; i++ ) {
+      if( stat[ i ] ) continue;
+
+      phii = phi[ i ];
+      the = theta[ i ];
+      sinthe = astSind( the );
+      abssin = fabs( sinthe );
+
+/* Equatorial zone */
+      if( abssin <= prj->w[2] ) {
+         x[ i ] =  prj->w[0] * phii;
+         y[ i ] = prj->w[8] * sinthe;
+
+/* Polar zone (see astHPXfwd) */
+      } else {
+         hodd = hodd0;
+         if( !prj->n && the <= 0.0 ) hodd = 1 - hodd;
+         if( hodd ) {
+            phic = -180.0 + (2.0*floor( prj->w[7] * phii + 1/2 ) + p1 ) * prj->w[6];
+         } else {
+            phic = -180.0 + (2.0*floor( prj->w[7] * phii ) +  p1 + 1 ) * prj->w[6];
+         }
+
+         sigma = sqrt( prj->p[2]*( 1.0 - abssin ));
+
+         x[ i ] = prj->w[0] *( phic + ( phii - phic )*sigma );
+
+         y[ i ] = prj->w[9] * ( prj->w[4] - sigma );
+         if( the < 0 ) y[ i ] = -y[ i ];
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------*/
+
+int astHPXrevN(n, x, y, prj, phi, theta, stat)
+
+const int n;
+const double x[], y[];
+struct AstPrjPrm *prj;
+double phi[], theta[];
+int stat[];
+
+{
+   double absy, p1, sigma, t, xc, xi, yi, yr;
+   int hodd, hodd0, i;
+
+   if (prj->flag != WCS__HPX) {
+      if (astHPXset(prj)) return 1;
+   }
+
+   p1 = prj->p[1];
+   hodd0 = ((int)p1) % 2;
+   for( i = 0; i < n; i++ ) {
+      if( stat[ i ] ) continue;
+
+      xi = x[ i ];
+      yi = y[ i ];
+      yr = prj->w[1]*yi;
+      absy = fabs( yr );
+
+/* Equatorial zone */
+      if( absy <= prj->w[5] ) {
+         t = yr/prj->w[3];
+         if( t < -1.0 || t > 1.0 ) {
+            stat[ i ] = 2;
+         } else {
+            phi[ i ] = prj->w[1] * xi;
+            theta[ i ] = astASind( t );
+         }
+
+/* Polar zone (see astHPXrev) */
+      } else if( absy <= 90 ){
+         hodd = hodd0;
+         if( !prj->n && yr <= 0.0 ) hodd = 1 - hodd;
+         if( hodd ) {
+            xc = -180.0 + (2.0*floor( prj->w[7] * xi + 1/2 ) + p1 ) * prj->w[6];
+         } else {
+            xc = -180.0 + (2.0*floor( prj->w[7] * xi ) +  p1 + 1 ) * prj->w[6];
+         }
+
+         sigma = prj->w[4] - absy / prj->w[6];
+
+         if( sigma == 0.0 ) {
+            stat[ i ] = 2;
+            continue;
+         }
+
+         t = ( xi - xc )/sigma;
+         if( fabs( t ) <= prj->w[6] ) {
+            phi[ i ] = prj->w[1] *( xc + t );
+         } else {
+            stat[ i ] = 2;
+            continue;
+         }
+
+         t = 1.0 - sigma*sigma/prj->p[2];
+         if( t < -1.0 || t > 1.0 ) {
+            stat[ i ] = 2;
+         } else {
+            theta[ i ] = astASind( t );
+            if( yi < 0 ) theta[ i ] = -theta[ i ];
+         }
+
+      } else {
+         stat[ i ] = 2;
+      }
+   }
+
+   return 0;
+}
+
 /*============================================================================
 *   XPH: HEALPix polar, aka "butterfly" projection.
 *
@@ -47,6 +47,8 @@
 *        tpn.c).
 *     -  Added prototypes for HPX projection functions.
 *     -  Added prototypes for XPH projection functions.
+*     -  Added prototypes for array versions of the TAN, SIN, ARC, ZEA,
+*        CAR, AIT and HPX projection functions.
 *===========================================================================*/
 
 #ifndef WCSLIB_PROJ_INCLUDED
@@ -90,21 +92,29 @@ struct AstPrjPrm {
    int astTANset(struct AstPrjPrm *);
    int astTANfwd(const double, const double, struct AstPrjPrm *, double *, double *);
    int astTANrev(const double, const double, struct AstPrjPrm *, double *, double *);
+   int astTANfwdN(const int, const double [], const double [], struct AstPrjPrm *, double [], double [], int []);
+   int astTANrevN(const int, const double [], const double [], struct AstPrjPrm *, double [], double [], int []);
    int astSTGset(struct AstPrjPrm *);
    int astSTGfwd(const double, const double, struct AstPrjPrm *, double *, double *);
    int astSTGrev(const double, const double, struct AstPrjPrm *, double *, double *);
    int astSINset(struct AstPrjPrm *);
    int astSINfwd(const double, const double, struct AstPrjPrm *, double *, double *);
    int astSINrev(const double, const double, struct AstPrjPrm *, double *, double *);
+   int astSINfwdN(const int, const double [], const double [], struct AstPrjPrm *, double [], double [], int []);
+   int astSINrevN(const int, const double [], const double [], struct AstPrjPrm *, double [], double [], int []);
    int astARCset(struct AstPrjPrm *);
    int astARCfwd(const double, const double, struct AstPrjPrm *, double *, double *);
    int astARCrev(const double, const double, struct AstPrjPrm *, double *, double *);
+   int astARCfwdN(const int, const double [], const double [], struct AstPrjPrm *, double [], double [], int []);
+   int astARCrevN(const int, const double [], const double [], struct AstPrjPrm *, double [], double [], int []);
    int astZPNset(struct AstPrjPrm *);
    int astZPNfwd(const double, const double, struct AstPrjPrm *, double *, double *);
    int astZPNrev(const double, const double, struct AstPrjPrm *, double *, double *);
    int astZEAset(struct AstPrjPrm *);
    int astZEAfwd(const double, const double, struct AstPrjPrm *, double *, double *);
    int astZEArev(const double, const double, struct AstPrjPrm *, double *, double *);
+   int astZEAfwdN(const int, const double [], const double [], struct AstPrjPrm *, double [], double [], int []);
+   int astZEArevN(const int, const double [], const double [], struct AstPrjPrm *, double [], double [], int []);
    int astAIRset(struct AstPrjPrm *);
    int astAIRfwd(const double, const double, struct AstPrjPrm *, double *, double *);
    int astAIRrev(const double, const double, struct AstPrjPrm *, double *, double *);
@@ -117,6 +127,8 @@ struct AstPrjPrm {
    int astCARset(struct AstPrjPrm *);
    int astCARfwd(const double, const double, struct AstPrjPrm *, double *, double *);
    int astCARrev(const double, const double, struct AstPrjPrm *, double *, double *);
+   int astCARfwdN(const int, const double [], const double [], struct AstPrjPrm *, double [], double [], int []);
+   int astCARrevN(const int, const double [], const double [], struct AstPrjPrm *, double [], double [], int []);
    int astMERset(struct AstPrjPrm *);
    int astMERfwd(const double, const double, struct AstPrjPrm *, double *, double *);
    int astMERrev(const double, const double, struct AstPrjPrm *, double *, double *);
@@ -132,6 +144,8 @@ struct AstPrjPrm {
    int astAITset(struct AstPrjPrm *);
    int astAITfwd(const double, const double, struct AstPrjPrm *, double *, double *);
    int astAITrev(const double, const double, struct AstPrjPrm *, double *, double *);
+   int astAITfwdN(const int, const double [], const double [], struct AstPrjPrm *, double [], double [], int []);
+   int astAITrevN(const int, const double [], const double [], struct AstPrjPrm *, double [], double [], int []);
    int astCOPset(struct AstPrjPrm *);
    int astCOPfwd(const double, const double, struct AstPrjPrm *, double *, double *);
    int astCOPrev(const double, const double, struct AstPrjPrm *, double *, double *);
@@ -162,6 +176,8 @@ struct AstPrjPrm {
    int astHPXset(struct AstPrjPrm *);
    int astHPXfwd(const double, const double, struct AstPrjPrm *, double *, double *);
    int astHPXrev(const double, const double, struct AstPrjPrm *, double *, double *);
+   int astHPXfwdN(const int, const double [], const double [], struct AstPrjPrm *, double [], double [], int []);
+   int astHPXrevN(const int, const double [], const double [], struct AstPrjPrm *, double [], double [], int []);
    int astXPHset(struct AstPrjPrm *);
    int astXPHfwd(const double, const double, struct AstPrjPrm *, double *, double *);
    int astXPHrev(const double, const double, struct AstPrjPrm *, double *, double *);
@@ -232,6 +232,10 @@ f     - AST_SHOWMESH: Display a mesh of points on the surface of a Region
 *     1-DEC-2016 (DSB):
 *        Changed MapRegion to remove any unnecessary base frame axes in
 *        the returned Region.
+*     17-OCT-2026 (DSB):
+*        Added protected method astRegScan, and use it in astMask<X> to
+*        rasterise 2-dimensional Regions a row at a time, rather than
+*        testing every pixel centre individually.
 *class--
 
 *  Implementation Notes:
@@ -922,6 +926,7 @@ static const char *Format( AstFrame *, int, double, int * );
 static const char *SystemString( AstFrame *, AstSystemType, int * );
 static const int *GetPerm( AstFrame *, int * );
 static double *RegCentre( AstRegion *, double *, double **, int, int, int * );
+static unsigned char *MaskScan( AstRegion *, int, const int[], const int[], int * );
 static double Angle( AstFrame *, const double[], const double[], const double[], int * );
 static double AxAngle( AstFrame *, const double[], const double[], int, int * );
 static double AxDistance( AstFrame *, int, double, double, int * );
@@ -944,6 +949,7 @@ static int RegDummyFS( AstRegion *, int * );
 static int RegPins( AstRegion *, AstPointSet *, AstRegion *, int **, int * );
 static int SubFrame( AstFrame *, AstFrame *, int, const int *, const int *, AstMapping **, AstFrame **, int * );
 static int RegTrace( AstRegion *, int, double *, double **, int * );
+static int RegScan( AstRegion *, double, int *, double **, int * );
 static int Unformat( AstFrame *, int, const char *, double *, int * );
 static int ValidateAxis( AstFrame *, int, int, const char *, int * );
 static void AxNorm( AstFrame *, int, int, int, double *, int * );
@@ -4543,6 +4549,7 @@ void astInitRegionVtab_(  AstRegionVtab *vtab, const char *name, int *status ) {
 
    vtab->ResetCache = ResetCache;
    vtab->RegTrace = RegTrace;
+   vtab->RegScan = RegScan;
    vtab->GetBounded = GetBounded;
    vtab->TestUnc = TestUnc;
    vtab->ClearUnc = ClearUnc;
@@ -5890,12 +5897,17 @@ static int Mask##X( AstRegion *this, AstMapping *map, int inside, int ndim, \
    int *ubndg;                   /* Pointer to array holding upper grid bounds */ \
    int idim;                     /* Loop counter for coordinate dimensions */ \
    int ipix;                     /* Loop counter for pixel index */ \
+   int ix;                       /* Grid coordinate on first axis */ \
+   int iy;                       /* Grid coordinate on second axis */ \
    int nax;                      /* Number of Region axes */ \
    int nin;                      /* Number of Mapping input coordinates */ \
    int nout;                     /* Number of Mapping output coordinates */ \
    int npix;                     /* Number of pixels in supplied array */ \
    int npixg;                    /* Number of pixels in bounding box */ \
+   int outval;                   /* Mask pixels outside the bounding box? */ \
    int result;                   /* Result value to return */ \
+   unsigned char *mask;          /* Pixels in bounding box to be masked */ \
+   unsigned char *m;             /* Pointer to next mask element */ \
 \
 /* Initialise. */ \
    result = 0; \
@@ -6014,6 +6026,46 @@ static int Mask##X( AstRegion *this, AstMapping *map, int inside, int ndim, \
 /* If the bounding box is null, return without action. */ \
       } else if( npixg > 0 && astOK ) { \
 \
+/* For 2-dimensional Regions, first try to rasterise the Region a row at \
+   a time within the bounding box. This returns NULL if the Region cannot \
+   be handled in this way. */ \
+         mask = ( ndim == 2 ) ? MaskScan( used_region, inside, lbndg, ubndg, \
+                                          status ) : NULL; \
+         if( mask ) { \
+\
+/* Pixels outside the bounding box are assigned the mask value if the \
+   outside of the Region is being masked (or the inside of a negated \
+   Region). Pixels inside the bounding box are assigned the mask value \
+   if they are flagged in the array returned by MaskScan. */ \
+            outval = ( ( inside != 0 ) == ( astGetNegated( used_region ) != 0 ) ); \
+            c = in; \
+            m = mask; \
+            for( iy = lbnd[ 1 ]; iy <= ubnd[ 1 ]; iy++ ) { \
+               if( iy < lbndg[ 1 ] || iy > ubndg[ 1 ] ) { \
+                  if( outval ) { \
+                     for( ix = lbnd[ 0 ]; ix <= ubnd[ 0 ]; ix++ ) c[ ix - lbnd[ 0 ] ] = val; \
+                     result += ubnd[ 0 ] - lbnd[ 0 ] + 1; \
+                  } \
+               } else { \
+                  if( outval ) { \
+                     for( ix = lbnd[ 0 ]; ix < lbndg[ 0 ]; ix++ ) c[ ix - lbnd[ 0 ] ] = val; \
+                     for( ix = ubndg[ 0 ] + 1; ix <= ubnd[ 0 ]; ix++ ) c[ ix - lbnd[ 0 ] ] = val; \
+                     result += ubnd[ 0 ] - lbnd[ 0 ] - ubndg[ 0 ] + lbndg[ 0 ]; \
+                  } \
+                  for( ix = lbndg[ 0 ]; ix <= ubndg[ 0 ]; ix++, m++ ) { \
+                     if( *m ) { \
+                        c[ ix - lbnd[ 0 ] ] = val; \
+                        result++; \
+                     } \
+                  } \
+               } \
+               c += ubnd[ 0 ] - lbnd[ 0 ] + 1; \
+            } \
+            mask = astFree( mask ); \
+\
+/* Otherwise, use astResample to test each pixel centre individually. */ \
+         } else { \
+\
 /* All points outside this box are either all inside, or all outside, the \
    Region. So we can speed up processing by setting all the points which are \
    outside the box to the supplied data value (if required). This is \
@@ -6021,54 +6073,55 @@ static int Mask##X( AstRegion *this, AstMapping *map, int inside, int ndim, \
    of the Region. We do this by supplying an alternative output array to \
    the resampling function below, which has been pre-filled with "val" at \
    every pixel. */ \
-         if( ( inside != 0 ) == ( astGetNegated( used_region ) != 0 ) ) { \
+            if( ( inside != 0 ) == ( astGetNegated( used_region ) != 0 ) ) { \
 \
 /* Allocate memory for the alternative output array, and fill it with \
    "val". */ \
-            tmp_out = astMalloc( sizeof( Xtype )*(size_t) npix ); \
-            if( tmp_out ) { \
-               c = tmp_out; \
-               for( ipix = 0; ipix < npix; ipix++ ) *(c++) = val; \
-               result = npix - npixg; \
-            } \
+               tmp_out = astMalloc( sizeof( Xtype )*(size_t) npix ); \
+               if( tmp_out ) { \
+                  c = tmp_out; \
+                  for( ipix = 0; ipix < npix; ipix++ ) *(c++) = val; \
+                  result = npix - npixg; \
+               } \
 \
 /* Indicate that we will use this temporary array rather than the \
    supplied array. */ \
-            out = tmp_out; \
+               out = tmp_out; \
 \
 /* If the outside of the grid box is outside the region of interest it \
    will be unchanged in the resturned array. Therefore we can use the \
    supplied array as the output array below. */ \
-         } else { \
-            tmp_out = NULL; \
-            out = in; \
-         } \
+            } else { \
+               tmp_out = NULL; \
+               out = in; \
+            } \
 \
 /* Temporarily invert the Region if required. The Region Transform methods \
    leave interior points unchanged and assign AST__BAD to exterior points. \
    This is the opposite of what we want (which is to leave exterior \
    points unchanged and assign VAL to interior points), so we negate the \
    region if the inside is to be assigned the value VAL.*/ \
-         if( inside ) astNegate( used_region ); \
+            if( inside ) astNegate( used_region ); \
 \
 /* Invoke astResample to mask just the region inside the bounding box found \
    above (specified by lbndg and ubndg), since all the points outside this \
    box will already contain their required value. */ \
-         result += astResample##X( used_region, ndim, lbnd, ubnd, in, NULL, AST__NEAREST, \
-                                   NULL, NULL, 0, 0.0, 100, val, ndim, \
-                                   lbnd, ubnd, lbndg, ubndg, out, NULL ); \
+            result += astResample##X( used_region, ndim, lbnd, ubnd, in, NULL, AST__NEAREST, \
+                                      NULL, NULL, 0, 0.0, 100, val, ndim, \
+                                      lbnd, ubnd, lbndg, ubndg, out, NULL ); \
 \
 /* Revert to the original setting of the Negated attribute. */ \
-         if( inside ) astNegate( used_region ); \
+            if( inside ) astNegate( used_region ); \
 \
 /* If required, copy the output data from the temporary output array to \
    the supplied array, and then free the temporary output array. */ \
-         if( tmp_out ) { \
-            c = tmp_out; \
-            d = in; \
-            for( ipix = 0; ipix < npix; ipix++ ) *(d++) = *(c++); \
-            tmp_out = astFree( tmp_out ); \
-         }\
+            if( tmp_out ) { \
+               c = tmp_out; \
+               d = in; \
+               for( ipix = 0; ipix < npix; ipix++ ) *(d++) = *(c++); \
+               tmp_out = astFree( tmp_out ); \
+            } \
+         } \
       }\
    } \
 \
@@ -6105,6 +6158,234 @@ MAKE_MASK(F,float)
 /* Undefine the macro. */
 #undef MAKE_MASK
 
+static unsigned char *MaskScan( AstRegion *this, int inside, const int lbnd[],
+                                const int ubnd[], int *status ){
+/*
+*  Name:
+*     MaskScan
+
+*  Purpose:
+*     Identify the pixels in a 2D grid to be assigned a mask value.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "region.h"
+*     unsigned char *MaskScan( AstRegion *this, int inside, const int lbnd[],
+*                              const int ubnd[], int *status )
+
+*  Class Membership:
+*     Region member function
+
+*  Description:
+*     This function is used by the astMask<X> methods to find the pixels
+*     that are to be assigned the mask value, in the case of a
+*     2-dimensional Region that has already been mapped into grid
+*     coordinates. Rather than testing each pixel centre individually,
+*     it uses the astRegScan method to find where each row of the grid
+*     crosses the Region boundary, and classifies each run of pixels
+*     between crossings in one go. Only pixels close to a crossing are
+*     tested individually, using the Transform method of the Region,
+*     so the results are identical to those of astResample<X>.
+
+*  Parameters:
+*     this
+*        Pointer to the Region. Its current Frame should describe grid
+*        coordinates.
+*     inside
+*        The "inside" value supplied to astMask<X>.
+*     lbnd
+*        The grid coordinates at the centre of the first pixel in the
+*        section of the grid to be processed.
+*     ubnd
+*        The grid coordinates at the centre of the last pixel in the
+*        section of the grid to be processed.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     A pointer to a newly allocated array with one element for each
+*     pixel in the grid section, holding 1 for pixels that are to be
+*     assigned the mask value and 0 for all others. It should be freed
+*     using astFree when no longer needed. NULL is returned if the
+*     Region cannot be rasterised in this way (for instance, if its
+*     class does not implement astRegScan, or if the Region is not
+*     defined directly in grid coordinates).
+
+*  Notes:
+*     - NULL is returned if this function is invoked with the global
+*     error status set, or if it should fail for any reason.
+*/
+
+/* Local Variables: */
+   AstMapping *map;              /* Base->current Mapping in the Region */
+   AstPointSet *pset_in;         /* Positions of pixels to be tested */
+   AstPointSet *pset_out;        /* Transformed pixel positions */
+   AstRegion *reg;               /* Region to be rasterised */
+   double **ptr_in;              /* Pointers to positions to be tested */
+   double **ptr_out;             /* Pointers to transformed positions */
+   double *x;                    /* Crossing intervals for current row */
+   double xhi;                   /* Upper limit of crossing interval */
+   double xlo;                   /* Lower limit of crossing interval */
+   int *cand;                    /* Indices of pixels to be tested */
+   int icand;                    /* Index of next pixel to be tested */
+   int ix;                       /* Zero-based column index */
+   int ix0;                      /* First column in crossing interval */
+   int ix1;                      /* Last column in crossing interval */
+   int ixc;                      /* Index of crossing interval */
+   int iy;                       /* Zero-based row index */
+   int ncand;                    /* Number of pixels to be tested */
+   int neg;                      /* Is the used Region negated? */
+   int nx;                       /* Number of crossing intervals */
+   int nxp;                      /* Number of columns */
+   int nyp;                      /* Number of rows */
+   int ok;                       /* Can the Region be rasterised? */
+   unsigned char *result;        /* Returned array */
+   unsigned char *row;           /* Pointer to start of current row */
+   unsigned char *tog;           /* Parity changes for current row */
+   unsigned char parity;         /* Parity of current pixel */
+
+/* Initialise */
+   result = NULL;
+
+/* Check the global error status. */
+   if( !astOK ) return result;
+
+/* As in astMask<X>, the pixels that are to be assigned the mask value
+   are those that are outside the Region, after negating the Region if
+   the inside is to be masked. Negate the Region now (rather than after
+   finding the crossings), since some classes of Region cache
+   information that depends on the Negated attribute. */
+   if( inside ) astNegate( this );
+
+/* The pixels close to the boundary are tested below using the Transform
+   method. To ensure the results are the same as astResample<X>, use a
+   simplified copy of the Region in the same circumstances that
+   astResample<X> would. */
+   nxp = ubnd[ 0 ] - lbnd[ 0 ] + 1;
+   nyp = ubnd[ 1 ] - lbnd[ 1 ] + 1;
+   if( nxp*nyp > 1024 ) {
+      reg = (AstRegion *) astSimplify( this );
+   } else {
+      reg = astClone( this );
+   }
+
+/* See if the class of Region supports the astRegScan method. */
+   x = NULL;
+   ok = astIsARegion( reg ) && astRegScan( reg, AST__BAD, &nx, &x );
+
+/* The crossings are found in the base Frame of the Region, so we can
+   only use them if the base Frame is the same as the current Frame (grid
+   coordinates). */
+   if( ok ) {
+      map = astRegMapping( reg );
+      ok = astIsAUnitMap( map );
+      map = astAnnul( map );
+   }
+
+/* Allocate the returned array, and another to record the columns at
+   which the parity of the current row changes. */
+   cand = NULL;
+   ncand = 0;
+   if( ok ) {
+      result = astMalloc( sizeof( unsigned char )*(size_t) nxp*(size_t) nyp );
+      tog = astMalloc( sizeof( unsigned char )*(size_t)( nxp + 1 ) );
+      neg = astGetNegated( reg );
+   } else {
+      tog = NULL;
+      neg = 0;
+   }
+
+/* Loop round each row of the grid. */
+   for( iy = 0; iy < nyp && ok && astOK; iy++ ) {
+      row = result + (size_t) iy*(size_t) nxp;
+
+/* Get the crossing intervals for the row. */
+      (void) astRegScan( reg, (double)( lbnd[ 1 ] + iy ), &nx, &x );
+      if( !astOK ) break;
+
+/* The parity of a pixel that is not within any interval is given by the
+   number of intervals that lie wholly below it. Record the first column
+   above the upper limit of each interval. */
+      memset( tog, 0, (size_t)( nxp + 1 ) );
+      for( ixc = 0; ixc < nx; ixc++ ) {
+         xhi = x[ 2*ixc + 1 ] - lbnd[ 0 ];
+         if( xhi < 0.0 ) {
+            tog[ 0 ] ^= 1;
+         } else if( xhi < nxp ) {
+            tog[ (int) xhi + 1 ] ^= 1;
+         }
+      }
+
+/* Pixels with odd parity are inside the un-negated Region. Store 1 for
+   the pixels that are to be assigned the mask value. */
+      parity = 0;
+      for( ix = 0; ix < nxp; ix++ ) {
+         parity ^= tog[ ix ];
+         row[ ix ] = neg ? parity : !parity;
+      }
+
+/* Flag the pixels within each interval (using the value 2), and record
+   their indices so that they can be tested individually below. */
+      for( ixc = 0; ixc < nx; ixc++ ) {
+         xlo = x[ 2*ixc ] - lbnd[ 0 ];
+         xhi = x[ 2*ixc + 1 ] - lbnd[ 0 ];
+         if( xhi >= 0.0 && xlo <= nxp - 1 ) {
+            ix0 = ( xlo <= 0.0 ) ? 0 : (int) ceil( xlo );
+            ix1 = ( xhi >= nxp - 1 ) ? nxp - 1 : (int) floor( xhi );
+            for( ix = ix0; ix <= ix1; ix++ ) {
+               if( row[ ix ] != 2 ) {
+                  row[ ix ] = 2;
+                  cand = astGrow( cand, ncand + 1, sizeof( int ) );
+                  if( !astOK ) break;
+                  cand[ ncand++ ] = iy*nxp + ix;
+               }
+            }
+         }
+      }
+   }
+
+/* Test the pixels close to the boundary using the Transform method of
+   the Region, exactly as astResample<X> would. Pixels that transform
+   to bad values are outside the (possibly negated) Region. */
+   if( ncand > 0 && astOK ) {
+      pset_in = astPointSet( ncand, 2, "", status );
+      ptr_in = astGetPoints( pset_in );
+      if( astOK ) {
+         for( icand = 0; icand < ncand; icand++ ) {
+            ptr_in[ 0 ][ icand ] = lbnd[ 0 ] + cand[ icand ] % nxp;
+            ptr_in[ 1 ][ icand ] = lbnd[ 1 ] + cand[ icand ] / nxp;
+         }
+      }
+      pset_out = astTransform( reg, pset_in, 1, NULL );
+      ptr_out = astGetPoints( pset_out );
+      if( astOK ) {
+         for( icand = 0; icand < ncand; icand++ ) {
+            result[ cand[ icand ] ] = ( ptr_out[ 0 ][ icand ] == AST__BAD ||
+                                        ptr_out[ 1 ][ icand ] == AST__BAD );
+         }
+      }
+      pset_out = astAnnul( pset_out );
+      pset_in = astAnnul( pset_in );
+   }
+
+/* Revert to the original setting of the Negated attribute. */
+   reg = astAnnul( reg );
+   if( inside ) astNegate( this );
+
+/* Free resources. */
+   cand = astFree( cand );
+   tog = astFree( tog );
+   x = astFree( x );
+
+/* Free the result if an error occurred. */
+   if( !astOK ) result = astFree( result );
+
+/* Return the result. */
+   return result;
+}
+
 
 
 static int Match( AstFrame *this_frame, AstFrame *target, int matchsub,
@@ -9452,6 +9733,72 @@ static void RegOverlay( AstRegion *this, AstRegion *that, int unc, int *status )
 
 }
 
+static int RegScan( AstRegion *this, double y, int *nx, double **x,
+                    int *status ){
+/*
+*+
+*  Name:
+*     astRegScan
+
+*  Purpose:
+*     Find where a row of constant Y crosses the boundary of a 2D Region.
+
+*  Type:
+*     Protected function.
+
+*  Synopsis:
+*     #include "region.h"
+*     int astRegScan( AstRegion *this, double y, int *nx, double **x )
+
+*  Class Membership:
+*     Region virtual function
+
+*  Description:
+*     This function finds the places at which a line of constant value
+*     on the second axis of the base Frame of the supplied 2-dimensional
+*     Region crosses the boundary of the Region. It is used to rasterise
+*     Regions a row at a time.
+*
+*     Each crossing is returned as an interval along the first base
+*     Frame axis that is guaranteed to contain the crossing. The
+*     intervals are padded by at least one unit on each side so that
+*     rounding errors cannot move a crossing outside its interval.
+*     Points on the line that are not within any interval are inside
+*     the Region if they have an odd number of intervals wholly below
+*     them, and are outside the Region otherwise. Points within an
+*     interval should be tested individually using the Transform method
+*     of the Region. The Negated attribute of the Region is ignored.
+
+*  Parameters:
+*     this
+*        Pointer to the Region.
+*     y
+*        The value on the second base Frame axis at which the crossings
+*        are required. If this is AST__BAD, the function returns
+*        without action (but the returned function value still
+*        indicates if the method is supported or not).
+*     nx
+*        Pointer to an int in which to return the number of intervals.
+*     x
+*        Address of a pointer to an array in which to return the lower
+*        and upper bounds of each interval, ordered (lo,hi,lo,hi,...).
+*        The array is extended if necessary using astGrow, so the
+*        supplied pointer may be NULL. It should be freed using astFree
+*        when no longer needed. The intervals are not in any particular
+*        order, and may overlap.
+
+*  Returned Value:
+*     Non-zero if the astRegScan method is implemented by the class of
+*     Region supplied, and is able to handle the base Frame of the
+*     Region. Zero otherwise.
+
+*-
+*/
+
+/* Concrete sub-classes of Region may over-ride this method. */
+   return 0;
+}
+
 static void RegSetAttrib( AstRegion *this, const char *asetting,
                           char **base_setting, int *status ) {
 /*
@@ -13249,6 +13596,10 @@ int astRegTrace_( AstRegion *this, int n, double *dist, double **ptr, int *statu
    if ( !astOK ) return 0;
    return (**astMEMBER(this,Region,RegTrace))( this, n, dist, ptr, status );
 }
+int astRegScan_( AstRegion *this, double y, int *nx, double **x, int *status ){
+   if ( !astOK ) return 0;
+   return (**astMEMBER(this,Region,RegScan))( this, y, nx, x, status );
+}
 void astGetRegionBounds_( AstRegion *this, double *lbnd, double *ubnd, int *status ){
    if ( !astOK ) return;
    (**astMEMBER(this,Region,GetRegionBounds))( this, lbnd, ubnd, status );
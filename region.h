@@ -58,6 +58,8 @@
 *        Original version.
 *     2-MAR-2006 (DSB):
 *        Changed AST_LONG_DOUBLE to HAVE_LONG_DOUBLE.
+*     17-OCT-2026 (DSB):
+*        Added protected astRegScan method.
 *-
 */
 
@@ -158,6 +160,7 @@ typedef struct AstRegionVtab {
    AstRegion *(* RegBasePick)( AstRegion *this, int, const int *, int * );
    void (* ResetCache)( AstRegion *, int * );
    int (* RegTrace)( AstRegion *, int, double *, double **, int * );
+   int (* RegScan)( AstRegion *, double, int *, double **, int * );
    void (* SetUnc)( AstRegion *, AstRegion *, int * );
    void (* SetRegFS)( AstRegion *, AstFrame *, int * );
    double *(* RegCentre)( AstRegion *, double *, double **, int, int, int * );
@@ -310,6 +313,7 @@ double *astRegCentre_( AstRegion *, double *, double **, int, int, int * );
 double *astRegTranPoint_( AstRegion *, double *, int, int, int * );
 void astResetCache_( AstRegion *, int * );
 int astRegTrace_( AstRegion *, int, double *, double **, int * );
+int astRegScan_( AstRegion *, double, int *, double **, int * );
 
 int astGetNegated_( AstRegion *, int * );
 int astTestNegated_( AstRegion *, int * );
@@ -462,6 +466,7 @@ astINVOKE(V,astGetRegionPoints_(astCheckRegion(this),maxpoint,maxcoord,npoint,po
 #define astTestUnc(this) astINVOKE(V,astTestUnc_(astCheckRegion(this),STATUS_PTR))
 #define astResetCache(this) astINVOKE(V,astResetCache_(astCheckRegion(this),STATUS_PTR))
 #define astRegTrace(this,n,dist,ptr) astINVOKE(V,astRegTrace_(astCheckRegion(this),n,dist,ptr,STATUS_PTR))
+#define astRegScan(this,y,nx,x) astINVOKE(V,astRegScan_(astCheckRegion(this),y,nx,x,STATUS_PTR))
 
 /* Since a NULL PointSet pointer is acceptable for "out", we must omit the
    argument checking in that case. (But unfortunately, "out" then gets
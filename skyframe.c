@@ -349,6 +349,9 @@ f     - AST_SKYOFFSETMAP: Obtain a Mapping from absolute to offset coordinates
 *        Added dtai to AstSkyLastTable.
 *     10-APR-2017 (GSB):
 *        Added macro to test floating point equality and used it for Dtai.
+*     17-OCT-2026 (DSB):
+*        Record the number of times LAST values are found in the cache,
+*        and add astSkyLastCacheStats to return them.
 *class--
 */
 
@@ -869,6 +872,11 @@ static double piby2;
 static int nlast_tables = 0;
 static AstSkyLastTable **last_tables = NULL;
 
+/* The number of times a LAST value was found, or not found, in the above
+   tables. These should only be accessed when mutex2 is locked. */
+static size_t nlast_hit = 0;
+static size_t nlast_miss = 0;
+
 
 /* Define macros for accessing each item of thread specific global data. */
 #ifdef THREAD_SAFE
@@ -1268,6 +1276,15 @@ static double CalcLAST( AstSkyFrame *this, double epoch, double obslon,
    result = GetCachedLAST( this, epoch, obslon, obslat, obsalt, dut1, dtai,
                            status );
 
+/* Record whether the value was found in the cache. */
+   LOCK_MUTEX2
+   if( result == AST__BAD ) {
+      nlast_miss++;
+   } else {
+      nlast_hit++;
+   }
+   UNLOCK_MUTEX2
+
 /* If not, we do an exact calculation from scratch. */
    if( result == AST__BAD ) {
 
@@ -12320,6 +12337,57 @@ AstSkyFrame *astLoadSkyFrame_( void *mem, size_t size,
    return new;
 }
 
+void astSkyLastCacheStats_( size_t *nhit, size_t *nmiss, int *status ) {
+/*
+*+
+*  Name:
+*     astSkyLastCacheStats
+
+*  Purpose:
+*     Get statistics describing the use of the cache of LAST values.
+
+*  Type:
+*     Protected function.
+
+*  Synopsis:
+*     #include "skyframe.h"
+*     void astSkyLastCacheStats( size_t *nhit, size_t *nmiss )
+
+*  Class Membership:
+*     SkyFrame method.
+
+*  Description:
+*     This function returns the number of times that a Local Apparent
+*     Sidereal Time value required by a SkyFrame was determined from the
+*     cache of previously calculated LAST values, and the number of times
+*     it had to be calculated from scratch. This information may be used
+*     to tune the cache.
+
+*  Parameters:
+*     nhit
+*        Returned holding the number of times the LAST value was found in
+*        the cache.
+*     nmiss
+*        Returned holding the number of times the LAST value was not found
+*        in the cache.
+
+*-
+*/
+
+/* Initialise. */
+   *nhit = 0;
+   *nmiss = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Return the statistics. */
+   LOCK_MUTEX2
+   *nhit = nlast_hit;
+   *nmiss = nlast_miss;
+   UNLOCK_MUTEX2
+}
+
 /* Virtual function interfaces. */
 /* ============================ */
 /* These provide the external interface to the virtual functions defined by
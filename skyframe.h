@@ -105,6 +105,8 @@
 *        Moved dut1 to the Frame class.
 *     6-APR-2017 (GSB):
 *        Added dtai to AstSkyLastTable.
+*     17-OCT-2026 (DSB):
+*        Added astSkyLastCacheStats.
 *-
 */
 
@@ -324,6 +326,9 @@ AstSkyFrame *astLoadSkyFrame_( void *, size_t, AstSkyFrameVtab *,
 #if defined(THREAD_SAFE)
 void astInitSkyFrameGlobals_( AstSkyFrameGlobals * );
 #endif
+
+/* Other functions. */
+void astSkyLastCacheStats_( size_t *, size_t *, int * );
 #endif
 
 /* Prototypes for member functions. */
@@ -418,6 +423,9 @@ astINVOKE(O,astInitSkyFrame_(mem,size,init,vtab,name,STATUS_PTR))
 #define astLoadSkyFrame(mem,size,vtab,name,channel) \
 astINVOKE(O,astLoadSkyFrame_(mem,size,vtab,name,astCheckChannel(channel),STATUS_PTR))
 
+/* Other functions. */
+#define astSkyLastCacheStats(nhit,nmiss) astSkyLastCacheStats_(nhit,nmiss,STATUS_PTR)
+
 #endif
 
 /* Interfaces to public member functions. */
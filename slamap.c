@@ -119,6 +119,18 @@ f     - AST_SLAADD: Add a celestial coordinate conversion to an SlaMap
 *        Added method astSlaIsEmpty.
 *     30-NOV-2016 (DSB):
 *        Added a "narg" argumeent to astSlaAdd.
+*     17-OCT-2026 (DSB):
+*        In astTransform, combine adjacent conversions that are rigid
+*        rotations into a single rotation matrix, and apply it in a
+*        single pass.
+*     17-OCT-2026 (DSB):
+*        Replace the single-entry per-thread cache of palMappa results with
+*        small least-recently-used caches of palMappa and palEvp results
+*        that are shared by all threads (see astSlaMappa and astSlaEvp).
+*     17-OCT-2026 (DSB):
+*        Apply the AMP and MAP conversions to blocks of points using
+*        private functions Ampqk and Mapqkz, rather than calling palAmpqk
+*        and palMapqkz for each point.
 
 *class--
 */
@@ -174,6 +186,10 @@ f     - AST_SLAADD: Add a celestial coordinate conversion to an SlaMap
 #define R2D (180.0/PI)
 #define AS2R (PI/648000.0)
 
+/* The number of points processed together by functions Ampqk and
+   Mapqkz. */
+#define SLA_BLOCK 128
+
 /* Include files. */
 /* ============== */
 /* Interface definitions. */
@@ -198,6 +214,7 @@ f     - AST_SLAADD: Add a celestial coordinate conversion to an SlaMap
 /* C header files. */
 /* --------------- */
 #include <ctype.h>
+#include <math.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <string.h>
@@ -220,8 +237,6 @@ static AstPointSet *(* parent_transform)( AstMapping *, AstPointSet *, int, AstP
 /* Define how to initialise thread-specific globals. */
 #define GLOBAL_inits \
    globals->Class_Init = 0; \
-   globals->Eq_Cache = AST__BAD; \
-   globals->Ep_Cache = AST__BAD; \
 
 /* Create the function that initialises global data for this module. */
 astMAKE_INITGLOBALS(SlaMap)
@@ -229,30 +244,51 @@ astMAKE_INITGLOBALS(SlaMap)
 /* Define macros for accessing each item of thread specific global data. */
 #define class_init astGLOBAL(SlaMap,Class_Init)
 #define class_vtab astGLOBAL(SlaMap,Class_Vtab)
-#define eq_cache astGLOBAL(SlaMap,Eq_Cache)
-#define ep_cache astGLOBAL(SlaMap,Ep_Cache)
-#define amprms_cache astGLOBAL(SlaMap,Amprms_Cache)
 
+#include <pthread.h>
 
+/* A mutex used to protect the caches of star-independent parameters,
+   which are shared by all threads. */
+static pthread_mutex_t mutex1 = PTHREAD_MUTEX_INITIALIZER;
+#define LOCK_MUTEX1 pthread_mutex_lock( &mutex1 );
+#define UNLOCK_MUTEX1 pthread_mutex_unlock( &mutex1 );
 
 /* If thread safety is not needed, declare and initialise globals at static
    variables. */
 #else
 
-/* A cache used to store the most recent results from palMappa in order
-   to avoid continuously recalculating the same values. */
-static double eq_cache = AST__BAD;
-static double ep_cache = AST__BAD;
-static double amprms_cache[ 21 ];
-
 
 /* Define the class virtual function table and its initialisation flag
    as static variables. */
 static AstSlaMapVtab class_vtab;   /* Virtual function table */
 static int class_init = 0;       /* Virtual function table initialised? */
 
+#define LOCK_MUTEX1
+#define UNLOCK_MUTEX1
+
 #endif
 
+/* Caches used to store the most recent results from palMappa and
+   palEvp, in order to avoid continuously recalculating the same values.
+   Each cache holds up to SLA_CACHE_SIZE entries, in order of decreasing
+   time since last use. Each entry is identified by two keys (e.g. the
+   equinox and date passed to palMappa) and holds up to SLA_CACHE_NVAL
+   values. The caches are shared by all threads, and should only be
+   accessed when mutex1 is locked. */
+#define SLA_CACHE_SIZE 8
+#define SLA_CACHE_NVAL 21
+
+typedef struct SlaCache {
+   double key[ SLA_CACHE_SIZE ][ 2 ];  /* The keys for each entry */
+   double value[ SLA_CACHE_SIZE ][ SLA_CACHE_NVAL ]; /* Cached values */
+   int nentry;                         /* Number of entries in use */
+   size_t nhit;                        /* Number of successful searches */
+   size_t nmiss;                       /* Number of unsuccessful searches */
+} SlaCache;
+
+static SlaCache mappa_cache;
+static SlaCache evp_cache;
+
 /* External Interface Function Prototypes. */
 /* ======================================= */
 /* The following functions have public prototypes only (i.e. no
@@ -266,9 +302,13 @@ static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *,
 static const char *CvtString( int, const char **, int *, const char *[ MAX_SLA_ARGS ], int * );
 static int CvtCode( const char *, int * );
 static int Equal( AstObject *, AstObject *, int * );
+static int CacheGet( SlaCache *, double, double, int, double *, int * );
 static int MapMerge( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
+static int RotMat( int, const double *, int, double[3][3], int * );
 static int SlaIsEmpty( AstSlaMap *, int * );
 static void AddSlaCvt( AstSlaMap *, int, int, const double *, int * );
+static void Ampqk( int, double *, double *, double[21], int * );
+static void CachePut( SlaCache *, double, double, int, const double *, int * );
 static void Copy( const AstObject *, AstObject *, int * );
 static void De2h( double, double, double, double, double *, double *, int * );
 static void Dh2e( double, double, double, double, double *, double *, int * );
@@ -285,6 +325,7 @@ static void Haqc( double, double[3][3], double[3], int * );
 static void Gsec( double, double[3][3], double[3], int * );
 static void STPConv( double, int, int, int, double[3], double *[3], int, double[3], double *[3], int * );
 static void J2000H( int, int, double *, double *, int * );
+static void Mapqkz( int, double *, double *, double[21], int * );
 
 static int GetObjSize( AstObject *, int * );
 
@@ -801,6 +842,334 @@ static void AddSlaCvt( AstSlaMap *this, int cvttype, int narg,
    }
 }
 
+static void Ampqk( int npoint, double *alpha, double *delta,
+                   double amprms[21], int *status ) {
+/*
+*  Name:
+*     Ampqk
+
+*  Purpose:
+*     Convert a set of positions from apparent to mean place.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "slamap.h"
+*     void Ampqk( int npoint, double *alpha, double *delta,
+*                 double amprms[21], int *status )
+
+*  Class Membership:
+*     SlaMap member function.
+
+*  Description:
+*     This function converts a set of positions from geocentric apparent
+*     to mean place, producing the same results as calling palAmpqk for
+*     each position. The positions are processed in blocks. Each step of
+*     the conversion is applied to all the positions in a block before
+*     moving on to the next step, which allows the compiler to vectorise
+*     the arithmetic.
+*
+*     The iterative removal of light deflection is ended as soon as it
+*     leaves all the positions in a block unchanged. Since each
+*     iteration depends only on the result of the previous iteration,
+*     any further iterations would also leave the positions unchanged,
+*     so this does not affect the results.
+
+*  Parameters:
+*     npoint
+*        The number of positions.
+*     alpha
+*        The apparent RA of each position (radians). Returned holding
+*        the mean RA.
+*     delta
+*        The apparent Dec of each position (radians). Returned holding
+*        the mean Dec.
+*     amprms
+*        The star-independent mean to apparent parameters (see palMappa).
+*     status
+*        Pointer to the inherited status variable.
+
+*  Notes:
+*     - Bad values are returned for any position that has a bad RA or Dec.
+*/
+
+/* Local Variables: */
+   double *r;                    /* Precession/nutation matrix */
+   double ab1;                   /* sqrt(1-v*v), v = Earth speed */
+   double ab1p1;                 /* ab1 + 1 */
+   double abv[ 3 ];              /* Earth velocity wrt SSB */
+   double ehn[ 3 ];              /* Unit vector from Sun to Earth */
+   double gr2e;                  /* Light deflection parameter */
+   double p1dv;                  /* Dot product of p1 and abv */
+   double p1dvp1;                /* p1dv + 1 */
+   double p1[ 3 ][ SLA_BLOCK ];  /* Positions with aberration removed */
+   double p2[ 3 ][ SLA_BLOCK ];  /* Apparent positions in mean frame */
+   double p[ 3 ][ SLA_BLOCK ];   /* Positions with deflection removed */
+   double pde;                   /* Dot product of p and ehn */
+   double pdep1;                 /* pde + 1 */
+   double q[ 3 ];                /* Work vector */
+   double v[ 3 ];                /* Cartesian position */
+   double w;                     /* Work value */
+   int changed;                  /* Was any position changed? */
+   int i;                        /* Axis index */
+   int index[ SLA_BLOCK ];       /* Index of each position in the block */
+   int iter;                     /* Iteration count */
+   int k;                        /* Index of position within block */
+   int n;                        /* Number of good positions in block */
+   int point;                    /* Index of first position in block */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Unpack some of the parameters. */
+   gr2e = amprms[ 7 ];
+   ab1 = amprms[ 11 ];
+   for( i = 0; i < 3; i++ ) {
+      ehn[ i ] = amprms[ i + 4 ];
+      abv[ i ] = amprms[ i + 8 ];
+   }
+   r = amprms + 12;
+   ab1p1 = ab1 + 1.0;
+
+/* Loop round each block of positions. */
+   for( point = 0; point < npoint; point += SLA_BLOCK ) {
+
+/* Convert the good positions in the block to Cartesian form, and apply
+   the inverse precession and nutation. Note the index of each good
+   position, and set bad positions bad in both axes. */
+      n = 0;
+      for( k = point; k < npoint && k < point + SLA_BLOCK; k++ ) {
+         if( alpha[ k ] == AST__BAD || delta[ k ] == AST__BAD ) {
+            alpha[ k ] = AST__BAD;
+            delta[ k ] = AST__BAD;
+         } else {
+            palDcs2c( alpha[ k ], delta[ k ], v );
+            for( i = 0; i < 3; i++ ) {
+               w = 0.0;
+               w += r[ i ]*v[ 0 ];
+               w += r[ 3 + i ]*v[ 1 ];
+               w += r[ 6 + i ]*v[ 2 ];
+               p2[ i ][ n ] = w;
+               p1[ i ][ n ] = w;
+            }
+            index[ n++ ] = k;
+         }
+      }
+
+/* Remove aberration. */
+      for( iter = 0; iter < 2; iter++ ) {
+         for( k = 0; k < n; k++ ) {
+            p1dv = p1[ 0 ][ k ]*abv[ 0 ] + p1[ 1 ][ k ]*abv[ 1 ] +
+                   p1[ 2 ][ k ]*abv[ 2 ];
+            p1dvp1 = 1.0 + p1dv;
+            w = 1.0 + p1dv/ab1p1;
+            for( i = 0; i < 3; i++ ) {
+               q[ i ] = ( p1dvp1*p2[ i ][ k ] - w*abv[ i ] )/ab1;
+            }
+            w = sqrt( q[ 0 ]*q[ 0 ] + q[ 1 ]*q[ 1 ] + q[ 2 ]*q[ 2 ] );
+            w = ( w == 0.0 ) ? 0.0 : 1.0/w;
+            for( i = 0; i < 3; i++ ) p1[ i ][ k ] = w*q[ i ];
+         }
+      }
+
+/* Remove light deflection. */
+      for( i = 0; i < 3; i++ ) {
+         for( k = 0; k < n; k++ ) p[ i ][ k ] = p1[ i ][ k ];
+      }
+      changed = 1;
+      for( iter = 0; iter < 5 && changed; iter++ ) {
+         changed = 0;
+         for( k = 0; k < n; k++ ) {
+            pde = p[ 0 ][ k ]*ehn[ 0 ] + p[ 1 ][ k ]*ehn[ 1 ] +
+                  p[ 2 ][ k ]*ehn[ 2 ];
+            pdep1 = 1.0 + pde;
+            w = pdep1 - gr2e*pde;
+            for( i = 0; i < 3; i++ ) {
+               q[ i ] = ( pdep1*p1[ i ][ k ] - gr2e*ehn[ i ] )/w;
+            }
+            w = sqrt( q[ 0 ]*q[ 0 ] + q[ 1 ]*q[ 1 ] + q[ 2 ]*q[ 2 ] );
+            w = ( w == 0.0 ) ? 0.0 : 1.0/w;
+            for( i = 0; i < 3; i++ ) {
+               q[ i ] *= w;
+               if( q[ i ] != p[ i ][ k ] ) changed = 1;
+               p[ i ][ k ] = q[ i ];
+            }
+         }
+      }
+
+/* Convert back to spherical coordinates. */
+      for( k = 0; k < n; k++ ) {
+         for( i = 0; i < 3; i++ ) v[ i ] = p[ i ][ k ];
+         palDcc2s( v, alpha + index[ k ], delta + index[ k ] );
+         alpha[ index[ k ] ] = palDranrm( alpha[ index[ k ] ] );
+      }
+   }
+}
+
+static int CacheGet( SlaCache *cache, double key1, double key2, int nval,
+                     double *value, int *status ) {
+/*
+*  Name:
+*     CacheGet
+
+*  Purpose:
+*     Search a cache of star-independent parameters.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "slamap.h"
+*     int CacheGet( SlaCache *cache, double key1, double key2, int nval,
+*                   double *value, int *status )
+
+*  Class Membership:
+*     SlaMap member function.
+
+*  Description:
+*     This function searches the supplied cache for an entry with the
+*     given keys. If found, the values in the entry are returned, and the
+*     entry is moved to the start of the cache so that it becomes the most
+*     recently used entry. The number of successful or unsuccessful
+*     searches recorded in the cache is incremented as appropriate.
+*
+*     The cache should be protected by a mutex when this function is
+*     called.
+
+*  Parameters:
+*     cache
+*        Pointer to the cache.
+*     key1
+*        The first key.
+*     key2
+*        The second key.
+*     nval
+*        The number of values to return.
+*     value
+*        An array in which to return the values. Unchanged if no entry
+*        is found.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Non-zero if an entry was found.
+*/
+
+/* Local Variables: */
+   double key[ 2 ];              /* Keys for the found entry */
+   double val[ SLA_CACHE_NVAL ]; /* Values for the found entry */
+   int ientry;                   /* Index of entry */
+
+/* Check the global error status. */
+   if ( !astOK ) return 0;
+
+/* Search for an entry with the required keys. */
+   for( ientry = 0; ientry < cache->nentry; ientry++ ) {
+      if( cache->key[ ientry ][ 0 ] == key1 &&
+          cache->key[ ientry ][ 1 ] == key2 ) break;
+   }
+
+/* Return zero if no entry was found. */
+   if( ientry == cache->nentry ) {
+      cache->nmiss++;
+      return 0;
+   }
+
+/* Return the values, and then move the entry to the start of the cache,
+   shifting the more recently used entries down by one. */
+   cache->nhit++;
+   (void) memcpy( value, cache->value[ ientry ], sizeof( double )*nval );
+   if( ientry > 0 ) {
+      (void) memcpy( key, cache->key[ ientry ], sizeof( key ) );
+      (void) memcpy( val, cache->value[ ientry ], sizeof( val ) );
+      (void) memmove( cache->key[ 1 ], cache->key[ 0 ],
+                      sizeof( key )*ientry );
+      (void) memmove( cache->value[ 1 ], cache->value[ 0 ],
+                      sizeof( val )*ientry );
+      (void) memcpy( cache->key[ 0 ], key, sizeof( key ) );
+      (void) memcpy( cache->value[ 0 ], val, sizeof( val ) );
+   }
+   return 1;
+}
+
+static void CachePut( SlaCache *cache, double key1, double key2, int nval,
+                      const double *value, int *status ) {
+/*
+*  Name:
+*     CachePut
+
+*  Purpose:
+*     Add an entry to a cache of star-independent parameters.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "slamap.h"
+*     void CachePut( SlaCache *cache, double key1, double key2, int nval,
+*                    const double *value, int *status )
+
+*  Class Membership:
+*     SlaMap member function.
+
+*  Description:
+*     This function stores the supplied values at the start of the
+*     supplied cache, as the most recently used entry. If the cache is
+*     full, the least recently used entry is discarded. Any existing entry
+*     with the same keys (which may have been added by another thread) is
+*     replaced.
+*
+*     The cache should be protected by a mutex when this function is
+*     called.
+
+*  Parameters:
+*     cache
+*        Pointer to the cache.
+*     key1
+*        The first key.
+*     key2
+*        The second key.
+*     nval
+*        The number of values to store.
+*     value
+*        An array holding the values to store.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   int ientry;                   /* Index of entry */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Find the entry to be discarded. This is any existing entry with the
+   same keys, or the least recently used entry if the cache is full, or
+   the next unused entry otherwise. */
+   for( ientry = 0; ientry < cache->nentry; ientry++ ) {
+      if( cache->key[ ientry ][ 0 ] == key1 &&
+          cache->key[ ientry ][ 1 ] == key2 ) break;
+   }
+   if( ientry == cache->nentry ) {
+      if( cache->nentry < SLA_CACHE_SIZE ) {
+         cache->nentry++;
+      } else {
+         ientry = SLA_CACHE_SIZE - 1;
+      }
+   }
+
+/* Shift the more recently used entries down by one, over-writing the
+   discarded entry, and store the new entry at the start of the cache. */
+   (void) memmove( cache->key[ 1 ], cache->key[ 0 ],
+                   sizeof( cache->key[ 0 ] )*ientry );
+   (void) memmove( cache->value[ 1 ], cache->value[ 0 ],
+                   sizeof( cache->value[ 0 ] )*ientry );
+   cache->key[ 0 ][ 0 ] = key1;
+   cache->key[ 0 ][ 1 ] = key2;
+   (void) memcpy( cache->value[ 0 ], value, sizeof( double )*nval );
+}
+
 static int CvtCode( const char *cvt_string, int *status ) {
 /*
 *  Name:
@@ -1277,7 +1646,7 @@ static void Earth( double mjd, double earth[3], int *status ) {
 
 /* Get the position of the earth at the given date in the AST__HAQC coord
    system (dph). */
-   palEvp( mjd, 2000.0, dvb, dpb, dvh, dph );
+   astSlaEvp( mjd, 2000.0, dvb, dpb, dvh, dph );
 
 /* Now rotate the earths position vector into AST__HAEC coords. */
    palEcmat( palEpj2d( 2000.0 ), ecmat );
@@ -2089,6 +2458,209 @@ void astSTPConv_( double mjd, int n, int in_sys, double in_obs[3],
    STPConv( mjd, 0, n, in_sys, in_obs, in, out_sys, out_obs, out, status );
 }
 
+void astSlaCacheStats_( const char *cache, size_t *nhit, size_t *nmiss,
+                        int *status ){
+/*
+*+
+*  Name:
+*     astSlaCacheStats
+
+*  Purpose:
+*     Get statistics describing the use of a cache of star-independent
+*     parameters.
+
+*  Type:
+*     Protected function.
+
+*  Synopsis:
+*     #include "slamap.h"
+*     void astSlaCacheStats( const char *cache, size_t *nhit,
+*                            size_t *nmiss )
+
+*  Class Membership:
+*     SlaMap method.
+
+*  Description:
+*     This function returns the number of times that the values requested
+*     from one of the caches used by astSlaMappa and astSlaEvp were
+*     found in the cache, and the number of times they had to be
+*     calculated. This information may be used to tune the size of the
+*     caches.
+
+*  Parameters:
+*     cache
+*        The name of the cache: "MAPPA" or "EVP" (case insensitive).
+*     nhit
+*        Returned holding the number of times the values were found in
+*        the cache.
+*     nmiss
+*        Returned holding the number of times the values were not found
+*        in the cache.
+
+*-
+*/
+
+/* Local Variables: */
+   SlaCache *sla_cache;   /* The cache */
+
+/* Initialise. */
+   *nhit = 0;
+   *nmiss = 0;
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Identify the cache. */
+   if( astChrMatch( cache, "MAPPA" ) ) {
+      sla_cache = &mappa_cache;
+   } else if( astChrMatch( cache, "EVP" ) ) {
+      sla_cache = &evp_cache;
+   } else {
+      astError( AST__INTER, "astSlaCacheStats(SlaMap): Unknown cache "
+                "name '%s' (internal AST programming error).", status,
+                cache );
+      return;
+   }
+
+/* Return the statistics. */
+   LOCK_MUTEX1
+   *nhit = sla_cache->nhit;
+   *nmiss = sla_cache->nmiss;
+   UNLOCK_MUTEX1
+}
+
+void astSlaEvp_( double date, double deqx, double dvb[3], double dpb[3],
+                 double dvh[3], double dph[3], int *status ){
+/*
+*+
+*  Name:
+*     astSlaEvp
+
+*  Purpose:
+*     Get the barycentric and heliocentric velocity and position of the
+*     Earth, using a cache.
+
+*  Type:
+*     Protected function.
+
+*  Synopsis:
+*     #include "slamap.h"
+*     void astSlaEvp( double date, double deqx, double dvb[3],
+*                     double dpb[3], double dvh[3], double dph[3] )
+
+*  Class Membership:
+*     SlaMap method.
+
+*  Description:
+*     This function returns the values returned by palEvp for the given
+*     arguments. The results of the most recent calls to palEvp are
+*     retained in a cache that is shared by all threads, and are re-used
+*     if possible.
+
+*  Parameters:
+*     date
+*        TDB as an MJD.
+*     deqx
+*        Julian epoch (e.g. 2000.0) of mean equator and equinox of the
+*        vectors returned.
+*     dvb
+*        Returned holding the barycentric velocity of the Earth.
+*     dpb
+*        Returned holding the barycentric position of the Earth.
+*     dvh
+*        Returned holding the heliocentric velocity of the Earth.
+*     dph
+*        Returned holding the heliocentric position of the Earth.
+
+*-
+*/
+
+/* Local Variables: */
+   double value[ 12 ];    /* Cached values */
+   int hit;               /* Were the values found in the cache? */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Attempt to get the values from the cache. If they are not in the cache,
+   calculate them and add them to the cache. Note, the mutex is not
+   locked while calculating the values, to avoid blocking other threads. */
+   LOCK_MUTEX1
+   hit = CacheGet( &evp_cache, date, deqx, 12, value, status );
+   UNLOCK_MUTEX1
+
+   if( !hit ) {
+      palEvp( date, deqx, value, value + 3, value + 6, value + 9 );
+      LOCK_MUTEX1
+      CachePut( &evp_cache, date, deqx, 12, value, status );
+      UNLOCK_MUTEX1
+   }
+
+/* Return the values. */
+   (void) memcpy( dvb, value, sizeof( double )*3 );
+   (void) memcpy( dpb, value + 3, sizeof( double )*3 );
+   (void) memcpy( dvh, value + 6, sizeof( double )*3 );
+   (void) memcpy( dph, value + 9, sizeof( double )*3 );
+}
+
+void astSlaMappa_( double eq, double date, double amprms[21], int *status ){
+/*
+*+
+*  Name:
+*     astSlaMappa
+
+*  Purpose:
+*     Get the star-independent parameters for mean to apparent place
+*     conversions, using a cache.
+
+*  Type:
+*     Protected function.
+
+*  Synopsis:
+*     #include "slamap.h"
+*     void astSlaMappa( double eq, double date, double amprms[21] )
+
+*  Class Membership:
+*     SlaMap method.
+
+*  Description:
+*     This function returns the parameters returned by palMappa for the
+*     given arguments. The results of the most recent calls to palMappa
+*     are retained in a cache that is shared by all threads, and are
+*     re-used if possible.
+
+*  Parameters:
+*     eq
+*        Epoch of mean equinox to be used (Julian).
+*     date
+*        TDB as an MJD.
+*     amprms
+*        Returned holding the star-independent mean to apparent
+*        parameters.
+
+*-
+*/
+
+/* Local Variables: */
+   int hit;               /* Were the values found in the cache? */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Attempt to get the values from the cache. If they are not in the cache,
+   calculate them and add them to the cache. */
+   LOCK_MUTEX1
+   hit = CacheGet( &mappa_cache, eq, date, 21, amprms, status );
+   UNLOCK_MUTEX1
+
+   if( !hit ) {
+      palMappa( eq, date, amprms );
+      LOCK_MUTEX1
+      CachePut( &mappa_cache, eq, date, 21, amprms, status );
+      UNLOCK_MUTEX1
+   }
+}
+
 static void STPConv( double mjd, int ignore_origins, int n, int in_sys,
                      double in_obs[3], double *in[3], int out_sys,
                      double out_obs[3], double *out[3], int *status ){
@@ -2532,6 +3104,135 @@ void astInitSlaMapVtab_(  AstSlaMapVtab *vtab, const char *name, int *status ) {
    }
 }
 
+static void Mapqkz( int npoint, double *alpha, double *delta,
+                    double amprms[21], int *status ) {
+/*
+*  Name:
+*     Mapqkz
+
+*  Purpose:
+*     Convert a set of positions from mean to apparent place.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "slamap.h"
+*     void Mapqkz( int npoint, double *alpha, double *delta,
+*                  double amprms[21], int *status )
+
+*  Class Membership:
+*     SlaMap member function.
+
+*  Description:
+*     This function converts a set of positions from mean to geocentric
+*     apparent place, producing the same results as calling palMapqkz
+*     for each position. The positions are processed in blocks. Each step
+*     of the conversion is applied to all the positions in a block before
+*     moving on to the next step, which allows the compiler to vectorise
+*     the arithmetic.
+
+*  Parameters:
+*     npoint
+*        The number of positions.
+*     alpha
+*        The mean RA of each position (radians). Returned holding the
+*        apparent RA.
+*     delta
+*        The mean Dec of each position (radians). Returned holding the
+*        apparent Dec.
+*     amprms
+*        The star-independent mean to apparent parameters (see palMappa).
+*     status
+*        Pointer to the inherited status variable.
+
+*  Notes:
+*     - Bad values are returned for any position that has a bad RA or Dec.
+*/
+
+/* Local Variables: */
+   double *r;                    /* Precession/nutation matrix */
+   double ab1;                   /* sqrt(1-v*v), v = Earth speed */
+   double abv[ 3 ];              /* Earth velocity wrt SSB */
+   double ehn[ 3 ];              /* Unit vector from Sun to Earth */
+   double gr2e;                  /* Light deflection parameter */
+   double p1[ 3 ];               /* Position with deflection applied */
+   double p1dv;                  /* Dot product of p1 and abv */
+   double p2[ 3 ][ SLA_BLOCK ];  /* Positions with aberration applied */
+   double p[ 3 ][ SLA_BLOCK ];   /* Mean positions */
+   double pde;                   /* Dot product of p and ehn */
+   double pdep1;                 /* pde + 1 */
+   double v[ 3 ];                /* Cartesian position */
+   double w;                     /* Work value */
+   int i;                        /* Axis index */
+   int index[ SLA_BLOCK ];       /* Index of each position in the block */
+   int k;                        /* Index of position within block */
+   int n;                        /* Number of good positions in block */
+   int point;                    /* Index of first position in block */
+
+/* Check the global error status. */
+   if ( !astOK ) return;
+
+/* Unpack some of the parameters. */
+   ab1 = amprms[ 11 ];
+   gr2e = amprms[ 7 ];
+   for( i = 0; i < 3; i++ ) {
+      abv[ i ] = amprms[ i + 8 ];
+      ehn[ i ] = amprms[ i + 4 ];
+   }
+   r = amprms + 12;
+
+/* Loop round each block of positions. */
+   for( point = 0; point < npoint; point += SLA_BLOCK ) {
+
+/* Convert the good positions in the block to Cartesian form. Note the
+   index of each good position, and set bad positions bad in both axes. */
+      n = 0;
+      for( k = point; k < npoint && k < point + SLA_BLOCK; k++ ) {
+         if( alpha[ k ] == AST__BAD || delta[ k ] == AST__BAD ) {
+            alpha[ k ] = AST__BAD;
+            delta[ k ] = AST__BAD;
+         } else {
+            palDcs2c( alpha[ k ], delta[ k ], v );
+            for( i = 0; i < 3; i++ ) p[ i ][ n ] = v[ i ];
+            index[ n++ ] = k;
+         }
+      }
+
+/* Apply light deflection (restrained within the Sun's disc), and then
+   aberration. */
+      for( k = 0; k < n; k++ ) {
+         pde = p[ 0 ][ k ]*ehn[ 0 ] + p[ 1 ][ k ]*ehn[ 1 ] +
+               p[ 2 ][ k ]*ehn[ 2 ];
+         pdep1 = pde + 1.0;
+         w = gr2e/( pdep1 > 1.0e-5 ? pdep1 : 1.0e-5 );
+         for( i = 0; i < 3; i++ ) {
+            p1[ i ] = p[ i ][ k ] + w*( ehn[ i ] - pde*p[ i ][ k ] );
+         }
+
+         p1dv = p1[ 0 ]*abv[ 0 ] + p1[ 1 ]*abv[ 1 ] + p1[ 2 ]*abv[ 2 ];
+         w = 1.0 + p1dv/( ab1 + 1.0 );
+         for( i = 0; i < 3; i++ ) {
+            p2[ i ][ k ] = ( ab1*p1[ i ] ) + ( w*abv[ i ] );
+         }
+      }
+
+/* Apply precession and nutation, and convert back to spherical
+   coordinates. */
+      for( k = 0; k < n; k++ ) {
+         for( i = 0; i < 3; i++ ) {
+            w = 0.0;
+            w += r[ 3*i ]*p2[ 0 ][ k ];
+            w += r[ 3*i + 1 ]*p2[ 1 ][ k ];
+            w += r[ 3*i + 2 ]*p2[ 2 ][ k ];
+            v[ i ] = w;
+         }
+         palDcc2s( v, alpha + index[ k ], delta + index[ k ] );
+         alpha[ index[ k ] ] = palDranrm( alpha[ index[ k ] ] );
+      }
+   }
+}
+
 static int MapMerge( AstMapping *this, int where, int series, int *nmap,
                      AstMapping ***map_list, int **invert_list, int *status ) {
 /*
@@ -3193,6 +3894,160 @@ static int MapMerge( AstMapping *this, int where, int series, int *nmap,
    return result;
 }
 
+static int RotMat( int ct, const double *args, int forward,
+                   double mat[3][3], int *status ){
+/*
+*  Name:
+*     RotMat
+
+*  Purpose:
+*     Get the rotation matrix for a rigid rotation conversion.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "slamap.h"
+*     int RotMat( int ct, const double *args, int forward,
+*                 double mat[3][3], int *status )
+
+*  Class Membership:
+*     SlaMap member function.
+
+*  Description:
+*     This function checks if a sky coordinate conversion is a rigid
+*     rotation of the celestial sphere (precession, or conversion between
+*     equatorial, ecliptic, galactic, supergalactic, ICRS and dynamical
+*     J2000 coordinates). If so, it returns the matrix that transforms a
+*     Cartesian vector in the input system of the conversion to the output
+*     system. Conversions that include E-terms, aberration, diurnal
+*     aberration or a change of origin are not rigid rotations.
+*
+*     The matrices are the same as those used by the PAL functions that
+*     astTransform calls for each conversion, so that applying the matrix
+*     gives the same result as the conversion, apart from rounding errors.
+
+*  Parameters:
+*     ct
+*        The conversion type.
+*     args
+*        Pointer to the arguments for the conversion.
+*     forward
+*        If non-zero, the matrix for the forward conversion is returned.
+*        Otherwise, the matrix for the inverse conversion is returned.
+*     mat
+*        Returned holding the rotation matrix. Unchanged if the
+*        conversion is not a rigid rotation.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Non-zero if the conversion is a rigid rotation.
+*/
+
+/* Local Constants: */
+/* The J2000.0 equatorial to galactic rotation matrix used by palEqgal
+   and palGaleq. */
+   static const double eqgal_matrix[ 3 ][ 3 ] = {
+      { -0.054875539726,-0.873437108010,-0.483834985808 },
+      { +0.494109453312,-0.444829589425,+0.746982251810 },
+      { -0.867666135858,-0.198076386122,+0.455983795705 }
+   };
+
+/* The galactic to supergalactic rotation matrix used by palGalsup and
+   palSupgal. */
+   static const double galsup_matrix[ 3 ][ 3 ] = {
+      { -0.735742574804,+0.677261296414,+0.000000000000 },
+      { -0.074553778365,-0.080991471307,+0.993922590400 },
+      { +0.673145302109,+0.731271165817,+0.110081262225 }
+   };
+
+/* Local Variables: */
+   double alpha[ 3 ];               /* Longitude of each converted axis */
+   double convert_matrix[ 3 ][ 3 ]; /* Matrix for one direction */
+   double delta[ 3 ];               /* Latitude of each converted axis */
+   double dd;                       /* Unused proper motion */
+   double dr;                       /* Unused proper motion */
+   double precess_matrix[ 3 ][ 3 ]; /* Precession matrix */
+   double rotate_matrix[ 3 ][ 3 ];  /* Equatorial to ecliptic matrix */
+   double vec[ 3 ];                 /* Converted axis vector */
+   int iax;                         /* Axis index */
+   int icol;                        /* Matrix column index */
+   int irow;                        /* Matrix row index */
+   int transpose;                   /* Return transpose of convert_matrix? */
+
+/* Check the global error status. */
+   if ( !astOK ) return 0;
+
+/* Precession. The inverse matrix is obtained by swapping the epochs. */
+   if( ct == AST__SLA_PREBN || ct == AST__SLA_PREC ) {
+      if( ct == AST__SLA_PREBN ) {
+         palPrebn( forward ? args[ 0 ] : args[ 1 ],
+                   forward ? args[ 1 ] : args[ 0 ], mat );
+      } else {
+         palPrec( forward ? args[ 0 ] : args[ 1 ],
+                  forward ? args[ 1 ] : args[ 0 ], mat );
+      }
+      return 1;
+
+/* ICRS to and from FK5 J2000. The PAL functions rotate the position
+   using a matrix that is not directly available, so find the matrix by
+   converting the X, Y and Z axes to the output system. The converted
+   axes form the columns of the matrix. */
+   } else if( ct == AST__SLA_HFK5Z || ct == AST__SLA_FK5HZ ) {
+      for( iax = 0; iax < 3; iax++ ) {
+         alpha[ iax ] = ( iax == 1 ) ? AST__DPIBY2 : 0.0;
+         delta[ iax ] = ( iax == 2 ) ? AST__DPIBY2 : 0.0;
+         if( ( ct == AST__SLA_HFK5Z ) == ( forward != 0 ) ) {
+            palHfk5z( alpha[ iax ], delta[ iax ], args[ 0 ], alpha + iax,
+                      delta + iax, &dr, &dd );
+         } else {
+            palFk5hz( alpha[ iax ], delta[ iax ], args[ 0 ], alpha + iax,
+                      delta + iax );
+         }
+         palDcs2c( alpha[ iax ], delta[ iax ], vec );
+         for( irow = 0; irow < 3; irow++ ) mat[ irow ][ iax ] = vec[ irow ];
+      }
+      return 1;
+
+/* For the other rotations, get the matrix for one direction of the
+   conversion, and note if its transpose is needed for the requested
+   direction. */
+   } else if( ct == AST__SLA_ECLEQ || ct == AST__SLA_EQECL ) {
+      palPrec( 2000.0, palEpj( args[ 0 ] ), precess_matrix );
+      palEcmat( args[ 0 ], rotate_matrix );
+      palDmxm( rotate_matrix, precess_matrix, convert_matrix );
+      transpose = ( ( ct == AST__SLA_EQECL ) != ( forward != 0 ) );
+
+   } else if( ct == AST__SLA_GALEQ || ct == AST__SLA_EQGAL ) {
+      (void) memcpy( convert_matrix, eqgal_matrix, sizeof( convert_matrix ) );
+      transpose = ( ( ct == AST__SLA_EQGAL ) != ( forward != 0 ) );
+
+   } else if( ct == AST__SLA_GALSUP || ct == AST__SLA_SUPGAL ) {
+      (void) memcpy( convert_matrix, galsup_matrix, sizeof( convert_matrix ) );
+      transpose = ( ( ct == AST__SLA_GALSUP ) != ( forward != 0 ) );
+
+/* This is the matrix used by function J2000H. */
+   } else if( ct == AST__J2000H || ct == AST__HJ2000 ) {
+      palDeuler( "XYZ", -0.0068192*AS2R, 0.0166172*AS2R, 0.0146000*AS2R,
+                 convert_matrix );
+      transpose = ( ( ct == AST__J2000H ) != ( forward != 0 ) );
+
+/* Return zero if the conversion is not a rigid rotation. */
+   } else {
+      return 0;
+   }
+
+/* Return the matrix or its transpose. */
+   for( irow = 0; irow < 3; irow++ ) {
+      for( icol = 0; icol < 3; icol++ ) {
+         mat[ irow ][ icol ] = transpose ? convert_matrix[ icol ][ irow ] :
+                                           convert_matrix[ irow ][ icol ];
+      }
+   }
+   return 1;
+}
+
 static void SlaAdd( AstSlaMap *this, const char *cvt, int narg,
                     const double args[], int *status ) {
 /*
@@ -3560,7 +4415,6 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 */
 
 /* Local Variables: */
-   astDECLARE_GLOBALS            /* Pointer to thread-specific global data */
    AstPointSet *result;          /* Pointer to output PointSet */
    AstSlaMap *map;               /* Pointer to SlaMap to be applied */
    double **ptr_in;              /* Pointer to input coordinate data */
@@ -3571,11 +4425,16 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
    double *delta;                /* Pointer to latitude array */
    double *p[3];                 /* Pointers to arrays to be transformed */
    double *obs;                  /* Pointer to array holding observers position */
+   double rot_matrix[ 3 ][ 3 ];  /* Combined rotation matrix */
+   double step_matrix[ 3 ][ 3 ]; /* Rotation matrix for one conversion */
+   double work_matrix[ 3 ][ 3 ]; /* Work space for matrix product */
    int cvt;                      /* Loop counter for conversions */
    int ct;                       /* Conversion type */
    int end;                      /* Termination index for conversion loop */
    int inc;                      /* Increment for conversion loop */
+   int next;                     /* Index of next non-rotation conversion */
    int npoint;                   /* Number of points */
+   int nrot;                     /* Number of adjacent rotations */
    int point;                    /* Loop counter for points */
    int start;                    /* Starting index for conversion loop */
    int sys;                      /* STP coordinate system code */
@@ -3583,9 +4442,6 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 /* Check the global error status. */
    if ( !astOK ) return NULL;
 
-/* Get a pointer to the thread specific global data structure. */
-   astGET_GLOBALS(this);
-
 /* Obtain a pointer to the SlaMap. */
    map = (AstSlaMap *) this;
 
@@ -3651,6 +4507,46 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 	   } \
         }
 
+/* If this conversion and one or more of the following conversions are
+   all rigid rotations, multiply their rotation matrices together and
+   apply the product to each point in a single pass, so that each point
+   is converted to and from Cartesian coordinates only once. */
+         nrot = 0;
+         for( next = cvt; next != end; next += inc ) {
+            if( !RotMat( map->cvttype[ next ], map->cvtargs[ next ], forward,
+                         step_matrix, status ) ) break;
+            if( nrot++ == 0 ) {
+               (void) memcpy( rot_matrix, step_matrix, sizeof( rot_matrix ) );
+            } else {
+               palDmxm( step_matrix, rot_matrix, work_matrix );
+               (void) memcpy( rot_matrix, work_matrix, sizeof( rot_matrix ) );
+            }
+         }
+
+         if( nrot > 1 && astOK ) {
+            double vec1[ 3 ];
+            double vec2[ 3 ];
+
+/* Constrain the longitude results to lie in the range 0 to 2*pi, unless
+   the last conversion is to or from dynamical J2000 (which does not
+   do this). */
+            ct = map->cvttype[ next - inc ];
+            if( ct == AST__J2000H || ct == AST__HJ2000 ) {
+               TRAN_ARRAY(palDcs2c( alpha[ point ], delta[ point ], vec1 );
+                          palDmxv( rot_matrix, vec1, vec2 );
+                          palDcc2s( vec2, alpha + point, delta + point );)
+            } else {
+               TRAN_ARRAY(palDcs2c( alpha[ point ], delta[ point ], vec1 );
+                          palDmxv( rot_matrix, vec1, vec2 );
+                          palDcc2s( vec2, alpha + point, delta + point );
+                          alpha[ point ] = palDranrm( alpha[ point ] );)
+            }
+
+/* Skip over the conversions that have been applied. */
+            cvt = next - inc;
+            continue;
+         }
+
 /* Classify the SLALIB sky coordinate conversion to be applied. */
          ct = map->cvttype[ cvt ];
          switch ( ct ) {
@@ -3774,35 +4670,23 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 /* Convert geocentric apparent to mean place. */
 /* ------------------------------------------ */
 /* Since we are transforming a sequence of points, first set up the required
-   parameter array. Than apply this to each point in turn. */
+   parameter array. Then apply this to all the points. */
 	    case AST__SLA_AMP:
                {
 
                   if( !extra ) {
-
-                     if( args[ 1 ] != eq_cache ||
-                         args[ 0 ] != ep_cache ) {
-                        eq_cache = args[ 1 ];
-                        ep_cache = args[ 0 ];
-                        palMappa( eq_cache, ep_cache, amprms_cache );
-                     }
-
-                     extra = astStore( NULL, amprms_cache,
-                                       sizeof( double )*21 );
+                     extra = astMalloc( sizeof( double )*21 );
+                     astSlaMappa( args[ 1 ], args[ 0 ], extra );
                      map->cvtextra[ cvt ] = extra;
                   }
 
                   if ( forward ) {
-                     TRAN_ARRAY(palAmpqk( alpha[ point ], delta[ point ],
-                                          extra,
-                                          alpha + point, delta + point );)
+                     Ampqk( npoint, alpha, delta, extra, status );
 
 /* The inverse uses the same parameter array but converts from mean place
    to geocentric apparent. */
                   } else {
-                     TRAN_ARRAY(palMapqkz( alpha[ point ], delta[ point ],
-                                           extra,
-                                           alpha + point, delta + point );)
+                     Mapqkz( npoint, alpha, delta, extra, status );
 		  }
                }
                break;
@@ -3814,27 +4698,15 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 	    case AST__SLA_MAP:
                {
                   if( !extra ) {
-
-                     if( args[ 0 ] != eq_cache ||
-                         args[ 1 ] != ep_cache ) {
-                        eq_cache = args[ 0 ];
-                        ep_cache = args[ 1 ];
-                        palMappa( eq_cache, ep_cache, amprms_cache );
-                     }
-
-                     extra = astStore( NULL, amprms_cache,
-                                       sizeof( double )*21 );
+                     extra = astMalloc( sizeof( double )*21 );
+                     astSlaMappa( args[ 0 ], args[ 1 ], extra );
                      map->cvtextra[ cvt ] = extra;
                   }
 
                   if ( forward ) {
-                     TRAN_ARRAY(palMapqkz( alpha[ point ], delta[ point ],
-                                           extra,
-                                           alpha + point, delta + point );)
+                     Mapqkz( npoint, alpha, delta, extra, status );
                   } else {
-                     TRAN_ARRAY(palAmpqk( alpha[ point ], delta[ point ],
-                                          extra,
-                                          alpha + point, delta + point );)
+                     Ampqk( npoint, alpha, delta, extra, status );
 		  }
                }
                break;
@@ -124,6 +124,8 @@
 *        Added protected astInitSlaMapVtab method.
 *     22-FEB-2006 (DSB):
 *        Added cvtextra to the AstSlaMap structure.
+*     17-OCT-2026 (DSB):
+*        Added astSlaMappa, astSlaEvp and astSlaCacheStats.
 *-
 */
 
@@ -216,9 +218,6 @@ typedef struct AstSlaMapVtab {
 typedef struct AstSlaMapGlobals {
    AstSlaMapVtab Class_Vtab;
    int Class_Init;
-   double Eq_Cache;
-   double Ep_Cache;
-   double Amprms_Cache[ 21 ];
 } AstSlaMapGlobals;
 
 #endif
@@ -260,6 +259,9 @@ void astInitSlaMapGlobals_( AstSlaMapGlobals * );
 /* Other functions. */
 void astSTPConv1_( double, int, double[3], double[3], int, double[3], double[3], int * );
 void astSTPConv_( double, int, int, double[3], double *[3], int, double[3], double *[3], int * );
+void astSlaCacheStats_( const char *, size_t *, size_t *, int * );
+void astSlaEvp_( double, double, double[3], double[3], double[3], double[3], int * );
+void astSlaMappa_( double, double, double[21], int * );
 
 #endif
 
@@ -319,6 +321,9 @@ astINVOKE(V,astSlaAdd_(astCheckSlaMap(this),cvt,narg,args,STATUS_PTR))
 #if defined(astCLASS)            /* Protected */
 #define astSTPConv astSTPConv_
 #define astSTPConv1 astSTPConv1_
+#define astSlaCacheStats(cache,nhit,nmiss) astSlaCacheStats_(cache,nhit,nmiss,STATUS_PTR)
+#define astSlaEvp(date,deqx,dvb,dpb,dvh,dph) astSlaEvp_(date,deqx,dvb,dpb,dvh,dph,STATUS_PTR)
+#define astSlaMappa(eq,date,amprms) astSlaMappa_(eq,date,amprms,STATUS_PTR)
 #define astSlaIsEmpty(this) astINVOKE(V,astSlaIsEmpty_(astCheckSlaMap(this),STATUS_PTR))
 #endif
 
@@ -107,6 +107,9 @@ f     - AST_SPECADD: Add a spectral coordinate conversion to an SpecMap
 *        Check for Infs as well as NaNs.
 *     1-DEC-2016 (DSB):
 *        Added a "narg" argumeent to astSpecAdd.
+*     17-OCT-2026 (DSB):
+*        Use the shared caches of palEvp and palMappa results provided by
+*        the SlaMap class.
 
 *class--
 */
@@ -180,6 +183,7 @@ f     - AST_SPECADD: Add a spectral coordinate conversion to an SpecMap
 #include "pointset.h"            /* Sets of points/coordinates */
 #include "mapping.h"             /* Coordinate Mappings (parent class) */
 #include "unitmap.h"             /* Unit (null) Mappings */
+#include "slamap.h"              /* Cached SLALIB parameters */
 #include "specmap.h"             /* Interface definition for this class */
 
 /* Error code definitions. */
@@ -762,7 +766,7 @@ static double BaryVel( double ra, double dec, FrameDef *def, int *status ) {
    the same system. Speed is returned in units of AU/s. Store in the supplied
    frame definition structure. */
    if( def->dvb[ 0 ] == AST__BAD ) {
-      palEvp( def->epoch, 2000.0, def->dvb, dpb, dvh, dph );
+      astSlaEvp( def->epoch, 2000.0, def->dvb, dpb, dvh, dph );
 
 /* Change the barycentric velocity of the earth into the heliocentric
    velocity of the barycentre. */
@@ -1829,8 +1833,8 @@ static double GeoVel( double ra, double dec, FrameDef *def, int *status ) {
 /* If not already done so, get the Earth/Sun velocity and position vectors in
    the same system. Speed is returned in units of AU/s. Store in the supplied
    frame definition structure. */
-   if( def->dvh[ 0 ] == AST__BAD ) palEvp( def->epoch, 2000.0, dvb, dpb,
-                                           def->dvh, dph );
+   if( def->dvh[ 0 ] == AST__BAD ) astSlaEvp( def->epoch, 2000.0, dvb, dpb,
+                                              def->dvh, dph );
 
 /* Return the component away from the source, of the velocity of the earths
    centre relative to the sun (in m/s). */
@@ -3562,8 +3566,8 @@ static double TopoVel( double ra, double dec, FrameDef *def, int *status ) {
 /* If not already done so, get the parameters defining the transformation
    of mean ra and dec to apparent ra and dec, and store in the supplied frame
    definition structure. */
-   if( def->amprms[ 0 ] == AST__BAD ) palMappa( 2000.0, def->epoch,
-                                                def->amprms );
+   if( def->amprms[ 0 ] == AST__BAD ) astSlaMappa( 2000.0, def->epoch,
+                                                   def->amprms );
 
 /* Convert the source position from mean ra and dec to apparent ra and dec. */
    palMapqkz( ra, dec, def->amprms, &raa, &deca );
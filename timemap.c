@@ -104,6 +104,16 @@ f     - AST_TIMEADD: Add a time coordinate conversion to an TimeMap
 *        - Fix bug in MapMerge that prevented adjacent TAITOUTC and UTCTOTAI
 *        conversions cancelling out.
 *        - Add DTAI argument for TTTOTDB and TDBTOTT.
+*     17-OCT-2026 (DSB):
+*        Hold the leap seconds used by astDat in a sorted table that is
+*        searched using a bisection, and which can be replaced by the
+*        contents of a file specified using the "LeapFile" tuning
+*        parameter (see astTuneC). Transform re-uses the table entry
+*        found for the previous point if possible.
+*     17-OCT-2026 (DSB):
+*        If the "TDBInterp" tuning parameter is set (see astTune), find
+*        the geocentric part of TDB-TT for closely spaced points by
+*        interpolation between a grid of nodes.
 *class--
 */
 
@@ -164,6 +174,13 @@ f     - AST_TIMEADD: Add a time coordinate conversion to an TimeMap
 #define P0 6.55E-5
 #define TTOFF 32.184
 
+/* The spacing, in days, between the nodes used to interpolate the
+   geocentric part of TDB-TT (see TdbNodes). */
+#define TDB_NODE_DAYS 0.5
+
+/* The maximum length of the path to a leap second file. */
+#define LEAP_MAXLEN 200
+
 /* Include files. */
 /* ============== */
 /* Interface definitions. */
@@ -187,6 +204,7 @@ f     - AST_TIMEADD: Add a time coordinate conversion to an TimeMap
 /* C header files. */
 /* --------------- */
 #include <ctype.h>
+#include <float.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <string.h>
@@ -204,6 +222,95 @@ static int (* parent_getobjsize)( AstObject *, int * );
 static AstPointSet *(* parent_transform)( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static double (* parent_rate)( AstMapping *, double *, int, int, int * );
 
+/* A structure describing a single interval of constant leap seconds. For
+   a UTC value "mjd" on or after the start of the interval, TAI-UTC in
+   seconds is "dat + ( mjd - mjdref )*rate". For UTC values after 1972,
+   "rate" is zero. */
+typedef struct LeapEntry {
+   double mjd;                   /* UTC MJD at start of interval */
+   double tai;                   /* TAI MJD at start of interval */
+   double dat;                   /* TAI-UTC at "mjdref" (seconds) */
+   double mjdref;                /* UTC MJD at which TAI-UTC equals "dat" */
+   double rate;                  /* Rate of change of TAI-UTC (s/day) */
+} LeapEntry;
+
+/* A structure describing a table of leap second intervals, sorted into
+   increasing order of start time. TimeMaps that are in the process of
+   being transformed may still be using a table after it has been
+   replaced by a new table, so each table is reference counted. */
+typedef struct LeapTable {
+   LeapEntry *entry;             /* Array of intervals */
+   int nentry;                   /* Number of intervals */
+   int nref;                     /* Number of references to the table */
+} LeapTable;
+
+/* The built-in table of leap second intervals, from
+   ftp://maia.usno.navy.mil/ser7/tai-utc.dat. The 5ms time step at 1961
+   January 1 is taken from 2.58.1 (p87) of the 1992 Explanatory
+   Supplement. The first interval (starting 1960 January 1) is also used
+   for all earlier epochs. The TAI value at the start of each interval
+   is filled in when the table is first used. This table must be updated
+   on each occasion that a leap second is announced. Latest leap second:
+   2017 January 1. */
+static LeapEntry leap_builtin[] = {
+   { 36934.0, 0.0, 1.4178180, 37300.0, 0.001296 },  /* 1960 January 1 */
+   { 37300.0, 0.0, 1.4228180, 37300.0, 0.001296 },  /* 1961 January 1 */
+   { 37512.0, 0.0, 1.3728180, 37300.0, 0.001296 },  /* 1961 August 1 */
+   { 37665.0, 0.0, 1.8458580, 37665.0, 0.0011232 }, /* 1962 January 1 */
+   { 38334.0, 0.0, 1.9458580, 37665.0, 0.0011232 }, /* 1963 November 1 */
+   { 38395.0, 0.0, 3.2401300, 38761.0, 0.001296 },  /* 1964 January 1 */
+   { 38486.0, 0.0, 3.3401300, 38761.0, 0.001296 },  /* 1964 April 1 */
+   { 38639.0, 0.0, 3.4401300, 38761.0, 0.001296 },  /* 1964 September 1 */
+   { 38761.0, 0.0, 3.5401300, 38761.0, 0.001296 },  /* 1965 January 1 */
+   { 38820.0, 0.0, 3.6401300, 38761.0, 0.001296 },  /* 1965 March 1 */
+   { 38942.0, 0.0, 3.7401300, 38761.0, 0.001296 },  /* 1965 July 1 */
+   { 39004.0, 0.0, 3.8401300, 38761.0, 0.001296 },  /* 1965 September 1 */
+   { 39126.0, 0.0, 4.3131700, 39126.0, 0.002592 },  /* 1966 January 1 */
+   { 39887.0, 0.0, 4.2131700, 39126.0, 0.002592 },  /* 1968 February 1 */
+   { 41317.0, 0.0, 10.0, 0.0, 0.0 },                /* 1972 January 1 */
+   { 41499.0, 0.0, 11.0, 0.0, 0.0 },                /* 1972 July 1 */
+   { 41683.0, 0.0, 12.0, 0.0, 0.0 },                /* 1973 January 1 */
+   { 42048.0, 0.0, 13.0, 0.0, 0.0 },                /* 1974 January 1 */
+   { 42413.0, 0.0, 14.0, 0.0, 0.0 },                /* 1975 January 1 */
+   { 42778.0, 0.0, 15.0, 0.0, 0.0 },                /* 1976 January 1 */
+   { 43144.0, 0.0, 16.0, 0.0, 0.0 },                /* 1977 January 1 */
+   { 43509.0, 0.0, 17.0, 0.0, 0.0 },                /* 1978 January 1 */
+   { 43874.0, 0.0, 18.0, 0.0, 0.0 },                /* 1979 January 1 */
+   { 44239.0, 0.0, 19.0, 0.0, 0.0 },                /* 1980 January 1 */
+   { 44786.0, 0.0, 20.0, 0.0, 0.0 },                /* 1981 July 1 */
+   { 45151.0, 0.0, 21.0, 0.0, 0.0 },                /* 1982 July 1 */
+   { 45516.0, 0.0, 22.0, 0.0, 0.0 },                /* 1983 July 1 */
+   { 46247.0, 0.0, 23.0, 0.0, 0.0 },                /* 1985 July 1 */
+   { 47161.0, 0.0, 24.0, 0.0, 0.0 },                /* 1988 January 1 */
+   { 47892.0, 0.0, 25.0, 0.0, 0.0 },                /* 1990 January 1 */
+   { 48257.0, 0.0, 26.0, 0.0, 0.0 },                /* 1991 January 1 */
+   { 48804.0, 0.0, 27.0, 0.0, 0.0 },                /* 1992 July 1 */
+   { 49169.0, 0.0, 28.0, 0.0, 0.0 },                /* 1993 July 1 */
+   { 49534.0, 0.0, 29.0, 0.0, 0.0 },                /* 1994 July 1 */
+   { 50083.0, 0.0, 30.0, 0.0, 0.0 },                /* 1996 January 1 */
+   { 50630.0, 0.0, 31.0, 0.0, 0.0 },                /* 1997 July 1 */
+   { 51179.0, 0.0, 32.0, 0.0, 0.0 },                /* 1999 January 1 */
+   { 53736.0, 0.0, 33.0, 0.0, 0.0 },                /* 2006 January 1 */
+   { 54832.0, 0.0, 34.0, 0.0, 0.0 },                /* 2009 January 1 */
+   { 56109.0, 0.0, 35.0, 0.0, 0.0 },                /* 2012 July 1 */
+   { 57204.0, 0.0, 36.0, 0.0, 0.0 },                /* 2015 July 1 */
+   { 57754.0, 0.0, 37.0, 0.0, 0.0 }                 /* 2017 January 1 */
+};
+
+/* A LeapTable describing the built-in table. Its reference count starts
+   at one (rather than zero) so that it never falls to zero, and the
+   table is thus never freed. */
+static LeapTable leap_default = { leap_builtin,
+                                  sizeof( leap_builtin )/sizeof( LeapEntry ),
+                                  1 };
+
+/* The leap second table currently in use, shared by all threads, the
+   path to the file from which it was read (blank if the built-in table
+   is in use), and the value returned by astTuneCGen when the LeapFile
+   tuning parameter was last checked. */
+static LeapTable *leap_table = NULL;
+static char leap_file[ LEAP_MAXLEN ] = "";
+static int leap_gen = -1;
 
 
 #ifdef THREAD_SAFE
@@ -220,10 +327,16 @@ astMAKE_INITGLOBALS(TimeMap)
 
 
 #include <pthread.h>
+static pthread_mutex_t mutex1 = PTHREAD_MUTEX_INITIALIZER;
+#define LOCK_MUTEX1 pthread_mutex_lock( &mutex1 );
+#define UNLOCK_MUTEX1 pthread_mutex_unlock( &mutex1 );
 
 
 #else
 
+#define LOCK_MUTEX1
+#define UNLOCK_MUTEX1
+
 
 /* Define the class virtual function table and its initialisation flag
    as static variables. */
@@ -243,9 +356,14 @@ AstTimeMap *astTimeMapId_( int, const char *, ... );
 /* ======================================== */
 static AstPointSet *Transform( AstMapping *, AstPointSet *, int, AstPointSet *, int * );
 static const char *CvtString( int, const char **, int *, int *, const char *[ MAX_ARGS ], int **order, int * );
+static LeapTable *GetLeapTable( int * );
+static LeapTable *ReadLeapFile( const char *, int * );
+static double Dat( double, int, LeapTable *, int *, int * );
 static double Gmsta( double, double, int, int * );
 static double Rate( AstMapping *, double *, int, int, int * );
-static double Rcc( double, double, double, double, double, int * );
+static double Rcc( double, double, double, double, double, double, int * );
+static double TdbInterp( double, double, int, const double *, int * );
+static double *TdbNodes( int, const double *, double, double *, int *, int * );
 static int Equal( AstObject *, AstObject *, int * );
 static int CvtCode( const char *, int * );
 static int MapMerge( AstMapping *, int, int, int *, AstMapping ***, int **, int * );
@@ -254,6 +372,8 @@ static void AddTimeCvt( AstTimeMap *, int, int, const double *, int * );
 static void Copy( const AstObject *, AstObject *, int * );
 static void Delete( AstObject *, int * );
 static void Dump( AstObject *, AstChannel *, int * );
+static void FreeLeapTable( LeapTable *, int * );
+static void LeapTai( LeapEntry *, int, int * );
 static void TimeAdd( AstTimeMap *, const char *, int, const double[], int * );
 
 static int GetObjSize( AstObject *, int * );
@@ -1337,7 +1457,9 @@ double astDat_( double in, int forward, int *status ){
 *     fractional part, correct behaviour on the day of a leap second
 *     can only be guaranteed up to the end of the second 23:59:59.
 *     - For epochs from 1961 January 1 onwards, the expressions from the
-*     file ftp://maia.usno.navy.mil/ser7/tai-utc.dat are used.
+*     file ftp://maia.usno.navy.mil/ser7/tai-utc.dat are used, unless
+*     a different file has been specified using the "LeapFile" tuning
+*     parameter (see astTuneC).
 *     - The 5ms time step at 1961 January 1 is taken from 2.58.1 (p87) of
 *     the 1992 Explanatory Supplement.
 *     - UTC began at 1960 January 1.0 (JD 2436934.5) and it is improper
@@ -1346,381 +1468,337 @@ double astDat_( double in, int forward, int *status ){
 
 *  Implementation Details:
 *     - This function is based on SLA_DAT by P.T.Wallace.
-*     - This routine must be updated on each occasion that a leap second is
-*     announced
-*     - Latest leap second:  2017 January 1
+*     - The built-in table of leap seconds must be updated on each
+*     occasion that a leap second is announced (see "leap_builtin").
 
 *-
 */
 
 /* Local Variables: */
+   LeapTable *table;
    double result;
+   int ileap;
 
 /* Initialise the returned value. */
    if( in == AST__BAD ) return AST__BAD;
 
-/* First do TAI-UTC at a given UTC
-   ------------------------------- */
-   if( forward ) {
-
-/* 2017 January 1 */
-      if ( in >= 57754.0 ) {
-         result = 37.0;
-
-/* 2015 July 1 */
-      } else if ( in >= 57204.0 ) {
-         result = 36.0;
-
-/* 2012 July 1 */
-      } else if ( in >= 56109.0 ) {
-         result = 35.0;
-
-/* 2009 January 1 */
-      } else if ( in >= 54832.0 ) {
-         result = 34.0;
-
-/* 2006 January 1 */
-      } else if( in >= 53736.0 ) {
-         result = 33.0;
+/* Get the leap second table, find the value in it, and then release the
+   table. */
+   ileap = -1;
+   table = GetLeapTable( status );
+   result = Dat( in, forward, table, &ileap, status );
+   FreeLeapTable( table, status );
 
-/* 1999 January 1 */
-      } else if( in >= 51179.0 ){
-         result = 32.0;
-
-/* 1997 July 1 */
-      } else if( in >= 50630.0 ){
-         result = 31.0;
-
-/* 1996 January 1 */
-      } else if( in >= 50083.0 ){
-         result = 30.0;
-
-/* 1994 July 1 */
-      } else if( in >= 49534.0 ){
-         result = 29.0;
-
-/* 1993 July 1 */
-      } else if( in >= 49169.0 ){
-         result = 28.0;
+/* Return the result */
+   return result;
+}
 
-/* 1992 July 1 */
-      } else if( in >= 48804.0 ){
-         result = 27.0;
+static double Dat( double in, int forward, LeapTable *table, int *ileap,
+                   int *status ){
+/*
+*  Name:
+*     Dat
 
-/* 1991 January 1 */
-      } else if( in >= 48257.0 ){
-         result = 26.0;
+*  Purpose:
+*     Convert between UTC and TAI using a given leap second table.
 
-/* 1990 January 1 */
-      } else if( in >= 47892.0 ){
-         result = 25.0;
+*  Type:
+*     Private function.
 
-/* 1988 January 1 */
-      } else if( in >= 47161.0 ){
-         result = 24.0;
+*  Synopsis:
+*     #include "timemap.h"
+*     double Dat( double in, int forward, LeapTable *table, int *ileap,
+*                 int *status )
 
-/* 1985 July 1 */
-      } else if( in >= 46247.0 ){
-         result = 23.0;
+*  Class Membership:
+*     TimeMap member function
 
-/* 1983 July 1 */
-      } else if( in >= 45516.0 ){
-         result = 22.0;
+*  Description:
+*     This function returns the difference between UTC and TAI at a given
+*     epoch, using the supplied table of leap second intervals. The
+*     interval containing the epoch is found by bisection. However, the
+*     interval used by the previous invocation is checked first, so a
+*     series of epochs in increasing or decreasing order will usually
+*     avoid the bisection.
 
-/* 1982 July 1 */
-      } else if( in >= 45151.0 ){
-         result = 21.0;
+*  Parameters:
+*     in
+*        UTC date or TAI time (as selected by "forward"), as an absolute
+*        MJD.
+*     forward
+*        If non-zero, "in" should be a UTC value, and the returned value
+*        is TAI-UTC. If zero, "in" should be a TAI value, and the returned
+*        value is UTC-TAI.
+*     table
+*        The leap second table.
+*     ileap
+*        Pointer to an int holding the index of the interval used by the
+*        previous invocation, or -1 if there was no previous invocation.
+*        Returned holding the index of the interval used by this
+*        invocation.
+*     status
+*        Pointer to the inherited status variable.
 
-/* 1981 July 1 */
-      } else if( in >= 44786.0 ){
-         result = 20.0;
+*  Returned Value:
+*     Either UTC-TAI or TAI-UTC (as indicated by "forward") in units of
+*     seconds.
 
-/* 1980 January 1 */
-      } else if( in >= 44239.0 ){
-         result = 19.0;
+*  Notes:
+*     - See astDat.
+*/
 
-/* 1979 January 1 */
-      } else if( in >= 43874.0 ){
-         result = 18.0;
+/* Local Variables: */
+   LeapEntry *entry;             /* Pointer to the table of intervals */
+   double result;                /* Returned value */
+   int half;                     /* Half the number of intervals to search */
+   int i;                        /* Index of interval containing "in" */
+   int len;                      /* Number of intervals to search */
+   int n;                        /* Number of intervals */
 
-/* 1978 January 1 */
-      } else if( in >= 43509.0 ){
-         result = 17.0;
+/* Initialise the returned value. */
+   if( in == AST__BAD ) return AST__BAD;
 
-/* 1977 January 1 */
-      } else if( in >= 43144.0 ){
-         result = 16.0;
+/* Get the intervals. */
+   entry = table->entry;
+   n = table->nentry;
+
+/* Find the last interval that starts on or before the supplied epoch,
+   using the interval found by the previous invocation if it is still
+   appropriate. Epochs before the start of the first interval use the
+   first interval. The start of each interval is a UTC value if "forward"
+   is non-zero and a TAI value otherwise. The bisection is written so
+   that the compiler can avoid unpredictable branches. */
+   i = *ileap;
+   if( forward ) {
+      if( i < 0 || i >= n || ( i > 0 && entry[ i ].mjd > in ) ||
+          ( i < n - 1 && entry[ i + 1 ].mjd <= in ) ) {
+         i = 0;
+         len = n;
+         while( len > 1 ) {
+            half = len/2;
+            i = ( entry[ i + half ].mjd <= in ) ? i + half : i;
+            len -= half;
+         }
+      }
 
-/* 1976 January 1 */
-      } else if( in >= 42778.0 ){
-         result = 15.0;
+   } else {
+      if( i < 0 || i >= n || ( i > 0 && entry[ i ].tai > in ) ||
+          ( i < n - 1 && entry[ i + 1 ].tai <= in ) ) {
+         i = 0;
+         len = n;
+         while( len > 1 ) {
+            half = len/2;
+            i = ( entry[ i + half ].tai <= in ) ? i + half : i;
+            len -= half;
+         }
+      }
+   }
+   *ileap = i;
 
-/* 1975 January 1 */
-      } else if( in >= 42413.0 ){
-         result = 14.0;
+/* Intervals after 1972 have a constant number of leap seconds. */
+   if( entry[ i ].rate == 0.0 ) {
+      result = forward ? entry[ i ].dat : -entry[ i ].dat;
 
-/* 1974 January 1 */
-      } else if( in >= 42048.0 ){
-         result = 13.0;
+/* Before 1972, do TAI-UTC at a given UTC. */
+   } else if( forward ) {
+      result = entry[ i ].dat + ( in - entry[ i ].mjdref )*entry[ i ].rate;
 
-/* 1973 January 1 */
-      } else if( in >= 41683.0 ){
-         result = 12.0;
+/* Or UTC-TAI at a given TAI. Within the interval, TAI-UTC is given by
+   "dat + ( mjd_utc - mjdref )*rate", where mjd_utc equals
+   "in - (TAI-UTC)/SPD". Solve for TAI-UTC. */
+   } else {
+      result = -( entry[ i ].dat + ( in - entry[ i ].mjdref )*entry[ i ].rate )/
+                ( 1.0 + entry[ i ].rate/SPD );
+   }
 
-/* 1972 July 1 */
-      } else if( in >= 41499.0 ){
-         result = 11.0;
+/* Return the result */
+   return result;
+}
 
-/* 1972 January 1 */
-      } else if( in >= 41317.0 ){
-         result = 10.0;
+static void FreeLeapTable( LeapTable *table, int *status ){
+/*
+*  Name:
+*     FreeLeapTable
 
-/* 1968 February 1 */
-      } else if( in >= 39887.0 ){
-         result = 4.2131700 + ( in - 39126.0 )*0.002592;
+*  Purpose:
+*     Release a leap second table obtained using GetLeapTable.
 
-/* 1966 January 1 */
-      } else if( in >= 39126.0 ){
-         result = 4.3131700 + ( in - 39126.0 )*0.002592;
+*  Type:
+*     Private function.
 
-/* 1965 September 1 */
-      } else if( in >= 39004.0 ){
-         result = 3.8401300 + ( in - 38761.0 )*0.001296;
+*  Synopsis:
+*     #include "timemap.h"
+*     void FreeLeapTable( LeapTable *table, int *status )
 
-/* 1965 July 1 */
-      } else if( in >= 38942.0 ){
-         result = 3.7401300 + ( in - 38761.0 )*0.001296;
+*  Class Membership:
+*     TimeMap member function
 
-/* 1965 March 1 */
-      } else if( in >= 38820.0 ){
-         result = 3.6401300 + ( in - 38761.0 )*0.001296;
+*  Description:
+*     This function decrements the reference count of a leap second table
+*     returned by GetLeapTable, and frees it if it is no longer used.
 
-/* 1965 January 1 */
-      } else if( in >= 38761.0 ){
-         result = 3.5401300 + ( in - 38761.0 )*0.001296;
+*  Parameters:
+*     table
+*        The leap second table. May be NULL.
+*     status
+*        Pointer to the inherited status variable.
 
-/* 1964 September 1 */
-      } else if( in >= 38639.0 ){
-         result = 3.4401300 + ( in - 38761.0 )*0.001296;
+*  Notes:
+*     - This function attempts to execute even if an error has already
+*     occurred.
+*/
 
-/* 1964 April 1 */
-      } else if( in >= 38486.0 ){
-         result = 3.3401300 + ( in - 38761.0 )*0.001296;
+/* Check a table was supplied. */
+   if( !table ) return;
 
-/* 1964 January 1 */
-      } else if( in >= 38395.0 ){
-         result = 3.2401300 + ( in - 38761.0 )*0.001296;
+/* Decrement the reference count, and free the table if it is no longer
+   used. The current table (including the built-in table) is always
+   referenced by "leap_table", so will not be freed. */
+   LOCK_MUTEX1;
+   if( --table->nref == 0 ) {
+      table->entry = astFree( table->entry );
+      table = astFree( table );
+   }
+   UNLOCK_MUTEX1;
+}
 
-/* 1963 November 1 */
-      } else if( in >= 38334.0 ){
-         result = 1.9458580 + ( in - 37665.0 )*0.0011232;
+static LeapTable *GetLeapTable( int *status ){
+/*
+*  Name:
+*     GetLeapTable
 
-/* 1962 January 1 */
-      } else if( in >= 37665.0 ){
-         result = 1.8458580 + ( in - 37665.0 )*0.0011232;
+*  Purpose:
+*     Get the current leap second table.
 
-/* 1961 August 1 */
-      } else if( in >= 37512.0 ){
-         result = 1.3728180 + ( in - 37300.0 )*0.001296;
+*  Type:
+*     Private function.
 
-/* 1961 January 1 */
-      } else if( in >= 37300.0 ){
-         result = 1.4228180 + ( in - 37300.0 )*0.001296;
+*  Synopsis:
+*     #include "timemap.h"
+*     LeapTable *GetLeapTable( int *status )
 
-/* Before that */
-      } else {
-         result = 1.4178180 + ( in - 37300.0 )*0.001296;
-      }
+*  Class Membership:
+*     TimeMap member function
 
-/* Now do UTC-TAI at a given TAI.
-   ------------------------------  */
-   } else {
+*  Description:
+*     This function returns a pointer to the leap second table that
+*     should currently be used. If the "LeapFile" tuning parameter has
+*     changed since the current table was created, a new table is first
+*     read from the file it specifies (or the built-in table is used if
+*     "LeapFile" is blank).
+*
+*     The value of "LeapFile" is only obtained if astTuneCGen indicates
+*     that a tuning parameter may have changed since it was last checked.
+*     The file is read without locking the table, so other threads can
+*     continue to use the current table while the file is read. If the
+*     file cannot be read, the current table continues to be used, and
+*     the file is not read again until a new value is stored for
+*     "LeapFile" (or any other character-valued tuning parameter).
+*
+*     The reference count of the returned table is incremented, so the
+*     table will not be freed even if another thread subsequently
+*     replaces it. The table should be released using FreeLeapTable when
+*     it is no longer needed.
 
+*  Parameters:
+*     status
+*        Pointer to the inherited status variable.
 
-/* 2017 January 1 */
-      if ( in >= 57754.0 + 37.0/SPD ) {
-         result = -37.0;
+*  Returned Value:
+*     A pointer to the leap second table.
 
-/* 2015 July 1 */
-      } else if ( in >= 57204.0 + 36.0/SPD ) {
-         result = -36.0;
+*  Notes:
+*     - A usable table is returned even if an error occurs.
+*     - The "LeapFile" tuning parameter is not checked if this function
+*     is invoked with the global error status set.
+*/
 
-/* 2012 July 1 */
-      } else if( in >= 56109.0 + 35.0/SPD ) {
-         result = -35.0;
+/* Local Variables: */
+   LeapTable *new;               /* Newly created table */
+   LeapTable *result;            /* Returned table */
+   char file[ LEAP_MAXLEN ];     /* Current value of LeapFile */
+   int gen;                      /* Tuning parameter generation number */
+   int read;                     /* Read a new table? */
+
+/* Note how many times the character-valued tuning parameters have been
+   changed. */
+   gen = astTuneCGen;
+
+/* Serialise access to the table, since it is shared by all threads. */
+   LOCK_MUTEX1;
+
+/* On the first invocation, find the TAI value at the start of each
+   interval in the built-in table, and start using the built-in table. */
+   if( !leap_table ) {
+      LeapTai( leap_default.entry, leap_default.nentry, status );
+      leap_table = &leap_default;
+      leap_table->nref++;
+   }
 
-/* 2009 January 1 */
-      } else if( in >= 54832.0 + 34.0/SPD ) {
-         result = -34.0;
+/* If no tuning parameter has changed since the LeapFile tuning parameter
+   was last checked, or an error has already occurred, return the current
+   table, incrementing its reference count. */
+   if( gen == leap_gen || !astOK ) {
+      result = leap_table;
+      result->nref++;
+      UNLOCK_MUTEX1;
+      return result;
+   }
+   UNLOCK_MUTEX1;
 
-/* 2006 January 1 */
-      } else if( in >= 53736.0 + 33.0/SPD ){
-         result = -33.0;
+/* Otherwise, get the current value of the LeapFile tuning parameter. */
+   file[ 0 ] = 0;
+   astTuneC( "LeapFile", NULL, file, sizeof( file ) );
+   file[ astChrLen( file ) ] = 0;
 
-/* 1999 January 1 */
-      } else if( in >= 51179.0 + 32.0/SPD ){
-         result = -32.0;
+/* A new table is needed if LeapFile has changed. */
+   LOCK_MUTEX1;
+   read = strcmp( file, leap_file );
+   UNLOCK_MUTEX1;
 
-/* 1997 July 1 */
-      } else if( in >= 50630.0 + 31.0/SPD ){
-         result = -31.0;
+/* If required, read the new table. The file is read without locking the
+   mutex so that other threads can continue to use the current table. */
+   new = NULL;
+   if( read && file[ 0 ] ) new = ReadLeapFile( file, status );
 
-/* 1996 January 1 */
-      } else if( in >= 50083.0 + 30.0/SPD ){
-         result = -30.0;
+   LOCK_MUTEX1;
 
-/* 1994 July 1 */
-      } else if( in >= 49534.0 + 29.0/SPD ){
-         result = -29.0;
+/* A blank LeapFile value selects the built-in table. */
+   if( read && !file[ 0 ] ) {
+      new = &leap_default;
+      new->nref++;
+   }
 
-/* 1993 July 1 */
-      } else if( in >= 49169.0 + 28.0/SPD ){
-         result = -28.0;
+/* Replace the current table, releasing the reference to it held by
+   "leap_table". If another thread has already installed a table read
+   from the same file, use that table instead, and discard the new one. */
+   if( new ) {
+      if( strcmp( file, leap_file ) ) {
+         if( --leap_table->nref == 0 ) {
+            leap_table->entry = astFree( leap_table->entry );
+            leap_table = astFree( leap_table );
+         }
+         leap_table = new;
+         strcpy( leap_file, file );
 
-/* 1992 July 1 */
-      } else if( in >= 48804.0 + 27.0/SPD ){
-         result = -27.0;
+      } else if( --new->nref == 0 ) {
+         new->entry = astFree( new->entry );
+         new = astFree( new );
+      }
+   }
 
-/* 1991 January 1 */
-      } else if( in >= 48257.0 + 26.0/SPD ){
-         result = -26.0;
+/* Record that LeapFile has been checked. If the new file could not be
+   read, the current table continues to be used (an error will have been
+   reported), and the file will not be read again until a new value is
+   stored for a tuning parameter. */
+   leap_gen = gen;
 
-/* 1990 January 1 */
-      } else if( in >= 47892.0 + 25.0/SPD ){
-         result = -25.0;
+/* Return the current table, incrementing its reference count. */
+   result = leap_table;
+   result->nref++;
 
-/* 1988 January 1 */
-      } else if( in >= 47161.0 + 24.0/SPD ){
-         result = -24.0;
-
-/* 1985 July 1 */
-      } else if( in >= 46247.0 + 23.0/SPD ){
-         result = -23.0;
-
-/* 1983 July 1 */
-      } else if( in >= 45516.0 + 22.0/SPD ){
-         result = -22.0;
-
-/* 1982 July 1 */
-      } else if( in >= 45151.0 + 21.0/SPD ){
-         result = -21.0;
-
-/* 1981 July 1 */
-      } else if( in >= 44786.0 + 20.0/SPD ){
-         result = -20.0;
-
-/* 1980 January 1 */
-      } else if( in >= 44239.0 + 19.0/SPD ){
-         result = -19.0;
-
-/* 1979 January 1 */
-      } else if( in >= 43874.0 + 18.0/SPD ){
-         result = -18.0;
-
-/* 1978 January 1 */
-      } else if( in >= 43509.0 + 17.0/SPD ){
-         result = -17.0;
-
-/* 1977 January 1 */
-      } else if( in >= 43144.0 + 16.0/SPD ){
-         result = -16.0;
-
-/* 1976 January 1 */
-      } else if( in >= 42778.0 + 15.0/SPD ){
-         result = -15.0;
-
-/* 1975 January 1 */
-      } else if( in >= 42413.0 + 14.0/SPD ){
-         result = -14.0;
-
-/* 1974 January 1 */
-      } else if( in >= 42048.0 + 13.0/SPD ){
-         result = -13.0;
-
-/* 1973 January 1 */
-      } else if( in >= 41683.0 + 12.0/SPD ){
-         result = -12.0;
-
-/* 1972 July 1 */
-      } else if( in >= 41499.0 + 11.0/SPD ){
-         result = -11.0;
-
-/* 1972 January 1 */
-      } else if( in >= 41317.0 + 10.0/SPD ){
-         result = -10.0;
-
-/* 1968 February 1 */
-      } else if( in >= 39887.0 + ( 4.2131700
-                                  + ( 39887.0 - 39126.0 )*0.002592 )/SPD ){
-         result = -( 4.2131700 + ( in - 39126.0 )*0.002592 )/1.02592;
-
-/* 1966 January 1 */
-      } else if( in >= 39126.0 + ( 4.3131700
-                                  + ( 39126.0 - 39126.0 )*0.002592 )/SPD ){
-         result = -( 4.2131700 + ( in - 39126.0 )*0.002592 )/1.02592;
-
-/* 1965 September 1 */
-      } else if( in >= 39004.0 + ( 3.8401300
-                                  + ( 39004.0 - 38761.0 )*0.001296 )/SPD ){
-         result = -( 3.8401300 + ( in - 38761.0 )*0.001296 )/1.001296;
-
-/* 1965 July 1 */
-      } else if( in >= 38942.0 + ( 3.7401300
-                                  + ( 38942.0 - 38761.0 )*0.001296 )/SPD ){
-         result = -( 3.7401300 + ( in - 38761.0 )*0.001296 )/1.01296;
-
-/* 1965 March 1 */
-      } else if( in >= 38820.0 + ( 3.6401300
-                                  + ( 38820.0 - 38761.0 )*0.001296 )/SPD ){
-         result = -( 3.6401300 + ( in - 38761.0 )*0.001296 )/1.001296;
-
-/* 1965 January 1 */
-      } else if( in >= 38761.0 + ( 3.5401300
-                                   + ( 38761.0 - 38761.0 )*0.001296 )/SPD ){
-         result = -( 3.5401300 + ( in - 38761.0 )*0.001296 )/1.001296;
-
-/* 1964 September 1 */
-      } else if( in >= 38639.0 + ( 3.4401300
-                                   + ( 38639.0 - 38761.0 )*0.001296 )/SPD ){
-         result = -( 3.4401300 + ( in - 38761.0 )*0.001296 )/1.001296;
-
-/* 1964 April 1 */
-      } else if( in >= 38486.0 + ( 3.3401300
-                                   + ( 38486.0 - 38761.0 )*0.001296 )/SPD ){
-         result = -( 3.3401300 + ( in - 38761.0 )*0.001296 )/1.001296;
-
-/* 1964 January 1 */
-      } else if( in >= 38395.0 + ( 3.2401300
-                                   + ( 38395.0 - 38761.0 )*0.001296 )/SPD ){
-         result = -( 3.2401300 + ( in - 38761.0 )*0.001296 )/1.001296;
-
-/* 1963 November 1 */
-      } else if( in >= 38334.0 + ( 1.9458580
-                                   + ( 38334.0 - 37665.0 )*0.0011232 )/SPD ){
-         result = -( 1.9458580 + ( in - 37665.0 )*0.0011232 )/1.0011232;
-
-/* 1962 January 1 */
-      } else if( in >= 37665.0 + ( 1.8458580
-                                   + ( 37665.0 - 37665.0 )*0.0011232 )/SPD ){
-         result = -( 1.8458580 + ( in - 37665.0 )*0.0011232 )/1.0011232;
-
-/* 1961 August 1 */
-      } else if( in >= 37512.0 + ( 1.3728180
-                                   + ( 37512.0 - 37300.0 )*0.001296 )/SPD ){
-         result = -( 1.3728180 + ( in - 37300.0 )*0.001296 )/1.001296;
-
-/* 1961 January 1 */
-      } else if( in >= 37300.0 + ( 1.4228180
-                                   + ( 37300.0 - 37300.0 )*0.001296 )/SPD ){
-         result = -( 1.4228180 + ( in - 37300.0 )*0.001296 )/1.001296;
-
-/* Before that */
-      } else {
-         result = -( 1.4178180 + ( in - 37300.0 )*0.001296 )/1.001296;
-      }
-   }
+   UNLOCK_MUTEX1;
 
-/* Return the result */
    return result;
 }
 
@@ -1926,6 +2004,50 @@ void astInitTimeMapVtab_(  AstTimeMapVtab *vtab, const char *name, int *status )
    }
 }
 
+static void LeapTai( LeapEntry *entry, int nentry, int *status ){
+/*
+*  Name:
+*     LeapTai
+
+*  Purpose:
+*     Find the TAI value at the start of each interval in a leap second
+*     table.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "timemap.h"
+*     void LeapTai( LeapEntry *entry, int nentry, int *status )
+
+*  Class Membership:
+*     TimeMap member function
+
+*  Description:
+*     This function stores the TAI value at the start of each supplied
+*     leap second interval, using the UTC value and the expression for
+*     TAI-UTC stored in the interval.
+
+*  Parameters:
+*     entry
+*        The array of intervals.
+*     nentry
+*        The number of intervals.
+*     status
+*        Pointer to the inherited status variable.
+*/
+
+/* Local Variables: */
+   int i;                        /* Interval index */
+
+/* Loop round each interval. */
+   for( i = 0; i < nentry; i++ ) {
+      entry[ i ].tai = entry[ i ].mjd + ( entry[ i ].dat +
+                       ( entry[ i ].mjd - entry[ i ].mjdref )*
+                       entry[ i ].rate )/SPD;
+   }
+}
+
 static int MapMerge( AstMapping *this, int where, int series, int *nmap,
                      AstMapping ***map_list, int **invert_list, int *status ) {
 /*
@@ -2454,6 +2576,178 @@ static int MapMerge( AstMapping *this, int where, int series, int *nmap,
    return result;
 }
 
+static LeapTable *ReadLeapFile( const char *file, int *status ){
+/*
+*  Name:
+*     ReadLeapFile
+
+*  Purpose:
+*     Create a leap second table from a text file.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "timemap.h"
+*     LeapTable *ReadLeapFile( const char *file, int *status )
+
+*  Class Membership:
+*     TimeMap member function
+
+*  Description:
+*     This function reads a list of leap second intervals from a text
+*     file, and returns a new leap second table holding them. Any
+*     intervals in the built-in table that start before the first
+*     interval in the file are retained.
+*
+*     Each line of the file may have the format used by the USNO
+*     "tai-utc.dat" file:
+*
+*     " 1961 JAN  1 =JD 2437300.5  TAI-UTC=   1.4228180 S + (MJD - 37300.) X 0.001296       S"
+*
+*     or the format used by the IERS "Leap_Second.dat" file (MJD, day,
+*     month, year, TAI-UTC):
+*
+*     "    41317.0    1  1 1972       10"
+*
+*     Blank lines and lines starting with "#" are ignored. The intervals
+*     must be in order of increasing start time.
+
+*  Parameters:
+*     file
+*        The path to the file.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     A pointer to the new table, with a reference count of one, or NULL
+*     if an error occurs.
+*/
+
+/* Local Variables: */
+   FILE *fd;                     /* File descriptor */
+   LeapEntry *entry;             /* Array of intervals */
+   LeapTable *result;            /* Returned table */
+   char *c;                      /* Pointer to field within line */
+   char line[ 200 ];             /* Buffer for a line of the file */
+   double dat;                   /* TAI-UTC value */
+   double jd;                    /* Julian date at start of interval */
+   double mjd;                   /* MJD at start of interval */
+   double mjdref;                /* Reference MJD for TAI-UTC drift */
+   double rate;                  /* Rate of TAI-UTC drift */
+   int day;                      /* Day of month */
+   int month;                    /* Month of year */
+   int nbuiltin;                 /* No. of built-in intervals retained */
+   int nentry;                   /* No. of intervals */
+   int nline;                    /* No. of lines read */
+   int year;                     /* Year */
+
+/* Initialise */
+   result = NULL;
+
+/* Check the global error status. */
+   if ( !astOK ) return result;
+
+/* Open the file. */
+   fd = fopen( file, "r" );
+   if( !fd ) {
+      astError( AST__RDERR, "Cannot open the leap second file \"%s\" "
+                "specified by the LeapFile tuning parameter.", status, file );
+      return result;
+   }
+
+/* Read each line of the file, storing the intervals in a new array. */
+   entry = NULL;
+   nentry = 0;
+   nline = 0;
+   while( astOK && fgets( line, sizeof( line ), fd ) ) {
+      nline++;
+
+/* Remove trailing white space (including the newline), and skip comments
+   and blank lines. */
+      line[ astChrLen( line ) ] = 0;
+      if( line[ 0 ] == '#' || line[ 0 ] == 0 ) continue;
+
+/* First try the USNO format. */
+      mjdref = 0.0;
+      rate = 0.0;
+      if( ( c = strstr( line, "=JD" ) ) && sscanf( c + 3, "%lf", &jd ) == 1 &&
+          ( c = strstr( line, "TAI-UTC=" ) ) &&
+          sscanf( c + 8, "%lf", &dat ) == 1 ) {
+         mjd = jd - 2400000.5;
+         if( ( c = strstr( line, "MJD -" ) ) ) {
+            if( sscanf( c + 5, "%lf", &mjdref ) != 1 ) mjdref = 0.0;
+         }
+         if( ( c = strstr( line, ") X" ) ) ) {
+            if( sscanf( c + 3, "%lf", &rate ) != 1 ) rate = 0.0;
+         }
+
+/* Otherwise try the IERS format. */
+      } else if( sscanf( line, "%lf %d %d %d %lf", &mjd, &day, &month,
+                         &year, &dat ) != 5 ) {
+         astError( AST__RDERR, "Cannot interpret line %d of the leap "
+                   "second file \"%s\": %s", status, nline, file, line );
+         break;
+      }
+
+/* Check the intervals are in order. */
+      if( nentry > 0 && mjd <= entry[ nentry - 1 ].mjd ) {
+         astError( AST__RDERR, "The leap seconds in file \"%s\" are not "
+                   "in chronological order (line %d).", status, file, nline );
+         break;
+      }
+
+/* Store the interval. */
+      entry = astGrow( entry, nentry + 1, sizeof( LeapEntry ) );
+      if( astOK ) {
+         entry[ nentry ].mjd = mjd;
+         entry[ nentry ].dat = dat;
+         entry[ nentry ].mjdref = mjdref;
+         entry[ nentry ].rate = rate;
+         nentry++;
+      }
+   }
+   fclose( fd );
+
+/* Report an error if the file contained no intervals. */
+   if( astOK && nentry == 0 ) {
+      astError( AST__RDERR, "No leap seconds found in file \"%s\".",
+                status, file );
+   }
+
+/* Find the number of built-in intervals that start before the first
+   interval in the file. */
+   if( astOK ) {
+      nbuiltin = 0;
+      while( nbuiltin < leap_default.nentry &&
+             leap_builtin[ nbuiltin ].mjd < entry[ 0 ].mjd ) nbuiltin++;
+
+/* Create the new table, holding these built-in intervals followed by the
+   intervals read from the file. */
+      result = astMalloc( sizeof( LeapTable ) );
+      entry = astGrow( entry, nentry + nbuiltin, sizeof( LeapEntry ) );
+      if( astOK ) {
+         memmove( entry + nbuiltin, entry, nentry*sizeof( LeapEntry ) );
+         memcpy( entry, leap_builtin, nbuiltin*sizeof( LeapEntry ) );
+         nentry += nbuiltin;
+         LeapTai( entry, nentry, status );
+
+         result->entry = entry;
+         result->nentry = nentry;
+         result->nref = 1;
+         entry = NULL;
+      } else {
+         result = astFree( result );
+      }
+   }
+
+/* Free the array of intervals if it has not been stored in the table. */
+   entry = astFree( entry );
+
+/* Return the table. */
+   return result;
+}
+
 static double Rate( AstMapping *this, double *at, int ax1, int ax2, int *status ){
 /*
 *  Name:
@@ -2565,7 +2859,8 @@ static double Rate( AstMapping *this, double *at, int ax1, int ax2, int *status
    return result;
 }
 
-static double Rcc( double tdb, double ut1, double wl, double u, double v, int *status ){
+static double Rcc( double tdb, double ut1, double wl, double u, double v,
+                   double geo, int *status ){
 /*
 *  Name:
 *     Rcc
@@ -2578,7 +2873,8 @@ static double Rcc( double tdb, double ut1, double wl, double u, double v, int *s
 
 *  Synopsis:
 *     #include "timemap.h"
-*     double Rcc( double tdb, double ut1, double wl, double u, double v, int *status )
+*     double Rcc( double tdb, double ut1, double wl, double u, double v,
+*                 double geo, int *status )
 
 *  Class Membership:
 *     TimeMap member function
@@ -2602,6 +2898,13 @@ static double Rcc( double tdb, double ut1, double wl, double u, double v, int *s
 *        Observer distance from Earth spin axis (km)
 *     v
 *        Observer distance north of Earth equatorial plane (km)
+*     geo
+*        The geocentric part of TDB-TT (in seconds), or AST__BAD. If
+*        AST__BAD is supplied, the geocentric part is found by evaluating
+*        the Fairhead & Bretagnon series. Otherwise, the supplied value
+*        is used (for instance, a value found by TdbInterp), and only the
+*        topocentric terms are evaluated. Supplying zero for "u" and "v"
+*        and AST__BAD for "geo" returns just the geocentric part.
 *     status
 *        Pointer to the inherited status variable.
 
@@ -3542,6 +3845,9 @@ static double Rcc( double tdb, double ut1, double wl, double u, double v, int *s
           - 1.3184E-10*v*cos( elsun )
           + 3.17679E-10*u*sin( tsol );
 
+/* If the geocentric part was supplied, just add on the topocentric
+   terms. */
+   if( geo != AST__BAD ) return wt + geo;
 
 
 /* --------------- Fairhead model --------------------------------------- */
@@ -3595,6 +3901,189 @@ static double Rcc( double tdb, double ut1, double wl, double u, double v, int *s
 
 }
 
+static double TdbInterp( double t, double tnode, int nnode,
+                         const double *node, int *status ){
+/*
+*  Name:
+*     TdbInterp
+
+*  Purpose:
+*     Interpolate the geocentric part of TDB-TT.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "timemap.h"
+*     double TdbInterp( double t, double tnode, int nnode,
+*                       const double *node, int *status )
+
+*  Class Membership:
+*     TimeMap member function
+
+*  Description:
+*     This function returns the geocentric part of TDB-TT at a given
+*     time, using cubic (four point Lagrange) interpolation between the
+*     node values created by TdbNodes.
+
+*  Parameters:
+*     t
+*        The TT or TDB value, as an absolute MJD. It should be within the
+*        range of times used to create the nodes.
+*     tnode
+*        The time at the first node, as an absolute MJD.
+*     nnode
+*        The number of nodes (at least four).
+*     node
+*        The geocentric part of TDB-TT at each node, in seconds.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     The geocentric part of TDB-TT, in seconds.
+*/
+
+/* Local Variables: */
+   const double *f;              /* Pointer to first of four nodes */
+   double s;                     /* Offset from second of four nodes */
+   double x;                     /* Offset from first node */
+   int k;                        /* Index of second of four nodes */
+
+/* Find the node that precedes the supplied time, keeping it away from
+   the ends of the grid so that there is a node before it and two nodes
+   after it. */
+   x = ( t - tnode )/TDB_NODE_DAYS;
+   k = (int) x;
+   if( k < 1 ) {
+      k = 1;
+   } else if( k > nnode - 3 ) {
+      k = nnode - 3;
+   }
+
+/* Use the Lagrange polynomial through the four surrounding nodes. */
+   s = x - k;
+   f = node + k - 1;
+   return ( ( s + 1.0 )*s*( s - 1.0 )*f[ 3 ]
+            - 3.0*( s + 1.0 )*s*( s - 2.0 )*f[ 2 ]
+            + 3.0*( s + 1.0 )*( s - 1.0 )*( s - 2.0 )*f[ 1 ]
+            - s*( s - 1.0 )*( s - 2.0 )*f[ 0 ] )/6.0;
+}
+
+static double *TdbNodes( int npoint, const double *time, double off,
+                         double *tnode, int *nnode, int *status ){
+/*
+*  Name:
+*     TdbNodes
+
+*  Purpose:
+*     Create a grid of nodes for interpolating the geocentric part of
+*     TDB-TT.
+
+*  Type:
+*     Private function.
+
+*  Synopsis:
+*     #include "timemap.h"
+*     double *TdbNodes( int npoint, const double *time, double off,
+*                       double *tnode, int *nnode, int *status )
+
+*  Class Membership:
+*     TimeMap member function
+
+*  Description:
+*     If the "TDBInterp" tuning parameter is non-zero (see astTune), this
+*     function evaluates the geocentric part of TDB-TT (the Fairhead &
+*     Bretagnon series used by Rcc) at a grid of nodes spaced
+*     TDB_NODE_DAYS apart, covering the range of the supplied times with
+*     one spare node below the range and two above. The values at
+*     intermediate times can then be found using TdbInterp.
+*
+*     The shortest period in the series is about 7.25 days. Summing the
+*     fourth derivative of each term of the series gives an upper limit
+*     on the error of cubic interpolation with nodes every half day of
+*     less than 0.01 nanoseconds for epochs between 1500 and 2500.
+*
+*     No nodes are created if the supplied times are so sparse that
+*     interpolation would not be faster than evaluating the series at
+*     each time (i.e. if there would be more than one node for every
+*     four good times).
+
+*  Parameters:
+*     npoint
+*        The number of times.
+*     time
+*        The times (TT or TDB) as offsets from the MJD given by "off".
+*        Bad values are ignored.
+*     off
+*        The MJD zero point for the supplied times.
+*     tnode
+*        Returned holding the time at the first node, as an absolute MJD.
+*     nnode
+*        Returned holding the number of nodes.
+*     status
+*        Pointer to the inherited status variable.
+
+*  Returned Value:
+*     Pointer to a newly allocated array holding the geocentric part of
+*     TDB-TT (in seconds) at each node. It should be freed using astFree
+*     when no longer needed. NULL is returned if interpolation should not
+*     be used.
+*/
+
+/* Local Variables: */
+   double *result;               /* Returned array */
+   double dn;                    /* Number of nodes needed */
+   double t;                     /* Absolute time */
+   double tmax;                  /* Largest absolute time */
+   double tmin;                  /* Smallest absolute time */
+   int i;                        /* Node index */
+   int ngood;                    /* Number of good times */
+   int point;                    /* Index of time */
+
+/* Initialise. */
+   result = NULL;
+   *tnode = AST__BAD;
+   *nnode = 0;
+
+/* Check the global error status, and whether interpolation is allowed. */
+   if( !astOK || !astTune( "TDBInterp", AST__TUNULL ) ) return result;
+
+/* Find the range of the good absolute times. */
+   ngood = 0;
+   tmin = DBL_MAX;
+   tmax = -DBL_MAX;
+   for( point = 0; point < npoint; point++ ) {
+      if( time[ point ] != AST__BAD ) {
+         t = time[ point ] + off;
+         if( t < tmin ) tmin = t;
+         if( t > tmax ) tmax = t;
+         ngood++;
+      }
+   }
+
+/* Find the number of nodes needed, and return if the times are too
+   sparse. */
+   if( ngood == 0 ) return result;
+   dn = floor( ( tmax - tmin )/TDB_NODE_DAYS ) + 4.0;
+   if( dn > 0.25*ngood ) return result;
+
+/* Allocate the returned array, and evaluate the geocentric part of
+   TDB-TT at each node (zero is supplied for the observer's position so
+   that Rcc omits the topocentric terms). */
+   *nnode = (int) dn;
+   result = astMalloc( *nnode*sizeof( double ) );
+   if( astOK ) {
+      *tnode = tmin - TDB_NODE_DAYS;
+      for( i = 0; i < *nnode; i++ ) {
+         result[ i ] = Rcc( *tnode + i*TDB_NODE_DAYS, 0.0, 0.0, 0.0, 0.0,
+                            AST__BAD, status );
+      }
+   }
+
+/* Return the nodes. */
+   return result;
+}
+
 static void TimeAdd( AstTimeMap *this, const char *cvt, int narg,
                      const double args[], int *status ) {
 /*
@@ -3840,19 +4329,24 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 /* Local Variables: */
    AstPointSet *result;          /* Pointer to output PointSet */
    AstTimeMap *map;              /* Pointer to TimeMap to be applied */
+   LeapTable *leaps;             /* Leap second table */
    double **ptr_in;              /* Pointer to input coordinate data */
    double **ptr_out;             /* Pointer to output coordinate data */
    double *args;                 /* Pointer to argument list for conversion */
+   double *nodes;                /* Geocentric TDB-TT at interpolation nodes */
    double *time;                 /* Pointer to output time axis value array */
    double gmstx;                 /* GMST offset (in days) */
    double tai;                   /* Absolute TAI value (in days) */
    double tdb;                   /* Absolute TDB value (in days) */
+   double tnode;                 /* Absolute time at first node (in days) */
    double tt;                    /* Absolute TT value (in days) */
    double utc;                   /* Absolute UTC value (in days) */
    int ct;                       /* Conversion type */
    int cvt;                      /* Loop counter for conversions */
    int end;                      /* Termination index for conversion loop */
+   int ileap;                    /* Leap second interval used for last point */
    int inc;                      /* Increment for conversion loop */
+   int nnode;                    /* Number of interpolation nodes */
    int npoint;                   /* Number of points */
    int point;                    /* Loop counter for points */
    int start;                    /* Starting index for conversion loop */
@@ -3895,6 +4389,12 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
          (void) memcpy( time, ptr_in[ 0 ], sizeof( double ) * (size_t) npoint );
       }
 
+/* The leap second table is obtained when it is first needed. Each
+   search of the table starts by checking the interval used for the
+   previous point. */
+      leaps = NULL;
+      ileap = -1;
+
 /* We will loop to apply each time coordinate conversion in turn to the
    (time) array. However, if the inverse transformation was requested,
    we must loop through these transformations in reverse order, so set up
@@ -4041,11 +4541,13 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 /* TAI to UTC. */
 /* ----------- */
             case AST__TAITOUTC:
+               if( !leaps ) leaps = GetLeapTable( status );
                if ( forward ) {
                   for ( point = 0; point < npoint; point++ ) {
                      if ( time[ point ] != AST__BAD ) {
                         time[ point ] += ( (args[ 1 ] == AST__BAD)
-                            ? astDat( time[ point ] + args[ 0 ], 0 )
+                            ? Dat( time[ point ] + args[ 0 ], 0, leaps,
+                                   &ileap, status )
                             : - args[ 1 ] )/SPD;
                      }
                   }
@@ -4053,7 +4555,8 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
                   for ( point = 0; point < npoint; point++ ) {
                      if ( time[ point ] != AST__BAD ) {
                         time[ point ] += ( (args[ 1 ] == AST__BAD)
-                            ? astDat( time[ point ] + args[ 0 ], 1 )
+                            ? Dat( time[ point ] + args[ 0 ], 1, leaps,
+                                   &ileap, status )
                             : args[ 1 ] )/SPD;
                      }
                   }
@@ -4063,11 +4566,13 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 /* UTC to TAI. */
 /* ----------- */
             case AST__UTCTOTAI:
+               if( !leaps ) leaps = GetLeapTable( status );
                if ( forward ) {
                   for ( point = 0; point < npoint; point++ ) {
                      if ( time[ point ] != AST__BAD ) {
                         time[ point ] += ( (args[ 1 ] == AST__BAD)
-                            ? astDat( time[ point ] + args[ 0 ], 1 )
+                            ? Dat( time[ point ] + args[ 0 ], 1, leaps,
+                                   &ileap, status )
                             : args[ 1 ] )/SPD;
                      }
                   }
@@ -4075,7 +4580,8 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
                   for ( point = 0; point < npoint; point++ ) {
                      if ( time[ point ] != AST__BAD ) {
                         time[ point ] += ( (args[ 1 ] == AST__BAD)
-                            ? astDat( time[ point ] + args[ 0 ], 0 )
+                            ? Dat( time[ point ] + args[ 0 ], 0, leaps,
+                                   &ileap, status )
                             : - args[ 1 ] )/SPD;
                      }
                   }
@@ -4124,17 +4630,26 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
    to UT1, and that TT is a good approximation to TDB. In fact, TAI is
    probably a good enough approximation to UTC for the vast majority of
    cases, but for completeness we handle the difference between TAI and
-   UTC (i.e. leap seconds) here. */
+   UTC (i.e. leap seconds) here. If possible, the geocentric part of
+   TDB-TT is found by interpolation between a grid of nodes (see
+   TdbNodes). */
             case AST__TTTOTDB:
+               if( !leaps ) leaps = GetLeapTable( status );
+               nodes = TdbNodes( npoint, time, args[ 0 ], &tnode, &nnode,
+                                 status );
                if ( forward ) {
                   for ( point = 0; point < npoint; point++ ) {
                      if ( time[ point ] != AST__BAD ) {
                         tt = time[ point ] + args[ 0 ];
                         tai = tt - (TTOFF/SPD);
-                        utc = tai + ( (args[ 4 ] == AST__BAD) ? astDat( tai, 0 )
-                                                              : -args[ 4 ] )/SPD;
+                        utc = tai + ( (args[ 4 ] == AST__BAD)
+                                      ? Dat( tai, 0, leaps, &ileap, status )
+                                      : -args[ 4 ] )/SPD;
                         time[ point ] += Rcc( tt, utc, args[ 1 ], args[ 5 ],
-                                              args[ 6 ], status )/SPD;
+                                              args[ 6 ], nodes ?
+                                              TdbInterp( tt, tnode, nnode,
+                                                         nodes, status ) :
+                                              AST__BAD, status )/SPD;
                      }
                   }
                } else {
@@ -4142,13 +4657,18 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
                      if ( time[ point ] != AST__BAD ) {
                         tdb = time[ point ] + args[ 0 ];
                         tai = tdb - (TTOFF/SPD);
-                        utc = tai + ( (args[ 4 ] == AST__BAD) ? astDat( tai, 0 )
-                                                              : -args[ 4 ] )/SPD;
+                        utc = tai + ( (args[ 4 ] == AST__BAD)
+                                      ? Dat( tai, 0, leaps, &ileap, status )
+                                      : -args[ 4 ] )/SPD;
                         time[ point ] -= Rcc( tdb, utc, args[ 1 ], args[ 5 ],
-                                              args[ 6 ], status )/SPD;
+                                              args[ 6 ], nodes ?
+                                              TdbInterp( tdb, tnode, nnode,
+                                                         nodes, status ) :
+                                              AST__BAD, status )/SPD;
                      }
                   }
                }
+               nodes = astFree( nodes );
                break;
 
 /* TDB to TT. */
@@ -4157,17 +4677,25 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
    to UT1, and that TT is a good approximation to TDB. In fact, TAI is
    probably a good enough approximation to UTC for the vast majority of
    cases, but for completeness we handle the difference between TAI and
-   UTC (i.e. leap seconds) here. */
+   UTC (i.e. leap seconds) here. The geocentric part of TDB-TT is
+   interpolated if possible, as above. */
             case AST__TDBTOTT:
+               if( !leaps ) leaps = GetLeapTable( status );
+               nodes = TdbNodes( npoint, time, args[ 0 ], &tnode, &nnode,
+                                 status );
                if ( forward ) {
                   for ( point = 0; point < npoint; point++ ) {
                      if ( time[ point ] != AST__BAD ) {
                         tdb = time[ point ] + args[ 0 ];
                         tai = tdb - (TTOFF/SPD);
-                        utc = tai + ( (args[ 4 ] == AST__BAD) ? astDat( tai, 0 )
-                                                              : -args[ 4 ] )/SPD;
+                        utc = tai + ( (args[ 4 ] == AST__BAD)
+                                      ? Dat( tai, 0, leaps, &ileap, status )
+                                      : -args[ 4 ] )/SPD;
                         time[ point ] -= Rcc( tdb, utc, args[ 1 ], args[ 5 ],
-                                              args[ 6 ], status )/SPD;
+                                              args[ 6 ], nodes ?
+                                              TdbInterp( tdb, tnode, nnode,
+                                                         nodes, status ) :
+                                              AST__BAD, status )/SPD;
                      }
                   }
                } else {
@@ -4175,13 +4703,18 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
                      if ( time[ point ] != AST__BAD ) {
                         tt = time[ point ] + args[ 0 ];
                         tai = tt - (TTOFF/SPD);
-                        utc = tai + ( (args[ 4 ] == AST__BAD) ? astDat( tai, 0 )
-                                                              : -args[ 4 ] )/SPD;
+                        utc = tai + ( (args[ 4 ] == AST__BAD)
+                                      ? Dat( tai, 0, leaps, &ileap, status )
+                                      : -args[ 4 ] )/SPD;
                         time[ point ] += Rcc( tt, utc, args[ 1 ], args[ 5 ],
-                                              args[ 6 ], status )/SPD;
+                                              args[ 6 ], nodes ?
+                                              TdbInterp( tt, tnode, nnode,
+                                                         nodes, status ) :
+                                              AST__BAD, status )/SPD;
                      }
                   }
                }
+               nodes = astFree( nodes );
                break;
 
 /* TT to TCG. */
@@ -4469,6 +5002,9 @@ static AstPointSet *Transform( AstMapping *this, AstPointSet *in,
 
          }
       }
+
+/* Release the leap second table. */
+      FreeLeapTable( leaps, status );
    }
 
 /* If an error has occurred and a new PointSet may have been created, then
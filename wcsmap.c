@@ -219,6 +219,11 @@ f     The WcsMap class does not define any new routines beyond those
 *        Added XPH projection.
 *     30-DEC-2017 (DSB):
 *        Improve merging of WcsMaps and PermMaps.
+*     17-OCT-2026 (DSB):
+*        In function Map, use the array versions of the WCSLIB projection
+*        functions (where available) to transform blocks of points in a
+*        single call, and avoid calling palDrange for angles that are
+*        already within the range [-pi,pi].
 *class--
 */
 
@@ -238,6 +243,15 @@ f     The WcsMap class does not define any new routines beyond those
    exceptions, so bad values are dealt with explicitly. */
 #define EQUAL(aa,bb) (((aa)==AST__BAD)?(((bb)==AST__BAD)?1:0):(((bb)==AST__BAD)?0:(fabs((aa)-(bb))<=1.0E5*MAX((fabs(aa)+fabs(bb))*DBL_EPSILON,DBL_MIN))))
 
+/* Macro which normalises an angle in radians into the range [-pi,pi],
+   giving the same result as palDrange but without the cost of a function
+   call for angles that are already within the range. */
+#define DRANGE(aa) ((fabs(aa)<=AST__DPI)?(aa):palDrange(aa))
+
+/* The number of points transformed by each call to an array version of a
+   WCSLIB projection function within function Map. */
+#define MAP_BLOCK 256
+
 /*
 *
 *  Name:
@@ -654,6 +668,12 @@ typedef struct PrjData {
                                 /* Pointer to forward projection function */
    int (* WcsRev)(double, double, struct AstPrjPrm *, double *, double *);
                                 /* Pointer to reverse projection function */
+   int (* WcsFwdN)(int, const double [], const double [], struct AstPrjPrm *,
+                   double [], double [], int []);
+                                /* Pointer to array forward function (or NULL) */
+   int (* WcsRevN)(int, const double [], const double [], struct AstPrjPrm *,
+                   double [], double [], int []);
+                                /* Pointer to array reverse function (or NULL) */
    double theta0;               /* Default native latitude of fiducial point */
 } PrjData;
 
@@ -677,38 +697,38 @@ static int *(* parent_mapsplit)( AstMapping *, int, const int *, AstMapping **,
    projections. The last entry in the list should be for the AST__WCSBAD
    projection. This marks the end of the list. */
 static PrjData PrjInfo[] = {
-   { AST__AZP,  2, 4, "zenithal perspective", "-AZP", astAZPfwd, astAZPrev, AST__DPIBY2 },
-   { AST__SZP,  3, 4, "slant zenithal perspective", "-SZP", astSZPfwd, astSZPrev, AST__DPIBY2 },
-   { AST__TAN,  0, 4, "gnomonic", "-TAN",  astTANfwd, astTANrev, AST__DPIBY2 },
-   { AST__STG,  0, 4, "stereographic", "-STG",  astSTGfwd, astSTGrev, AST__DPIBY2 },
-   { AST__SIN,  2, 4, "orthographic", "-SIN",  astSINfwd, astSINrev, AST__DPIBY2 },
-   { AST__ARC,  0, 4, "zenithal equidistant", "-ARC",  astARCfwd, astARCrev, AST__DPIBY2 },
-   { AST__ZPN,  WCSLIB_MXPAR, 4, "zenithal polynomial", "-ZPN",  astZPNfwd, astZPNrev, AST__DPIBY2 },
-   { AST__ZEA,  0, 4, "zenithal equal area", "-ZEA",  astZEAfwd, astZEArev, AST__DPIBY2 },
-   { AST__AIR,  1, 4, "Airy", "-AIR",  astAIRfwd, astAIRrev, AST__DPIBY2 },
-   { AST__CYP,  2, 4, "cylindrical perspective", "-CYP",  astCYPfwd, astCYPrev, 0.0 },
-   { AST__CEA,  1, 4, "cylindrical equal area", "-CEA",  astCEAfwd, astCEArev, 0.0 },
-   { AST__CAR,  0, 4, "Cartesian", "-CAR",  astCARfwd, astCARrev, 0.0 },
-   { AST__MER,  0, 4, "Mercator", "-MER",  astMERfwd, astMERrev, 0.0 },
-   { AST__SFL,  0, 4, "Sanson-Flamsteed", "-SFL",  astSFLfwd, astSFLrev, 0.0 },
-   { AST__PAR,  0, 4, "parabolic", "-PAR",  astPARfwd, astPARrev, 0.0 },
-   { AST__MOL,  0, 4, "Mollweide", "-MOL",  astMOLfwd, astMOLrev, 0.0 },
-   { AST__AIT,  0, 4, "Hammer-Aitoff", "-AIT",  astAITfwd, astAITrev, 0.0 },
-   { AST__COP,  2, 4, "conical perspective", "-COP",  astCOPfwd, astCOPrev, AST__BAD },
-   { AST__COE,  2, 4, "conical equal area", "-COE",  astCOEfwd, astCOErev, AST__BAD },
-   { AST__COD,  2, 4, "conical equidistant", "-COD",  astCODfwd, astCODrev, AST__BAD },
-   { AST__COO,  2, 4, "conical orthomorphic", "-COO",  astCOOfwd, astCOOrev, AST__BAD },
-   { AST__BON,  1, 4, "Bonne's equal area", "-BON",  astBONfwd, astBONrev, 0.0 },
-   { AST__PCO,  0, 4, "polyconic", "-PCO",  astPCOfwd, astPCOrev, 0.0 },
-   { AST__TSC,  0, 4, "tangential spherical cube", "-TSC",  astTSCfwd, astTSCrev, 0.0 },
-   { AST__CSC,  0, 4, "cobe quadrilateralized spherical cube", "-CSC", astCSCfwd, astCSCrev, 0.0 },
-   { AST__QSC,  0, 4, "quadrilateralized spherical cube", "-QSC",  astQSCfwd, astQSCrev, 0.0 },
-   { AST__NCP,  2, 4, "AIPS north celestial pole", "-NCP",  NULL,   NULL, 0.0 },
-   { AST__GLS,  0, 4, "sinusoidal", "-GLS",  astSFLfwd, astSFLrev, 0.0 },
-   { AST__HPX,  2, 4, "HEALPix", "-HPX",  astHPXfwd, astHPXrev, 0.0 },
-   { AST__XPH,  0, 4, "polar HEALPix", "-XPH",  astXPHfwd, astXPHrev, AST__DPIBY2 },
-   { AST__TPN,  WCSLIB_MXPAR, WCSLIB_MXPAR, "gnomonic polynomial", "-TPN",  astTPNfwd, astTPNrev, AST__DPIBY2 },
-   { AST__WCSBAD, 0, 4, "<null>",   "    ",  NULL,   NULL, 0.0 } };
+   { AST__AZP,  2, 4, "zenithal perspective", "-AZP", astAZPfwd, astAZPrev, NULL, NULL, AST__DPIBY2 },
+   { AST__SZP,  3, 4, "slant zenithal perspective", "-SZP", astSZPfwd, astSZPrev, NULL, NULL, AST__DPIBY2 },
+   { AST__TAN,  0, 4, "gnomonic", "-TAN",  astTANfwd, astTANrev, astTANfwdN, astTANrevN, AST__DPIBY2 },
+   { AST__STG,  0, 4, "stereographic", "-STG",  astSTGfwd, astSTGrev, NULL, NULL, AST__DPIBY2 },
+   { AST__SIN,  2, 4, "orthographic", "-SIN",  astSINfwd, astSINrev, astSINfwdN, astSINrevN, AST__DPIBY2 },
+   { AST__ARC,  0, 4, "zenithal equidistant", "-ARC",  astARCfwd, astARCrev, astARCfwdN, astARCrevN, AST__DPIBY2 },
+   { AST__ZPN,  WCSLIB_MXPAR, 4, "zenithal polynomial", "-ZPN",  astZPNfwd, astZPNrev, NULL, NULL, AST__DPIBY2 },
+   { AST__ZEA,  0, 4, "zenithal equal area", "-ZEA",  astZEAfwd, astZEArev, astZEAfwdN, astZEArevN, AST__DPIBY2 },
+   { AST__AIR,  1, 4, "Airy", "-AIR",  astAIRfwd, astAIRrev, NULL, NULL, AST__DPIBY2 },
+   { AST__CYP,  2, 4, "cylindrical perspective", "-CYP",  astCYPfwd, astCYPrev, NULL, NULL, 0.0 },
+   { AST__CEA,  1, 4, "cylindrical equal area", "-CEA",  astCEAfwd, astCEArev, NULL, NULL, 0.0 },
+   { AST__CAR,  0, 4, "Cartesian", "-CAR",  astCARfwd, astCARrev, astCARfwdN, astCARrevN, 0.0 },
+   { AST__MER,  0, 4, "Mercator", "-MER",  astMERfwd, astMERrev, NULL, NULL, 0.0 },
+   { AST__SFL,  0, 4, "Sanson-Flamsteed", "-SFL",  astSFLfwd, astSFLrev, NULL, NULL, 0.0 },
+   { AST__PAR,  0, 4, "parabolic", "-PAR",  astPARfwd, astPARrev, NULL, NULL, 0.0 },
+   { AST__MOL,  0, 4, "Mollweide", "-MOL",  astMOLfwd, astMOLrev, NULL, NULL, 0.0 },
+   { AST__AIT,  0, 4, "Hammer-Aitoff", "-AIT",  astAITfwd, astAITrev, astAITfwdN, astAITrevN, 0.0 },
+   { AST__COP,  2, 4, "conical perspective", "-COP",  astCOPfwd, astCOPrev, NULL, NULL, AST__BAD },
+   { AST__COE,  2, 4, "conical equal area", "-COE",  astCOEfwd, astCOErev, NULL, NULL, AST__BAD },
+   { AST__COD,  2, 4, "conical equidistant", "-COD",  astCODfwd, astCODrev, NULL, NULL, AST__BAD },
+   { AST__COO,  2, 4, "conical orthomorphic", "-COO",  astCOOfwd, astCOOrev, NULL, NULL, AST__BAD },
+   { AST__BON,  1, 4, "Bonne's equal area", "-BON",  astBONfwd, astBONrev, NULL, NULL, 0.0 },
+   { AST__PCO,  0, 4, "polyconic", "-PCO",  astPCOfwd, astPCOrev, NULL, NULL, 0.0 },
+   { AST__TSC,  0, 4, "tangential spherical cube", "-TSC",  astTSCfwd, astTSCrev, NULL, NULL, 0.0 },
+   { AST__CSC,  0, 4, "cobe quadrilateralized spherical cube", "-CSC", astCSCfwd, astCSCrev, NULL, NULL, 0.0 },
+   { AST__QSC,  0, 4, "quadrilateralized spherical cube", "-QSC",  astQSCfwd, astQSCrev, NULL, NULL, 0.0 },
+   { AST__NCP,  2, 4, "AIPS north celestial pole", "-NCP",  NULL,   NULL, NULL, NULL, 0.0 },
+   { AST__GLS,  0, 4, "sinusoidal", "-GLS",  astSFLfwd, astSFLrev, NULL, NULL, 0.0 },
+   { AST__HPX,  2, 4, "HEALPix", "-HPX",  astHPXfwd, astHPXrev, astHPXfwdN, astHPXrevN, 0.0 },
+   { AST__XPH,  0, 4, "polar HEALPix", "-XPH",  astXPHfwd, astXPHrev, NULL, NULL, AST__DPIBY2 },
+   { AST__TPN,  WCSLIB_MXPAR, WCSLIB_MXPAR, "gnomonic polynomial", "-TPN",  astTPNfwd, astTPNrev, NULL, NULL, AST__DPIBY2 },
+   { AST__WCSBAD, 0, 4, "<null>",   "    ",  NULL,   NULL, NULL, NULL, 0.0 } };
 
 /* Define macros for accessing each item of thread specific global data. */
 #ifdef THREAD_SAFE
@@ -2734,6 +2754,8 @@ static int Map( AstWcsMap *this, int forward, int npoint, double *in0,
 
 /* Local Variables: */
    const PrjData *prjdata;       /* Information about the projection */
+   double a0[ MAP_BLOCK ];       /* Block of axis 0 values in degrees */
+   double a1[ MAP_BLOCK ];       /* Block of axis 1 values in degrees */
    double factor;                /* Factor that scales input into radians. */
    double latitude;              /* Latitude value in degrees */
    double longhi;                /* Upper longitude limit in degrees */
@@ -2741,10 +2763,15 @@ static int Map( AstWcsMap *this, int forward, int npoint, double *in0,
    double longlo;                /* Lower longitude limit in degrees */
    double x;                     /* X Cartesian coordinate in degrees */
    double y;                     /* Y Cartesian coordinate in degrees */
+   int (* wcsfunn)(int, const double [], const double [], struct AstPrjPrm *,
+                   double [], double [], int []); /* Array WCSLIB function */
    int cyclic;                   /* Is sky->xy transformation cyclic? */
    int i;                        /* Loop count */
+   int nblock;                   /* Number of points in current block */
    int plen;                     /* Length of proj par array */
+   int point0;                   /* Index of first point in current block */
    int point;                    /* Loop counter for points */
+   int stat[ MAP_BLOCK ];        /* WCSLIB status for each point in block */
    int type;                     /* Projection type */
    int wcs_status;               /* Status from WCSLIB functions */
    struct AstPrjPrm *params;     /* Pointer to structure holding WCSLIB info */
@@ -2786,6 +2813,75 @@ static int Map( AstWcsMap *this, int forward, int npoint, double *in0,
    the factor that scales the WcsMap input into radians. */
    factor = astGetTPNTan( this ) ? 1.0 : AST__DD2R;
 
+/* If an array version of the WCSLIB projection function is available,
+   use it to transform the points in blocks of MAP_BLOCK points. The
+   input values for each block are first converted to degrees (in the
+   same way as is done below for individual points) and stored in local
+   work arrays, with the WCSLIB status for each bad input point set
+   non-zero so that it is ignored. The results are then converted back
+   into radians and stored in the output arrays. */
+   wcsfunn = forward ? prjdata->WcsFwdN : prjdata->WcsRevN;
+   if( wcsfunn ) {
+      for( point0 = 0; point0 < npoint; point0 += MAP_BLOCK ) {
+         nblock = npoint - point0;
+         if( nblock > MAP_BLOCK ) nblock = MAP_BLOCK;
+
+         for( i = 0; i < nblock; i++ ) {
+            point = point0 + i;
+            if ( in0[ point ] == AST__BAD ||
+                 in1[ point ] == AST__BAD ){
+               a0[ i ] = 0.0;
+               a1[ i ] = 0.0;
+               stat[ i ] = 1;
+
+            } else if( forward ) {
+               latitude = AST__DR2D*DRANGE( factor*in1[ point ] );
+               if ( latitude > 90.0 ){
+                  a1[ i ] = 180.0 - latitude;
+                  a0[ i ] = AST__DR2D*palDrange( AST__DPI + factor*in0[ point ] );
+
+               } else if ( latitude < -90.0 ){
+                  a1[ i ] = -180.0 - latitude;
+                  a0[ i ] = AST__DR2D*palDrange( AST__DPI + factor*in0[ point ] );
+
+               } else {
+                  a1[ i ] = latitude;
+                  a0[ i ] = AST__DR2D*DRANGE( factor*in0[ point ] );
+               }
+               stat[ i ] = 0;
+
+            } else {
+               a0[ i ] = (AST__DR2D*factor)*in0[ point ];
+               a1[ i ] = (AST__DR2D*factor)*in1[ point ];
+               stat[ i ] = 0;
+            }
+         }
+
+/* Transform the block in place. Abort if the projection parameters were
+   unusable. */
+         wcs_status = wcsfunn( nblock, a0, a1, params, a0, a1, stat );
+         if( wcs_status == 1 ) return 2;
+
+/* Store the results, using AST__BAD for any point that could not be
+   transformed, or (for the reverse transformation) any point outside
+   the primary longitude or latitude range (see below). */
+         for( i = 0; i < nblock; i++ ) {
+            point = point0 + i;
+            if( stat[ i ] == 0 && ( forward || ( ( cyclic ||
+                                    ( a0[ i ] < longhi && a0[ i ] >= longlo ) ) &&
+                                    fabs( a1[ i ] ) <= 90.0 ) ) ) {
+               out0[ point ] = (AST__DD2R/factor)*a0[ i ];
+               out1[ point ] = (AST__DD2R/factor)*a1[ i ];
+            } else {
+               out0[ point ] = AST__BAD;
+               out1[ point ] = AST__BAD;
+            }
+         }
+      }
+
+      return 0;
+   }
+
 /* Loop to apply the projection to each point in turn, checking for
    (and propagating) bad values in the process. */
    for ( point = 0; point < npoint; point++ ) {
@@ -2804,7 +2900,7 @@ static int Map( AstWcsMap *this, int forward, int npoint, double *in0,
    and the latitude is in the range [-90,90] (as required by the WCSLIB
    library). Any point with a latitude outside the range [-90,90] is
    converted to the equivalent point on the complementary meridian. */
-            latitude = AST__DR2D*palDrange(  factor*in1[ point ] );
+            latitude = AST__DR2D*DRANGE(  factor*in1[ point ] );
             if ( latitude > 90.0 ){
                latitude = 180.0 - latitude;
                longitude = AST__DR2D*palDrange( AST__DPI + factor*in0[ point ] );
@@ -2814,7 +2910,7 @@ static int Map( AstWcsMap *this, int forward, int npoint, double *in0,
                longitude = AST__DR2D*palDrange( AST__DPI + factor*in0[ point ] );
 
             } else {
-               longitude = AST__DR2D*palDrange( factor*in0[ point ] );
+               longitude = AST__DR2D*DRANGE( factor*in0[ point ] );
             }
 
 /* Call the relevant WCSLIB forward projection function. */
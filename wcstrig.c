@@ -33,6 +33,14 @@
 *     -  Support for non-ANSI C "const" class removed
 *     -  Changed names of projection functions and degrees trig functions
 *        to avoid clashes with wcslib.
+*     -  astCosd, astSind and astTand: Avoid the fmod call for angles that
+*        cannot be one of the special values (e.g. an angle that is not an
+*        exact multiple of 90 degrees cannot have a cosine of exactly 0 or
+*        1). The returned values are unchanged.
+*     -  astSind: Return exact values for negative multiples of 90 degrees
+*        (fmod returns a negative remainder for these).
+*     -  Added astSinCosd, which returns both the sine and cosine of an
+*        angle.
 *=============================================================================
 *
 *   The functions defined herein are trigonometric or inverse trigonometric
@@ -52,6 +60,11 @@ const double angle;
 {
    double resid;
 
+   /* Only exact multiples of 90 degrees are special cases. */
+   if (fabs(angle) <= 360.0 && angle != 90.0*(int)(angle/90.0)) {
+      return cos(angle*D2R);
+   }
+
    resid = fabs(fmod(angle,360.0));
    if (resid == 0.0) {
       return 1.0;
@@ -75,14 +88,20 @@ const double angle;
 {
    double resid;
 
+   /* Only exact multiples of 90 degrees are special cases (angle-90 is
+      computed exactly for angles within this range). */
+   if (fabs(angle) <= 360.0 && angle != 90.0*(int)(angle/90.0)) {
+      return sin(angle*D2R);
+   }
+
    resid = fmod(angle-90.0,360.0);
    if (resid == 0.0) {
       return 1.0;
-   } else if (resid == 90.0) {
+   } else if (fabs(resid) == 90.0) {
       return 0.0;
-   } else if (resid == 180.0) {
+   } else if (fabs(resid) == 180.0) {
       return -1.0;
-   } else if (resid == 270.0) {
+   } else if (fabs(resid) == 270.0) {
       return 0.0;
    }
 
@@ -98,6 +117,11 @@ const double angle;
 {
    double resid;
 
+   /* Only exact multiples of 45 degrees are special cases. */
+   if (fabs(angle) <= 360.0 && angle != 45.0*(int)(angle/45.0)) {
+      return tan(angle*D2R);
+   }
+
    resid = fmod(angle,360.0);
    if (resid == 0.0 || fabs(resid) == 180.0) {
       return 0.0;
@@ -112,6 +136,23 @@ const double angle;
 
 /*--------------------------------------------------------------------------*/
 
+void astSinCosd(angle, s, c)
+
+const double angle;
+double *s, *c;
+
+{
+   if (fabs(angle) <= 360.0 && angle != 90.0*(int)(angle/90.0)) {
+      *s = sin(angle*D2R);
+      *c = cos(angle*D2R);
+   } else {
+      *s = astSind(angle);
+      *c = astCosd(angle);
+   }
+}
+
+/*--------------------------------------------------------------------------*/
+
 double astACosd(v)
 
 const double v;
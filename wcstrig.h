@@ -36,6 +36,7 @@
 *     -  Changed the name of the WCSLIB_TRIG macro to WCSLIB_TRIG_INCLUDED
 *     -  Changed names of degrees trig functions to avoid clashes with
 *        wcslib.
+*     -  Added astSinCosd.
 *===========================================================================*/
 
 #ifndef WCSLIB_TRIG_INCLUDED
@@ -48,6 +49,7 @@ extern "C" {
 double astCosd(const double);
 double astSind(const double);
 double astTand(const double);
+void astSinCosd(const double, double *, double *);
 double astACosd(const double);
 double astASind(const double);
 double astATand(const double);